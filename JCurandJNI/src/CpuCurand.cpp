@@ -0,0 +1,2828 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CpuCurand.hpp"
+#include "CpuCurandConvert.hpp"
+#include "CpuCurandGamma.hpp"
+#include "CpuCurandGenerator.hpp"
+#include "CpuCurandMath.hpp"
+#include "CpuCurandTruncatedNormal.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <math.h>
+#include <map>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+//=== Poisson distribution ===================================================
+
+/**
+ * The table for sampling a Poisson distribution by inversion, with
+ * a guide table for the search. For very large lambda, the normal
+ * approximation is used instead.
+ */
+struct CpuPoissonTable
+{
+    double lambda;
+    bool normalApproximation;
+    unsigned int first;
+    std::vector<double> cdf;
+    std::vector<unsigned int> guide;
+
+    unsigned int sample(double u) const
+    {
+        if (normalApproximation)
+        {
+            double x = floor(lambda + sqrt(lambda) * cpuCurandNormalCdfInv(u, false) + 0.5);
+            return x < 0.0 ? 0 : (unsigned int)x;
+        }
+        size_t j = (size_t)(u * guide.size());
+        size_t i = guide[j < guide.size() ? j : guide.size() - 1];
+        while (i + 1 < cdf.size() && cdf[i] < u)
+        {
+            i++;
+        }
+        return first + (unsigned int)i;
+    }
+};
+
+/**
+ * The distribution that is handed out as curandDiscreteDistribution_t
+ */
+struct CpuDiscreteDistribution
+{
+    std::shared_ptr<CpuPoissonTable> table;
+};
+
+namespace
+{
+    /**
+     * Above this lambda, Poisson samples are computed with the normal
+     * approximation, as the tables would become too large
+     */
+    const double POISSON_TABLE_MAX_LAMBDA = 16777216.0;
+
+    std::shared_ptr<CpuPoissonTable> createPoissonTable(double lambda)
+    {
+        std::shared_ptr<CpuPoissonTable> table(new CpuPoissonTable());
+        table->lambda = lambda;
+        table->normalApproximation = lambda > POISSON_TABLE_MAX_LAMBDA;
+        table->first = 0;
+        if (table->normalApproximation)
+        {
+            return table;
+        }
+
+        // Cover 10 standard deviations around the mean, which is far
+        // beyond the resolution of the uniform samples
+        double range = 10.0 * sqrt(lambda) + 10.0;
+        double low = floor(lambda - range);
+        unsigned int first = low < 0.0 ? 0 : (unsigned int)low;
+        unsigned int last = (unsigned int)ceil(lambda + range);
+        unsigned int mode = (unsigned int)floor(lambda);
+        std::vector<double> pmf(last - first + 1);
+        pmf[mode - first] = exp(-lambda + mode * log(lambda) - lgamma(mode + 1.0));
+        for (unsigned int k = mode; k < last; k++)
+        {
+            pmf[k + 1 - first] = pmf[k - first] * lambda / (k + 1);
+        }
+        for (unsigned int k = mode; k > first; k--)
+        {
+            pmf[k - 1 - first] = pmf[k - first] * k / lambda;
+        }
+        double sum = 0.0;
+        table->cdf.resize(pmf.size());
+        for (size_t i = 0; i < pmf.size(); i++)
+        {
+            sum += pmf[i];
+            table->cdf[i] = sum;
+        }
+        for (size_t i = 0; i < pmf.size(); i++)
+        {
+            table->cdf[i] /= sum;
+        }
+        table->cdf.back() = 1.0;
+        table->first = first;
+
+        table->guide.resize(table->cdf.size());
+        size_t i = 0;
+        for (size_t j = 0; j < table->guide.size(); j++)
+        {
+            double u = (double)j / table->guide.size();
+            while (table->cdf[i] < u)
+            {
+                i++;
+            }
+            table->guide[j] = (unsigned int)i;
+        }
+        return table;
+    }
+}
+
+
+//=== Transforms =============================================================
+
+namespace
+{
+    struct BitsTransform
+    {
+        template <typename Word, typename T>
+        void operator()(const Word *words, T *output, size_t n) const
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                output[i] = (T)words[i];
+            }
+        }
+    };
+
+    struct UniformTransform
+    {
+        template <typename Word>
+        void operator()(const Word *words, float *output, size_t n) const
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                output[i] = cpuCurandUniform(words[i]);
+            }
+        }
+    };
+
+    /**
+     * Uniform doubles from one word of a quasirandom generator
+     */
+    struct UniformDoubleTransform
+    {
+        template <typename Word>
+        void operator()(const Word *words, double *output, size_t n) const
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                output[i] = cpuCurandUniformDouble(words[i]);
+            }
+        }
+    };
+
+    /**
+     * Uniform doubles from two words of a pseudorandom generator
+     */
+    struct UniformDoublePseudoTransform
+    {
+        void operator()(const unsigned int *words, double *output, size_t n) const
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                output[i] = cpuCurandUniformDouble(words[2 * i], words[2 * i + 1]);
+            }
+        }
+    };
+
+    /**
+     * Normal (or log-normal) samples from pairs of words of a
+     * pseudorandom generator, with the Box-Muller transform
+     */
+    template <typename T>
+    struct NormalPseudoTransform
+    {
+        T mean;
+        T stddev;
+        bool logNormal;
+
+        void operator()(const unsigned int *words, float *output, size_t n) const
+        {
+            for (size_t i = 0; i + 1 < n; i += 2)
+            {
+                float a, b;
+                cpuCurandBoxMuller(cpuCurandUniform(words[i]), cpuCurandUniform(words[i + 1]), a, b);
+                output[i] = store(a);
+                output[i + 1] = store(b);
+            }
+        }
+
+        void operator()(const unsigned int *words, double *output, size_t n) const
+        {
+            for (size_t i = 0; i + 1 < n; i += 2)
+            {
+                double u = cpuCurandUniformDouble(words[2 * i], words[2 * i + 1]);
+                double v = cpuCurandUniformDouble(words[2 * i + 2], words[2 * i + 3]);
+                double a, b;
+                cpuCurandBoxMuller(u, v, a, b);
+                output[i] = store(a);
+                output[i + 1] = store(b);
+            }
+        }
+
+        T store(T x) const
+        {
+            T y = mean + stddev * x;
+            return logNormal ? exp(y) : y;
+        }
+    };
+
+    /**
+     * Normal (or log-normal) samples from single words of a
+     * quasirandom generator, by inversion
+     */
+    template <typename T>
+    struct NormalQuasiTransform
+    {
+        T mean;
+        T stddev;
+        bool logNormal;
+
+        template <typename Word>
+        void operator()(const Word *words, T *output, size_t n) const
+        {
+            const bool refine = sizeof(T) == sizeof(double);
+            for (size_t i = 0; i < n; i++)
+            {
+                double u = sizeof(T) == sizeof(double) ?
+                    cpuCurandUniformDouble(words[i]) : (double)cpuCurandUniform(words[i]);
+                T y = mean + stddev * (T)cpuCurandNormalCdfInv(u, refine);
+                output[i] = logNormal ? exp(y) : y;
+            }
+        }
+    };
+
+    /**
+     * Antithetic pairs of uniform floats from one word. The partner of
+     * u is 1-u, computed from the complemented word, so that it has the
+     * same resolution and range as u.
+     */
+    struct UniformAntitheticSample
+    {
+        enum { WORDS = 1, VALUES = 1 };
+
+        void operator()(const unsigned int *words, float *x, float *partner) const
+        {
+            x[0] = cpuCurandUniform(words[0]);
+            partner[0] = cpuCurandUniform(~words[0]);
+        }
+    };
+
+    /**
+     * Antithetic pairs of uniform doubles from two words, combined like
+     * in cpuCurandUniformDouble, with the complemented 53 bits for the
+     * partner
+     */
+    struct UniformDoubleAntitheticSample
+    {
+        enum { WORDS = 2, VALUES = 1 };
+
+        void operator()(const unsigned int *words, double *x, double *partner) const
+        {
+            const unsigned long long mask = (1ULL << 53) - 1;
+            unsigned long long z = (unsigned long long)words[0] ^ ((unsigned long long)words[1] << (53 - 32));
+            x[0] = z * CPU_CURAND_2POW53_INV_DOUBLE + (CPU_CURAND_2POW53_INV_DOUBLE / 2.0);
+            partner[0] = (~z & mask) * CPU_CURAND_2POW53_INV_DOUBLE + (CPU_CURAND_2POW53_INV_DOUBLE / 2.0);
+        }
+    };
+
+    /**
+     * The affine map of a fraction in [0, 1) to [a, b). The value is
+     * computed in double precision, with the halved width so that it
+     * does not overflow for ranges like [-DBL_MAX, DBL_MAX], and a
+     * value that is rounded up to b is replaced with the largest value
+     * below b. Shifting the uniform values in (0, 1] instead would
+     * exclude a and include b.
+     */
+    template <typename T>
+    struct UniformRange
+    {
+        double a;
+        double half;
+        T b;
+        T below;
+
+        UniformRange(T a, T b) : a(a), half(0.5 * b - 0.5 * a), b(b), below(nextafter(b, a))
+        {
+        }
+
+        T operator()(double f) const
+        {
+            T r = (T)(a + half * f + half * f);
+            return r < b ? r : below;
+        }
+    };
+
+    /**
+     * Uniform values in [a, b) from one word of a quasirandom generator,
+     * or from one word of a pseudorandom generator for floats
+     */
+    template <typename T>
+    struct UniformRangeTransform
+    {
+        UniformRange<T> range;
+
+        template <typename Word>
+        void operator()(const Word *words, T *output, size_t n) const
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                output[i] = range(cpuCurandFraction(words[i]));
+            }
+        }
+    };
+
+    /**
+     * Uniform doubles in [a, b) from two words of a pseudorandom generator
+     */
+    struct UniformRangeDoublePseudoTransform
+    {
+        UniformRange<double> range;
+
+        void operator()(const unsigned int *words, double *output, size_t n) const
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                output[i] = range(cpuCurandFraction(words[2 * i], words[2 * i + 1]));
+            }
+        }
+    };
+
+    /**
+     * Antithetic pairs of uniform values in [a, b), where the partner is
+     * computed from the complemented bits like in UniformAntitheticSample
+     * and UniformDoubleAntitheticSample
+     */
+    template <typename T>
+    struct UniformRangeAntitheticSample
+    {
+        enum { WORDS = sizeof(T) / sizeof(float), VALUES = 1 };
+
+        UniformRange<T> range;
+
+        void operator()(const unsigned int *words, float *x, float *partner) const
+        {
+            x[0] = range(cpuCurandFraction(words[0]));
+            partner[0] = range(cpuCurandFraction(~words[0]));
+        }
+
+        void operator()(const unsigned int *words, double *x, double *partner) const
+        {
+            const unsigned long long mask = (1ULL << 53) - 1;
+            unsigned long long z = (unsigned long long)words[0] ^ ((unsigned long long)words[1] << (53 - 32));
+            x[0] = range(z * CPU_CURAND_2POW53_INV_DOUBLE);
+            partner[0] = range((~z & mask) * CPU_CURAND_2POW53_INV_DOUBLE);
+        }
+    };
+
+    /**
+     * Antithetic pairs of normal (or log-normal) samples. Each unit is
+     * one Box-Muller pair from the same words as in NormalPseudoTransform,
+     * and the partner of mean+stddev*z is mean-stddev*z.
+     */
+    template <typename T>
+    struct NormalAntitheticSample
+    {
+        enum { WORDS = 2 * sizeof(T) / sizeof(float), VALUES = 2 };
+
+        T mean;
+        T stddev;
+        bool logNormal;
+
+        void operator()(const unsigned int *words, T *x, T *partner) const
+        {
+            T a, b;
+            normalPair(words, a, b);
+            store(a, x[0], partner[0]);
+            store(b, x[1], partner[1]);
+        }
+
+        void normalPair(const unsigned int *words, float &a, float &b) const
+        {
+            cpuCurandBoxMuller(cpuCurandUniform(words[0]), cpuCurandUniform(words[1]), a, b);
+        }
+
+        void normalPair(const unsigned int *words, double &a, double &b) const
+        {
+            double u = cpuCurandUniformDouble(words[0], words[1]);
+            double v = cpuCurandUniformDouble(words[2], words[3]);
+            cpuCurandBoxMuller(u, v, a, b);
+        }
+
+        void store(T z, T &x, T &partner) const
+        {
+            T d = stddev * z;
+            x = mean + d;
+            partner = mean - d;
+            if (logNormal)
+            {
+                x = exp(x);
+                partner = exp(partner);
+            }
+        }
+    };
+
+    /**
+     * Writes the antithetic pairs that are computed by a sample for
+     * each unit of words. It is used with cpuCurandGeneratePseudo for
+     * the units, which passes the output plus the index of the first
+     * unit of each chunk. Units that exceed the half of the output
+     * are computed, but not stored.
+     */
+    template <typename T, typename Sample>
+    struct AntitheticTransform
+    {
+        Sample sample;
+        T *output;
+        size_t half;
+        bool interleaved;
+
+        void operator()(const unsigned int *words, T *chunk, size_t count) const
+        {
+            size_t k = (size_t)(chunk - output) * Sample::VALUES;
+            T x[Sample::VALUES];
+            T partner[Sample::VALUES];
+            for (size_t j = 0; j < count; j++)
+            {
+                sample(words + j * Sample::WORDS, x, partner);
+                for (size_t v = 0; v < (size_t)Sample::VALUES && k < half; v++, k++)
+                {
+                    if (interleaved)
+                    {
+                        output[2 * k] = x[v];
+                        output[2 * k + 1] = partner[v];
+                    }
+                    else
+                    {
+                        output[k] = x[v];
+                        output[half + k] = partner[v];
+                    }
+                }
+            }
+        }
+    };
+
+    /**
+     * Applies a transform that computes floats, and converts the
+     * results into 16 bit floating point values, chunk by chunk
+     */
+    template <typename Transform>
+    struct Float16Transform
+    {
+        Transform transform;
+        void (*convert)(const float *input, unsigned short *output, size_t n);
+
+        template <typename Word>
+        void operator()(const Word *words, unsigned short *output, size_t n) const
+        {
+            float values[CPU_CURAND_CHUNK_SIZE];
+            transform(words, values, n);
+            convert(values, output, n);
+        }
+    };
+
+    /**
+     * Applies a transform to a chunk, and stores the results into the
+     * rows of a pitched output. It is used with the linear output that
+     * has the same start, so that the index of each chunk is its
+     * offset from the start. The values of a chunk remain in the cache,
+     * and are copied to each row that they cover at once.
+     */
+    template <typename T, typename Transform>
+    struct PitchedTransform
+    {
+        Transform transform;
+        T *output;
+        size_t cols;
+        size_t pitch;
+
+        template <typename Word>
+        void operator()(const Word *words, T *chunk, size_t n) const
+        {
+            T values[CPU_CURAND_CHUNK_SIZE];
+            transform(words, values, n);
+            size_t k = (size_t)(chunk - output);
+            size_t row = k / cols;
+            size_t col = k % cols;
+            for (size_t i = 0; i < n; )
+            {
+                size_t count = std::min(cols - col, n - i);
+                std::copy(values + i, values + i + count, output + row * pitch + col);
+                i += count;
+                row++;
+                col = 0;
+            }
+        }
+    };
+
+    template <typename T, typename Transform>
+    PitchedTransform<T, Transform> pitched(T *output, size_t cols, size_t pitch, const Transform &transform)
+    {
+        PitchedTransform<T, Transform> result = { transform, output, cols, pitch };
+        return result;
+    }
+
+    /**
+     * Bounded integers from a quasirandom generator, by scaling the
+     * words to the range, which preserves their uniformity. A range
+     * of 0 stands for 2^64.
+     */
+    template <typename T>
+    struct RangeQuasiTransform
+    {
+        T lo;
+        unsigned long long range;
+
+        template <typename Word>
+        void operator()(const Word *words, T *output, size_t n) const
+        {
+            const int shift = sizeof(Word) == 4 ? 32 : 0;
+            for (size_t i = 0; i < n; i++)
+            {
+                unsigned long long x = (unsigned long long)words[i] << shift;
+                unsigned long long low;
+                unsigned long long offset = range == 0 ? x : cpuCurandMultiplyHigh(x, range, low);
+                output[i] = (T)(lo + offset);
+            }
+        }
+    };
+
+    /**
+     * Two bounded integers from one 32 bit word, for ranges up to
+     * 2^16, with Lemire's multiply-shift method: The leftover low bits
+     * of the first product are used for the second value. This is the
+     * multiply-shift method for the product of the ranges, so the pair
+     * is accepted if the final low bits are not below 2^32 mod range^2.
+     */
+    template <typename T>
+    struct RangePairSample
+    {
+        T *output;
+        size_t n;
+        T lo;
+        unsigned long long range;
+        unsigned int threshold;
+
+        bool operator()(const unsigned int *words, size_t unit, bool retry) const
+        {
+            unsigned long long m0 = words[0] * range;
+            unsigned long long m1 = (m0 & 0xFFFFFFFFull) * range;
+            if ((unsigned int)m1 < threshold)
+            {
+                return false;
+            }
+            size_t i = 2 * unit;
+            output[i] = (T)(lo + (m0 >> 32));
+            if (i + 1 < n)
+            {
+                output[i + 1] = (T)(lo + (m1 >> 32));
+            }
+            return true;
+        }
+    };
+
+    /**
+     * A bounded integer from one 32 bit word, for ranges up to 2^32,
+     * with Lemire's multiply-shift method
+     */
+    template <typename T>
+    struct RangeSample
+    {
+        T *output;
+        T lo;
+        unsigned long long range;
+        unsigned int threshold;
+
+        bool operator()(const unsigned int *words, size_t unit, bool retry) const
+        {
+            unsigned long long m = words[0] * range;
+            if ((unsigned int)m < threshold)
+            {
+                return false;
+            }
+            output[unit] = (T)(lo + (m >> 32));
+            return true;
+        }
+    };
+
+    /**
+     * A bounded integer from two 32 bit words, for ranges above 2^32,
+     * with Lemire's multiply-shift method. A range of 0 stands for 2^64.
+     */
+    template <typename T>
+    struct RangeWideSample
+    {
+        T *output;
+        T lo;
+        unsigned long long range;
+        unsigned long long threshold;
+
+        bool operator()(const unsigned int *words, size_t unit, bool retry) const
+        {
+            unsigned long long x = words[0] | ((unsigned long long)words[1] << 32);
+            if (range == 0)
+            {
+                output[unit] = (T)(lo + x);
+                return true;
+            }
+            unsigned long long low;
+            unsigned long long high = cpuCurandMultiplyHigh(x, range, low);
+            if (low < threshold)
+            {
+                return false;
+            }
+            output[unit] = (T)(lo + high);
+            return true;
+        }
+    };
+
+    /**
+     * Exponential samples with rate lambda, by inversion. The
+     * 'pairs' flag tells whether each double is computed from two
+     * words of a pseudorandom generator.
+     */
+    template <typename T>
+    struct ExponentialTransform
+    {
+        T invLambda;
+        bool pairs;
+
+        template <typename Word>
+        void operator()(const Word *words, float *output, size_t n) const
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                output[i] = -logf(cpuCurandUniform(words[i])) * invLambda;
+            }
+        }
+
+        template <typename Word>
+        void operator()(const Word *words, double *output, size_t n) const
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                double u = pairs ? cpuCurandUniformDouble((unsigned int)words[2 * i],
+                    (unsigned int)words[2 * i + 1]) : cpuCurandUniformDouble(words[i]);
+                output[i] = -log(u) * invLambda;
+            }
+        }
+    };
+
+    /**
+     * Returns the uniform sample with the given index from the given
+     * words: One word for floats, and two words for doubles
+     */
+    inline float uniformAt(const unsigned int *words, size_t index, float)
+    {
+        return cpuCurandUniform(words[index]);
+    }
+
+    inline double uniformAt(const unsigned int *words, size_t index, double)
+    {
+        return cpuCurandUniformDouble(words[2 * index], words[2 * index + 1]);
+    }
+
+    /**
+     * Gamma samples with the method of Marsaglia and Tsang. The words
+     * of one sample provide two normal samples (with the Box-Muller
+     * transform) and two uniform samples, for two attempts, so that a
+     * sample is rejected with a probability of less than 0.3%. For a
+     * shape a < 1, a sample for a+1 is multiplied with U^(1/a), which
+     * needs a fifth uniform sample.
+     *
+     * A sample is returned as x and e, with the value x * exp(e), so
+     * that the ratios of small values can be computed without underflow.
+     * The attempts are computed for many units at once, with
+     * cpuCurandMarsagliaTsang.
+     */
+    template <typename T>
+    struct GammaSampler
+    {
+        T d;
+        T c;
+        T invShape;
+        bool boost;
+
+        explicit GammaSampler(T shape)
+        {
+            boost = shape < 1;
+            d = (boost ? shape + 1 : shape) - (T)1 / 3;
+            c = 1 / sqrt(9 * d);
+            invShape = 1 / shape;
+        }
+
+        /**
+         * The number of uniform samples for one sample
+         */
+        size_t uniforms() const
+        {
+            return boost ? 5 : 4;
+        }
+
+        /**
+         * Computes x for 'count' units whose words start 'stride' words
+         * apart. Writes the indices of the rejected units into
+         * 'rejected', in increasing order, and returns their number.
+         */
+        size_t operator()(const unsigned int *words, size_t stride, size_t count,
+            T *x, size_t *rejected) const
+        {
+            return cpuCurandMarsagliaTsang(words, stride, count, d, c, x, rejected);
+        }
+
+        /**
+         * Returns e for the words of one accepted unit
+         */
+        T exponent(const unsigned int *words) const
+        {
+            return boost ? log(uniformAt(words, 4, T())) * invShape : 0;
+        }
+    };
+
+    /**
+     * The number of units for which the gamma based samples keep
+     * intermediate results at a time
+     */
+    const size_t GAMMA_BLOCK_SIZE = 256;
+
+    template <typename T>
+    struct GammaSample
+    {
+        T *output;
+        GammaSampler<T> gamma;
+        T scale;
+
+        size_t operator()(const unsigned int *words, size_t first, size_t count,
+            bool retry, size_t *rejected) const
+        {
+            const size_t stride = gamma.uniforms() * (sizeof(T) / sizeof(float));
+            size_t numRejected = gamma(words, stride, count, output + first, rejected);
+            size_t r = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+                if (r < numRejected && rejected[r] == i)
+                {
+                    rejected[r++] += first;
+                    continue;
+                }
+                output[first + i] = scale * output[first + i] * exp(gamma.exponent(words + i * stride));
+            }
+            return numRejected;
+        }
+    };
+
+    /**
+     * Beta samples X / (X + Y), where X and Y are gamma samples
+     * with the shapes alpha and beta. A unit is rejected when one
+     * of them is rejected.
+     */
+    template <typename T>
+    struct BetaSample
+    {
+        T *output;
+        GammaSampler<T> gammaAlpha;
+        GammaSampler<T> gammaBeta;
+
+        size_t operator()(const unsigned int *words, size_t first, size_t count,
+            bool retry, size_t *rejected) const
+        {
+            const size_t offset = gammaAlpha.uniforms() * (sizeof(T) / sizeof(float));
+            const size_t stride = offset + gammaBeta.uniforms() * (sizeof(T) / sizeof(float));
+            T y[GAMMA_BLOCK_SIZE];
+            size_t rejectedX[GAMMA_BLOCK_SIZE];
+            size_t rejectedY[GAMMA_BLOCK_SIZE];
+            size_t numRejected = 0;
+            for (size_t begin = 0; begin < count; begin += GAMMA_BLOCK_SIZE)
+            {
+                size_t size = count - begin < GAMMA_BLOCK_SIZE ? count - begin : GAMMA_BLOCK_SIZE;
+                const unsigned int *blockWords = words + begin * stride;
+                T *x = output + first + begin;
+                size_t numRejectedX = gammaAlpha(blockWords, stride, size, x, rejectedX);
+                size_t numRejectedY = gammaBeta(blockWords + offset, stride, size, y, rejectedY);
+                size_t rx = 0;
+                size_t ry = 0;
+                for (size_t i = 0; i < size; i++)
+                {
+                    bool accepted = true;
+                    if (rx < numRejectedX && rejectedX[rx] == i)
+                    {
+                        rx++;
+                        accepted = false;
+                    }
+                    if (ry < numRejectedY && rejectedY[ry] == i)
+                    {
+                        ry++;
+                        accepted = false;
+                    }
+                    if (!accepted)
+                    {
+                        rejected[numRejected++] = first + begin + i;
+                        continue;
+                    }
+                    const unsigned int *unitWords = blockWords + i * stride;
+                    T ex = gammaAlpha.exponent(unitWords);
+                    T ey = gammaBeta.exponent(unitWords + offset);
+                    // In double precision, so that float results that are close
+                    // to 0 become subnormal instead of 0
+                    x[i] = (T)(1 / (1 + ((double)y[i] / x[i]) * exp((double)ey - ex)));
+                }
+            }
+            return numRejected;
+        }
+    };
+
+    /**
+     * Student-t samples Z / sqrt(2 G / nu), where G is a gamma sample
+     * with the shape nu/2, and Z is a normal sample, computed from one
+     * more uniform sample by inversion
+     */
+    template <typename T>
+    struct StudentTSample
+    {
+        T *output;
+        GammaSampler<T> gamma;
+        T nu;
+
+        size_t operator()(const unsigned int *words, size_t first, size_t count,
+            bool retry, size_t *rejected) const
+        {
+            const bool refine = sizeof(T) == sizeof(double);
+            const size_t stride = (gamma.uniforms() + 1) * (sizeof(T) / sizeof(float));
+            size_t numRejected = gamma(words, stride, count, output + first, rejected);
+            size_t r = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+                if (r < numRejected && rejected[r] == i)
+                {
+                    rejected[r++] += first;
+                    continue;
+                }
+                const unsigned int *unitWords = words + i * stride;
+                T x = output[first + i];
+                T e = gamma.exponent(unitWords);
+                T z = (T)cpuCurandNormalCdfInv(uniformAt(unitWords, gamma.uniforms(), T()), refine);
+                output[first + i] = z * sqrt(nu / (2 * x)) * exp(-e / 2);
+            }
+            return numRejected;
+        }
+    };
+
+    /**
+     * The methods for sampling a truncated standard normal distribution
+     * in [a, b], depending on the interval
+     */
+    enum TruncatedNormalMethod
+    {
+        // Rejection of standard normal samples that are not in [a, b],
+        // for intervals that contain a large part of the probability
+        TRUNCATED_NORMAL_NAIVE,
+
+        // Inversion of the cumulative distribution function, for
+        // narrower intervals, and for quasirandom generators
+        TRUNCATED_NORMAL_INVERSE,
+
+        // Robert's rejection with a shifted exponential proposal, for
+        // intervals in the tail
+        TRUNCATED_NORMAL_ROBERT,
+
+        // Rejection with a uniform proposal, for narrow intervals that
+        // are so far in the tail that the inversion would underflow
+        TRUNCATED_NORMAL_UNIFORM
+    };
+
+    /**
+     * The parameters of a truncated normal distribution. The bounds are
+     * standardized, and mirrored if necessary, so that either a < 0 < b,
+     * or 0 <= a < b. The 'sign' is -1 if they have been mirrored.
+     */
+    struct TruncatedNormal
+    {
+        double mean;
+        double stddev;
+        double sign;
+        double a;
+        double b;
+
+        // The upper tail probabilities Q(a) and Q(b)
+        double qa;
+        double qb;
+
+        // The rate of the exponential proposal of Robert's method
+        double lambda;
+
+        TruncatedNormalMethod method;
+
+        // The number of attempts of each sample, for the rejection methods
+        size_t attempts;
+
+        /**
+         * Returns the value for the given standardized sample, mapped
+         * back to the original interval
+         */
+        template <typename T>
+        T store(double x, T lo, T hi) const
+        {
+            x = x < a ? a : x > b ? b : x;
+            T y = (T)(mean + stddev * sign * x);
+            return y < lo ? lo : y > hi ? hi : y;
+        }
+    };
+
+    /**
+     * Returns the standard normal upper tail probability Q(x)
+     */
+    inline double normalQ(double x)
+    {
+        return 0.5 * erfc(x / sqrt(2.0));
+    }
+
+    /**
+     * The number of truncated normal samples that are computed at once
+     * by cpuCurandTruncatedNormalInverse and cpuCurandTruncatedNormalTail
+     */
+    const size_t TRUNCATED_NORMAL_BLOCK_SIZE = 256;
+
+    /**
+     * Truncated normal samples by inversion, from single words of a
+     * quasirandom generator, or pairs of words of a pseudorandom
+     * generator for doubles
+     */
+    template <typename T>
+    struct TruncatedNormalInverseTransform
+    {
+        const TruncatedNormal *d;
+        T lo;
+        T hi;
+        bool pairs;
+
+        template <typename Word>
+        void operator()(const Word *words, T *output, size_t n) const
+        {
+            const bool refine = sizeof(T) == sizeof(double);
+            double u[TRUNCATED_NORMAL_BLOCK_SIZE];
+            double x[TRUNCATED_NORMAL_BLOCK_SIZE];
+            for (size_t begin = 0; begin < n; begin += TRUNCATED_NORMAL_BLOCK_SIZE)
+            {
+                size_t size = n - begin < TRUNCATED_NORMAL_BLOCK_SIZE ? n - begin : TRUNCATED_NORMAL_BLOCK_SIZE;
+                for (size_t i = 0; i < size; i++)
+                {
+                    size_t j = begin + i;
+                    u[i] = pairs ? cpuCurandUniformDouble((unsigned int)words[2 * j],
+                        (unsigned int)words[2 * j + 1]) : cpuCurandUniformDouble(words[j]);
+                }
+                cpuCurandTruncatedNormalInverse(u, size, d->qa, d->qb, refine, x);
+                for (size_t i = 0; i < size; i++)
+                {
+                    output[begin + i] = d->store(x[i], lo, hi);
+                }
+            }
+        }
+    };
+
+    /**
+     * Pairs of truncated normal samples by the rejection of normal
+     * samples. Both values of each Box-Muller transform are attempts,
+     * and the first two that are in [a, b] are the results.
+     */
+    template <typename T>
+    struct TruncatedNormalNaiveSample
+    {
+        T *output;
+        size_t n;
+        const TruncatedNormal *d;
+        T lo;
+        T hi;
+
+        bool operator()(const unsigned int *words, size_t unit, bool retry) const
+        {
+            size_t i = 2 * unit;
+            size_t end = i + 2 < n ? i + 2 : n;
+            for (size_t j = 0; j < d->attempts && i < end; j++)
+            {
+                T z[2];
+                cpuCurandBoxMuller(uniformAt(words, 2 * j, T()), uniformAt(words, 2 * j + 1, T()), z[0], z[1]);
+                for (int k = 0; k < 2 && i < end; k++)
+                {
+                    if (z[k] >= d->a && z[k] <= d->b)
+                    {
+                        output[i++] = d->store(z[k], lo, hi);
+                    }
+                }
+            }
+            return i == end;
+        }
+    };
+
+    /**
+     * Truncated normal samples with Robert's method, or with a uniform
+     * proposal. Each sample has the words for the given number of
+     * attempts, which are tried with cpuCurandTruncatedNormalTail.
+     */
+    template <typename T>
+    struct TruncatedNormalTailSample
+    {
+        T *output;
+        const TruncatedNormal *d;
+        T lo;
+        T hi;
+
+        size_t operator()(const unsigned int *words, size_t first, size_t count,
+            bool retry, size_t *rejected) const
+        {
+            const bool pairs = sizeof(T) == sizeof(double);
+            const bool robert = d->method == TRUNCATED_NORMAL_ROBERT;
+            const size_t stride = 2 * d->attempts * (sizeof(T) / sizeof(float));
+            double z[TRUNCATED_NORMAL_BLOCK_SIZE];
+            size_t numRejected = 0;
+            for (size_t begin = 0; begin < count; begin += TRUNCATED_NORMAL_BLOCK_SIZE)
+            {
+                size_t size = count - begin < TRUNCATED_NORMAL_BLOCK_SIZE ? count - begin : TRUNCATED_NORMAL_BLOCK_SIZE;
+                size_t *blockRejected = rejected + numRejected;
+                size_t numBlockRejected = cpuCurandTruncatedNormalTail(words + begin * stride, stride,
+                    size, d->attempts, pairs, robert, d->a, d->b, d->lambda, z, blockRejected);
+                size_t r = 0;
+                for (size_t i = 0; i < size; i++)
+                {
+                    if (r < numBlockRejected && blockRejected[r] == i)
+                    {
+                        blockRejected[r++] = first + begin + i;
+                        continue;
+                    }
+                    output[first + begin + i] = d->store(z[i], lo, hi);
+                }
+                numRejected += numBlockRejected;
+            }
+            return numRejected;
+        }
+    };
+
+    struct PoissonTransform
+    {
+        const CpuPoissonTable *table;
+
+        template <typename Word>
+        void operator()(const Word *words, unsigned int *output, size_t n) const
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                output[i] = table->sample(cpuCurandUniformDouble(words[i]));
+            }
+        }
+    };
+}
+
+
+//=== Stateless Philox =======================================================
+
+namespace
+{
+    /**
+     * Fill the given output with n values that are computed from the
+     * words of the Philox4x32-10 stream for the given seed and
+     * subsequence, starting at the given offset, in the same way as
+     * cpuCurandGeneratePseudo does it for a generator. The transform
+     * has to consume wordsPerOutput words for each output, which may
+     * be 1 or 2.
+     */
+    template <typename T, typename Transform>
+    void philoxGenerate(unsigned long long seed, unsigned long long subsequence,
+        unsigned long long offset, T *output, size_t n,
+        size_t wordsPerOutput, const Transform &transform)
+    {
+        const size_t numTasks = (n + CPU_CURAND_TASK_SIZE - 1) / CPU_CURAND_TASK_SIZE;
+        cpuCurandParallelFor(numTasks, [&](size_t t)
+        {
+            size_t begin = t * CPU_CURAND_TASK_SIZE;
+            size_t end = std::min(begin + CPU_CURAND_TASK_SIZE, n);
+            unsigned long long position = offset + begin * wordsPerOutput;
+            // Up to 3 leading words of a partially consumed block
+            unsigned int words[2 * CPU_CURAND_CHUNK_SIZE + 8];
+            for (size_t i = begin; i < end; i += CPU_CURAND_CHUNK_SIZE)
+            {
+                size_t count = std::min((size_t)CPU_CURAND_CHUNK_SIZE, end - i);
+                size_t skip = (size_t)(position & 3);
+                size_t numBlocks = (skip + count * wordsPerOutput + 3) / 4;
+                cpuCurandPhilox4x32_10(seed, subsequence, position >> 2,
+                    words, numBlocks);
+                transform((const unsigned int*)words + skip, output + i, count);
+                position += count * wordsPerOutput;
+            }
+        });
+    }
+
+    /**
+     * Fill the given output with n values, where value i is computed
+     * from the words of the Philox4x32-10 stream for the given seed
+     * and subsequence that start at offsets[i]. This is the first
+     * value that a generator with this offset would produce. The
+     * wordsPerOutput may be 1 or 2.
+     */
+    template <typename T, typename Transform>
+    void philoxGather(unsigned long long seed, unsigned long long subsequence,
+        const unsigned long long *offsets, T *output, size_t n,
+        size_t wordsPerOutput, const Transform &transform)
+    {
+        const size_t numTasks = (n + CPU_CURAND_TASK_SIZE - 1) / CPU_CURAND_TASK_SIZE;
+        cpuCurandParallelFor(numTasks, [&](size_t t)
+        {
+            size_t begin = t * CPU_CURAND_TASK_SIZE;
+            size_t end = std::min(begin + CPU_CURAND_TASK_SIZE, n);
+            unsigned long long positions[2 * CPU_CURAND_CHUNK_SIZE];
+            unsigned int words[2 * CPU_CURAND_CHUNK_SIZE];
+            for (size_t i = begin; i < end; i += CPU_CURAND_CHUNK_SIZE)
+            {
+                size_t count = std::min((size_t)CPU_CURAND_CHUNK_SIZE, end - i);
+                for (size_t j = 0; j < count; j++)
+                {
+                    for (size_t w = 0; w < wordsPerOutput; w++)
+                    {
+                        positions[j * wordsPerOutput + w] = offsets[i + j] + w;
+                    }
+                }
+                cpuCurandPhilox4x32_10Gather(seed, subsequence, positions,
+                    words, count * wordsPerOutput);
+                transform((const unsigned int*)words, output + i, count);
+            }
+        });
+    }
+}
+
+
+//=== Lanes ==================================================================
+
+/**
+ * The lane of one thread of a generator in the concurrent mode. The
+ * lane with the given index takes its words from the subsequence of
+ * the generator plus the index. The generation tells which rewind of
+ * the generator the position of the lane refers to, and the session
+ * tells in which period of the concurrent mode the index was assigned.
+ */
+struct CpuLane
+{
+    CpuGenerator generator;
+    unsigned int index;
+    unsigned long long generation;
+    unsigned long long session;
+};
+
+namespace
+{
+    /**
+     * The ids of the lanes that currently exist, and the number of
+     * lanes that have been destroyed, which tells the threads when
+     * they have to remove the entries of destroyed lanes from their
+     * thread-local maps
+     */
+    struct CpuLaneRegistry
+    {
+        std::mutex mutex;
+        std::unordered_set<unsigned long long> ids;
+        std::atomic<unsigned long long> destroyed;
+        std::atomic<unsigned long long> nextId;
+
+        CpuLaneRegistry() : destroyed(0), nextId(0) {}
+    };
+
+    CpuLaneRegistry &laneRegistry()
+    {
+        static CpuLaneRegistry registry;
+        return registry;
+    }
+}
+
+/**
+ * The lanes of a generator in the concurrent mode. Each thread that
+ * uses the generator has its own lane, which is a generator with the
+ * same settings that takes its words from its own subsequence. The
+ * lanes are found with a thread-local map from the unique id of this
+ * structure, so that only the creation of a lane requires the lock.
+ *
+ * The lanes are kept until the generator is destroyed, also when the
+ * concurrent mode is switched off, so that calls that are still
+ * running in their lanes do not use freed memory. Switching the
+ * concurrent mode on again starts a new session, in which the lanes
+ * are numbered again and start at their first word.
+ */
+struct CpuLanes
+{
+    CpuLanes() : generation(0), session(0), nextIndex(0), active(true)
+    {
+        CpuLaneRegistry &registry = laneRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        id = registry.nextId++;
+        registry.ids.insert(id);
+    }
+
+    ~CpuLanes()
+    {
+        for (size_t i = 0; i < lanes.size(); i++)
+        {
+            delete lanes[i]->generator.engine;
+            delete lanes[i];
+        }
+        CpuLaneRegistry &registry = laneRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.ids.erase(id);
+        registry.destroyed++;
+    }
+
+    unsigned long long id;
+    unsigned long long generation;
+    unsigned long long session;
+    unsigned int nextIndex;
+    std::atomic<bool> active;
+    std::mutex mutex;
+    std::vector<CpuLane*> lanes;
+};
+
+namespace
+{
+    /**
+     * The lanes of the calling thread, by the ids of their generators,
+     * and the number of destroyed lanes when the entries of destroyed
+     * lanes were last removed
+     */
+    struct CpuThreadLanes
+    {
+        std::unordered_map<unsigned long long, CpuLane*> lanes;
+        unsigned long long destroyed;
+
+        CpuThreadLanes() : destroyed(0) {}
+    };
+
+    /**
+     * Returns a reference to the entry for the lane of the calling
+     * thread in the given lanes, which is NULL if the calling thread
+     * did not use the generator yet. The entries of lanes that have
+     * been destroyed since the last call are removed, so that the map
+     * only grows with the number of existing generators.
+     */
+    CpuLane *&threadLane(const CpuLanes *lanes)
+    {
+        thread_local CpuThreadLanes threadLanes;
+        CpuLaneRegistry &registry = laneRegistry();
+        unsigned long long destroyed = registry.destroyed.load();
+        if (destroyed != threadLanes.destroyed)
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (auto it = threadLanes.lanes.begin(); it != threadLanes.lanes.end();)
+            {
+                if (registry.ids.count(it->first) == 0)
+                {
+                    it = threadLanes.lanes.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            threadLanes.destroyed = destroyed;
+        }
+        return threadLanes.lanes[lanes->id];
+    }
+
+    /**
+     * Add a lane with the given index to the given lanes. The caller
+     * has to hold the lock of the lanes.
+     */
+    CpuLane *addLane(CpuLanes *lanes, unsigned int index)
+    {
+        CpuLane *lane = new CpuLane();
+        lane->generator.engine = NULL;
+        lane->generator.lanes = NULL;
+        lane->generator.position = 0;
+        lane->index = index;
+        lane->generation = lanes->generation;
+        lane->session = lanes->session;
+        lanes->lanes.push_back(lane);
+        return lane;
+    }
+}
+
+CpuGenerator *cpuCurandLane(CpuGenerator *generator)
+{
+    if (generator == NULL || generator->lanes == NULL || !generator->lanes->active)
+    {
+        return generator;
+    }
+    CpuLanes *lanes = generator->lanes;
+    CpuLane *&lane = threadLane(lanes);
+    if (lane == NULL)
+    {
+        std::lock_guard<std::mutex> lock(lanes->mutex);
+        lane = addLane(lanes, lanes->nextIndex++);
+    }
+    else if (lane->session != lanes->session)
+    {
+        std::lock_guard<std::mutex> lock(lanes->mutex);
+        lane->index = lanes->nextIndex++;
+        lane->session = lanes->session;
+        lane->generator.position = 0;
+    }
+    CpuGenerator *g = &lane->generator;
+    const unsigned long long subsequence = generator->subsequence + lane->index;
+    if (g->engine != NULL && (g->seed != generator->seed || g->subsequence != subsequence))
+    {
+        delete g->engine;
+        g->engine = NULL;
+    }
+    if (lane->generation != lanes->generation)
+    {
+        g->position = 0;
+        lane->generation = lanes->generation;
+    }
+    g->type = generator->type;
+    g->seed = generator->seed;
+    g->subsequence = subsequence;
+    g->offset = generator->offset;
+    g->ordering = generator->ordering;
+    g->dimensions = generator->dimensions;
+    g->antithetic = generator->antithetic;
+    g->layout = generator->layout;
+    return g;
+}
+
+
+//=== Generator handling =====================================================
+
+/**
+ * Obtain the prepared generator for the given handle, or return
+ * the error status from the calling function
+ */
+#define CPU_CURAND_PREPARE(g, generator) \
+    CpuGenerator *g = cpuCurandLane(toCpuGenerator(generator)); \
+    do { \
+        curandStatus_t status = cpuCurandPrepare(g); \
+        if (status != CURAND_STATUS_SUCCESS) return status; \
+    } while (0)
+
+namespace
+{
+    CpuGenerator *toCpuGenerator(curandGenerator_t generator)
+    {
+        return reinterpret_cast<CpuGenerator*>(generator);
+    }
+
+    bool isValidType(curandRngType_t type)
+    {
+        if (type == CURAND_RNG_QUASI_HALTON || type == CURAND_RNG_QUASI_LATTICE)
+        {
+            return true;
+        }
+        switch (type)
+        {
+            case CURAND_RNG_PSEUDO_DEFAULT:
+            case CURAND_RNG_PSEUDO_XORWOW:
+            case CURAND_RNG_PSEUDO_MRG32K3A:
+            case CURAND_RNG_PSEUDO_MTGP32:
+            case CURAND_RNG_PSEUDO_MT19937:
+            case CURAND_RNG_PSEUDO_PHILOX4_32_10:
+            case CURAND_RNG_QUASI_DEFAULT:
+            case CURAND_RNG_QUASI_SOBOL32:
+            case CURAND_RNG_QUASI_SCRAMBLED_SOBOL32:
+            case CURAND_RNG_QUASI_SOBOL64:
+            case CURAND_RNG_QUASI_SCRAMBLED_SOBOL64:
+                return true;
+            default:
+                break;
+        }
+        return false;
+    }
+
+    /**
+     * Move the given generator, and all its lanes, back to the start
+     * of their streams
+     */
+    void rewind(CpuGenerator *g)
+    {
+        g->position = 0;
+        if (g->lanes != NULL)
+        {
+            g->lanes->generation++;
+        }
+    }
+
+    /**
+     * Invalidate the engine of the given generator, so that it is
+     * created again, for the current settings, before the next use
+     */
+    void invalidate(CpuGenerator *g)
+    {
+        delete g->engine;
+        g->engine = NULL;
+        rewind(g);
+    }
+
+    /**
+     * Returns the subsequence for the given path in the tree of
+     * streams. Each level mixes the index into the subsequence of the
+     * parent with a bijective function, so that the children of one
+     * parent always get different subsequences.
+     */
+    unsigned long long deriveSubsequence(const unsigned long long *path, unsigned int depth)
+    {
+        unsigned long long subsequence = 0;
+        for (unsigned int i = 0; i < depth; i++)
+        {
+            subsequence = cpuCurandMix64(cpuCurandMix64(subsequence) + path[i]);
+        }
+        return subsequence;
+    }
+
+    bool is64BitQuasi(const CpuGenerator *g)
+    {
+        return g->type == CURAND_RNG_QUASI_SOBOL64 ||
+            g->type == CURAND_RNG_QUASI_SCRAMBLED_SOBOL64;
+    }
+
+    bool isSobol(const CpuGenerator *g)
+    {
+        return cpuCurandIsQuasi(g) &&
+            g->type != CURAND_RNG_QUASI_HALTON &&
+            g->type != CURAND_RNG_QUASI_LATTICE;
+    }
+
+    /**
+     * Returns the maximum number of dimensions of the given quasirandom
+     * generator, with the given direction file (or NULL)
+     */
+    unsigned int maxDimensions(const CpuGenerator *g, const CpuDirectionFile *file)
+    {
+        if (file != NULL)
+        {
+            return file->dimensions;
+        }
+        return isSobol(g) ? CPU_CURAND_SOBOL_DIMENSIONS : CPU_CURAND_MAX_DIMENSIONS;
+    }
+
+    /**
+     * Generate n values with the given transform from a quasirandom
+     * generator, dispatching on the word size of the engine
+     */
+    template <typename T, typename Transform>
+    curandStatus_t generateQuasi(CpuGenerator *g, T *output, size_t n, const Transform &transform)
+    {
+        if (n % g->dimensions != 0)
+        {
+            return CURAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        if (g->engine->is64Bit())
+        {
+            cpuCurandGenerateQuasi<unsigned long long>(g, output, n, transform);
+        }
+        else
+        {
+            cpuCurandGenerateQuasi<unsigned int>(g, output, n, transform);
+        }
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * Generate n/2 samples of a pseudorandom generator and write them
+     * together with their antithetic partners, in the antithetic mode
+     * of the generator
+     */
+    template <typename T, typename Sample>
+    curandStatus_t generateAntithetic(CpuGenerator *g, T *output, size_t n, const Sample &sample)
+    {
+        if (n % 2 != 0)
+        {
+            return CURAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        const size_t half = n / 2;
+        const size_t units = (half + Sample::VALUES - 1) / Sample::VALUES;
+        AntitheticTransform<T, Sample> transform = { sample, output, half,
+            g->antithetic == CURAND_ANTITHETIC_INTERLEAVED };
+        cpuCurandGeneratePseudo<unsigned int>(g, output, units, Sample::WORDS, transform);
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    curandStatus_t generateNormal(CpuGenerator *g, T *output, size_t n, T mean, T stddev, bool logNormal)
+    {
+        if (cpuCurandIsQuasi(g))
+        {
+            NormalQuasiTransform<T> transform = { mean, stddev, logNormal };
+            return generateQuasi(g, output, n, transform);
+        }
+        if (g->antithetic != CURAND_ANTITHETIC_NONE)
+        {
+            NormalAntitheticSample<T> sample = { mean, stddev, logNormal };
+            return generateAntithetic(g, output, n, sample);
+        }
+        if (n % 2 != 0)
+        {
+            return CURAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        NormalPseudoTransform<T> transform = { mean, stddev, logNormal };
+        cpuCurandGeneratePseudo<unsigned int>(g, output, n, sizeof(T) / sizeof(float), transform);
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * Generate uniform values in [a, b), from the same words as the
+     * uniform values of the generator
+     */
+    template <typename T, typename PseudoTransform>
+    curandStatus_t generateUniformRange(CpuGenerator *g, T *output, size_t n, T a, T b)
+    {
+        if (!(a < b) || !std::isfinite(a) || !std::isfinite(b))
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        UniformRange<T> range(a, b);
+        if (cpuCurandIsQuasi(g))
+        {
+            UniformRangeTransform<T> transform = { range };
+            return generateQuasi(g, output, n, transform);
+        }
+        if (g->antithetic != CURAND_ANTITHETIC_NONE)
+        {
+            UniformRangeAntitheticSample<T> sample = { range };
+            return generateAntithetic(g, output, n, sample);
+        }
+        PseudoTransform transform = { range };
+        cpuCurandGeneratePseudo<unsigned int>(g, output, n, sizeof(T) / sizeof(float), transform);
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * Generate uniform values into the given rows of a pitched output,
+     * with the transforms for quasirandom and pseudorandom generators
+     */
+    template <typename T, typename QuasiTransform, typename PseudoTransform>
+    curandStatus_t generateUniform2D(CpuGenerator *g, T *output, size_t rows, size_t cols, size_t pitch,
+        const QuasiTransform &quasiTransform, const PseudoTransform &pseudoTransform)
+    {
+        if (pitch < cols)
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        const size_t n = rows * cols;
+        if (cpuCurandIsQuasi(g))
+        {
+            return generateQuasi(g, output, n, pitched(output, cols, pitch, quasiTransform));
+        }
+        cpuCurandGeneratePseudo<unsigned int>(g, output, n, sizeof(T) / sizeof(float),
+            pitched(output, cols, pitch, pseudoTransform));
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * Generate normal (or log-normal) values into the given rows of a
+     * pitched output, in the same order as generateNormal
+     */
+    template <typename T>
+    curandStatus_t generateNormal2D(CpuGenerator *g, T *output, size_t rows, size_t cols, size_t pitch,
+        T mean, T stddev, bool logNormal)
+    {
+        if (pitch < cols)
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        const size_t n = rows * cols;
+        if (cpuCurandIsQuasi(g))
+        {
+            NormalQuasiTransform<T> transform = { mean, stddev, logNormal };
+            return generateQuasi(g, output, n, pitched(output, cols, pitch, transform));
+        }
+        if (n % 2 != 0)
+        {
+            return CURAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        NormalPseudoTransform<T> transform = { mean, stddev, logNormal };
+        cpuCurandGeneratePseudo<unsigned int>(g, output, n, sizeof(T) / sizeof(float),
+            pitched(output, cols, pitch, transform));
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * Generate uniformly distributed integers in [lo, hi]. For
+     * pseudorandom generators, small ranges use one word for two
+     * values, ranges up to 2^32 use one word, and larger ranges use
+     * two words for each value.
+     */
+    template <typename T>
+    curandStatus_t generateRange(CpuGenerator *g, T *output, size_t n, T lo, T hi)
+    {
+        typedef typename std::make_unsigned<T>::type U;
+        if (hi < lo)
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        // Wraps around to 0 for the full 64 bit range
+        unsigned long long range = (unsigned long long)(U)((U)hi - (U)lo) + 1;
+        if (cpuCurandIsQuasi(g))
+        {
+            RangeQuasiTransform<T> transform = { lo, range };
+            return generateQuasi(g, output, n, transform);
+        }
+        if (range != 0 && range <= (1ull << 16))
+        {
+            unsigned long long product = range * range;
+            RangePairSample<T> sample = { output, n, lo, range,
+                (unsigned int)((1ull << 32) % product) };
+            cpuCurandGenerateRejection(g, (n + 1) / 2, 1, sample);
+        }
+        else if (range != 0 && range <= (1ull << 32))
+        {
+            RangeSample<T> sample = { output, lo, range,
+                (unsigned int)((1ull << 32) % range) };
+            cpuCurandGenerateRejection(g, n, 1, sample);
+        }
+        else
+        {
+            RangeWideSample<T> sample = { output, lo, range,
+                range == 0 ? 0 : (0 - range) % range };
+            cpuCurandGenerateRejection(g, n, 2, sample);
+        }
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * The number of words that are used for each word of Bernoulli bits
+     * with an arbitrary probability. The bit-sliced comparison decides
+     * all 32 bits within this many steps with a probability of about
+     * 1 - 32 * 2^-12. Otherwise, it is continued with further words.
+     */
+    const size_t BERNOULLI_WORDS_PER_UNIT = 12;
+
+    /**
+     * The binary digits of a probability p in (0,1), where digit j
+     * has the weight 2^-j, for j >= 1
+     */
+    struct BernoulliDigits
+    {
+        // p = mantissa * 2^(exponent - 53)
+        unsigned long long mantissa;
+        int exponent;
+
+        // The index of the last nonzero digit
+        int last;
+
+        explicit BernoulliDigits(double p)
+        {
+            double f = frexp(p, &exponent);
+            mantissa = (unsigned long long)ldexp(f, 53);
+            int zeros = 0;
+            while (((mantissa >> zeros) & 1) == 0)
+            {
+                zeros++;
+            }
+            last = 53 - exponent - zeros;
+        }
+
+        bool digit(int j) const
+        {
+            int b = 53 - exponent - j;
+            return b >= 0 && b <= 52 && ((mantissa >> b) & 1) != 0;
+        }
+    };
+
+    /**
+     * Bernoulli bits for p = 2^-k: A bit is 1 if the first k bits of
+     * its uniform value are all 0
+     */
+    struct BernoulliPowerSample
+    {
+        unsigned int *output;
+        size_t k;
+
+        bool operator()(const unsigned int *words, size_t unit, bool retry) const
+        {
+            unsigned int any = 0;
+            for (size_t i = 0; i < k; i++)
+            {
+                any |= words[i];
+            }
+            output[unit] = ~any;
+            return true;
+        }
+    };
+
+    /**
+     * Bernoulli bits for an arbitrary p, by comparing 32 uniform values
+     * with p at once, one binary digit per step: Each word provides
+     * the next digit of all 32 values. A value is below p if its first
+     * digit that differs from p is 0, and above p otherwise. Since p
+     * has finitely many digits, this is exact.
+     *
+     * When bits are still undecided after all given words have been
+     * used, their state is stored, and the unit is rejected, so that it
+     * is continued with further words when it is retried.
+     */
+    struct BernoulliSample
+    {
+        struct State
+        {
+            unsigned int result;
+            unsigned int undecided;
+            int level;
+        };
+
+        unsigned int *output;
+        const BernoulliDigits *digits;
+        std::map<size_t, State> *pending;
+        std::mutex *pendingMutex;
+
+        bool operator()(const unsigned int *words, size_t unit, bool retry) const
+        {
+            State state = { 0, 0xFFFFFFFFu, 1 };
+            if (retry)
+            {
+                std::lock_guard<std::mutex> lock(*pendingMutex);
+                auto p = pending->find(unit);
+                state = p->second;
+                pending->erase(p);
+            }
+            for (size_t i = 0; i < BERNOULLI_WORDS_PER_UNIT; i++)
+            {
+                if (state.undecided == 0 || state.level > digits->last)
+                {
+                    // Undecided values are equal to p in all its digits
+                    output[unit] = state.result;
+                    return true;
+                }
+                unsigned int r = words[i];
+                if (digits->digit(state.level))
+                {
+                    state.result |= state.undecided & ~r;
+                    state.undecided &= r;
+                }
+                else
+                {
+                    state.undecided &= ~r;
+                }
+                state.level++;
+            }
+            if (state.undecided == 0 || state.level > digits->last)
+            {
+                output[unit] = state.result;
+                return true;
+            }
+            std::lock_guard<std::mutex> lock(*pendingMutex);
+            (*pending)[unit] = state;
+            return false;
+        }
+    };
+
+    /**
+     * Generate nBits Bernoulli bits with probability p, packed into
+     * 32 bit words, starting at the least significant bit
+     */
+    curandStatus_t generateBernoulliBits(CpuGenerator *g, unsigned int *output, size_t nBits, double p)
+    {
+        if (!(p >= 0.0 && p <= 1.0))
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        if (cpuCurandIsQuasi(g))
+        {
+            return CURAND_STATUS_TYPE_ERROR;
+        }
+        const size_t n = (nBits + 31) / 32;
+        if (p == 0.0 || p == 1.0)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                output[i] = p == 0.0 ? 0 : 0xFFFFFFFFu;
+            }
+        }
+        else
+        {
+            BernoulliDigits digits(p);
+            int k = 1 - digits.exponent;
+            if (digits.mantissa == (1ull << 52) && k <= 32)
+            {
+                BernoulliPowerSample sample = { output, (size_t)k };
+                cpuCurandGenerateRejection(g, n, (size_t)k, sample);
+            }
+            else
+            {
+                std::map<size_t, BernoulliSample::State> pending;
+                std::mutex pendingMutex;
+                BernoulliSample sample = { output, &digits, &pending, &pendingMutex };
+                cpuCurandGenerateRejection(g, n, BERNOULLI_WORDS_PER_UNIT, sample);
+            }
+        }
+        if (nBits % 32 != 0)
+        {
+            output[n - 1] &= (1u << (nBits % 32)) - 1;
+        }
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * Generate exponentially distributed values with rate lambda
+     */
+    template <typename T>
+    curandStatus_t generateExponential(CpuGenerator *g, T *output, size_t n, T lambda)
+    {
+        if (!(lambda > 0))
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        ExponentialTransform<T> transform = { 1 / lambda, !cpuCurandIsQuasi(g) };
+        if (cpuCurandIsQuasi(g))
+        {
+            return generateQuasi(g, output, n, transform);
+        }
+        cpuCurandGeneratePseudo<unsigned int>(g, output, n, sizeof(T) / sizeof(float), transform);
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * Generate n values with one of the gamma based samples. These use
+     * rejection, so they are not available for quasirandom generators.
+     */
+    template <typename Sample>
+    curandStatus_t generateGammaBased(CpuGenerator *g, size_t n, size_t wordsPerUnit, const Sample &sample)
+    {
+        if (cpuCurandIsQuasi(g))
+        {
+            return CURAND_STATUS_TYPE_ERROR;
+        }
+        cpuCurandGenerateRejectionBatch(g, n, wordsPerUnit, sample);
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    curandStatus_t generateGamma(CpuGenerator *g, T *output, size_t n, T shape, T scale)
+    {
+        if (!(shape > 0 && scale > 0))
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        GammaSample<T> sample = { output, GammaSampler<T>(shape), scale };
+        return generateGammaBased(g, n, sample.gamma.uniforms() * (sizeof(T) / sizeof(float)), sample);
+    }
+
+    template <typename T>
+    curandStatus_t generateBeta(CpuGenerator *g, T *output, size_t n, T alpha, T beta)
+    {
+        if (!(alpha > 0 && beta > 0))
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        BetaSample<T> sample = { output, GammaSampler<T>(alpha), GammaSampler<T>(beta) };
+        size_t uniforms = sample.gammaAlpha.uniforms() + sample.gammaBeta.uniforms();
+        return generateGammaBased(g, n, uniforms * (sizeof(T) / sizeof(float)), sample);
+    }
+
+    template <typename T>
+    curandStatus_t generateStudentT(CpuGenerator *g, T *output, size_t n, T nu)
+    {
+        if (!(nu > 0))
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        StudentTSample<T> sample = { output, GammaSampler<T>(nu / 2), nu };
+        return generateGammaBased(g, n, (sample.gamma.uniforms() + 1) * (sizeof(T) / sizeof(float)), sample);
+    }
+
+    /**
+     * The smallest probability for which a rejection method is used
+     */
+    const double TRUNCATED_NORMAL_MIN_ACCEPTANCE = 0.25;
+
+    /**
+     * The largest number of attempts of each truncated normal sample
+     */
+    const size_t TRUNCATED_NORMAL_MAX_ATTEMPTS = 16;
+
+    /**
+     * Returns Q(x) * sqrt(2 pi) * exp(x^2 / 2) for x >= 0, which does
+     * not underflow for large x
+     */
+    double normalQScaled(double x)
+    {
+        if (x < 26.0)
+        {
+            return normalQ(x) * CPU_CURAND_SQRT2PI_DOUBLE * exp(0.5 * x * x);
+        }
+        double r = 1.0 / (x * x);
+        return (1.0 - r + 3.0 * r * r) / x;
+    }
+
+    /**
+     * Set up the given truncated normal distribution for [lo, hi], and
+     * select the method and the number of attempts
+     */
+    template <typename T>
+    void initTruncatedNormal(TruncatedNormal &d, T mean, T stddev, T lo, T hi, bool quasi)
+    {
+        d.mean = mean;
+        d.stddev = stddev;
+        d.a = ((double)lo - mean) / stddev;
+        d.b = ((double)hi - mean) / stddev;
+        d.sign = 1.0;
+        if (d.b <= 0.0)
+        {
+            double a = d.a;
+            d.a = -d.b;
+            d.b = -a;
+            d.sign = -1.0;
+        }
+        d.qa = normalQ(d.a);
+        d.qb = normalQ(d.b);
+        d.lambda = 0.5 * (d.a + sqrt(d.a * d.a + 4.0));
+        d.attempts = 1;
+
+        double acceptance = d.qa - d.qb;
+        if (quasi)
+        {
+            d.method = TRUNCATED_NORMAL_INVERSE;
+            return;
+        }
+        if (acceptance >= TRUNCATED_NORMAL_MIN_ACCEPTANCE)
+        {
+            d.method = TRUNCATED_NORMAL_NAIVE;
+        }
+        else
+        {
+            // The probability of [a, b] relative to the envelope of the
+            // exponential proposal of Robert's method
+            double t = d.a - d.lambda;
+            double tail = normalQScaled(d.a) - normalQScaled(d.b) * exp(0.5 * (d.a - d.b) * (d.a + d.b));
+            acceptance = d.a > 0.0 ? d.lambda * exp(-0.5 * t * t) * tail : 0.0;
+            if (acceptance >= 0.5)
+            {
+                d.method = TRUNCATED_NORMAL_ROBERT;
+            }
+            else if (d.qa > 1e-300 && d.qa - d.qb > 0.0)
+            {
+                d.method = TRUNCATED_NORMAL_INVERSE;
+                return;
+            }
+            else
+            {
+                // The smallest acceptance probability is that of b
+                d.method = TRUNCATED_NORMAL_UNIFORM;
+                acceptance = exp(0.5 * (d.a - d.b) * (d.a + d.b));
+            }
+        }
+
+        // Enough attempts so that less than 1% of the samples are retried.
+        // The naive method needs two of two values for each attempt, and
+        // the others need one of one value.
+        while (d.attempts < TRUNCATED_NORMAL_MAX_ATTEMPTS)
+        {
+            double r = 1.0 - acceptance;
+            double retried;
+            if (d.method == TRUNCATED_NORMAL_NAIVE)
+            {
+                double m = 2.0 * d.attempts;
+                retried = pow(r, m) + m * acceptance * pow(r, m - 1.0);
+            }
+            else
+            {
+                retried = pow(r, (double)d.attempts);
+            }
+            if (retried < 0.01)
+            {
+                break;
+            }
+            d.attempts++;
+        }
+    }
+
+    /**
+     * Generate normally distributed values that are truncated to the
+     * interval [lo, hi]
+     */
+    template <typename T>
+    curandStatus_t generateTruncatedNormal(CpuGenerator *g, T *output, size_t n,
+        T mean, T stddev, T lo, T hi)
+    {
+        if (!(stddev > 0 && lo <= hi) || (lo == hi && isinf(lo)))
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        TruncatedNormal d;
+        initTruncatedNormal(d, mean, stddev, lo, hi, cpuCurandIsQuasi(g));
+        if (d.method == TRUNCATED_NORMAL_INVERSE)
+        {
+            bool pairs = !cpuCurandIsQuasi(g) && sizeof(T) == sizeof(double);
+            TruncatedNormalInverseTransform<T> transform = { &d, lo, hi, pairs };
+            if (cpuCurandIsQuasi(g))
+            {
+                return generateQuasi(g, output, n, transform);
+            }
+            cpuCurandGeneratePseudo<unsigned int>(g, output, n, sizeof(T) / sizeof(float), transform);
+            return CURAND_STATUS_SUCCESS;
+        }
+        const size_t wordsPerUnit = 2 * d.attempts * (sizeof(T) / sizeof(float));
+        if (d.method == TRUNCATED_NORMAL_NAIVE)
+        {
+            TruncatedNormalNaiveSample<T> sample = { output, n, &d, lo, hi };
+            cpuCurandGenerateRejection(g, (n + 1) / 2, wordsPerUnit, sample);
+        }
+        else
+        {
+            TruncatedNormalTailSample<T> sample = { output, &d, lo, hi };
+            cpuCurandGenerateRejectionBatch(g, n, wordsPerUnit, sample);
+        }
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * Generate uniform floats, converted with the given function
+     */
+    curandStatus_t generateUniform16(CpuGenerator *g, unsigned short *output, size_t n,
+        void (*convert)(const float*, unsigned short*, size_t))
+    {
+        Float16Transform<UniformTransform> transform = { UniformTransform(), convert };
+        if (cpuCurandIsQuasi(g))
+        {
+            return generateQuasi(g, output, n, transform);
+        }
+        cpuCurandGeneratePseudo<unsigned int>(g, output, n, 1, transform);
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * Generate normal floats, converted with the given function
+     */
+    curandStatus_t generateNormal16(CpuGenerator *g, unsigned short *output, size_t n,
+        float mean, float stddev, void (*convert)(const float*, unsigned short*, size_t))
+    {
+        if (cpuCurandIsQuasi(g))
+        {
+            NormalQuasiTransform<float> normal = { mean, stddev, false };
+            Float16Transform<NormalQuasiTransform<float> > transform = { normal, convert };
+            return generateQuasi(g, output, n, transform);
+        }
+        if (n % 2 != 0)
+        {
+            return CURAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        NormalPseudoTransform<float> normal = { mean, stddev, false };
+        Float16Transform<NormalPseudoTransform<float> > transform = { normal, convert };
+        cpuCurandGeneratePseudo<unsigned int>(g, output, n, 1, transform);
+        return CURAND_STATUS_SUCCESS;
+    }
+}
+
+curandStatus_t cpuCurandPrepare(CpuGenerator *generator)
+{
+    if (generator == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    if (generator->engine == NULL)
+    {
+        if (generator->directionFile != NULL)
+        {
+            generator->engine = cpuCurandCreateSobolEngine(generator->type,
+                generator->directionFile->directions, generator->directionFile->bits,
+                generator->scrambling, generator->scramblingSeed);
+        }
+        else if (generator->scrambling != CURAND_SCRAMBLING_DEFAULT)
+        {
+            const void *directions = is64BitQuasi(generator) ?
+                (const void*)cpuCurandSobolDirections64(generator->dimensions) :
+                (const void*)cpuCurandSobolDirections32(generator->dimensions);
+            generator->engine = cpuCurandCreateSobolEngine(generator->type,
+                directions, is64BitQuasi(generator) ? 64 : 32,
+                generator->scrambling, generator->scramblingSeed);
+        }
+        else
+        {
+            unsigned long long seed = cpuCurandIsQuasi(generator) ?
+                generator->scramblingSeed : generator->seed;
+            generator->engine = cpuCurandCreateEngine(generator->type,
+                seed, generator->dimensions, generator->subsequence);
+        }
+        if (generator->engine == NULL)
+        {
+            return CURAND_STATUS_TYPE_ERROR;
+        }
+    }
+    return CURAND_STATUS_SUCCESS;
+}
+
+
+//=== API ====================================================================
+
+curandStatus_t CURANDAPI cpuCurandCreateGenerator(curandGenerator_t *generator, curandRngType_t rng_type)
+{
+    if (!isValidType(rng_type))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    CpuGenerator *g = new (std::nothrow) CpuGenerator();
+    if (g == NULL)
+    {
+        return CURAND_STATUS_ALLOCATION_FAILED;
+    }
+    if (rng_type == CURAND_RNG_PSEUDO_DEFAULT)
+    {
+        rng_type = CURAND_RNG_PSEUDO_XORWOW;
+    }
+    if (rng_type == CURAND_RNG_QUASI_DEFAULT)
+    {
+        rng_type = CURAND_RNG_QUASI_SOBOL32;
+    }
+    g->type = rng_type;
+    g->seed = 0;
+    g->offset = 0;
+    g->position = 0;
+    g->subsequence = 0;
+    g->ordering = cpuCurandIsQuasi(g) ?
+        CURAND_ORDERING_QUASI_DEFAULT : CURAND_ORDERING_PSEUDO_DEFAULT;
+    g->dimensions = 1;
+    g->antithetic = CURAND_ANTITHETIC_NONE;
+    g->layout = CURAND_LAYOUT_COLUMN_MAJOR;
+    g->directionFile = NULL;
+    g->scrambling = CURAND_SCRAMBLING_DEFAULT;
+    g->scramblingSeed = 0;
+    g->engine = NULL;
+    g->lanes = NULL;
+    *generator = reinterpret_cast<curandGenerator_t>(g);
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandCreateGeneratorHost(curandGenerator_t *generator, curandRngType_t rng_type)
+{
+    return cpuCurandCreateGenerator(generator, rng_type);
+}
+
+curandStatus_t CURANDAPI cpuCurandDestroyGenerator(curandGenerator_t generator)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    delete g->lanes;
+    delete g->engine;
+    delete g;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGetVersion(int *version)
+{
+    *version = CURAND_VERSION;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGetProperty(libraryPropertyType type, int *value)
+{
+    switch (type)
+    {
+        case MAJOR_VERSION: *value = CURAND_VER_MAJOR; break;
+        case MINOR_VERSION: *value = CURAND_VER_MINOR; break;
+        case PATCH_LEVEL: *value = CURAND_VER_PATCH; break;
+        default: return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetStream(curandGenerator_t generator, cudaStream_t stream)
+{
+    // There are no streams on the CPU
+    return generator == NULL ? CURAND_STATUS_NOT_INITIALIZED : CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetPseudoRandomGeneratorSeed(curandGenerator_t generator, unsigned long long seed)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    if (cpuCurandIsQuasi(g))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    g->seed = seed;
+    g->subsequence = 0;
+    invalidate(g);
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetGeneratorOffset(curandGenerator_t generator, unsigned long long offset)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    g->offset = offset;
+    rewind(g);
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetGeneratorOrdering(curandGenerator_t generator, curandOrdering_t order)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    bool quasiOrder = order == CURAND_ORDERING_QUASI_DEFAULT;
+    bool pseudoOrder = order >= CURAND_ORDERING_PSEUDO_BEST && order <= CURAND_ORDERING_PSEUDO_DYNAMIC;
+    if ((cpuCurandIsQuasi(g) && !quasiOrder) || (!cpuCurandIsQuasi(g) && !pseudoOrder))
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    g->ordering = order;
+    rewind(g);
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetQuasiRandomGeneratorDimensions(curandGenerator_t generator, unsigned int num_dimensions)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    if (!cpuCurandIsQuasi(g))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    if (num_dimensions < 1 || num_dimensions > maxDimensions(g, g->directionFile))
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    g->dimensions = num_dimensions;
+    invalidate(g);
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetGeneratorAntitheticMode(curandGenerator_t generator, curandAntitheticMode_t mode)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    if (cpuCurandIsQuasi(g))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    if (mode < CURAND_ANTITHETIC_NONE || mode > CURAND_ANTITHETIC_BLOCKED)
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    g->antithetic = mode;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetQuasiRandomGeneratorLayout(curandGenerator_t generator, curandLayout_t layout)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    if (!cpuCurandIsQuasi(g))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    if (layout != CURAND_LAYOUT_ROW_MAJOR && layout != CURAND_LAYOUT_COLUMN_MAJOR)
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    g->layout = layout;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGetGeneratorDimensions(curandGenerator_t generator, unsigned int *dimensions)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    *dimensions = cpuCurandIsQuasi(g) ? g->dimensions : 1;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerate(curandGenerator_t generator, unsigned int *outputPtr, size_t num)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    if (is64BitQuasi(g))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    if (cpuCurandIsQuasi(g))
+    {
+        return generateQuasi(g, outputPtr, num, BitsTransform());
+    }
+    cpuCurandGeneratePseudo<unsigned int>(g, outputPtr, num, 1, BitsTransform());
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateLongLong(curandGenerator_t generator, unsigned long long *outputPtr, size_t num)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    if (!is64BitQuasi(g))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return generateQuasi(g, outputPtr, num, BitsTransform());
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateUniform(curandGenerator_t generator, float *outputPtr, size_t num)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    if (cpuCurandIsQuasi(g))
+    {
+        return generateQuasi(g, outputPtr, num, UniformTransform());
+    }
+    if (g->antithetic != CURAND_ANTITHETIC_NONE)
+    {
+        return generateAntithetic(g, outputPtr, num, UniformAntitheticSample());
+    }
+    cpuCurandGeneratePseudo<unsigned int>(g, outputPtr, num, 1, UniformTransform());
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateUniformDouble(curandGenerator_t generator, double *outputPtr, size_t num)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    if (cpuCurandIsQuasi(g))
+    {
+        return generateQuasi(g, outputPtr, num, UniformDoubleTransform());
+    }
+    if (g->antithetic != CURAND_ANTITHETIC_NONE)
+    {
+        return generateAntithetic(g, outputPtr, num, UniformDoubleAntitheticSample());
+    }
+    cpuCurandGeneratePseudo<unsigned int>(g, outputPtr, num, 2, UniformDoublePseudoTransform());
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateUniformRange(curandGenerator_t generator, float *outputPtr, size_t n, float a, float b)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateUniformRange<float, UniformRangeTransform<float> >(g, outputPtr, n, a, b);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateUniformRangeDouble(curandGenerator_t generator, double *outputPtr, size_t n, double a, double b)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateUniformRange<double, UniformRangeDoublePseudoTransform>(g, outputPtr, n, a, b);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateNormal(curandGenerator_t generator, float *outputPtr, size_t n, float mean, float stddev)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateNormal(g, outputPtr, n, mean, stddev, false);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateNormalDouble(curandGenerator_t generator, double *outputPtr, size_t n, double mean, double stddev)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateNormal(g, outputPtr, n, mean, stddev, false);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateLogNormal(curandGenerator_t generator, float *outputPtr, size_t n, float mean, float stddev)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateNormal(g, outputPtr, n, mean, stddev, true);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateLogNormalDouble(curandGenerator_t generator, double *outputPtr, size_t n, double mean, double stddev)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateNormal(g, outputPtr, n, mean, stddev, true);
+}
+
+curandStatus_t CURANDAPI cpuCurandCreatePoissonDistribution(double lambda, curandDiscreteDistribution_t *discrete_distribution)
+{
+    if (!(lambda > 0.0))
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    CpuDiscreteDistribution *d = new (std::nothrow) CpuDiscreteDistribution();
+    if (d == NULL)
+    {
+        return CURAND_STATUS_ALLOCATION_FAILED;
+    }
+    d->table = createPoissonTable(lambda);
+    *discrete_distribution = reinterpret_cast<curandDiscreteDistribution_t>(d);
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandDestroyDistribution(curandDiscreteDistribution_t discrete_distribution)
+{
+    CpuDiscreteDistribution *d = reinterpret_cast<CpuDiscreteDistribution*>(discrete_distribution);
+    if (d == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    delete d;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGeneratePoisson(curandGenerator_t generator, unsigned int *outputPtr, size_t n, double lambda)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    if (!(lambda > 0.0))
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    if (!g->poissonTable || g->poissonTable->lambda != lambda)
+    {
+        g->poissonTable = createPoissonTable(lambda);
+    }
+    PoissonTransform transform = { g->poissonTable.get() };
+    if (cpuCurandIsQuasi(g))
+    {
+        return generateQuasi(g, outputPtr, n, transform);
+    }
+    cpuCurandGeneratePseudo<unsigned int>(g, outputPtr, n, 1, transform);
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateSeeds(curandGenerator_t generator)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGetDirectionVectors32(curandDirectionVectors32_t *vectors[], curandDirectionVectorSet_t set)
+{
+    // The scrambled Sobol generators use a digital shift of the
+    // unscrambled vectors, so both sets are the JOEKUO6 vectors
+    if (set != CURAND_DIRECTION_VECTORS_32_JOEKUO6 &&
+        set != CURAND_SCRAMBLED_DIRECTION_VECTORS_32_JOEKUO6)
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    const unsigned int *directions = cpuCurandSobolDirections32(CPU_CURAND_SOBOL_DIMENSIONS);
+    *vectors = reinterpret_cast<curandDirectionVectors32_t*>(const_cast<unsigned int*>(directions));
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGetScrambleConstants32(unsigned int **constants)
+{
+    *constants = const_cast<unsigned int*>(cpuCurandSobolScrambleConstants32());
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGetDirectionVectors64(curandDirectionVectors64_t *vectors[], curandDirectionVectorSet_t set)
+{
+    if (set != CURAND_DIRECTION_VECTORS_64_JOEKUO6 &&
+        set != CURAND_SCRAMBLED_DIRECTION_VECTORS_64_JOEKUO6)
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    const unsigned long long *directions = cpuCurandSobolDirections64(CPU_CURAND_SOBOL_DIMENSIONS);
+    *vectors = reinterpret_cast<curandDirectionVectors64_t*>(const_cast<unsigned long long*>(directions));
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGetScrambleConstants64(unsigned long long **constants)
+{
+    *constants = const_cast<unsigned long long*>(cpuCurandSobolScrambleConstants64());
+    return CURAND_STATUS_SUCCESS;
+}
+
+
+//=== Extensions =============================================================
+
+curandStatus_t CURANDAPI cpuCurandGenerateUniformHalf(curandGenerator_t generator, unsigned short *outputPtr, size_t num)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateUniform16(g, outputPtr, num, cpuCurandConvertToHalf);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateUniformBF16(curandGenerator_t generator, unsigned short *outputPtr, size_t num)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateUniform16(g, outputPtr, num, cpuCurandConvertToBFloat16);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateNormalHalf(curandGenerator_t generator, unsigned short *outputPtr, size_t n, float mean, float stddev)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateNormal16(g, outputPtr, n, mean, stddev, cpuCurandConvertToHalf);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateNormalBF16(curandGenerator_t generator, unsigned short *outputPtr, size_t n, float mean, float stddev)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateNormal16(g, outputPtr, n, mean, stddev, cpuCurandConvertToBFloat16);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateIntRange(curandGenerator_t generator, int *outputPtr, size_t n, int lo, int hi)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateRange(g, outputPtr, n, lo, hi);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateLongLongRange(curandGenerator_t generator, long long *outputPtr, size_t n, long long lo, long long hi)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateRange(g, outputPtr, n, lo, hi);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateBernoulliBits(curandGenerator_t generator, unsigned int *outputPtr, size_t nBits, double p)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateBernoulliBits(g, outputPtr, nBits, p);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateExponential(curandGenerator_t generator, float *outputPtr, size_t n, float lambda)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateExponential(g, outputPtr, n, lambda);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateExponentialDouble(curandGenerator_t generator, double *outputPtr, size_t n, double lambda)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateExponential(g, outputPtr, n, lambda);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateGamma(curandGenerator_t generator, float *outputPtr, size_t n, float shape, float scale)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateGamma(g, outputPtr, n, shape, scale);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateGammaDouble(curandGenerator_t generator, double *outputPtr, size_t n, double shape, double scale)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateGamma(g, outputPtr, n, shape, scale);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateBeta(curandGenerator_t generator, float *outputPtr, size_t n, float alpha, float beta)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateBeta(g, outputPtr, n, alpha, beta);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateBetaDouble(curandGenerator_t generator, double *outputPtr, size_t n, double alpha, double beta)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateBeta(g, outputPtr, n, alpha, beta);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateChiSquared(curandGenerator_t generator, float *outputPtr, size_t n, float k)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateGamma(g, outputPtr, n, k / 2, 2.0f);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateChiSquaredDouble(curandGenerator_t generator, double *outputPtr, size_t n, double k)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateGamma(g, outputPtr, n, k / 2, 2.0);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateStudentT(curandGenerator_t generator, float *outputPtr, size_t n, float nu)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateStudentT(g, outputPtr, n, nu);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateStudentTDouble(curandGenerator_t generator, double *outputPtr, size_t n, double nu)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateStudentT(g, outputPtr, n, nu);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateTruncatedNormal(curandGenerator_t generator, float *outputPtr, size_t n, float mean, float stddev, float lo, float hi)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateTruncatedNormal(g, outputPtr, n, mean, stddev, lo, hi);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateTruncatedNormalDouble(curandGenerator_t generator, double *outputPtr, size_t n, double mean, double stddev, double lo, double hi)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateTruncatedNormal(g, outputPtr, n, mean, stddev, lo, hi);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateUniform2D(curandGenerator_t generator, float *outputPtr, size_t rows, size_t cols, size_t pitch)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateUniform2D(g, outputPtr, rows, cols, pitch, UniformTransform(), UniformTransform());
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateUniformDouble2D(curandGenerator_t generator, double *outputPtr, size_t rows, size_t cols, size_t pitch)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateUniform2D(g, outputPtr, rows, cols, pitch, UniformDoubleTransform(), UniformDoublePseudoTransform());
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateNormal2D(curandGenerator_t generator, float *outputPtr, size_t rows, size_t cols, size_t pitch, float mean, float stddev)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateNormal2D(g, outputPtr, rows, cols, pitch, mean, stddev, false);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateNormalDouble2D(curandGenerator_t generator, double *outputPtr, size_t rows, size_t cols, size_t pitch, double mean, double stddev)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateNormal2D(g, outputPtr, rows, cols, pitch, mean, stddev, false);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateLogNormal2D(curandGenerator_t generator, float *outputPtr, size_t rows, size_t cols, size_t pitch, float mean, float stddev)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateNormal2D(g, outputPtr, rows, cols, pitch, mean, stddev, true);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateLogNormalDouble2D(curandGenerator_t generator, double *outputPtr, size_t rows, size_t cols, size_t pitch, double mean, double stddev)
+{
+    CPU_CURAND_PREPARE(g, generator);
+    return generateNormal2D(g, outputPtr, rows, cols, pitch, mean, stddev, true);
+}
+
+curandStatus_t CURANDAPI cpuCurandSetGeneratorConcurrent(curandGenerator_t generator, int concurrent)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    if (!cpuCurandHasSubsequences(g->type))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    if (!concurrent)
+    {
+        if (g->lanes != NULL)
+        {
+            g->lanes->active = false;
+        }
+        return CURAND_STATUS_SUCCESS;
+    }
+    if (g->lanes == NULL)
+    {
+        g->lanes = new (std::nothrow) CpuLanes();
+        if (g->lanes == NULL)
+        {
+            return CURAND_STATUS_ALLOCATION_FAILED;
+        }
+    }
+    else if (!g->lanes->active)
+    {
+        std::lock_guard<std::mutex> lock(g->lanes->mutex);
+        g->lanes->session++;
+        g->lanes->nextIndex = 0;
+        g->lanes->active = true;
+    }
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetGeneratorThreadLane(curandGenerator_t generator, unsigned int lane)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    if (g->lanes == NULL || !g->lanes->active)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    CpuLane *&threadEntry = threadLane(g->lanes);
+    if (threadEntry == NULL)
+    {
+        std::lock_guard<std::mutex> lock(g->lanes->mutex);
+        threadEntry = addLane(g->lanes, lane);
+        return CURAND_STATUS_SUCCESS;
+    }
+    threadEntry->index = lane;
+    threadEntry->session = g->lanes->session;
+    threadEntry->generator.position = 0;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandPhiloxUniform(unsigned long long seed, unsigned long long subsequence, unsigned long long offset, float *outputPtr, size_t num)
+{
+    philoxGenerate(seed, subsequence, offset, outputPtr, num, 1, UniformTransform());
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandPhiloxUniformDouble(unsigned long long seed, unsigned long long subsequence, unsigned long long offset, double *outputPtr, size_t num)
+{
+    philoxGenerate(seed, subsequence, offset, outputPtr, num, 2, UniformDoublePseudoTransform());
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandPhiloxUniformGather(unsigned long long seed, unsigned long long subsequence, const unsigned long long *offsets, float *outputPtr, size_t num)
+{
+    philoxGather(seed, subsequence, offsets, outputPtr, num, 1, UniformTransform());
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandPhiloxUniformDoubleGather(unsigned long long seed, unsigned long long subsequence, const unsigned long long *offsets, double *outputPtr, size_t num)
+{
+    philoxGather(seed, subsequence, offsets, outputPtr, num, 2, UniformDoublePseudoTransform());
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandDeriveStreamSubsequence(const unsigned long long *path, unsigned int depth, unsigned long long *subsequence)
+{
+    if (path == NULL && depth > 0)
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    *subsequence = deriveSubsequence(path, depth);
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetGeneratorStream(curandGenerator_t generator, unsigned long long seed, const unsigned long long *path, unsigned int depth)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    if (!cpuCurandHasSubsequences(g->type))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    if (path == NULL && depth > 0)
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    g->seed = seed;
+    g->subsequence = deriveSubsequence(path, depth);
+    invalidate(g);
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetGeneratorStreams(const curandGenerator_t *generators, unsigned int count, unsigned long long seed, const unsigned long long *paths, unsigned int depth)
+{
+    for (unsigned int i = 0; i < count; i++)
+    {
+        curandStatus_t status = cpuCurandSetGeneratorStream(
+            generators[i], seed, paths + (size_t)i * depth, depth);
+        if (status != CURAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetQuasiRandomGeneratorDirectionFile(curandGenerator_t generator, curandDirectionFile_t file)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    unsigned int bits = is64BitQuasi(g) ? 64 : 32;
+    if (!isSobol(g) || (file != NULL && file->bits != bits))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    if (g->dimensions > maxDimensions(g, file))
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    g->directionFile = file;
+    invalidate(g);
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandSetQuasiRandomGeneratorScrambling(curandGenerator_t generator, curandScramblingMode_t mode, unsigned long long seed)
+{
+    CpuGenerator *g = toCpuGenerator(generator);
+    if (g == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    if (!cpuCurandIsQuasi(g) || (mode == CURAND_SCRAMBLING_OWEN && !isSobol(g)))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    if (mode != CURAND_SCRAMBLING_DEFAULT && mode != CURAND_SCRAMBLING_OWEN)
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    g->scrambling = mode;
+    g->scramblingSeed = seed;
+    invalidate(g);
+    return CURAND_STATUS_SUCCESS;
+}
@@ -0,0 +1,159 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_CPU_CURAND
+#define JCURAND_CPU_CURAND
+
+#include <curand.h>
+#include "JCurandExtensions.hpp"
+
+/**
+ * An emulation of the CURAND host API on the CPU, for systems that
+ * do not have a CUDA capable device. All functions have the same
+ * signatures and the same semantics as the CURAND functions with the
+ * same name (without the 'cpu' prefix), with the following
+ * differences:
+ *
+ * - All generators are host generators: The output pointers must
+ *   point to host memory, and curandSetStream has no effect.
+ * - The sequences are statistically equivalent to, but not the same
+ *   as the sequences of CURAND. The orderings of pseudorandom
+ *   generators do not affect the sequence.
+ * - MTGP32 generators are emulated with MT19937.
+ * - The Sobol generators use the CPU_CURAND_SOBOL_DIMENSIONS (20000)
+ *   dimensions of the JOEKUO6 direction vectors of CURAND. More
+ *   dimensions need a direction file. The scrambled Sobol
+ *   generators use a digital shift of these vectors, unless the Owen
+ *   scrambling is enabled, because the scrambled direction vectors
+ *   and scramble constants of CURAND are not published.
+ * - curandGetDirectionVectors32/64 return the JOEKUO6 direction vectors
+ *   for both the unscrambled and the scrambled sets, and
+ *   curandGetScrambleConstants32/64 return the digital shifts of the
+ *   scrambled Sobol generators of this backend. Together they give the
+ *   scrambled sequences of this backend, not those of CURAND.
+ * - The additional quasirandom types CURAND_RNG_QUASI_HALTON and
+ *   CURAND_RNG_QUASI_LATTICE are supported.
+ *
+ * The random access engines (XORWOW, MRG32k3a, Philox and Sobol)
+ * generate in parallel, with results that do not depend on the
+ * number of threads.
+ */
+
+curandStatus_t CURANDAPI cpuCurandCreateGenerator(curandGenerator_t *generator, curandRngType_t rng_type);
+curandStatus_t CURANDAPI cpuCurandCreateGeneratorHost(curandGenerator_t *generator, curandRngType_t rng_type);
+curandStatus_t CURANDAPI cpuCurandDestroyGenerator(curandGenerator_t generator);
+curandStatus_t CURANDAPI cpuCurandGetVersion(int *version);
+curandStatus_t CURANDAPI cpuCurandGetProperty(libraryPropertyType type, int *value);
+curandStatus_t CURANDAPI cpuCurandSetStream(curandGenerator_t generator, cudaStream_t stream);
+curandStatus_t CURANDAPI cpuCurandSetPseudoRandomGeneratorSeed(curandGenerator_t generator, unsigned long long seed);
+curandStatus_t CURANDAPI cpuCurandSetGeneratorOffset(curandGenerator_t generator, unsigned long long offset);
+curandStatus_t CURANDAPI cpuCurandSetGeneratorOrdering(curandGenerator_t generator, curandOrdering_t order);
+curandStatus_t CURANDAPI cpuCurandSetQuasiRandomGeneratorDimensions(curandGenerator_t generator, unsigned int num_dimensions);
+curandStatus_t CURANDAPI cpuCurandGenerate(curandGenerator_t generator, unsigned int *outputPtr, size_t num);
+curandStatus_t CURANDAPI cpuCurandGenerateLongLong(curandGenerator_t generator, unsigned long long *outputPtr, size_t num);
+curandStatus_t CURANDAPI cpuCurandGenerateUniform(curandGenerator_t generator, float *outputPtr, size_t num);
+curandStatus_t CURANDAPI cpuCurandGenerateUniformDouble(curandGenerator_t generator, double *outputPtr, size_t num);
+curandStatus_t CURANDAPI cpuCurandGenerateNormal(curandGenerator_t generator, float *outputPtr, size_t n, float mean, float stddev);
+curandStatus_t CURANDAPI cpuCurandGenerateNormalDouble(curandGenerator_t generator, double *outputPtr, size_t n, double mean, double stddev);
+curandStatus_t CURANDAPI cpuCurandGenerateLogNormal(curandGenerator_t generator, float *outputPtr, size_t n, float mean, float stddev);
+curandStatus_t CURANDAPI cpuCurandGenerateLogNormalDouble(curandGenerator_t generator, double *outputPtr, size_t n, double mean, double stddev);
+curandStatus_t CURANDAPI cpuCurandCreatePoissonDistribution(double lambda, curandDiscreteDistribution_t *discrete_distribution);
+curandStatus_t CURANDAPI cpuCurandDestroyDistribution(curandDiscreteDistribution_t discrete_distribution);
+curandStatus_t CURANDAPI cpuCurandGeneratePoisson(curandGenerator_t generator, unsigned int *outputPtr, size_t n, double lambda);
+curandStatus_t CURANDAPI cpuCurandGenerateSeeds(curandGenerator_t generator);
+curandStatus_t CURANDAPI cpuCurandGetDirectionVectors32(curandDirectionVectors32_t *vectors[], curandDirectionVectorSet_t set);
+curandStatus_t CURANDAPI cpuCurandGetScrambleConstants32(unsigned int **constants);
+curandStatus_t CURANDAPI cpuCurandGetDirectionVectors64(curandDirectionVectors64_t *vectors[], curandDirectionVectorSet_t set);
+curandStatus_t CURANDAPI cpuCurandGetScrambleConstants64(unsigned long long **constants);
+
+/**
+ * Extensions of the CURAND host API. They follow the conventions of
+ * the CURAND functions: Quasirandom generators return the values in
+ * dimension-major order, and the functions return a curandStatus_t.
+ */
+curandStatus_t CURANDAPI cpuCurandGenerateUniformHalf(curandGenerator_t generator, unsigned short *outputPtr, size_t num);
+curandStatus_t CURANDAPI cpuCurandGenerateUniformBF16(curandGenerator_t generator, unsigned short *outputPtr, size_t num);
+curandStatus_t CURANDAPI cpuCurandGenerateNormalHalf(curandGenerator_t generator, unsigned short *outputPtr, size_t n, float mean, float stddev);
+curandStatus_t CURANDAPI cpuCurandGenerateNormalBF16(curandGenerator_t generator, unsigned short *outputPtr, size_t n, float mean, float stddev);
+curandStatus_t CURANDAPI cpuCurandGenerateIntRange(curandGenerator_t generator, int *outputPtr, size_t n, int lo, int hi);
+curandStatus_t CURANDAPI cpuCurandGenerateLongLongRange(curandGenerator_t generator, long long *outputPtr, size_t n, long long lo, long long hi);
+curandStatus_t CURANDAPI cpuCurandGenerateBernoulliBits(curandGenerator_t generator, unsigned int *outputPtr, size_t nBits, double p);
+curandStatus_t CURANDAPI cpuCurandGenerateExponential(curandGenerator_t generator, float *outputPtr, size_t n, float lambda);
+curandStatus_t CURANDAPI cpuCurandGenerateExponentialDouble(curandGenerator_t generator, double *outputPtr, size_t n, double lambda);
+curandStatus_t CURANDAPI cpuCurandGenerateGamma(curandGenerator_t generator, float *outputPtr, size_t n, float shape, float scale);
+curandStatus_t CURANDAPI cpuCurandGenerateGammaDouble(curandGenerator_t generator, double *outputPtr, size_t n, double shape, double scale);
+curandStatus_t CURANDAPI cpuCurandGenerateBeta(curandGenerator_t generator, float *outputPtr, size_t n, float alpha, float beta);
+curandStatus_t CURANDAPI cpuCurandGenerateBetaDouble(curandGenerator_t generator, double *outputPtr, size_t n, double alpha, double beta);
+curandStatus_t CURANDAPI cpuCurandGenerateChiSquared(curandGenerator_t generator, float *outputPtr, size_t n, float k);
+curandStatus_t CURANDAPI cpuCurandGenerateChiSquaredDouble(curandGenerator_t generator, double *outputPtr, size_t n, double k);
+curandStatus_t CURANDAPI cpuCurandGenerateStudentT(curandGenerator_t generator, float *outputPtr, size_t n, float nu);
+curandStatus_t CURANDAPI cpuCurandGenerateStudentTDouble(curandGenerator_t generator, double *outputPtr, size_t n, double nu);
+curandStatus_t CURANDAPI cpuCurandGenerateTruncatedNormal(curandGenerator_t generator, float *outputPtr, size_t n, float mean, float stddev, float lo, float hi);
+curandStatus_t CURANDAPI cpuCurandGenerateTruncatedNormalDouble(curandGenerator_t generator, double *outputPtr, size_t n, double mean, double stddev, double lo, double hi);
+curandStatus_t CURANDAPI cpuCurandCreateMultivariateNormal(curandMultivariateNormal_t *distribution, unsigned int dimensions, const double *mean, const double *matrix, curandMatrixType_t matrixType);
+curandStatus_t CURANDAPI cpuCurandDestroyMultivariateNormal(curandMultivariateNormal_t distribution);
+curandStatus_t CURANDAPI cpuCurandGenerateMultivariateNormal(curandGenerator_t generator, float *outputPtr, size_t n, curandMultivariateNormal_t distribution, curandLayout_t layout);
+curandStatus_t CURANDAPI cpuCurandGenerateMultivariateNormalDouble(curandGenerator_t generator, double *outputPtr, size_t n, curandMultivariateNormal_t distribution, curandLayout_t layout);
+curandStatus_t CURANDAPI cpuCurandGeneratePermutation(curandGenerator_t generator, int *outputPtr, size_t n);
+curandStatus_t CURANDAPI cpuCurandGeneratePermutationLongLong(curandGenerator_t generator, long long *outputPtr, size_t n);
+curandStatus_t CURANDAPI cpuCurandSampleWithoutReplacement(curandGenerator_t generator, int *outputPtr, size_t n, size_t k);
+curandStatus_t CURANDAPI cpuCurandSampleWithoutReplacementLongLong(curandGenerator_t generator, long long *outputPtr, size_t n, size_t k);
+curandStatus_t CURANDAPI cpuCurandCreateBrownianBridge(curandBrownianBridge_t *bridge, unsigned int steps, const double *times);
+curandStatus_t CURANDAPI cpuCurandDestroyBrownianBridge(curandBrownianBridge_t bridge);
+curandStatus_t CURANDAPI cpuCurandTransformBrownianBridge(curandBrownianBridge_t bridge, float *data, size_t n);
+curandStatus_t CURANDAPI cpuCurandTransformBrownianBridgeDouble(curandBrownianBridge_t bridge, double *data, size_t n);
+curandStatus_t CURANDAPI cpuCurandGenerateBrownianBridge(curandGenerator_t generator, float *outputPtr, size_t n, curandBrownianBridge_t bridge, curandLayout_t layout);
+curandStatus_t CURANDAPI cpuCurandGenerateBrownianBridgeDouble(curandGenerator_t generator, double *outputPtr, size_t n, curandBrownianBridge_t bridge, curandLayout_t layout);
+curandStatus_t CURANDAPI cpuCurandSetGeneratorAntitheticMode(curandGenerator_t generator, curandAntitheticMode_t mode);
+curandStatus_t CURANDAPI cpuCurandGenerateUniform2D(curandGenerator_t generator, float *outputPtr, size_t rows, size_t cols, size_t pitch);
+curandStatus_t CURANDAPI cpuCurandGenerateUniformDouble2D(curandGenerator_t generator, double *outputPtr, size_t rows, size_t cols, size_t pitch);
+curandStatus_t CURANDAPI cpuCurandGenerateNormal2D(curandGenerator_t generator, float *outputPtr, size_t rows, size_t cols, size_t pitch, float mean, float stddev);
+curandStatus_t CURANDAPI cpuCurandGenerateNormalDouble2D(curandGenerator_t generator, double *outputPtr, size_t rows, size_t cols, size_t pitch, double mean, double stddev);
+curandStatus_t CURANDAPI cpuCurandGenerateLogNormal2D(curandGenerator_t generator, float *outputPtr, size_t rows, size_t cols, size_t pitch, float mean, float stddev);
+curandStatus_t CURANDAPI cpuCurandGenerateLogNormalDouble2D(curandGenerator_t generator, double *outputPtr, size_t rows, size_t cols, size_t pitch, double mean, double stddev);
+curandStatus_t CURANDAPI cpuCurandSetQuasiRandomGeneratorLayout(curandGenerator_t generator, curandLayout_t layout);
+curandStatus_t CURANDAPI cpuCurandSetGeneratorConcurrent(curandGenerator_t generator, int concurrent);
+curandStatus_t CURANDAPI cpuCurandSetGeneratorThreadLane(curandGenerator_t generator, unsigned int lane);
+curandStatus_t CURANDAPI cpuCurandPhiloxUniform(unsigned long long seed, unsigned long long subsequence, unsigned long long offset, float *outputPtr, size_t num);
+curandStatus_t CURANDAPI cpuCurandPhiloxUniformDouble(unsigned long long seed, unsigned long long subsequence, unsigned long long offset, double *outputPtr, size_t num);
+curandStatus_t CURANDAPI cpuCurandPhiloxUniformGather(unsigned long long seed, unsigned long long subsequence, const unsigned long long *offsets, float *outputPtr, size_t num);
+curandStatus_t CURANDAPI cpuCurandPhiloxUniformDoubleGather(unsigned long long seed, unsigned long long subsequence, const unsigned long long *offsets, double *outputPtr, size_t num);
+curandStatus_t CURANDAPI cpuCurandDeriveStreamSubsequence(const unsigned long long *path, unsigned int depth, unsigned long long *subsequence);
+curandStatus_t CURANDAPI cpuCurandSetGeneratorStream(curandGenerator_t generator, unsigned long long seed, const unsigned long long *path, unsigned int depth);
+curandStatus_t CURANDAPI cpuCurandSetGeneratorStreams(const curandGenerator_t *generators, unsigned int count, unsigned long long seed, const unsigned long long *paths, unsigned int depth);
+curandStatus_t CURANDAPI cpuCurandWriteDirectionFile(const char *joeKuoPath, const char *path, unsigned int bits, unsigned int dimensions);
+curandStatus_t CURANDAPI cpuCurandLoadDirectionFile(curandDirectionFile_t *file, const char *path);
+curandStatus_t CURANDAPI cpuCurandDestroyDirectionFile(curandDirectionFile_t file);
+curandStatus_t CURANDAPI cpuCurandSetQuasiRandomGeneratorDirectionFile(curandGenerator_t generator, curandDirectionFile_t file);
+curandStatus_t CURANDAPI cpuCurandSetQuasiRandomGeneratorScrambling(curandGenerator_t generator, curandScramblingMode_t mode, unsigned long long seed);
+curandStatus_t CURANDAPI cpuCurandGenerateLatinHypercube(curandGenerator_t generator, double *outputPtr, size_t n, unsigned int dimensions, curandLatinHypercubeMode_t mode, curandLayout_t layout);
+curandStatus_t CURANDAPI cpuCurandGenerateUniformRange(curandGenerator_t generator, float *outputPtr, size_t n, float a, float b);
+curandStatus_t CURANDAPI cpuCurandGenerateUniformRangeDouble(curandGenerator_t generator, double *outputPtr, size_t n, double a, double b);
+curandStatus_t CURANDAPI cpuCurandGetGeneratorDimensions(curandGenerator_t generator, unsigned int *dimensions);
+
+#endif
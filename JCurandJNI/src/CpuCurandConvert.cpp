@@ -0,0 +1,136 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CpuCurandConvert.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CPU_CURAND_F16C
+#if (defined(__clang__) && __clang_major__ >= 9) || (!defined(__clang__) && __GNUC__ >= 9)
+#define CPU_CURAND_AVX512_BF16
+#endif
+#endif
+
+namespace
+{
+    typedef void (*ConvertFunction)(const float *input, unsigned short *output, size_t n);
+
+    void convertToHalfScalar(const float *input, unsigned short *output, size_t n)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            output[i] = cpuCurandFloatToHalf(input[i]);
+        }
+    }
+
+    void convertToBFloat16Scalar(const float *input, unsigned short *output, size_t n)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            output[i] = cpuCurandFloatToBFloat16(input[i]);
+        }
+    }
+
+#ifdef CPU_CURAND_F16C
+    __attribute__((target("avx,f16c")))
+    void convertToHalfF16C(const float *input, unsigned short *output, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 x = _mm256_loadu_ps(input + i);
+            __m128i h = _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            _mm_storeu_si128((__m128i*)(output + i), h);
+        }
+        convertToHalfScalar(input + i, output + i, n - i);
+    }
+#endif
+
+#ifdef CPU_CURAND_AVX512_BF16
+    /**
+     * The conversion instruction flushes subnormal inputs to zero, so
+     * blocks that contain subnormal values are converted by the scalar
+     * function, to obtain the same results on all CPUs
+     */
+    __attribute__((target("avx512f,avx512bf16")))
+    void convertToBFloat16Avx512(const float *input, unsigned short *output, size_t n)
+    {
+        const __m512 minNormal = _mm512_set1_ps(1.17549435e-38f);
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            __m512 x = _mm512_loadu_ps(input + i);
+            __m512 a = _mm512_abs_ps(x);
+            __mmask16 subnormal = _mm512_cmp_ps_mask(a, minNormal, _CMP_LT_OQ) &
+                _mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_NEQ_OQ);
+            if (subnormal != 0)
+            {
+                convertToBFloat16Scalar(input + i, output + i, 16);
+                continue;
+            }
+            __m256bh b = _mm512_cvtneps_pbh(x);
+            _mm256_storeu_si256((__m256i*)(output + i), (__m256i)b);
+        }
+        convertToBFloat16Scalar(input + i, output + i, n - i);
+    }
+#endif
+
+    ConvertFunction selectConvertToHalf()
+    {
+#ifdef CPU_CURAND_F16C
+        if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c"))
+        {
+            return convertToHalfF16C;
+        }
+#endif
+        return convertToHalfScalar;
+    }
+
+    ConvertFunction selectConvertToBFloat16()
+    {
+#ifdef CPU_CURAND_AVX512_BF16
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bf16"))
+        {
+            return convertToBFloat16Avx512;
+        }
+#endif
+        return convertToBFloat16Scalar;
+    }
+}
+
+void cpuCurandConvertToHalf(const float *input, unsigned short *output, size_t n)
+{
+    static const ConvertFunction convert = selectConvertToHalf();
+    convert(input, output, n);
+}
+
+void cpuCurandConvertToBFloat16(const float *input, unsigned short *output, size_t n)
+{
+    static const ConvertFunction convert = selectConvertToBFloat16();
+    convert(input, output, n);
+}
@@ -0,0 +1,119 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_CPU_CURAND_CONVERT
+#define JCURAND_CPU_CURAND_CONVERT
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * Conversions of float values into 16 bit floating point formats,
+ * with rounding to the nearest value (ties to even). The results
+ * are the raw bits of IEEE half precision values or of bfloat16
+ * values (the upper half of a float).
+ */
+
+/**
+ * Converts the given float into the bits of the nearest half value.
+ * Values whose magnitude is at least 65520 become infinity, and NaN
+ * becomes a quiet NaN.
+ */
+inline unsigned short cpuCurandFloatToHalf(float f)
+{
+    unsigned int x;
+    memcpy(&x, &f, sizeof(x));
+    unsigned int sign = (x >> 16) & 0x8000u;
+    x &= 0x7FFFFFFFu;
+    if (x > 0x7F800000u)
+    {
+        return (unsigned short)(sign | 0x7E00u | ((x >> 13) & 0x3FFu));
+    }
+    if (x >= 0x477FF000u)
+    {
+        return (unsigned short)(sign | 0x7C00u);
+    }
+    if (x < 0x38800000u)
+    {
+        // The result is a subnormal half value, in units of 2^-24
+        if (x < 0x33000000u)
+        {
+            return (unsigned short)sign;
+        }
+        unsigned int shift = 126 - (x >> 23);
+        unsigned int mantissa = (x & 0x7FFFFFu) | 0x800000u;
+        unsigned int result = mantissa >> shift;
+        unsigned int remainder = mantissa & ((1u << shift) - 1);
+        unsigned int halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (result & 1)))
+        {
+            result++;
+        }
+        return (unsigned short)(sign | result);
+    }
+    // Rebias the exponent. A carry of the rounding propagates into
+    // the exponent, which gives the correct result.
+    x -= 0x38000000u;
+    unsigned int result = x >> 13;
+    unsigned int remainder = x & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (result & 1)))
+    {
+        result++;
+    }
+    return (unsigned short)(sign | result);
+}
+
+/**
+ * Converts the given float into the bits of the nearest bfloat16
+ * value. NaN becomes a quiet NaN.
+ */
+inline unsigned short cpuCurandFloatToBFloat16(float f)
+{
+    unsigned int x;
+    memcpy(&x, &f, sizeof(x));
+    if ((x & 0x7FFFFFFFu) > 0x7F800000u)
+    {
+        return (unsigned short)((x >> 16) | 0x40u);
+    }
+    x += 0x7FFFu + ((x >> 16) & 1);
+    return (unsigned short)(x >> 16);
+}
+
+/**
+ * Converts the given floats into half values. This uses the F16C
+ * instructions when the CPU supports them.
+ */
+void cpuCurandConvertToHalf(const float *input, unsigned short *output, size_t n);
+
+/**
+ * Converts the given floats into bfloat16 values. This uses the
+ * AVX-512-BF16 instructions when the CPU supports them.
+ */
+void cpuCurandConvertToBFloat16(const float *input, unsigned short *output, size_t n);
+
+#endif
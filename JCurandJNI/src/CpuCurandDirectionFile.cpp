@@ -0,0 +1,379 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CpuCurand.hpp"
+#include "CpuCurandEngines.hpp"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//=== Direction files ========================================================
+
+namespace
+{
+    /**
+     * The header of a direction file. It is followed by the direction
+     * vectors, as 'bits' words of 'bits' bits for each dimension, in
+     * the byte order of the platform that wrote the file. The header
+     * is 64 bytes long, so that the vectors are aligned.
+     */
+    struct DirectionFileHeader
+    {
+        char magic[8];
+        unsigned int byteOrder;
+        unsigned int version;
+        unsigned int bits;
+        unsigned int dimensions;
+        char reserved[40];
+    };
+
+    const char DIRECTION_FILE_MAGIC[8] = { 'J', 'C', 'U', 'R', 'S', 'O', 'B', 'L' };
+    const unsigned int DIRECTION_FILE_BYTE_ORDER = 0x01020304;
+    const unsigned int DIRECTION_FILE_VERSION = 1;
+
+    /**
+     * Returns the size of a direction file with the given header, or 0
+     * if the header is not valid
+     */
+    unsigned long long directionFileSize(const DirectionFileHeader &header)
+    {
+        if (memcmp(header.magic, DIRECTION_FILE_MAGIC, sizeof(DIRECTION_FILE_MAGIC)) != 0 ||
+            header.byteOrder != DIRECTION_FILE_BYTE_ORDER ||
+            header.version != DIRECTION_FILE_VERSION ||
+            (header.bits != 32 && header.bits != 64) ||
+            header.dimensions < 1)
+        {
+            return 0;
+        }
+        return sizeof(DirectionFileHeader) +
+            (unsigned long long)header.dimensions * header.bits * (header.bits / 8);
+    }
+
+    /**
+     * Map the whole file with the given path into memory, read-only.
+     * Returns NULL if this is not possible.
+     */
+    void *mapFile(const char *path, size_t *size)
+    {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return NULL;
+        }
+        LARGE_INTEGER fileSize;
+        void *data = NULL;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+        {
+            HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (mapping != NULL)
+            {
+                data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);
+                *size = (size_t)fileSize.QuadPart;
+            }
+        }
+        CloseHandle(file);
+        return data;
+#else
+        int fd = open(path, O_RDONLY);
+        if (fd < 0)
+        {
+            return NULL;
+        }
+        struct stat status;
+        void *data = NULL;
+        if (fstat(fd, &status) == 0 && status.st_size > 0)
+        {
+            data = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                data = NULL;
+            }
+            *size = (size_t)status.st_size;
+        }
+        close(fd);
+        return data;
+#endif
+    }
+
+    void unmapFile(void *data, size_t size)
+    {
+#ifdef _WIN32
+        (void)size;
+        UnmapViewOfFile(data);
+#else
+        munmap(data, size);
+#endif
+    }
+
+    /**
+     * One line of a table of direction numbers in the format of Joe and
+     * Kuo: The dimension d (starting at 2), the degree s and the
+     * coefficients a of the primitive polynomial, and the initial
+     * direction numbers m_1 ... m_s.
+     */
+    struct JoeKuoLine
+    {
+        int degree;
+        unsigned int coefficients;
+        unsigned long long m[32];
+    };
+
+    /**
+     * Parse the next line with direction numbers from the given file.
+     * Lines that do not start with a number, like the header line of
+     * the tables by Joe and Kuo, are skipped. Returns 1 if a line was
+     * parsed, 0 at the end of the file, and -1 for an invalid line.
+     */
+    int readJoeKuoLine(FILE *file, std::vector<char> &buffer, JoeKuoLine &line)
+    {
+        while (true)
+        {
+            size_t length = 0;
+            while (true)
+            {
+                if (fgets(buffer.data() + length, (int)(buffer.size() - length), file) == NULL)
+                {
+                    if (length == 0)
+                    {
+                        return 0;
+                    }
+                    break;
+                }
+                length += strlen(buffer.data() + length);
+                if (buffer[length - 1] == '\n')
+                {
+                    break;
+                }
+                buffer.resize(buffer.size() * 2);
+            }
+            const char *p = buffer.data();
+            while (isspace((unsigned char)*p))
+            {
+                p++;
+            }
+            if (!isdigit((unsigned char)*p))
+            {
+                continue;
+            }
+            char *end = NULL;
+            strtoul(p, &end, 10);
+            unsigned long degree = strtoul(end, &end, 10);
+            unsigned long coefficients = strtoul(end, &end, 10);
+            if (degree < 1 || degree > 31 || coefficients >= (1UL << (degree - 1)))
+            {
+                return -1;
+            }
+            line.degree = (int)degree;
+            line.coefficients = (unsigned int)coefficients;
+            for (int k = 0; k < line.degree; k++)
+            {
+                const char *start = end;
+                unsigned long long m = strtoull(start, &end, 10);
+                if (end == start || (m & 1) == 0 || m >= (2ULL << k))
+                {
+                    return -1;
+                }
+                line.m[k] = m;
+            }
+            return 1;
+        }
+    }
+
+    /**
+     * Write the direction vectors of one dimension with the given
+     * number of bits. The given 64 bit vectors are truncated to their
+     * upper bits, like for the built-in direction vectors.
+     */
+    bool writeDirections(FILE *file, const unsigned long long *v, unsigned int bits)
+    {
+        if (bits == 64)
+        {
+            return fwrite(v, sizeof(unsigned long long), 64, file) == 64;
+        }
+        unsigned int v32[32];
+        for (int k = 0; k < 32; k++)
+        {
+            v32[k] = (unsigned int)(v[k] >> 32);
+        }
+        return fwrite(v32, sizeof(unsigned int), 32, file) == 32;
+    }
+
+    curandStatus_t writeDirectionFile(FILE *input, FILE *output, unsigned int bits, unsigned int dimensions)
+    {
+        DirectionFileHeader header;
+        memset(&header, 0, sizeof(header));
+        if (fwrite(&header, sizeof(header), 1, output) != 1)
+        {
+            return CURAND_STATUS_INTERNAL_ERROR;
+        }
+
+        // The first dimension is the van der Corput sequence
+        unsigned long long v[64];
+        for (int k = 0; k < 64; k++)
+        {
+            v[k] = 1ULL << (63 - k);
+        }
+        if (!writeDirections(output, v, bits))
+        {
+            return CURAND_STATUS_INTERNAL_ERROR;
+        }
+        unsigned int written = 1;
+        std::vector<char> buffer(1024);
+        JoeKuoLine line;
+        while (dimensions == 0 || written < dimensions)
+        {
+            int result = readJoeKuoLine(input, buffer, line);
+            if (result < 0)
+            {
+                return CURAND_STATUS_OUT_OF_RANGE;
+            }
+            if (result == 0)
+            {
+                break;
+            }
+            for (int k = 0; k < line.degree; k++)
+            {
+                v[k] = line.m[k] << (63 - k);
+            }
+            unsigned int polynomial = (1U << line.degree) | (line.coefficients << 1) | 1U;
+            cpuCurandSobolRecurrence(v, polynomial, line.degree);
+            if (!writeDirections(output, v, bits))
+            {
+                return CURAND_STATUS_INTERNAL_ERROR;
+            }
+            written++;
+        }
+        if (dimensions != 0 && written < dimensions)
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+
+        memcpy(header.magic, DIRECTION_FILE_MAGIC, sizeof(DIRECTION_FILE_MAGIC));
+        header.byteOrder = DIRECTION_FILE_BYTE_ORDER;
+        header.version = DIRECTION_FILE_VERSION;
+        header.bits = bits;
+        header.dimensions = written;
+        if (fseek(output, 0, SEEK_SET) != 0 ||
+            fwrite(&header, sizeof(header), 1, output) != 1)
+        {
+            return CURAND_STATUS_INTERNAL_ERROR;
+        }
+        return CURAND_STATUS_SUCCESS;
+    }
+}
+
+curandStatus_t CURANDAPI cpuCurandLoadDirectionFile(curandDirectionFile_t *file, const char *path)
+{
+    if (file == NULL || path == NULL)
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    size_t size = 0;
+    void *data = mapFile(path, &size);
+    if (data == NULL)
+    {
+        return CURAND_STATUS_INTERNAL_ERROR;
+    }
+    const DirectionFileHeader *header = (const DirectionFileHeader*)data;
+    if (size < sizeof(DirectionFileHeader) ||
+        directionFileSize(*header) == 0 || directionFileSize(*header) > size)
+    {
+        unmapFile(data, size);
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    CpuDirectionFile *f = new (std::nothrow) CpuDirectionFile();
+    if (f == NULL)
+    {
+        unmapFile(data, size);
+        return CURAND_STATUS_ALLOCATION_FAILED;
+    }
+    f->dimensions = header->dimensions;
+    f->bits = header->bits;
+    f->directions = (const char*)data + sizeof(DirectionFileHeader);
+    f->mapping = data;
+    f->size = size;
+    *file = f;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandDestroyDirectionFile(curandDirectionFile_t file)
+{
+    if (file == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    unmapFile(file->mapping, file->size);
+    delete file;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandWriteDirectionFile(const char *joeKuoPath, const char *path, unsigned int bits, unsigned int dimensions)
+{
+    if (joeKuoPath == NULL || path == NULL || (bits != 32 && bits != 64))
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    FILE *input = fopen(joeKuoPath, "r");
+    if (input == NULL)
+    {
+        return CURAND_STATUS_INTERNAL_ERROR;
+    }
+    FILE *output = fopen(path, "wb");
+    if (output == NULL)
+    {
+        fclose(input);
+        return CURAND_STATUS_INTERNAL_ERROR;
+    }
+    curandStatus_t result = writeDirectionFile(input, output, bits, dimensions);
+    fclose(input);
+    if (fclose(output) != 0 && result == CURAND_STATUS_SUCCESS)
+    {
+        result = CURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (result != CURAND_STATUS_SUCCESS)
+    {
+        remove(path);
+    }
+    return result;
+}
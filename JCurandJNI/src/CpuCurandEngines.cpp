@@ -0,0 +1,1314 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CpuCurandEngines.hpp"
+
+#include <string.h>
+#include <mutex>
+#include <random>
+#include <vector>
+
+void CpuEngineCursor::next(unsigned long long *words, size_t n)
+{
+    // Only overridden by the 64 bit Sobol cursors
+    memset(words, 0, n * sizeof(unsigned long long));
+}
+
+
+//=== Philox4x32-10 ==========================================================
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define CPU_CURAND_PHILOX_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    const unsigned int PHILOX_M0 = 0xD2511F53U;
+    const unsigned int PHILOX_M1 = 0xCD9E8D57U;
+    const unsigned int PHILOX_W0 = 0x9E3779B9U;
+    const unsigned int PHILOX_W1 = 0xBB67AE85U;
+
+    void philoxBlock(unsigned int k0, unsigned int k1, unsigned int x[4])
+    {
+        for (int round = 0; round < 10; round++)
+        {
+            unsigned long long p0 = (unsigned long long)PHILOX_M0 * x[0];
+            unsigned long long p1 = (unsigned long long)PHILOX_M1 * x[2];
+            x[0] = (unsigned int)(p1 >> 32) ^ x[1] ^ k0;
+            x[1] = (unsigned int)p1;
+            x[2] = (unsigned int)(p0 >> 32) ^ x[3] ^ k1;
+            x[3] = (unsigned int)p0;
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+    }
+
+#ifdef CPU_CURAND_PHILOX_SSE2
+    /**
+     * Computes the high and low halves of the products of the four
+     * lanes of x with the given multiplier
+     */
+    inline void mulhilo(__m128i x, __m128i m, __m128i &hi, __m128i &lo)
+    {
+        const __m128i maskLo = _mm_set_epi32(0, -1, 0, -1);
+        __m128i even = _mm_mul_epu32(x, m);
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(x, 32), m);
+        lo = _mm_or_si128(_mm_and_si128(even, maskLo), _mm_slli_epi64(odd, 32));
+        hi = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_andnot_si128(maskLo, odd));
+    }
+
+    /**
+     * Computes the blocks for four counters at once, with one block
+     * per vector lane, and writes them transposed into the output
+     */
+    void philoxBlocks4(unsigned int k0, unsigned int k1, unsigned int c2,
+        unsigned int c3, const unsigned long long c[4], unsigned int *words)
+    {
+        const __m128i m0 = _mm_set1_epi32((int)PHILOX_M0);
+        const __m128i m1 = _mm_set1_epi32((int)PHILOX_M1);
+        __m128i x0 = _mm_set_epi32((int)c[3], (int)c[2], (int)c[1], (int)c[0]);
+        __m128i x1 = _mm_set_epi32((int)(c[3] >> 32), (int)(c[2] >> 32),
+            (int)(c[1] >> 32), (int)(c[0] >> 32));
+        __m128i x2 = _mm_set1_epi32((int)c2);
+        __m128i x3 = _mm_set1_epi32((int)c3);
+        for (int round = 0; round < 10; round++)
+        {
+            __m128i hi0, lo0, hi1, lo1;
+            mulhilo(x0, m0, hi0, lo0);
+            mulhilo(x2, m1, hi1, lo1);
+            x0 = _mm_xor_si128(_mm_xor_si128(hi1, x1), _mm_set1_epi32((int)k0));
+            x2 = _mm_xor_si128(_mm_xor_si128(hi0, x3), _mm_set1_epi32((int)k1));
+            x1 = lo1;
+            x3 = lo0;
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        __m128i t0 = _mm_unpacklo_epi32(x0, x1);
+        __m128i t1 = _mm_unpacklo_epi32(x2, x3);
+        __m128i t2 = _mm_unpackhi_epi32(x0, x1);
+        __m128i t3 = _mm_unpackhi_epi32(x2, x3);
+        __m128i *w = (__m128i*)words;
+        _mm_storeu_si128(w + 0, _mm_unpacklo_epi64(t0, t1));
+        _mm_storeu_si128(w + 1, _mm_unpackhi_epi64(t0, t1));
+        _mm_storeu_si128(w + 2, _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128(w + 3, _mm_unpackhi_epi64(t2, t3));
+    }
+#endif
+}
+
+void cpuCurandPhilox4x32_10(unsigned long long seed,
+    unsigned long long subsequence, unsigned long long counter,
+    unsigned int *words, size_t numBlocks)
+{
+    const unsigned int k0 = (unsigned int)seed;
+    const unsigned int k1 = (unsigned int)(seed >> 32);
+    const unsigned int c2 = (unsigned int)subsequence;
+    const unsigned int c3 = (unsigned int)(subsequence >> 32);
+    size_t b = 0;
+#ifdef CPU_CURAND_PHILOX_SSE2
+    for (; b + 4 <= numBlocks; b += 4)
+    {
+        const unsigned long long c[4] =
+            { counter + b, counter + b + 1, counter + b + 2, counter + b + 3 };
+        philoxBlocks4(k0, k1, c2, c3, c, words + 4 * b);
+    }
+#endif
+    for (; b < numBlocks; b++)
+    {
+        unsigned long long c = counter + b;
+        unsigned int *x = words + 4 * b;
+        x[0] = (unsigned int)c;
+        x[1] = (unsigned int)(c >> 32);
+        x[2] = c2;
+        x[3] = c3;
+        philoxBlock(k0, k1, x);
+    }
+}
+
+void cpuCurandPhilox4x32_10Gather(unsigned long long seed,
+    unsigned long long subsequence, const unsigned long long *positions,
+    unsigned int *words, size_t n)
+{
+    const unsigned int k0 = (unsigned int)seed;
+    const unsigned int k1 = (unsigned int)(seed >> 32);
+    const unsigned int c2 = (unsigned int)subsequence;
+    const unsigned int c3 = (unsigned int)(subsequence >> 32);
+    size_t i = 0;
+#ifdef CPU_CURAND_PHILOX_SSE2
+    unsigned int blocks[16];
+    for (; i + 4 <= n; i += 4)
+    {
+        const unsigned long long c[4] = { positions[i] >> 2,
+            positions[i + 1] >> 2, positions[i + 2] >> 2, positions[i + 3] >> 2 };
+        philoxBlocks4(k0, k1, c2, c3, c, blocks);
+        for (size_t j = 0; j < 4; j++)
+        {
+            words[i + j] = blocks[4 * j + (positions[i + j] & 3)];
+        }
+    }
+#endif
+    for (; i < n; i++)
+    {
+        unsigned long long c = positions[i] >> 2;
+        unsigned int x[4] = { (unsigned int)c, (unsigned int)(c >> 32), c2, c3 };
+        philoxBlock(k0, k1, x);
+        words[i] = x[positions[i] & 3];
+    }
+}
+
+namespace
+{
+    /**
+     * Word i of the stream is word (i % 4) of the block for counter
+     * (i / 4) in the given subsequence, like for a CURAND device API
+     * state that was initialized with curand_init(seed, subsequence,
+     * 0, &state)
+     */
+    class PhiloxCursor : public CpuEngineCursor
+    {
+    public:
+        PhiloxCursor(unsigned long long seed, unsigned long long subsequence)
+            : seed(seed), subsequence(subsequence), position(0) {}
+
+        void seek(unsigned int dimension, unsigned long long p)
+        {
+            position = p;
+        }
+
+        void next(unsigned int *words, size_t n)
+        {
+            unsigned int block[4];
+            // Leading words of a partially consumed block
+            while (n > 0 && (position & 3) != 0)
+            {
+                cpuCurandPhilox4x32_10(seed, subsequence, position >> 2, block, 1);
+                *words++ = block[position & 3];
+                position++;
+                n--;
+            }
+            size_t numBlocks = n / 4;
+            cpuCurandPhilox4x32_10(seed, subsequence, position >> 2, words, numBlocks);
+            words += 4 * numBlocks;
+            position += 4 * numBlocks;
+            n -= 4 * numBlocks;
+            if (n > 0)
+            {
+                cpuCurandPhilox4x32_10(seed, subsequence, position >> 2, block, 1);
+                for (size_t i = 0; i < n; i++)
+                {
+                    words[i] = block[i];
+                }
+                position += n;
+            }
+        }
+
+    private:
+        unsigned long long seed;
+        unsigned long long subsequence;
+        unsigned long long position;
+    };
+
+    class PhiloxEngine : public CpuEngine
+    {
+    public:
+        PhiloxEngine(unsigned long long seed, unsigned long long subsequence)
+            : seed(seed), subsequence(subsequence) {}
+        CpuEngineCursor *newCursor() { return new PhiloxCursor(seed, subsequence); }
+    private:
+        unsigned long long seed;
+        unsigned long long subsequence;
+    };
+}
+
+
+//=== XORWOW =================================================================
+
+namespace
+{
+    const int XORWOW_BITS = 160;
+    const unsigned int XORWOW_WEYL = 362437U;
+
+    /**
+     * The number of steps of one subsequence of XORWOW is 2^67, as
+     * for curand_init
+     */
+    const int XORWOW_SUBSEQUENCE_BITS = 67;
+
+    /**
+     * The matrices of the linear (xorshift) part of XORWOW for jumping
+     * ahead by 2^k steps, for positions and subsequences up to 2^64.
+     * Each matrix is stored as 160 columns of 5 words,
+     * so that a product with a state is the XOR of the columns that
+     * correspond to the bits of the state.
+     */
+    struct XorwowJumpTable
+    {
+        unsigned int columns[XORWOW_SUBSEQUENCE_BITS + 64][XORWOW_BITS][5];
+    };
+
+    void xorwowStep(unsigned int v[5])
+    {
+        unsigned int t = v[0] ^ (v[0] >> 2);
+        v[0] = v[1];
+        v[1] = v[2];
+        v[2] = v[3];
+        v[3] = v[4];
+        v[4] = (v[4] ^ (v[4] << 4)) ^ (t ^ (t << 1));
+    }
+
+    void xorwowApply(const unsigned int columns[XORWOW_BITS][5], unsigned int v[5])
+    {
+        unsigned int r[5] = { 0, 0, 0, 0, 0 };
+        for (int j = 0; j < XORWOW_BITS; j++)
+        {
+            if ((v[j >> 5] >> (j & 31)) & 1)
+            {
+                for (int w = 0; w < 5; w++)
+                {
+                    r[w] ^= columns[j][w];
+                }
+            }
+        }
+        memcpy(v, r, sizeof(r));
+    }
+
+    XorwowJumpTable *createXorwowJumpTable()
+    {
+        XorwowJumpTable *table = new XorwowJumpTable();
+        for (int j = 0; j < XORWOW_BITS; j++)
+        {
+            unsigned int *c = table->columns[0][j];
+            memset(c, 0, 5 * sizeof(unsigned int));
+            c[j >> 5] = 1U << (j & 31);
+            xorwowStep(c);
+        }
+        for (int k = 1; k < XORWOW_SUBSEQUENCE_BITS + 64; k++)
+        {
+            for (int j = 0; j < XORWOW_BITS; j++)
+            {
+                unsigned int *c = table->columns[k][j];
+                memcpy(c, table->columns[k - 1][j], 5 * sizeof(unsigned int));
+                xorwowApply(table->columns[k - 1], c);
+            }
+        }
+        return table;
+    }
+
+    const XorwowJumpTable &getXorwowJumpTable()
+    {
+        static const XorwowJumpTable *table = createXorwowJumpTable();
+        return *table;
+    }
+
+    /**
+     * The state of XORWOW at the start of a subsequence
+     */
+    struct XorwowState
+    {
+        unsigned int v[5];
+        unsigned int d;
+    };
+
+    XorwowState xorwowStart(unsigned long long seed, unsigned long long subsequence)
+    {
+        // The same scrambling of the seed as in curand_init
+        unsigned int s0 = ((unsigned int)seed) ^ 0xaad26b49U;
+        unsigned int s1 = ((unsigned int)(seed >> 32)) ^ 0xf7dcefddU;
+        unsigned int t0 = 1099087573U * s0;
+        unsigned int t1 = 2591861531U * s1;
+        XorwowState state;
+        state.d = 6615241U + t1 + t0;
+        state.v[0] = 123456789U + t0;
+        state.v[1] = 362436069U ^ t0;
+        state.v[2] = 521288629U + t1;
+        state.v[3] = 88675123U ^ t1;
+        state.v[4] = 5783321U + t0;
+        if (subsequence != 0)
+        {
+            // The Weyl sequence advances by a multiple of 2^32 here
+            const XorwowJumpTable &table = getXorwowJumpTable();
+            for (int k = 0; k < 64; k++)
+            {
+                if ((subsequence >> k) & 1)
+                {
+                    xorwowApply(table.columns[XORWOW_SUBSEQUENCE_BITS + k], state.v);
+                }
+            }
+        }
+        return state;
+    }
+
+    class XorwowCursor : public CpuEngineCursor
+    {
+    public:
+        XorwowCursor(const XorwowState &start) : start(start)
+        {
+            seek(0, 0);
+        }
+
+        void seek(unsigned int dimension, unsigned long long position)
+        {
+            memcpy(v, start.v, sizeof(v));
+            d = start.d;
+            if (position != 0)
+            {
+                const XorwowJumpTable &table = getXorwowJumpTable();
+                for (int k = 0; k < 64; k++)
+                {
+                    if ((position >> k) & 1)
+                    {
+                        xorwowApply(table.columns[k], v);
+                    }
+                }
+                d += (unsigned int)position * XORWOW_WEYL;
+            }
+        }
+
+        void next(unsigned int *words, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                xorwowStep(v);
+                d += XORWOW_WEYL;
+                words[i] = v[4] + d;
+            }
+        }
+
+    private:
+        XorwowState start;
+        unsigned int v[5];
+        unsigned int d;
+    };
+
+    class XorwowEngine : public CpuEngine
+    {
+    public:
+        XorwowEngine(unsigned long long seed, unsigned long long subsequence)
+            : start(xorwowStart(seed, subsequence)) {}
+        CpuEngineCursor *newCursor() { return new XorwowCursor(start); }
+    private:
+        XorwowState start;
+    };
+}
+
+
+//=== MRG32k3a ===============================================================
+
+namespace
+{
+    const unsigned long long MRG_M1 = 4294967087ULL;
+    const unsigned long long MRG_M2 = 4294944443ULL;
+    const unsigned long long MRG_A12 = 1403580ULL;
+    const unsigned long long MRG_A13N = 810728ULL;
+    const unsigned long long MRG_A21 = 527612ULL;
+    const unsigned long long MRG_A23N = 1370589ULL;
+
+    typedef unsigned long long Matrix3[3][3];
+
+    void matrixMulMod(const Matrix3 a, const Matrix3 b, Matrix3 r, unsigned long long m)
+    {
+        Matrix3 t;
+        for (int i = 0; i < 3; i++)
+        {
+            for (int j = 0; j < 3; j++)
+            {
+                unsigned long long s = 0;
+                for (int k = 0; k < 3; k++)
+                {
+                    s = (s + (a[i][k] * b[k][j]) % m) % m;
+                }
+                t[i][j] = s;
+            }
+        }
+        memcpy(r, t, sizeof(t));
+    }
+
+    void matrixVecMod(const Matrix3 a, unsigned long long v[3], unsigned long long m)
+    {
+        unsigned long long t[3];
+        for (int i = 0; i < 3; i++)
+        {
+            unsigned long long s = 0;
+            for (int k = 0; k < 3; k++)
+            {
+                s = (s + (a[i][k] * v[k]) % m) % m;
+            }
+            t[i] = s;
+        }
+        memcpy(v, t, sizeof(t));
+    }
+
+    /**
+     * Multiply the given state with the given transition matrix
+     * raised to the given power
+     */
+    void jumpMod(const Matrix3 transition, unsigned long long steps,
+        unsigned long long v[3], unsigned long long m)
+    {
+        Matrix3 p;
+        memcpy(p, transition, sizeof(p));
+        while (steps != 0)
+        {
+            if (steps & 1)
+            {
+                matrixVecMod(p, v, m);
+            }
+            steps >>= 1;
+            if (steps != 0)
+            {
+                matrixMulMod(p, p, p, m);
+            }
+        }
+    }
+
+    const Matrix3 MRG_A1 =
+    {
+        { 0, 1, 0 },
+        { 0, 0, 1 },
+        { MRG_M1 - MRG_A13N, MRG_A12, 0 }
+    };
+    const Matrix3 MRG_A2 =
+    {
+        { 0, 1, 0 },
+        { 0, 0, 1 },
+        { MRG_M2 - MRG_A23N, 0, MRG_A21 }
+    };
+
+    /**
+     * The number of steps of one subsequence of MRG32k3a is 2^76, as
+     * for curand_init
+     */
+    const int MRG_SUBSEQUENCE_BITS = 76;
+
+    /**
+     * The transition matrices of both components for one subsequence
+     */
+    struct MrgSubsequenceMatrices
+    {
+        Matrix3 a1;
+        Matrix3 a2;
+    };
+
+    MrgSubsequenceMatrices *createMrgSubsequenceMatrices()
+    {
+        MrgSubsequenceMatrices *matrices = new MrgSubsequenceMatrices();
+        memcpy(matrices->a1, MRG_A1, sizeof(Matrix3));
+        memcpy(matrices->a2, MRG_A2, sizeof(Matrix3));
+        for (int k = 0; k < MRG_SUBSEQUENCE_BITS; k++)
+        {
+            matrixMulMod(matrices->a1, matrices->a1, matrices->a1, MRG_M1);
+            matrixMulMod(matrices->a2, matrices->a2, matrices->a2, MRG_M2);
+        }
+        return matrices;
+    }
+
+    /**
+     * The state of both components of MRG32k3a at the start of a
+     * subsequence
+     */
+    struct MrgState
+    {
+        unsigned long long s1[3];
+        unsigned long long s2[3];
+    };
+
+    MrgState mrgStart(unsigned long long seed, unsigned long long subsequence)
+    {
+        MrgState state;
+        unsigned long long x1 = ((unsigned int)seed) ^ 0x55555555U;
+        unsigned long long x2 = ((unsigned int)(seed >> 32)) ^ 0xAAAAAAAAU;
+        for (int i = 0; i < 3; i++)
+        {
+            state.s1[i] = (x1 * 12345ULL) % MRG_M1;
+            state.s2[i] = (x2 * 12345ULL) % MRG_M2;
+        }
+        if (state.s1[0] == 0) state.s1[0] = state.s1[1] = state.s1[2] = 12345;
+        if (state.s2[0] == 0) state.s2[0] = state.s2[1] = state.s2[2] = 12345;
+        if (subsequence != 0)
+        {
+            static const MrgSubsequenceMatrices *matrices = createMrgSubsequenceMatrices();
+            jumpMod(matrices->a1, subsequence, state.s1, MRG_M1);
+            jumpMod(matrices->a2, subsequence, state.s2, MRG_M2);
+        }
+        return state;
+    }
+
+    class Mrg32k3aCursor : public CpuEngineCursor
+    {
+    public:
+        Mrg32k3aCursor(const MrgState &start) : start(start)
+        {
+            seek(0, 0);
+        }
+
+        void seek(unsigned int dimension, unsigned long long position)
+        {
+            memcpy(s1, start.s1, sizeof(s1));
+            memcpy(s2, start.s2, sizeof(s2));
+            jumpMod(MRG_A1, position, s1, MRG_M1);
+            jumpMod(MRG_A2, position, s2, MRG_M2);
+        }
+
+        void next(unsigned int *words, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                long long p1 = (long long)(MRG_A12 * s1[1]) - (long long)(MRG_A13N * s1[0]);
+                p1 %= (long long)MRG_M1;
+                if (p1 < 0) p1 += MRG_M1;
+                s1[0] = s1[1];
+                s1[1] = s1[2];
+                s1[2] = (unsigned long long)p1;
+
+                long long p2 = (long long)(MRG_A21 * s2[2]) - (long long)(MRG_A23N * s2[0]);
+                p2 %= (long long)MRG_M2;
+                if (p2 < 0) p2 += MRG_M2;
+                s2[0] = s2[1];
+                s2[1] = s2[2];
+                s2[2] = (unsigned long long)p2;
+
+                // The combination is in [0, m1), spread over all 32 bits
+                unsigned long long z = p1 >= p2 ? p1 - p2 : p1 - p2 + MRG_M1;
+                words[i] = (unsigned int)((z << 32) / MRG_M1);
+            }
+        }
+
+    private:
+        MrgState start;
+        unsigned long long s1[3];
+        unsigned long long s2[3];
+    };
+
+    class Mrg32k3aEngine : public CpuEngine
+    {
+    public:
+        Mrg32k3aEngine(unsigned long long seed, unsigned long long subsequence)
+            : start(mrgStart(seed, subsequence)) {}
+        CpuEngineCursor *newCursor() { return new Mrg32k3aCursor(start); }
+    private:
+        MrgState start;
+    };
+}
+
+
+//=== Mersenne Twister =======================================================
+
+namespace
+{
+    /**
+     * The Mersenne Twister can not cheaply jump ahead, so the engine
+     * keeps a single state that all cursors advance. This is used for
+     * CURAND_RNG_PSEUDO_MT19937 as well as CURAND_RNG_PSEUDO_MTGP32.
+     */
+    class MersenneTwisterEngine : public CpuEngine
+    {
+    public:
+        MersenneTwisterEngine(unsigned long long seed) : seed(seed)
+        {
+            reset();
+        }
+
+        bool isRandomAccess() const { return false; }
+
+        CpuEngineCursor *newCursor();
+
+        void reset()
+        {
+            std::seed_seq seq = { (unsigned int)seed, (unsigned int)(seed >> 32) };
+            mt.seed(seq);
+            position = 0;
+        }
+
+        unsigned long long seed;
+        std::mt19937 mt;
+        unsigned long long position;
+    };
+
+    class MersenneTwisterCursor : public CpuEngineCursor
+    {
+    public:
+        MersenneTwisterCursor(MersenneTwisterEngine *engine) : engine(engine) {}
+
+        void seek(unsigned int dimension, unsigned long long position)
+        {
+            if (position < engine->position)
+            {
+                engine->reset();
+            }
+            engine->mt.discard(position - engine->position);
+            engine->position = position;
+        }
+
+        void next(unsigned int *words, size_t n)
+        {
+            std::mt19937 &mt = engine->mt;
+            for (size_t i = 0; i < n; i++)
+            {
+                words[i] = (unsigned int)mt();
+            }
+            engine->position += n;
+        }
+
+    private:
+        MersenneTwisterEngine *engine;
+    };
+
+    CpuEngineCursor *MersenneTwisterEngine::newCursor()
+    {
+        return new MersenneTwisterCursor(this);
+    }
+}
+
+
+//=== Sobol ==================================================================
+
+namespace
+{
+    /**
+     * The lazily computed direction vectors of the Sobol engines.
+     *
+     * The first dimension is the van der Corput sequence. The further
+     * dimensions use the primitive polynomials and initial direction
+     * numbers of Joe and Kuo, so that the direction vectors are the
+     * same as those of the JOEKUO6 sets of CURAND.
+     */
+    class SobolDirections
+    {
+    public:
+        SobolDirections()
+            : directions64(new unsigned long long[(size_t)CPU_CURAND_SOBOL_DIMENSIONS * 64]),
+              directions32(new unsigned int[(size_t)CPU_CURAND_SOBOL_DIMENSIONS * 32]),
+              computedDimensions(0), nextInitialNumber(0)
+        {
+        }
+
+        void ensure(unsigned int dimensions)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            while (computedDimensions < dimensions)
+            {
+                computeDimension(computedDimensions);
+                computedDimensions++;
+            }
+        }
+
+        unsigned long long *directions64;
+        unsigned int *directions32;
+
+    private:
+        void computeDimension(unsigned int dimension)
+        {
+            unsigned long long *v = directions64 + (size_t)dimension * 64;
+            if (dimension == 0)
+            {
+                for (int k = 0; k < 64; k++)
+                {
+                    v[k] = 1ULL << (63 - k);
+                }
+            }
+            else
+            {
+                unsigned int p = cpuCurandJoeKuoPolynomials[dimension - 1];
+                int s = 0;
+                while ((p >> (s + 1)) != 0)
+                {
+                    s++;
+                }
+                for (int k = 0; k < s; k++)
+                {
+                    unsigned long long m = cpuCurandJoeKuoInitialNumbers[nextInitialNumber++];
+                    v[k] = m << (63 - k);
+                }
+                cpuCurandSobolRecurrence(v, p, s);
+            }
+            unsigned int *v32 = directions32 + (size_t)dimension * 32;
+            for (int k = 0; k < 32; k++)
+            {
+                v32[k] = (unsigned int)(v[k] >> 32);
+            }
+        }
+
+        std::mutex mutex;
+        unsigned int computedDimensions;
+        size_t nextInitialNumber;
+    };
+
+    /**
+     * Returns the digital shift of the scrambled Sobol generators for
+     * the given dimension. CURAND uses scrambled direction vectors and
+     * scramble constants that are not published, so the scrambled
+     * sequences are not the same as those of CURAND.
+     */
+    unsigned long long scrambleConstant64(unsigned int dimension)
+    {
+        return cpuCurandMix64(0x5C0B01ULL * (dimension + 1));
+    }
+
+    /**
+     * Reverse the order of the bits of the given value
+     */
+    inline unsigned int reverseBits(unsigned int x)
+    {
+        x = ((x >> 1) & 0x55555555U) | ((x & 0x55555555U) << 1);
+        x = ((x >> 2) & 0x33333333U) | ((x & 0x33333333U) << 2);
+        x = ((x >> 4) & 0x0F0F0F0FU) | ((x & 0x0F0F0F0FU) << 4);
+        x = ((x >> 8) & 0x00FF00FFU) | ((x & 0x00FF00FFU) << 8);
+        return (x >> 16) | (x << 16);
+    }
+    inline unsigned long long reverseBits(unsigned long long x)
+    {
+        return ((unsigned long long)reverseBits((unsigned int)x) << 32) |
+            reverseBits((unsigned int)(x >> 32));
+    }
+
+    /**
+     * The hash-based Owen scrambling of Laine and Karras, with the
+     * constants of Burley ("Practical Hash-based Owen Scrambling",
+     * 2020). It is applied to the bit-reversed value, where each step
+     * only propagates changes from lower to higher bits, so that each
+     * bit of the result is flipped depending on the seed and on the
+     * more significant bits of the original value only. The 64 bit
+     * version uses the same steps with 64 bit constants.
+     */
+    inline unsigned int nestedUniformScramble(unsigned int x, unsigned long long seed)
+    {
+        unsigned int s = (unsigned int)seed;
+        x = reverseBits(x);
+        x ^= x * 0x3D20ADEAU;
+        x += s;
+        x *= (s >> 16) | 1U;
+        x ^= x * 0x05526C56U;
+        x ^= x * 0x53A22864U;
+        return reverseBits(x);
+    }
+    inline unsigned long long nestedUniformScramble(unsigned long long x, unsigned long long seed)
+    {
+        x = reverseBits(x);
+        x ^= x * 0x9E3779B97F4A7C16ULL;
+        x += seed;
+        x *= (seed >> 32) | 1ULL;
+        x ^= x * 0xBF58476D1CE4E5BAULL;
+        x ^= x * 0x94D049BB133111ECULL;
+        return reverseBits(x);
+    }
+
+    SobolDirections &getSobolDirections()
+    {
+        static SobolDirections *directions = new SobolDirections();
+        return *directions;
+    }
+
+    template <typename Word>
+    class SobolCursor : public CpuEngineCursor
+    {
+    public:
+        SobolCursor(const Word *directions, bool scrambled, bool owen, unsigned long long owenSeed)
+            : directions(directions), scrambled(scrambled), owen(owen), owenSeed(owenSeed),
+              v(NULL), scramble(0), dimensionSeed(0), index(0), x(0)
+        {
+        }
+
+        void seek(unsigned int dimension, unsigned long long position)
+        {
+            const int bits = sizeof(Word) * 8;
+            v = directions + (size_t)dimension * bits;
+            // The upper bits for 32 bit words. The Owen scrambling
+            // replaces the digital shift.
+            scramble = scrambled && !owen ? (Word)(scrambleConstant64(dimension) >> (64 - bits)) : 0;
+            dimensionSeed = cpuCurandMix64(owenSeed + cpuCurandMix64(dimension));
+            if (bits == 32)
+            {
+                position &= 0xFFFFFFFFULL;
+            }
+            index = position;
+            unsigned long long gray = position ^ (position >> 1);
+            x = 0;
+            for (int k = 0; k < bits; k++)
+            {
+                if ((gray >> k) & 1)
+                {
+                    x ^= v[k];
+                }
+            }
+        }
+
+        void next(unsigned int *words, size_t n)
+        {
+            generate(words, n);
+        }
+
+        void next(unsigned long long *words, size_t n)
+        {
+            generate(words, n);
+        }
+
+    private:
+        template <typename T>
+        void generate(T *words, size_t n)
+        {
+            const int bits = sizeof(Word) * 8;
+            for (size_t i = 0; i < n; i++)
+            {
+                words[i] = (T)(x ^ scramble);
+                index++;
+                if (bits == 32)
+                {
+                    index &= 0xFFFFFFFFULL;
+                }
+                if (index == 0)
+                {
+                    x = 0;
+                }
+                else
+                {
+                    x ^= v[trailingZeros(index)];
+                }
+            }
+            if (owen)
+            {
+                // A separate loop without dependencies between the
+                // points, so that it can be vectorized
+                const unsigned long long seed = dimensionSeed;
+                for (size_t i = 0; i < n; i++)
+                {
+                    words[i] = (T)nestedUniformScramble((Word)words[i], seed);
+                }
+            }
+        }
+
+        static int trailingZeros(unsigned long long i)
+        {
+            int n = 0;
+            while ((i & 1) == 0)
+            {
+                i >>= 1;
+                n++;
+            }
+            return n;
+        }
+
+        const Word *directions;
+        bool scrambled;
+        bool owen;
+        unsigned long long owenSeed;
+        const Word *v;
+        Word scramble;
+        unsigned long long dimensionSeed;
+        unsigned long long index;
+        Word x;
+    };
+
+    template <typename Word>
+    class SobolEngine : public CpuEngine
+    {
+    public:
+        SobolEngine(const Word *directions, bool scrambled, bool owen, unsigned long long owenSeed)
+            : directions(directions), scrambled(scrambled), owen(owen), owenSeed(owenSeed)
+        {
+        }
+
+        bool is64Bit() const { return sizeof(Word) == 8; }
+
+        CpuEngineCursor *newCursor()
+        {
+            return new SobolCursor<Word>(directions, scrambled, owen, owenSeed);
+        }
+
+    private:
+        const Word *directions;
+        bool scrambled;
+        bool owen;
+        unsigned long long owenSeed;
+    };
+}
+
+void cpuCurandSobolRecurrence(unsigned long long *v, unsigned int polynomial, int degree)
+{
+    for (int k = degree; k < 64; k++)
+    {
+        unsigned long long x = v[k - degree] ^ (v[k - degree] >> degree);
+        for (int j = 1; j < degree; j++)
+        {
+            if ((polynomial >> (degree - j)) & 1)
+            {
+                x ^= v[k - j];
+            }
+        }
+        v[k] = x;
+    }
+}
+
+CpuEngine *cpuCurandCreateSobolEngine(curandRngType_t type, const void *directions, unsigned int bits,
+    curandScramblingMode_t scrambling, unsigned long long scramblingSeed)
+{
+    const bool owen = scrambling == CURAND_SCRAMBLING_OWEN;
+    switch (type)
+    {
+        case CURAND_RNG_QUASI_DEFAULT:
+        case CURAND_RNG_QUASI_SOBOL32:
+        case CURAND_RNG_QUASI_SCRAMBLED_SOBOL32:
+            if (bits != 32)
+            {
+                return NULL;
+            }
+            return new SobolEngine<unsigned int>((const unsigned int*)directions,
+                type == CURAND_RNG_QUASI_SCRAMBLED_SOBOL32, owen, scramblingSeed);
+
+        case CURAND_RNG_QUASI_SOBOL64:
+        case CURAND_RNG_QUASI_SCRAMBLED_SOBOL64:
+            if (bits != 64)
+            {
+                return NULL;
+            }
+            return new SobolEngine<unsigned long long>((const unsigned long long*)directions,
+                type == CURAND_RNG_QUASI_SCRAMBLED_SOBOL64, owen, scramblingSeed);
+
+        default:
+            break;
+    }
+    return NULL;
+}
+
+const unsigned int *cpuCurandSobolDirections32(unsigned int dimensions)
+{
+    SobolDirections &d = getSobolDirections();
+    d.ensure(dimensions);
+    return d.directions32;
+}
+
+const unsigned long long *cpuCurandSobolDirections64(unsigned int dimensions)
+{
+    SobolDirections &d = getSobolDirections();
+    d.ensure(dimensions);
+    return d.directions64;
+}
+
+const unsigned int *cpuCurandSobolScrambleConstants32()
+{
+    static const std::vector<unsigned int> constants = []()
+    {
+        std::vector<unsigned int> c(CPU_CURAND_SOBOL_DIMENSIONS);
+        for (unsigned int d = 0; d < CPU_CURAND_SOBOL_DIMENSIONS; d++)
+        {
+            c[d] = (unsigned int)(scrambleConstant64(d) >> 32);
+        }
+        return c;
+    }();
+    return constants.data();
+}
+
+const unsigned long long *cpuCurandSobolScrambleConstants64()
+{
+    static const std::vector<unsigned long long> constants = []()
+    {
+        std::vector<unsigned long long> c(CPU_CURAND_SOBOL_DIMENSIONS);
+        for (unsigned int d = 0; d < CPU_CURAND_SOBOL_DIMENSIONS; d++)
+        {
+            c[d] = scrambleConstant64(d);
+        }
+        return c;
+    }();
+    return constants.data();
+}
+
+
+//=== Halton and rank-1 lattice ==============================================
+
+namespace
+{
+    /**
+     * The multiplier of the Korobov generating vector (1, a, a^2, ...)
+     * modulo 2^32 of the rank-1 lattice. It was chosen from random
+     * candidates by the weighted P_2 criterion (weights 1/j^2) of the
+     * first 20 dimensions, for the lattices with 2^6 to 2^20 points.
+     */
+    const unsigned int LATTICE_MULTIPLIER = 0x3CB643B9U;
+
+    /**
+     * Returns the first CPU_CURAND_MAX_DIMENSIONS prime numbers
+     */
+    const unsigned int *getPrimes()
+    {
+        static unsigned int *primes = NULL;
+        static std::once_flag flag;
+        std::call_once(flag, []
+        {
+            // The 20000th prime is 224737
+            const unsigned int limit = 225000;
+            std::vector<bool> composite(limit, false);
+            primes = new unsigned int[CPU_CURAND_MAX_DIMENSIONS];
+            int count = 0;
+            for (unsigned int i = 2; i < limit && count < CPU_CURAND_MAX_DIMENSIONS; i++)
+            {
+                if (composite[i])
+                {
+                    continue;
+                }
+                primes[count++] = i;
+                for (unsigned long long j = (unsigned long long)i * i; j < limit; j += i)
+                {
+                    composite[(size_t)j] = true;
+                }
+            }
+        });
+        return primes;
+    }
+
+    /**
+     * A cursor of the Halton sequence, where dimension d is the radical
+     * inverse in the base of the d-th prime. Digit k of the index is
+     * permuted with the random linear permutation (a_k * digit + b_k)
+     * mod base, where a_k and b_k are derived from the seed and the
+     * dimension. As many digits are used as are required for 32 bits,
+     * so the sequence has a period of at least 2^32 points.
+     */
+    class HaltonCursor : public CpuEngineCursor
+    {
+    public:
+        HaltonCursor(const unsigned int *primes, unsigned long long seed)
+            : primes(primes), seed(seed), base(2), numDigits(0), upper(0.0)
+        {
+        }
+
+        void seek(unsigned int dimension, unsigned long long position)
+        {
+            base = primes[dimension];
+            numDigits = 0;
+            double weight = 1.0;
+            for (unsigned long long power = 1; power < 0x100000000ULL; power *= base)
+            {
+                weight /= base;
+                unsigned long long h = cpuCurandMix64(
+                    seed + cpuCurandMix64(((unsigned long long)dimension << 6) + numDigits));
+                multipliers[numDigits] = 1 + (unsigned int)((h >> 32) % (base - 1));
+                offsets[numDigits] = (unsigned int)((h & 0xFFFFFFFFULL) % base);
+                weights[numDigits] = weight;
+                numDigits++;
+            }
+            for (int k = 0; k < numDigits; k++)
+            {
+                digits[k] = (unsigned int)(position % base);
+                position /= base;
+            }
+            updateUpper();
+        }
+
+        void next(unsigned int *words, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                double value = upper + permute(0, digits[0]) * weights[0];
+                unsigned long long word = (unsigned long long)(value * 4294967296.0);
+                words[i] = word > 0xFFFFFFFFULL ? 0xFFFFFFFFU : (unsigned int)word;
+
+                // Increment the index. Only a carry changes the upper digits.
+                digits[0]++;
+                if (digits[0] == base)
+                {
+                    for (int k = 0; k < numDigits && digits[k] == base; k++)
+                    {
+                        digits[k] = 0;
+                        if (k + 1 < numDigits)
+                        {
+                            digits[k + 1]++;
+                        }
+                    }
+                    updateUpper();
+                }
+            }
+        }
+
+    private:
+        unsigned int permute(int k, unsigned int digit) const
+        {
+            return (unsigned int)(((unsigned long long)multipliers[k] * digit + offsets[k]) % base);
+        }
+
+        void updateUpper()
+        {
+            upper = 0.0;
+            for (int k = numDigits - 1; k >= 1; k--)
+            {
+                upper += permute(k, digits[k]) * weights[k];
+            }
+        }
+
+        const unsigned int *primes;
+        unsigned long long seed;
+        unsigned int base;
+        int numDigits;
+        unsigned int digits[32];
+        unsigned int multipliers[32];
+        unsigned int offsets[32];
+        double weights[32];
+        double upper;
+    };
+
+    class HaltonEngine : public CpuEngine
+    {
+    public:
+        HaltonEngine(unsigned long long seed)
+            : primes(getPrimes()), seed(seed)
+        {
+        }
+
+        CpuEngineCursor *newCursor()
+        {
+            return new HaltonCursor(primes, seed);
+        }
+
+    private:
+        const unsigned int *primes;
+        unsigned long long seed;
+    };
+
+    /**
+     * A cursor of the extensible rank-1 lattice sequence with a random
+     * shift: Point i of dimension d is frac(phi(i) * z_d + shift_d),
+     * where phi is the base 2 radical inverse. In 32 bit fixed point,
+     * this is reverseBits(i) * z_d + shift_d, so the first 2^m points
+     * are the shifted lattice rule with 2^m points, for each m.
+     */
+    class LatticeCursor : public CpuEngineCursor
+    {
+    public:
+        LatticeCursor(unsigned long long seed)
+            : seed(seed), z(1), shift(0), index(0)
+        {
+        }
+
+        void seek(unsigned int dimension, unsigned long long position)
+        {
+            z = 1;
+            unsigned int factor = LATTICE_MULTIPLIER;
+            for (unsigned int e = dimension; e != 0; e >>= 1)
+            {
+                if (e & 1)
+                {
+                    z *= factor;
+                }
+                factor *= factor;
+            }
+            shift = (unsigned int)(cpuCurandMix64(seed + cpuCurandMix64(dimension)) >> 32);
+            index = (unsigned int)position;
+        }
+
+        void next(unsigned int *words, size_t n)
+        {
+            const unsigned int start = index;
+            for (size_t i = 0; i < n; i++)
+            {
+                words[i] = reverseBits((unsigned int)(start + i)) * z + shift;
+            }
+            index = (unsigned int)(start + n);
+        }
+
+    private:
+        unsigned long long seed;
+        unsigned int z;
+        unsigned int shift;
+        unsigned int index;
+    };
+
+    class LatticeEngine : public CpuEngine
+    {
+    public:
+        LatticeEngine(unsigned long long seed)
+            : seed(seed)
+        {
+        }
+
+        CpuEngineCursor *newCursor()
+        {
+            return new LatticeCursor(seed);
+        }
+
+    private:
+        unsigned long long seed;
+    };
+}
+
+
+//=== Factory ================================================================
+
+bool cpuCurandHasSubsequences(curandRngType_t type)
+{
+    return type == CURAND_RNG_PSEUDO_DEFAULT ||
+        type == CURAND_RNG_PSEUDO_XORWOW ||
+        type == CURAND_RNG_PSEUDO_MRG32K3A ||
+        type == CURAND_RNG_PSEUDO_PHILOX4_32_10;
+}
+
+CpuEngine *cpuCurandCreateEngine(curandRngType_t type,
+    unsigned long long seed, unsigned int dimensions, unsigned long long subsequence)
+{
+    if (subsequence != 0 && !cpuCurandHasSubsequences(type))
+    {
+        return NULL;
+    }
+    if (type == CURAND_RNG_QUASI_HALTON)
+    {
+        return new HaltonEngine(seed);
+    }
+    if (type == CURAND_RNG_QUASI_LATTICE)
+    {
+        return new LatticeEngine(seed);
+    }
+    switch (type)
+    {
+        case CURAND_RNG_PSEUDO_DEFAULT:
+        case CURAND_RNG_PSEUDO_XORWOW:
+            return new XorwowEngine(seed, subsequence);
+
+        case CURAND_RNG_PSEUDO_MRG32K3A:
+            return new Mrg32k3aEngine(seed, subsequence);
+
+        case CURAND_RNG_PSEUDO_MTGP32:
+        case CURAND_RNG_PSEUDO_MT19937:
+            return new MersenneTwisterEngine(seed);
+
+        case CURAND_RNG_PSEUDO_PHILOX4_32_10:
+            return new PhiloxEngine(seed, subsequence);
+
+        case CURAND_RNG_QUASI_DEFAULT:
+        case CURAND_RNG_QUASI_SOBOL32:
+        case CURAND_RNG_QUASI_SCRAMBLED_SOBOL32:
+            return cpuCurandCreateSobolEngine(type, cpuCurandSobolDirections32(dimensions), 32,
+                CURAND_SCRAMBLING_DEFAULT, 0);
+
+        case CURAND_RNG_QUASI_SOBOL64:
+        case CURAND_RNG_QUASI_SCRAMBLED_SOBOL64:
+            return cpuCurandCreateSobolEngine(type, cpuCurandSobolDirections64(dimensions), 64,
+                CURAND_SCRAMBLING_DEFAULT, 0);
+
+        default:
+            break;
+    }
+    return NULL;
+}
@@ -0,0 +1,232 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_CPU_CURAND_ENGINES
+#define JCURAND_CPU_CURAND_ENGINES
+
+#include <stddef.h>
+#include <curand.h>
+#include "JCurandExtensions.hpp"
+
+/**
+ * The maximum number of dimensions of the quasirandom generators,
+ * which is the same as the number of dimensions that is supported
+ * by CURAND
+ */
+#define CPU_CURAND_MAX_DIMENSIONS 20000
+
+/**
+ * The number of dimensions of the built-in Sobol direction vectors,
+ * which are the JOEKUO6 direction vectors of CURAND. Sobol generators
+ * with more dimensions need a direction file.
+ */
+#define CPU_CURAND_SOBOL_DIMENSIONS 20000
+
+/**
+ * The primitive polynomials of the Sobol dimensions 2 to
+ * CPU_CURAND_SOBOL_DIMENSIONS, from the table new-joe-kuo-6.21201 by
+ * Joe and Kuo. Bit i of a polynomial is the coefficient of x^i.
+ */
+extern const unsigned int cpuCurandJoeKuoPolynomials[CPU_CURAND_SOBOL_DIMENSIONS - 1];
+
+/**
+ * The initial direction numbers m_1 to m_degree of each polynomial
+ * of cpuCurandJoeKuoPolynomials, one after the other
+ */
+extern const unsigned int cpuCurandJoeKuoInitialNumbers[];
+
+/**
+ * A cursor into the stream of raw words of a CpuEngine. Cursors are
+ * not thread-safe, but different cursors of a random access engine
+ * may be used concurrently.
+ */
+class CpuEngineCursor
+{
+public:
+    virtual ~CpuEngineCursor() {}
+
+    /**
+     * Move this cursor to the given position in the given dimension.
+     * Pseudorandom engines only have a single dimension, 0.
+     */
+    virtual void seek(unsigned int dimension, unsigned long long position) = 0;
+
+    /**
+     * Write the next n 32 bit words into the given array
+     */
+    virtual void next(unsigned int *words, size_t n) = 0;
+
+    /**
+     * Write the next n 64 bit words into the given array. This is
+     * only supported by the 64 bit quasirandom engines.
+     */
+    virtual void next(unsigned long long *words, size_t n);
+};
+
+/**
+ * Base class for the engines that produce the raw random words
+ * of the CPU emulation of CURAND
+ */
+class CpuEngine
+{
+public:
+    virtual ~CpuEngine() {}
+
+    /**
+     * Whether a cursor of this engine can be moved to any position
+     * cheaply. If this is false, then only a single cursor may be
+     * used at a time, and it may only be moved forward.
+     */
+    virtual bool isRandomAccess() const { return true; }
+
+    /**
+     * Whether this engine produces 64 bit words
+     */
+    virtual bool is64Bit() const { return false; }
+
+    /**
+     * Create a new cursor for this engine. The caller is responsible
+     * for deleting it.
+     */
+    virtual CpuEngineCursor *newCursor() = 0;
+};
+
+/**
+ * Returns whether the engines of the given generator type can start
+ * at subsequences other than 0. This is true for XORWOW, MRG32k3a
+ * and Philox4x32-10.
+ */
+bool cpuCurandHasSubsequences(curandRngType_t type);
+
+/**
+ * Create the engine for the given generator type. For pseudorandom
+ * generators, the seed is used and the dimensions are ignored, and
+ * the words are taken from the given subsequence, like for a CURAND
+ * device API state that was initialized with curand_init(seed,
+ * subsequence, 0, &state). For quasirandom generators, the
+ * dimensions are used, and the seed only selects the random digit
+ * permutations of the Halton sequence and the random shift of the
+ * rank-1 lattice. Returns NULL if the type is not valid, or if the
+ * subsequence is not 0 for a type without subsequences.
+ */
+CpuEngine *cpuCurandCreateEngine(curandRngType_t type,
+    unsigned long long seed, unsigned int dimensions, unsigned long long subsequence);
+
+/**
+ * Compute the given number of blocks of the Philox4x32-10 counter
+ * based generator, for the key that is given by the seed and the
+ * 128 bit counters that consist of the given subsequence (upper 64
+ * bits) and the consecutive values starting at the given counter
+ * (lower 64 bits). This writes 4 words per block.
+ */
+void cpuCurandPhilox4x32_10(unsigned long long seed,
+    unsigned long long subsequence, unsigned long long counter,
+    unsigned int *words, size_t numBlocks);
+
+/**
+ * Compute the words at the given positions of the stream of the
+ * Philox4x32-10 generator for the given seed and subsequence. Word
+ * i is word (positions[i] % 4) of the block for the counter
+ * (positions[i] / 4). Four positions are computed at once.
+ */
+void cpuCurandPhilox4x32_10Gather(unsigned long long seed,
+    unsigned long long subsequence, const unsigned long long *positions,
+    unsigned int *words, size_t n);
+
+/**
+ * Returns the 32 bit Sobol direction vectors for the given number of
+ * dimensions (at most CPU_CURAND_SOBOL_DIMENSIONS), as an array of
+ * 32 vectors per dimension. The returned pointer remains valid until
+ * the library is unloaded.
+ */
+const unsigned int *cpuCurandSobolDirections32(unsigned int dimensions);
+
+/**
+ * Returns the 64 bit Sobol direction vectors for the given number of
+ * dimensions (at most CPU_CURAND_SOBOL_DIMENSIONS), as an array of
+ * 64 vectors per dimension. The returned pointer remains valid until
+ * the library is unloaded.
+ */
+const unsigned long long *cpuCurandSobolDirections64(unsigned int dimensions);
+
+/**
+ * Returns the digital shifts of the scrambled Sobol generators for all
+ * CPU_CURAND_SOBOL_DIMENSIONS dimensions, with 32 or 64 bits. The
+ * returned pointer remains valid until the library is unloaded.
+ */
+const unsigned int *cpuCurandSobolScrambleConstants32();
+const unsigned long long *cpuCurandSobolScrambleConstants64();
+
+/**
+ * Compute the direction vectors v[degree] to v[63] of one dimension
+ * of a Sobol sequence from the initial vectors v[0] to v[degree-1],
+ * with the recurrence of the given primitive polynomial of the given
+ * degree. Bit i of the polynomial is the coefficient of x^i.
+ */
+void cpuCurandSobolRecurrence(unsigned long long *v, unsigned int polynomial, int degree);
+
+/**
+ * Create a Sobol engine of the given quasirandom type, for direction
+ * vectors with the given number of bits (32 or 64) that are stored
+ * as an array of 'bits' vectors per dimension. The direction vectors
+ * are not copied. With CURAND_SCRAMBLING_OWEN, the points are Owen
+ * scrambled with a seed for each dimension that is derived from the
+ * given seed, instead of the digital shift of the scrambled types.
+ * Returns NULL if the type is not a Sobol type, or does not use
+ * vectors with the given number of bits.
+ */
+CpuEngine *cpuCurandCreateSobolEngine(curandRngType_t type, const void *directions, unsigned int bits,
+    curandScramblingMode_t scrambling, unsigned long long scramblingSeed);
+
+/**
+ * A table of Sobol direction vectors in a memory-mapped file, as
+ * written by cpuCurandWriteDirectionFile. The directions point into
+ * the mapping, and are an array of 'bits' vectors per dimension.
+ */
+struct CpuDirectionFile
+{
+    unsigned int dimensions;
+    unsigned int bits;
+    const void *directions;
+    void *mapping;
+    size_t size;
+};
+
+/**
+ * The SplitMix64 mixing function, used to derive well-distributed
+ * values from seeds and indices
+ */
+inline unsigned long long cpuCurandMix64(unsigned long long x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+#endif
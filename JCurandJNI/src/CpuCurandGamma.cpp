@@ -0,0 +1,329 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CpuCurandGamma.hpp"
+#include "CpuCurandSimd.hpp"
+
+#include <math.h>
+
+namespace
+{
+    /**
+     * The number of units whose normal samples are kept at a time
+     */
+    const size_t BLOCK_SIZE = 256;
+
+    /**
+     * The states of a unit after an attempt. When the squeeze test
+     * fails, the unit is accepted or rejected with the exact test,
+     * which needs logarithms and is rarely required.
+     */
+    const unsigned char ATTEMPT_REJECTED = 0;
+    const unsigned char ATTEMPT_ACCEPTED = 1;
+    const unsigned char ATTEMPT_SQUEEZE_FAILED = 2;
+
+    inline float uniformAt(const unsigned int *words, size_t index, float)
+    {
+        return cpuCurandUniformSimd(words[index]);
+    }
+
+    inline double uniformAt(const unsigned int *words, size_t index, double)
+    {
+        return cpuCurandUniformDoubleSimd(words[2 * index], words[2 * index + 1]);
+    }
+
+    template <typename T>
+    struct Kernels
+    {
+        /**
+         * Computes the normal samples z0 and z1 of n consecutive units
+         */
+        void (*normals)(const unsigned int *words, size_t stride, size_t n, T *z0, T *z1);
+
+        /**
+         * Tries the n given units with their normal samples from z and
+         * the given uniform sample. Writes the state of each of them
+         * into 'states', and the samples of the units that passed the
+         * first check into x.
+         */
+        void (*attempt)(const unsigned int *words, size_t stride, const unsigned int *units,
+            size_t n, size_t uniform, const T *z, T d, T c, T *x, unsigned char *states);
+    };
+
+    template <typename T>
+    void normalsScalar(const unsigned int *words, size_t stride, size_t n, T *z0, T *z1)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            const unsigned int *unitWords = words + i * stride;
+            cpuCurandBoxMullerSimd(uniformAt(unitWords, 0, T()), uniformAt(unitWords, 1, T()), z0[i], z1[i]);
+        }
+    }
+
+    template <typename T>
+    void attemptScalar(const unsigned int *words, size_t stride, const unsigned int *units,
+        size_t n, size_t uniform, const T *z, T d, T c, T *x, unsigned char *states)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            unsigned int i = units[j];
+            T u = uniformAt(words + i * stride, uniform, T());
+            T t = 1 + c * z[i];
+            T v = t * t * t;
+            T z2 = z[i] * z[i];
+            if (!(t > 0))
+            {
+                states[j] = ATTEMPT_REJECTED;
+                continue;
+            }
+            x[i] = d * v;
+            states[j] = u < 1 - (T)0.0331 * z2 * z2 ? ATTEMPT_ACCEPTED : ATTEMPT_SQUEEZE_FAILED;
+        }
+    }
+
+    template <typename T>
+    bool exactTest(T z, T u, T d, T c, T &x)
+    {
+        T t = 1 + c * z;
+        T v = t * t * t;
+        T z2 = z * z;
+        if (log(u) < (T)0.5 * z2 + d * (1 - v + log(v)))
+        {
+            x = d * v;
+            return true;
+        }
+        return false;
+    }
+
+#ifdef CPU_CURAND_AVX2
+    // The AVX2 functions clear the upper halves of the vector registers
+    // before they return, because the compiler does not always do this
+    // for the functions with gather instructions, and the scalar code
+    // that follows would otherwise be slowed down considerably
+
+    __attribute__((target("avx2")))
+    void normalsAvx2(const unsigned int *words, size_t stride, size_t n, float *z0, float *z1)
+    {
+        const __m256i lanes = _mm256_mullo_epi32(
+            _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int)stride));
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            const int *w = (const int*)(words + i * stride);
+            __m256 u = cpuCurandUniformSimd(_mm256_i32gather_epi32(w, lanes, 4));
+            __m256 v = cpuCurandUniformSimd(_mm256_i32gather_epi32(w + 1, lanes, 4));
+            __m256 a, b;
+            cpuCurandBoxMullerSimd(u, v, a, b);
+            _mm256_storeu_ps(z0 + i, a);
+            _mm256_storeu_ps(z1 + i, b);
+        }
+        _mm256_zeroupper();
+        normalsScalar(words + i * stride, stride, n - i, z0 + i, z1 + i);
+    }
+
+    __attribute__((target("avx2")))
+    void normalsAvx2(const unsigned int *words, size_t stride, size_t n, double *z0, double *z1)
+    {
+        const __m128i lanes = _mm_mullo_epi32(
+            _mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32((int)stride));
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const int *w = (const int*)(words + i * stride);
+            __m256d u = cpuCurandUniformDoubleSimd(
+                _mm_i32gather_epi32(w, lanes, 4), _mm_i32gather_epi32(w + 1, lanes, 4));
+            __m256d v = cpuCurandUniformDoubleSimd(
+                _mm_i32gather_epi32(w + 2, lanes, 4), _mm_i32gather_epi32(w + 3, lanes, 4));
+            __m256d a, b;
+            cpuCurandBoxMullerSimd(u, v, a, b);
+            _mm256_storeu_pd(z0 + i, a);
+            _mm256_storeu_pd(z1 + i, b);
+        }
+        _mm256_zeroupper();
+        normalsScalar(words + i * stride, stride, n - i, z0 + i, z1 + i);
+    }
+
+    __attribute__((target("avx2")))
+    void attemptAvx2(const unsigned int *words, size_t stride, const unsigned int *units,
+        size_t n, size_t uniform, const float *z, float d, float c, float *x, unsigned char *states)
+    {
+        const __m256i strides = _mm256_set1_epi32((int)stride);
+        const __m256i offset = _mm256_set1_epi32((int)uniform);
+        size_t j = 0;
+        for (; j + 8 <= n; j += 8)
+        {
+            __m256i index = _mm256_loadu_si256((const __m256i*)(units + j));
+            __m256 zj = _mm256_i32gather_ps(z, index, 4);
+            __m256 u = cpuCurandUniformSimd(_mm256_i32gather_epi32((const int*)words,
+                _mm256_add_epi32(_mm256_mullo_epi32(index, strides), offset), 4));
+            __m256 t = _mm256_add_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(c), zj));
+            __m256 v = _mm256_mul_ps(_mm256_mul_ps(t, t), t);
+            __m256 z2 = _mm256_mul_ps(zj, zj);
+            __m256 bound = _mm256_sub_ps(_mm256_set1_ps(1.0f),
+                _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.0331f), z2), z2));
+            int positive = _mm256_movemask_ps(_mm256_cmp_ps(t, _mm256_setzero_ps(), _CMP_GT_OQ));
+            int accepted = _mm256_movemask_ps(_mm256_cmp_ps(u, bound, _CMP_LT_OQ)) & positive;
+            float values[8];
+            _mm256_storeu_ps(values, _mm256_mul_ps(_mm256_set1_ps(d), v));
+            for (int k = 0; k < 8; k++)
+            {
+                if (((positive >> k) & 1) == 0)
+                {
+                    states[j + k] = ATTEMPT_REJECTED;
+                    continue;
+                }
+                x[units[j + k]] = values[k];
+                states[j + k] = ((accepted >> k) & 1) ? ATTEMPT_ACCEPTED : ATTEMPT_SQUEEZE_FAILED;
+            }
+        }
+        _mm256_zeroupper();
+        attemptScalar(words, stride, units + j, n - j, uniform, z, d, c, x, states + j);
+    }
+
+    __attribute__((target("avx2")))
+    void attemptAvx2(const unsigned int *words, size_t stride, const unsigned int *units,
+        size_t n, size_t uniform, const double *z, double d, double c, double *x, unsigned char *states)
+    {
+        const __m128i strides = _mm_set1_epi32((int)stride);
+        const __m128i offset = _mm_set1_epi32((int)(2 * uniform));
+        size_t j = 0;
+        for (; j + 4 <= n; j += 4)
+        {
+            __m128i index = _mm_loadu_si128((const __m128i*)(units + j));
+            __m256d zj = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), z, index,
+                _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+            __m128i wordIndex = _mm_add_epi32(_mm_mullo_epi32(index, strides), offset);
+            __m256d u = cpuCurandUniformDoubleSimd(
+                _mm_i32gather_epi32((const int*)words, wordIndex, 4),
+                _mm_i32gather_epi32((const int*)words + 1, wordIndex, 4));
+            __m256d t = _mm256_add_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(_mm256_set1_pd(c), zj));
+            __m256d v = _mm256_mul_pd(_mm256_mul_pd(t, t), t);
+            __m256d z2 = _mm256_mul_pd(zj, zj);
+            __m256d bound = _mm256_sub_pd(_mm256_set1_pd(1.0),
+                _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(0.0331), z2), z2));
+            int positive = _mm256_movemask_pd(_mm256_cmp_pd(t, _mm256_setzero_pd(), _CMP_GT_OQ));
+            int accepted = _mm256_movemask_pd(_mm256_cmp_pd(u, bound, _CMP_LT_OQ)) & positive;
+            double values[4];
+            _mm256_storeu_pd(values, _mm256_mul_pd(_mm256_set1_pd(d), v));
+            for (int k = 0; k < 4; k++)
+            {
+                if (((positive >> k) & 1) == 0)
+                {
+                    states[j + k] = ATTEMPT_REJECTED;
+                    continue;
+                }
+                x[units[j + k]] = values[k];
+                states[j + k] = ((accepted >> k) & 1) ? ATTEMPT_ACCEPTED : ATTEMPT_SQUEEZE_FAILED;
+            }
+        }
+        _mm256_zeroupper();
+        attemptScalar(words, stride, units + j, n - j, uniform, z, d, c, x, states + j);
+    }
+#endif
+
+    template <typename T>
+    Kernels<T> selectKernels()
+    {
+        Kernels<T> kernels;
+#ifdef CPU_CURAND_AVX2
+        if (__builtin_cpu_supports("avx2"))
+        {
+            kernels.normals = normalsAvx2;
+            kernels.attempt = attemptAvx2;
+            return kernels;
+        }
+#endif
+        kernels.normals = normalsScalar<T>;
+        kernels.attempt = attemptScalar<T>;
+        return kernels;
+    }
+
+    template <typename T>
+    size_t marsagliaTsang(const Kernels<T> &kernels, const unsigned int *words,
+        size_t stride, size_t n, T d, T c, T *x, size_t *rejected)
+    {
+        T z[2][BLOCK_SIZE];
+        unsigned int units[BLOCK_SIZE];
+        unsigned char states[BLOCK_SIZE];
+        size_t numRejected = 0;
+        for (size_t begin = 0; begin < n; begin += BLOCK_SIZE)
+        {
+            size_t size = n - begin < BLOCK_SIZE ? n - begin : BLOCK_SIZE;
+            const unsigned int *blockWords = words + begin * stride;
+            T *blockX = x + begin;
+            kernels.normals(blockWords, stride, size, z[0], z[1]);
+            for (size_t i = 0; i < size; i++)
+            {
+                units[i] = (unsigned int)i;
+            }
+            size_t pending = size;
+            for (size_t k = 0; k < 2 && pending > 0; k++)
+            {
+                kernels.attempt(blockWords, stride, units, pending, 2 + k, z[k], d, c, blockX, states);
+
+                // Compact the units that are still rejected, for the
+                // next attempt or the list of rejected units
+                size_t remaining = 0;
+                for (size_t j = 0; j < pending; j++)
+                {
+                    unsigned int i = units[j];
+                    if (states[j] == ATTEMPT_ACCEPTED)
+                    {
+                        continue;
+                    }
+                    if (states[j] == ATTEMPT_SQUEEZE_FAILED &&
+                        exactTest(z[k][i], uniformAt(blockWords + i * stride, 2 + k, T()), d, c, blockX[i]))
+                    {
+                        continue;
+                    }
+                    units[remaining++] = i;
+                }
+                pending = remaining;
+            }
+            for (size_t j = 0; j < pending; j++)
+            {
+                rejected[numRejected++] = begin + units[j];
+            }
+        }
+        return numRejected;
+    }
+}
+
+size_t cpuCurandMarsagliaTsang(const unsigned int *words, size_t stride, size_t n,
+    float d, float c, float *x, size_t *rejected)
+{
+    static const Kernels<float> kernels = selectKernels<float>();
+    return marsagliaTsang(kernels, words, stride, n, d, c, x, rejected);
+}
+
+size_t cpuCurandMarsagliaTsang(const unsigned int *words, size_t stride, size_t n,
+    double d, double c, double *x, size_t *rejected)
+{
+    static const Kernels<double> kernels = selectKernels<double>();
+    return marsagliaTsang(kernels, words, stride, n, d, c, x, rejected);
+}
@@ -0,0 +1,55 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_CPU_CURAND_GAMMA
+#define JCURAND_CPU_CURAND_GAMMA
+
+#include <stddef.h>
+
+/**
+ * Computes the first pass of the gamma sampling method of Marsaglia and
+ * Tsang, for n units whose words start 'stride' words apart. The uniform
+ * samples 0 and 1 of a unit (one word each for floats, and two words each
+ * for doubles) provide two normal samples z with the Box-Muller transform,
+ * which are tried with the uniform samples 2 and 3. The sample d * v,
+ * with v = (1 + c z)^3, of each accepted unit is written into x.
+ *
+ * The units that are rejected by the first attempt are compacted, so
+ * that the second attempt runs with all vector lanes in use. The indices
+ * of the units that are rejected by both attempts are written into
+ * 'rejected', in increasing order, and their number is returned.
+ *
+ * The results do not depend on whether AVX2 instructions are used.
+ */
+size_t cpuCurandMarsagliaTsang(const unsigned int *words, size_t stride, size_t n,
+    float d, float c, float *x, size_t *rejected);
+
+size_t cpuCurandMarsagliaTsang(const unsigned int *words, size_t stride, size_t n,
+    double d, double c, double *x, size_t *rejected);
+
+#endif
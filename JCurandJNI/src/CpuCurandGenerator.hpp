@@ -0,0 +1,395 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_CPU_CURAND_GENERATOR
+#define JCURAND_CPU_CURAND_GENERATOR
+
+#include <stddef.h>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <curand.h>
+
+#include "CpuCurandEngines.hpp"
+#include "CpuCurandParallel.hpp"
+#include "JCurandExtensions.hpp"
+
+/**
+ * The number of outputs that are computed by one parallel task
+ */
+#define CPU_CURAND_TASK_SIZE (1 << 16)
+
+/**
+ * The number of outputs that one task converts at once, so that
+ * the raw words remain in the cache
+ */
+#define CPU_CURAND_CHUNK_SIZE 1024
+
+/**
+ * The number of dimensions that are transposed at once for the
+ * point-major output of quasirandom generators
+ */
+#define CPU_CURAND_QUASI_TILE_SIZE 32
+
+struct CpuPoissonTable;
+struct CpuLanes;
+
+/**
+ * The state of a generator of the CPU emulation of CURAND. Pointers
+ * to this structure are handed out as curandGenerator_t.
+ *
+ * For pseudorandom generators, the 'position' is the number of raw
+ * words that have been consumed since the 'offset', in the given
+ * 'subsequence'. For quasirandom generators, it is the number of
+ * points that have been consumed, and the 'layout' tells whether
+ * they are stored dimension-major (column major) or point-major
+ * (row major). Sobol generators may use the direction vectors of a
+ * 'directionFile', and the Owen 'scrambling' with the given seed.
+ *
+ * In the concurrent mode, the 'lanes' contain one generator for each
+ * calling thread, which is used instead of this generator.
+ */
+struct CpuGenerator
+{
+    curandRngType_t type;
+    unsigned long long seed;
+    unsigned long long offset;
+    unsigned long long position;
+    unsigned long long subsequence;
+    curandOrdering_t ordering;
+    unsigned int dimensions;
+    curandAntitheticMode_t antithetic;
+    curandLayout_t layout;
+    const CpuDirectionFile *directionFile;
+    curandScramblingMode_t scrambling;
+    unsigned long long scramblingSeed;
+    CpuEngine *engine;
+    std::shared_ptr<CpuPoissonTable> poissonTable;
+    CpuLanes *lanes;
+};
+
+/**
+ * Returns whether the given generator is a quasirandom generator
+ */
+inline bool cpuCurandIsQuasi(const CpuGenerator *generator)
+{
+    return generator->type >= CURAND_RNG_QUASI_DEFAULT;
+}
+
+/**
+ * Returns the generator that the calling thread has to use for the
+ * given generator. This is the lane of the calling thread if the
+ * generator is in the concurrent mode, and the generator itself
+ * otherwise.
+ */
+CpuGenerator *cpuCurandLane(CpuGenerator *generator);
+
+/**
+ * Make sure that the engine of the given generator has been created
+ * for its current seed, subsequence and dimensions
+ */
+curandStatus_t cpuCurandPrepare(CpuGenerator *generator);
+
+/**
+ * Fill the given output array with n values that are computed from
+ * the raw words of the given pseudorandom generator. The transform is
+ * called with (const Word *words, T *output, size_t count), and has to
+ * consume wordsPerOutput words for each output. The counts are always
+ * even unless n is odd. Afterwards, the generator is advanced past
+ * the words that have been consumed.
+ *
+ * The results only depend on the position of each output in the
+ * stream, and not on the number of threads.
+ */
+template <typename Word, typename T, typename Transform>
+void cpuCurandGeneratePseudo(CpuGenerator *generator, T *output, size_t n,
+    size_t wordsPerOutput, const Transform &transform)
+{
+    CpuEngine *engine = generator->engine;
+    const unsigned long long base = generator->offset + generator->position;
+    const size_t numTasks = (n + CPU_CURAND_TASK_SIZE - 1) / CPU_CURAND_TASK_SIZE;
+    auto task = [&](size_t t)
+    {
+        size_t begin = t * CPU_CURAND_TASK_SIZE;
+        size_t end = begin + CPU_CURAND_TASK_SIZE < n ? begin + CPU_CURAND_TASK_SIZE : n;
+        std::unique_ptr<CpuEngineCursor> cursor(engine->newCursor());
+        cursor->seek(0, base + begin * wordsPerOutput);
+        std::vector<Word> words(CPU_CURAND_CHUNK_SIZE * wordsPerOutput);
+        for (size_t i = begin; i < end; i += CPU_CURAND_CHUNK_SIZE)
+        {
+            size_t count = end - i < CPU_CURAND_CHUNK_SIZE ? end - i : CPU_CURAND_CHUNK_SIZE;
+            cursor->next(words.data(), count * wordsPerOutput);
+            transform((const Word*)words.data(), output + i, count);
+        }
+    };
+    if (engine->isRandomAccess())
+    {
+        cpuCurandParallelFor(numTasks, task);
+    }
+    else
+    {
+        for (size_t t = 0; t < numTasks; t++)
+        {
+            task(t);
+        }
+    }
+    generator->position += n * wordsPerOutput;
+}
+
+/**
+ * Fill the given output array with the n values of the next points of
+ * the given quasirandom generator in point-major order, where the
+ * coordinates of each point are stored contiguously. Each task covers
+ * a block of points and a tile of dimensions, with one cursor for each
+ * dimension of the tile. The words of a chunk of points are transposed
+ * in the cache, so that the transform writes the coordinates of each
+ * point in the tile at once.
+ */
+template <typename Word, typename T, typename Transform>
+void cpuCurandGenerateQuasiPointMajor(CpuGenerator *generator, T *output, size_t n,
+    const Transform &transform)
+{
+    CpuEngine *engine = generator->engine;
+    const unsigned long long base = generator->offset + generator->position;
+    const size_t dimensions = generator->dimensions;
+    const size_t points = n / dimensions;
+    const size_t tileSize = std::min(dimensions, (size_t)CPU_CURAND_QUASI_TILE_SIZE);
+    const size_t numTiles = (dimensions + tileSize - 1) / tileSize;
+    const size_t chunkPoints = CPU_CURAND_CHUNK_SIZE / tileSize;
+    const size_t taskPoints = CPU_CURAND_TASK_SIZE / tileSize;
+    const size_t numBlocks = (points + taskPoints - 1) / taskPoints;
+    auto task = [&](size_t t)
+    {
+        size_t firstDimension = (t % numTiles) * tileSize;
+        size_t tileDimensions = std::min(tileSize, dimensions - firstDimension);
+        size_t begin = (t / numTiles) * taskPoints;
+        size_t end = std::min(begin + taskPoints, points);
+        std::vector<std::unique_ptr<CpuEngineCursor> > cursors(tileDimensions);
+        for (size_t k = 0; k < tileDimensions; k++)
+        {
+            cursors[k].reset(engine->newCursor());
+            cursors[k]->seek((unsigned int)(firstDimension + k), base + begin);
+        }
+        Word column[CPU_CURAND_CHUNK_SIZE];
+        Word words[CPU_CURAND_CHUNK_SIZE];
+        for (size_t i = begin; i < end; i += chunkPoints)
+        {
+            size_t count = std::min(chunkPoints, end - i);
+            for (size_t k = 0; k < tileDimensions; k++)
+            {
+                cursors[k]->next(column, count);
+                for (size_t p = 0; p < count; p++)
+                {
+                    words[p * tileDimensions + k] = column[p];
+                }
+            }
+            if (tileDimensions == dimensions)
+            {
+                transform((const Word*)words, output + i * dimensions, count * dimensions);
+                continue;
+            }
+            for (size_t p = 0; p < count; p++)
+            {
+                transform((const Word*)words + p * tileDimensions,
+                    output + (i + p) * dimensions + firstDimension, tileDimensions);
+            }
+        }
+    };
+    cpuCurandParallelFor(numBlocks * numTiles, task);
+    generator->position += points;
+}
+
+/**
+ * Fill the given output array with n values that are computed from
+ * the given quasirandom generator, in the dimension-major order of
+ * CURAND: The first n/dimensions values are the first coordinates of
+ * the next points, followed by their second coordinates, and so on.
+ * If the layout of the generator is CURAND_LAYOUT_ROW_MAJOR, then the
+ * values are stored in point-major order instead.
+ * The transform is called with (const Word *words, T *output, size_t
+ * count), and has to consume one word for each output. The caller has
+ * to make sure that n is a multiple of the number of dimensions.
+ */
+template <typename Word, typename T, typename Transform>
+void cpuCurandGenerateQuasi(CpuGenerator *generator, T *output, size_t n,
+    const Transform &transform)
+{
+    if (generator->layout == CURAND_LAYOUT_ROW_MAJOR)
+    {
+        cpuCurandGenerateQuasiPointMajor<Word>(generator, output, n, transform);
+        return;
+    }
+    CpuEngine *engine = generator->engine;
+    const unsigned long long base = generator->offset + generator->position;
+    const size_t points = n / generator->dimensions;
+    const size_t tasksPerDimension = (points + CPU_CURAND_TASK_SIZE - 1) / CPU_CURAND_TASK_SIZE;
+    const size_t numTasks = tasksPerDimension * generator->dimensions;
+    auto task = [&](size_t t)
+    {
+        unsigned int dimension = (unsigned int)(t / tasksPerDimension);
+        size_t begin = (t % tasksPerDimension) * CPU_CURAND_TASK_SIZE;
+        size_t end = begin + CPU_CURAND_TASK_SIZE < points ? begin + CPU_CURAND_TASK_SIZE : points;
+        T *dimensionOutput = output + (size_t)dimension * points;
+        std::unique_ptr<CpuEngineCursor> cursor(engine->newCursor());
+        cursor->seek(dimension, base + begin);
+        Word words[CPU_CURAND_CHUNK_SIZE];
+        for (size_t i = begin; i < end; i += CPU_CURAND_CHUNK_SIZE)
+        {
+            size_t count = end - i < CPU_CURAND_CHUNK_SIZE ? end - i : CPU_CURAND_CHUNK_SIZE;
+            cursor->next(words, count);
+            transform((const Word*)words, dimensionOutput + i, count);
+        }
+    };
+    cpuCurandParallelFor(numTasks, task);
+    generator->position += points;
+}
+
+/**
+ * Compute n units of output with a rejection method, for samples that
+ * process many units at once. The batch function is called with
+ * (const unsigned int *words, size_t first, size_t count, bool retry,
+ * size_t *rejected), for the wordsPerUnit words of each of the 'count'
+ * consecutive units that start at unit 'first'. It has to write the
+ * outputs of the accepted units, write the indices of the rejected units
+ * into 'rejected', in increasing order, and return their number. The
+ * 'retry' flag tells whether the units have been rejected before. Each
+ * unit is first tried with the words at its own position in the stream,
+ * in parallel, like in cpuCurandGeneratePseudo. The units whose words
+ * have been rejected are then computed one by one in increasing order,
+ * with the words that follow the n units in the stream, until they are
+ * accepted.
+ *
+ * The results do not depend on the number of threads. The generator
+ * is advanced past all words that have been consumed.
+ */
+template <typename Batch>
+void cpuCurandGenerateRejectionBatch(CpuGenerator *generator, size_t n,
+    size_t wordsPerUnit, const Batch &batch)
+{
+    CpuEngine *engine = generator->engine;
+    const unsigned long long base = generator->offset + generator->position;
+    const size_t numTasks = (n + CPU_CURAND_TASK_SIZE - 1) / CPU_CURAND_TASK_SIZE;
+    std::vector<size_t> rejected;
+    std::mutex rejectedMutex;
+    auto task = [&](size_t t)
+    {
+        size_t begin = t * CPU_CURAND_TASK_SIZE;
+        size_t end = begin + CPU_CURAND_TASK_SIZE < n ? begin + CPU_CURAND_TASK_SIZE : n;
+        std::unique_ptr<CpuEngineCursor> cursor(engine->newCursor());
+        cursor->seek(0, base + begin * wordsPerUnit);
+        std::vector<unsigned int> words(CPU_CURAND_CHUNK_SIZE * wordsPerUnit);
+        std::vector<size_t> chunkRejected(CPU_CURAND_CHUNK_SIZE);
+        std::vector<size_t> taskRejected;
+        for (size_t i = begin; i < end; i += CPU_CURAND_CHUNK_SIZE)
+        {
+            size_t count = end - i < CPU_CURAND_CHUNK_SIZE ? end - i : CPU_CURAND_CHUNK_SIZE;
+            cursor->next(words.data(), count * wordsPerUnit);
+            size_t numRejected = batch((const unsigned int*)words.data(), i, count, false, chunkRejected.data());
+            taskRejected.insert(taskRejected.end(), chunkRejected.begin(), chunkRejected.begin() + numRejected);
+        }
+        if (!taskRejected.empty())
+        {
+            std::lock_guard<std::mutex> lock(rejectedMutex);
+            rejected.insert(rejected.end(), taskRejected.begin(), taskRejected.end());
+        }
+    };
+    if (engine->isRandomAccess())
+    {
+        cpuCurandParallelFor(numTasks, task);
+    }
+    else
+    {
+        for (size_t t = 0; t < numTasks; t++)
+        {
+            task(t);
+        }
+    }
+    generator->position += n * wordsPerUnit;
+    if (rejected.empty())
+    {
+        return;
+    }
+
+    std::sort(rejected.begin(), rejected.end());
+    std::unique_ptr<CpuEngineCursor> cursor(engine->newCursor());
+    cursor->seek(0, generator->offset + generator->position);
+    std::vector<unsigned int> words(wordsPerUnit);
+    size_t stillRejected;
+    for (size_t i = 0; i < rejected.size(); i++)
+    {
+        do
+        {
+            cursor->next(words.data(), wordsPerUnit);
+            generator->position += wordsPerUnit;
+        } while (batch((const unsigned int*)words.data(), rejected[i], 1, true, &stillRejected) != 0);
+    }
+}
+
+/**
+ * The batch function of cpuCurandGenerateRejectionBatch for a sample
+ * function that processes single units
+ */
+template <typename Sample>
+struct CpuRejectionUnits
+{
+    const Sample &sample;
+    size_t wordsPerUnit;
+
+    size_t operator()(const unsigned int *words, size_t first, size_t count,
+        bool retry, size_t *rejected) const
+    {
+        size_t numRejected = 0;
+        for (size_t j = 0; j < count; j++)
+        {
+            if (!sample(words + j * wordsPerUnit, first + j, retry))
+            {
+                rejected[numRejected++] = first + j;
+            }
+        }
+        return numRejected;
+    }
+};
+
+/**
+ * Compute n units of output with a rejection method. The sample
+ * function is called with (const unsigned int *words, size_t unit,
+ * bool retry), has to write the outputs of the given unit, and returns
+ * whether the given words have been accepted. The 'retry' flag tells
+ * whether the unit has been rejected before. The units are computed
+ * like in cpuCurandGenerateRejectionBatch.
+ */
+template <typename Sample>
+void cpuCurandGenerateRejection(CpuGenerator *generator, size_t n,
+    size_t wordsPerUnit, const Sample &sample)
+{
+    CpuRejectionUnits<Sample> batch = { sample, wordsPerUnit };
+    cpuCurandGenerateRejectionBatch(generator, n, wordsPerUnit, batch);
+}
+
+#endif
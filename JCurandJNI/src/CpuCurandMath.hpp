@@ -0,0 +1,202 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_CPU_CURAND_MATH
+#define JCURAND_CPU_CURAND_MATH
+
+#include <math.h>
+
+/**
+ * Inline functions that convert raw random words into samples of
+ * distributions, using the same conventions as CURAND: Uniform
+ * samples are in (0,1], and never 0.
+ */
+
+#define CPU_CURAND_2POW32_INV (2.3283064e-10f)
+#define CPU_CURAND_2POW32_INV_DOUBLE (2.3283064365386963e-10)
+#define CPU_CURAND_2POW53_INV_DOUBLE (1.1102230246251565e-16)
+#define CPU_CURAND_2POW64_INV (5.4210109e-20f)
+#define CPU_CURAND_PI_DOUBLE (3.1415926535897932)
+#define CPU_CURAND_SQRT2PI_DOUBLE (2.5066282746310002)
+
+inline float cpuCurandUniform(unsigned int x)
+{
+    return x * CPU_CURAND_2POW32_INV + (CPU_CURAND_2POW32_INV / 2.0f);
+}
+
+inline float cpuCurandUniform(unsigned long long x)
+{
+    return x * CPU_CURAND_2POW64_INV + (CPU_CURAND_2POW64_INV / 2.0f);
+}
+
+inline double cpuCurandUniformDouble(unsigned int x)
+{
+    return x * CPU_CURAND_2POW32_INV_DOUBLE + (CPU_CURAND_2POW32_INV_DOUBLE / 2.0);
+}
+
+inline double cpuCurandUniformDouble(unsigned long long x)
+{
+    return (x >> 11) * CPU_CURAND_2POW53_INV_DOUBLE + (CPU_CURAND_2POW53_INV_DOUBLE / 2.0);
+}
+
+/**
+ * Combines two 32 bit words into a uniform double with 53 random bits
+ */
+inline double cpuCurandUniformDouble(unsigned int x, unsigned int y)
+{
+    unsigned long long z = (unsigned long long)x ^ ((unsigned long long)y << (53 - 32));
+    return z * CPU_CURAND_2POW53_INV_DOUBLE + (CPU_CURAND_2POW53_INV_DOUBLE / 2.0);
+}
+
+/**
+ * Returns the fraction in [0, 1) with the 32 bits of x, the upper 53
+ * bits of x, or the 53 bits of two words combined like in
+ * cpuCurandUniformDouble. Unlike the uniform values, which are in
+ * (0, 1), these include 0 and exclude 1.
+ */
+inline double cpuCurandFraction(unsigned int x)
+{
+    return x * CPU_CURAND_2POW32_INV_DOUBLE;
+}
+
+inline double cpuCurandFraction(unsigned long long x)
+{
+    return (x >> 11) * CPU_CURAND_2POW53_INV_DOUBLE;
+}
+
+inline double cpuCurandFraction(unsigned int x, unsigned int y)
+{
+    unsigned long long z = (unsigned long long)x ^ ((unsigned long long)y << (53 - 32));
+    return z * CPU_CURAND_2POW53_INV_DOUBLE;
+}
+
+/**
+ * Returns the upper 64 bits of the 128 bit product of a and b, and
+ * stores the lower 64 bits in 'low'
+ */
+inline unsigned long long cpuCurandMultiplyHigh(unsigned long long a,
+    unsigned long long b, unsigned long long &low)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 p = (unsigned __int128)a * b;
+    low = (unsigned long long)p;
+    return (unsigned long long)(p >> 64);
+#else
+    unsigned long long a0 = a & 0xFFFFFFFFull;
+    unsigned long long a1 = a >> 32;
+    unsigned long long b0 = b & 0xFFFFFFFFull;
+    unsigned long long b1 = b >> 32;
+    unsigned long long p00 = a0 * b0;
+    unsigned long long p01 = a0 * b1;
+    unsigned long long p10 = a1 * b0;
+    unsigned long long middle = (p00 >> 32) + (p01 & 0xFFFFFFFFull) + (p10 & 0xFFFFFFFFull);
+    low = (middle << 32) | (p00 & 0xFFFFFFFFull);
+    return a1 * b1 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+#endif
+}
+
+/**
+ * Computes two standard normal samples from two uniform samples in
+ * (0,1] with the Box-Muller transform
+ */
+inline void cpuCurandBoxMuller(float u, float v, float &a, float &b)
+{
+    float s = sqrtf(-2.0f * logf(u));
+    float t = 2.0f * (float)CPU_CURAND_PI_DOUBLE * v;
+    a = sinf(t) * s;
+    b = cosf(t) * s;
+}
+
+inline void cpuCurandBoxMuller(double u, double v, double &a, double &b)
+{
+    double s = sqrt(-2.0 * log(u));
+    double t = 2.0 * CPU_CURAND_PI_DOUBLE * v;
+    a = sin(t) * s;
+    b = cos(t) * s;
+}
+
+/**
+ * One step of Halley's method for the inverse of the standard normal
+ * cumulative distribution function, which improves the approximation
+ * x for p to full double precision
+ */
+inline double cpuCurandNormalCdfInvRefine(double x, double p)
+{
+    double e = 0.5 * erfc(-x / sqrt(2.0)) - p;
+    double u = e * CPU_CURAND_SQRT2PI_DOUBLE * exp(x * x / 2.0);
+    return x - u / (1.0 + x * u / 2.0);
+}
+
+/**
+ * Computes the inverse of the standard normal cumulative distribution
+ * function for p in (0,1], with Acklam's rational approximation and,
+ * if 'refine' is true, one step of Halley's method, which gives full
+ * double precision. For p = 1, a large finite value is returned.
+ */
+inline double cpuCurandNormalCdfInv(double p, bool refine)
+{
+    static const double a[] = { -3.969683028665376e+01, 2.209460984245205e+02,
+        -2.759285104469687e+02, 1.383577518672690e+02, -3.066479806614716e+01,
+        2.506628277459239e+00 };
+    static const double b[] = { -5.447609879822406e+01, 1.615858368580409e+02,
+        -1.556989798598866e+02, 6.680131188771972e+01, -1.328068155288572e+01 };
+    static const double c[] = { -7.784894002430293e-03, -3.223964580411365e-01,
+        -2.400758277161838e+00, -2.549732539343734e+00, 4.374664141464968e+00,
+        2.938163982698783e+00 };
+    static const double d[] = { 7.784695709041462e-03, 3.224671290700398e-01,
+        2.445134137142996e+00, 3.754408661907416e+00 };
+    const double pLow = 0.02425;
+
+    if (p >= 1.0)
+    {
+        p = 1.0 - CPU_CURAND_2POW53_INV_DOUBLE;
+    }
+    double x;
+    if (p < pLow)
+    {
+        double q = sqrt(-2.0 * log(p));
+        x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    }
+    else if (p <= 1.0 - pLow)
+    {
+        double q = p - 0.5;
+        double r = q * q;
+        x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+            (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+    }
+    else
+    {
+        double q = sqrt(-2.0 * log(1.0 - p));
+        x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    }
+    return refine ? cpuCurandNormalCdfInvRefine(x, p) : x;
+}
+
+#endif
@@ -0,0 +1,747 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CpuCurand.hpp"
+#include "CpuCurandGenerator.hpp"
+#include "CpuCurandMath.hpp"
+
+#include <math.h>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CPU_CURAND_AVX2
+#endif
+
+/**
+ * The distribution that is handed out as curandMultivariateNormal_t.
+ * The factor is the lower triangular Cholesky factor L of the
+ * covariance matrix, stored as a full row-major matrix with zeros
+ * above the diagonal, in double and in float precision.
+ */
+struct CpuMultivariateNormal
+{
+    unsigned int dimensions;
+    std::vector<double> mean;
+    std::vector<double> factor;
+    std::vector<float> meanFloat;
+    std::vector<float> factorFloat;
+
+    const double *getMean(double) const { return mean.data(); }
+    const float *getMean(float) const { return meanFloat.data(); }
+    const double *getFactor(double) const { return factor.data(); }
+    const float *getFactor(float) const { return factorFloat.data(); }
+};
+
+/**
+ * The Brownian bridge that is handed out as curandBrownianBridge_t.
+ * The path values are constructed in the order of the steps: Step k
+ * computes the value at the time with the given index from the values
+ * at the left and right times (or -1 for none, at the time 0 or for
+ * the last time), as leftWeight * left + rightWeight * right +
+ * stddev * z[k]. The three weights of each step are stored in this
+ * order, in double and in float precision.
+ */
+struct CpuBrownianBridge
+{
+    unsigned int steps;
+    std::vector<unsigned int> index;
+    std::vector<int> left;
+    std::vector<int> right;
+    std::vector<double> weights;
+    std::vector<float> weightsFloat;
+
+    const double *getWeights(double) const { return weights.data(); }
+    const float *getWeights(float) const { return weightsFloat.data(); }
+};
+
+namespace
+{
+    /**
+     * The number of vectors that are transformed at once. The normal
+     * samples of a block are stored dimension-major, so that each
+     * element of the factor is applied to the whole block with a few
+     * vector instructions.
+     */
+    const size_t BLOCK_SIZE = 32;
+
+    /**
+     * The number of columns of the factor that are applied to all rows
+     * at once, so that the corresponding normal samples of a block
+     * remain in the L1 cache
+     */
+    const size_t TILE_SIZE = 64;
+
+    /**
+     * Computes x = mean + L * z for a block of BLOCK_SIZE vectors, where
+     * z and x are stored dimension-major, as d rows of BLOCK_SIZE values
+     */
+    template <typename T>
+    void multiplyScalar(const T *factor, const T *mean, size_t d, const T *z, T *x)
+    {
+        for (size_t j = 0; j < d; j++)
+        {
+            for (size_t b = 0; b < BLOCK_SIZE; b++)
+            {
+                x[j * BLOCK_SIZE + b] = mean[j];
+            }
+        }
+        for (size_t k0 = 0; k0 < d; k0 += TILE_SIZE)
+        {
+            size_t k1 = k0 + TILE_SIZE < d ? k0 + TILE_SIZE : d;
+            for (size_t j = k0; j < d; j++)
+            {
+                const T *row = factor + j * d;
+                T *xj = x + j * BLOCK_SIZE;
+                size_t kEnd = j + 1 < k1 ? j + 1 : k1;
+                for (size_t k = k0; k < kEnd; k++)
+                {
+                    const T f = row[k];
+                    const T *zk = z + k * BLOCK_SIZE;
+                    for (size_t b = 0; b < BLOCK_SIZE; b++)
+                    {
+                        xj[b] += f * zk[b];
+                    }
+                }
+            }
+        }
+    }
+
+#ifdef CPU_CURAND_AVX2
+    /**
+     * The same as multiplyScalar, keeping one row of the block in
+     * registers while the columns of a tile are applied
+     */
+    __attribute__((target("avx2,fma")))
+    void multiplyAvx2(const float *factor, const float *mean, size_t d, const float *z, float *x)
+    {
+        for (size_t j = 0; j < d; j++)
+        {
+            __m256 m = _mm256_set1_ps(mean[j]);
+            for (size_t b = 0; b < BLOCK_SIZE; b += 8)
+            {
+                _mm256_storeu_ps(x + j * BLOCK_SIZE + b, m);
+            }
+        }
+        for (size_t k0 = 0; k0 < d; k0 += TILE_SIZE)
+        {
+            size_t k1 = k0 + TILE_SIZE < d ? k0 + TILE_SIZE : d;
+            for (size_t j = k0; j < d; j++)
+            {
+                const float *row = factor + j * d;
+                float *xj = x + j * BLOCK_SIZE;
+                size_t kEnd = j + 1 < k1 ? j + 1 : k1;
+                __m256 a0 = _mm256_loadu_ps(xj);
+                __m256 a1 = _mm256_loadu_ps(xj + 8);
+                __m256 a2 = _mm256_loadu_ps(xj + 16);
+                __m256 a3 = _mm256_loadu_ps(xj + 24);
+                for (size_t k = k0; k < kEnd; k++)
+                {
+                    const __m256 f = _mm256_set1_ps(row[k]);
+                    const float *zk = z + k * BLOCK_SIZE;
+                    a0 = _mm256_fmadd_ps(f, _mm256_loadu_ps(zk), a0);
+                    a1 = _mm256_fmadd_ps(f, _mm256_loadu_ps(zk + 8), a1);
+                    a2 = _mm256_fmadd_ps(f, _mm256_loadu_ps(zk + 16), a2);
+                    a3 = _mm256_fmadd_ps(f, _mm256_loadu_ps(zk + 24), a3);
+                }
+                _mm256_storeu_ps(xj, a0);
+                _mm256_storeu_ps(xj + 8, a1);
+                _mm256_storeu_ps(xj + 16, a2);
+                _mm256_storeu_ps(xj + 24, a3);
+            }
+        }
+    }
+
+    __attribute__((target("avx2,fma")))
+    void multiplyAvx2(const double *factor, const double *mean, size_t d, const double *z, double *x)
+    {
+        for (size_t j = 0; j < d; j++)
+        {
+            __m256d m = _mm256_set1_pd(mean[j]);
+            for (size_t b = 0; b < BLOCK_SIZE; b += 4)
+            {
+                _mm256_storeu_pd(x + j * BLOCK_SIZE + b, m);
+            }
+        }
+        for (size_t k0 = 0; k0 < d; k0 += TILE_SIZE)
+        {
+            size_t k1 = k0 + TILE_SIZE < d ? k0 + TILE_SIZE : d;
+            for (size_t j = k0; j < d; j++)
+            {
+                const double *row = factor + j * d;
+                double *xj = x + j * BLOCK_SIZE;
+                size_t kEnd = j + 1 < k1 ? j + 1 : k1;
+                __m256d a[8];
+                for (int r = 0; r < 8; r++)
+                {
+                    a[r] = _mm256_loadu_pd(xj + 4 * r);
+                }
+                for (size_t k = k0; k < kEnd; k++)
+                {
+                    const __m256d f = _mm256_set1_pd(row[k]);
+                    const double *zk = z + k * BLOCK_SIZE;
+                    for (int r = 0; r < 8; r++)
+                    {
+                        a[r] = _mm256_fmadd_pd(f, _mm256_loadu_pd(zk + 4 * r), a[r]);
+                    }
+                }
+                for (int r = 0; r < 8; r++)
+                {
+                    _mm256_storeu_pd(xj + 4 * r, a[r]);
+                }
+            }
+        }
+    }
+#endif
+
+    template <typename T>
+    struct Multiply
+    {
+        typedef void (*Function)(const T *factor, const T *mean, size_t d, const T *z, T *x);
+
+        static Function select()
+        {
+#ifdef CPU_CURAND_AVX2
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            {
+                return multiplyAvx2;
+            }
+#endif
+            return multiplyScalar<T>;
+        }
+
+        static void apply(const T *factor, const T *mean, size_t d, const T *z, T *x)
+        {
+            static const Function function = select();
+            function(factor, mean, d, z, x);
+        }
+    };
+
+    /**
+     * Fill the first 'count' columns of the dimension-major block z
+     * with normal samples from the given words of a pseudorandom
+     * generator. Each vector uses an even number of normal samples,
+     * which are computed pairwise with the Box-Muller transform.
+     */
+    void normalBlock(const unsigned int *words, size_t d, size_t count, float *z)
+    {
+        const size_t perVector = d + (d & 1);
+        for (size_t b = 0; b < count; b++)
+        {
+            const unsigned int *w = words + b * perVector;
+            for (size_t k = 0; k < d; k += 2)
+            {
+                float s, t;
+                cpuCurandBoxMuller(cpuCurandUniform(w[k]), cpuCurandUniform(w[k + 1]), s, t);
+                z[k * BLOCK_SIZE + b] = s;
+                if (k + 1 < d)
+                {
+                    z[(k + 1) * BLOCK_SIZE + b] = t;
+                }
+            }
+        }
+    }
+
+    void normalBlock(const unsigned int *words, size_t d, size_t count, double *z)
+    {
+        const size_t perVector = d + (d & 1);
+        for (size_t b = 0; b < count; b++)
+        {
+            const unsigned int *w = words + 2 * b * perVector;
+            for (size_t k = 0; k < d; k += 2)
+            {
+                double u = cpuCurandUniformDouble(w[2 * k], w[2 * k + 1]);
+                double v = cpuCurandUniformDouble(w[2 * k + 2], w[2 * k + 3]);
+                double s, t;
+                cpuCurandBoxMuller(u, v, s, t);
+                z[k * BLOCK_SIZE + b] = s;
+                if (k + 1 < d)
+                {
+                    z[(k + 1) * BLOCK_SIZE + b] = t;
+                }
+            }
+        }
+    }
+
+    /**
+     * Fill one row of the dimension-major block z with normal samples
+     * from the given words of one dimension of a quasirandom generator,
+     * by inversion
+     */
+    template <typename Word, typename T>
+    void normalRow(const Word *words, size_t count, T *row)
+    {
+        const bool refine = sizeof(T) == sizeof(double);
+        for (size_t b = 0; b < count; b++)
+        {
+            double u = sizeof(T) == sizeof(double) ?
+                cpuCurandUniformDouble(words[b]) : (double)cpuCurandUniform(words[b]);
+            row[b] = (T)cpuCurandNormalCdfInv(u, refine);
+        }
+    }
+
+    /**
+     * Write the first 'count' vectors of the dimension-major block x,
+     * which are the vectors starting at index i of n vectors, into the
+     * output, in the given layout
+     */
+    template <typename T>
+    void store(const T *x, size_t d, size_t count, size_t i, size_t n, curandLayout_t layout, T *output)
+    {
+        if (layout == CURAND_LAYOUT_ROW_MAJOR)
+        {
+            for (size_t b = 0; b < count; b++)
+            {
+                T *vector = output + (i + b) * d;
+                for (size_t j = 0; j < d; j++)
+                {
+                    vector[j] = x[j * BLOCK_SIZE + b];
+                }
+            }
+        }
+        else
+        {
+            for (size_t j = 0; j < d; j++)
+            {
+                T *column = output + j * n + i;
+                for (size_t b = 0; b < count; b++)
+                {
+                    column[b] = x[j * BLOCK_SIZE + b];
+                }
+            }
+        }
+    }
+
+    /**
+     * Generate n vectors with d elements, in parallel tasks of whole
+     * blocks of vectors. The normal samples of each block are computed
+     * and passed to the transform, which is called with (const T *z,
+     * T *x), where both are dimension-major blocks of BLOCK_SIZE
+     * vectors. For pseudorandom generators, each vector consumes the
+     * words for an even number of normal samples. For quasirandom
+     * generators, each vector is one point, and its coordinates are
+     * transformed into normal samples by inversion.
+     */
+    template <typename T, typename Transform>
+    void generate(CpuGenerator *g, T *output, size_t n, size_t d, const Transform &transform, curandLayout_t layout)
+    {
+        const bool quasi = cpuCurandIsQuasi(g);
+        const size_t wordsPerVector = (d + (d & 1)) * (sizeof(T) / sizeof(float));
+        size_t blocksPerTask = CPU_CURAND_TASK_SIZE / (d * BLOCK_SIZE);
+        const size_t vectorsPerTask = (blocksPerTask < 1 ? 1 : blocksPerTask) * BLOCK_SIZE;
+        const size_t numTasks = (n + vectorsPerTask - 1) / vectorsPerTask;
+
+        CpuEngine *engine = g->engine;
+        const unsigned long long base = g->offset + g->position;
+        auto task = [&](size_t t)
+        {
+            size_t begin = t * vectorsPerTask;
+            size_t end = begin + vectorsPerTask < n ? begin + vectorsPerTask : n;
+            std::vector<T> z(d * BLOCK_SIZE, (T)0);
+            std::vector<T> x(d * BLOCK_SIZE);
+            std::vector<unsigned int> words(quasi ? 0 : BLOCK_SIZE * wordsPerVector);
+            std::vector<unsigned long long> quasiWords(quasi ? BLOCK_SIZE : 0);
+
+            // Quasirandom generators use one cursor for each dimension,
+            // because seeking is more expensive than generating a block
+            std::vector<std::unique_ptr<CpuEngineCursor> > cursors(quasi ? d : 1);
+            for (size_t k = 0; k < cursors.size(); k++)
+            {
+                cursors[k].reset(engine->newCursor());
+                cursors[k]->seek((unsigned int)k, base + (quasi ? begin : begin * wordsPerVector));
+            }
+            for (size_t i = begin; i < end; i += BLOCK_SIZE)
+            {
+                size_t count = end - i < BLOCK_SIZE ? end - i : BLOCK_SIZE;
+                if (quasi)
+                {
+                    for (size_t k = 0; k < d; k++)
+                    {
+                        if (engine->is64Bit())
+                        {
+                            cursors[k]->next(quasiWords.data(), count);
+                            normalRow(quasiWords.data(), count, z.data() + k * BLOCK_SIZE);
+                        }
+                        else
+                        {
+                            unsigned int *w = reinterpret_cast<unsigned int*>(quasiWords.data());
+                            cursors[k]->next(w, count);
+                            normalRow(w, count, z.data() + k * BLOCK_SIZE);
+                        }
+                    }
+                }
+                else
+                {
+                    cursors[0]->next(words.data(), count * wordsPerVector);
+                    normalBlock(words.data(), d, count, z.data());
+                }
+                transform((const T*)z.data(), x.data());
+                store(x.data(), d, count, i, n, layout, output);
+            }
+        };
+        if (quasi || engine->isRandomAccess())
+        {
+            cpuCurandParallelFor(numTasks, task);
+        }
+        else
+        {
+            for (size_t t = 0; t < numTasks; t++)
+            {
+                task(t);
+            }
+        }
+        g->position += quasi ? n : n * wordsPerVector;
+    }
+
+    template <typename T>
+    curandStatus_t generateMultivariateNormal(curandGenerator_t generator, T *output, size_t n,
+        curandMultivariateNormal_t distribution, curandLayout_t layout)
+    {
+        CpuGenerator *g = cpuCurandLane(reinterpret_cast<CpuGenerator*>(generator));
+        curandStatus_t status = cpuCurandPrepare(g);
+        if (status != CURAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if (distribution == NULL)
+        {
+            return CURAND_STATUS_NOT_INITIALIZED;
+        }
+        if (layout != CURAND_LAYOUT_ROW_MAJOR && layout != CURAND_LAYOUT_COLUMN_MAJOR)
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        if (cpuCurandIsQuasi(g) && g->dimensions != distribution->dimensions)
+        {
+            return CURAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        const T *factor = distribution->getFactor(T());
+        const T *mean = distribution->getMean(T());
+        const size_t d = distribution->dimensions;
+        generate(g, output, n, d, [&](const T *z, T *x)
+        {
+            Multiply<T>::apply(factor, mean, d, z, x);
+        }, layout);
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * Compute the Cholesky factor of the symmetric matrix whose lower
+     * triangle is given in the row-major matrix a. Returns false if the
+     * matrix is not positive definite.
+     */
+    bool cholesky(const double *a, size_t d, double *factor)
+    {
+        for (size_t j = 0; j < d; j++)
+        {
+            double *lj = factor + j * d;
+            double s = a[j * d + j];
+            for (size_t k = 0; k < j; k++)
+            {
+                s -= lj[k] * lj[k];
+            }
+            if (!(s > 0.0))
+            {
+                return false;
+            }
+            lj[j] = sqrt(s);
+            for (size_t i = j + 1; i < d; i++)
+            {
+                double *li = factor + i * d;
+                double t = a[i * d + j];
+                for (size_t k = 0; k < j; k++)
+                {
+                    t -= li[k] * lj[k];
+                }
+                li[j] = t / lj[j];
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Construct the paths of the given bridge for 'count' vectors of
+     * normal samples z, into the path values x. Row k of z contains the
+     * normal samples of the step k, and row i of x the values at the
+     * time i, with the given distances between the rows.
+     */
+    template <typename T>
+    void constructPaths(const CpuBrownianBridge *bridge, const T *z, size_t zStride,
+        T *x, size_t xStride, size_t count)
+    {
+        static const T zeros[BLOCK_SIZE] = {};
+        const T *weights = bridge->getWeights(T());
+        for (size_t k = 0; k < bridge->steps; k++)
+        {
+            const T *left = bridge->left[k] < 0 ? zeros : x + bridge->left[k] * xStride;
+            const T *right = bridge->right[k] < 0 ? zeros : x + bridge->right[k] * xStride;
+            const T *zk = z + k * zStride;
+            T *xi = x + bridge->index[k] * xStride;
+            const T leftWeight = weights[3 * k];
+            const T rightWeight = weights[3 * k + 1];
+            const T stddev = weights[3 * k + 2];
+            for (size_t b = 0; b < count; b++)
+            {
+                xi[b] = leftWeight * left[b] + rightWeight * right[b] + stddev * zk[b];
+            }
+        }
+    }
+
+    /**
+     * Transform the given dimension-major normal samples of n paths
+     * into the path values in place, in parallel tasks of whole blocks
+     * of paths. The samples of each block are copied first, because
+     * the value at one time overwrites the samples of another step.
+     */
+    template <typename T>
+    curandStatus_t transformBrownianBridge(curandBrownianBridge_t bridge, T *data, size_t n)
+    {
+        if (bridge == NULL)
+        {
+            return CURAND_STATUS_NOT_INITIALIZED;
+        }
+        const size_t steps = bridge->steps;
+        size_t blocksPerTask = CPU_CURAND_TASK_SIZE / (steps * BLOCK_SIZE);
+        const size_t pathsPerTask = (blocksPerTask < 1 ? 1 : blocksPerTask) * BLOCK_SIZE;
+        const size_t numTasks = (n + pathsPerTask - 1) / pathsPerTask;
+        cpuCurandParallelFor(numTasks, [&](size_t t)
+        {
+            size_t begin = t * pathsPerTask;
+            size_t end = begin + pathsPerTask < n ? begin + pathsPerTask : n;
+            std::vector<T> z(steps * BLOCK_SIZE);
+            for (size_t i = begin; i < end; i += BLOCK_SIZE)
+            {
+                size_t count = end - i < BLOCK_SIZE ? end - i : BLOCK_SIZE;
+                for (size_t k = 0; k < steps; k++)
+                {
+                    std::copy(data + k * n + i, data + k * n + i + count, z.data() + k * BLOCK_SIZE);
+                }
+                constructPaths(bridge, (const T*)z.data(), BLOCK_SIZE, data + i, n, count);
+            }
+        });
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    curandStatus_t generateBrownianBridge(curandGenerator_t generator, T *output, size_t n,
+        curandBrownianBridge_t bridge, curandLayout_t layout)
+    {
+        CpuGenerator *g = cpuCurandLane(reinterpret_cast<CpuGenerator*>(generator));
+        curandStatus_t status = cpuCurandPrepare(g);
+        if (status != CURAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if (bridge == NULL)
+        {
+            return CURAND_STATUS_NOT_INITIALIZED;
+        }
+        if (layout != CURAND_LAYOUT_ROW_MAJOR && layout != CURAND_LAYOUT_COLUMN_MAJOR)
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        if (cpuCurandIsQuasi(g) && g->dimensions != bridge->steps)
+        {
+            return CURAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        generate(g, output, n, bridge->steps, [&](const T *z, T *x)
+        {
+            constructPaths(bridge, z, BLOCK_SIZE, x, BLOCK_SIZE, BLOCK_SIZE);
+        }, layout);
+        return CURAND_STATUS_SUCCESS;
+    }
+}
+
+curandStatus_t CURANDAPI cpuCurandCreateMultivariateNormal(curandMultivariateNormal_t *distribution, unsigned int dimensions, const double *mean, const double *matrix, curandMatrixType_t matrixType)
+{
+    if (dimensions < 1 || (matrixType != CURAND_MATRIX_COVARIANCE && matrixType != CURAND_MATRIX_CHOLESKY_FACTOR))
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    CpuMultivariateNormal *mvn = new (std::nothrow) CpuMultivariateNormal();
+    if (mvn == NULL)
+    {
+        return CURAND_STATUS_ALLOCATION_FAILED;
+    }
+    const size_t d = dimensions;
+    try
+    {
+        mvn->dimensions = dimensions;
+        mvn->mean.assign(d, 0.0);
+        mvn->factor.assign(d * d, 0.0);
+        if (mean != NULL)
+        {
+            mvn->mean.assign(mean, mean + d);
+        }
+        if (matrixType == CURAND_MATRIX_COVARIANCE)
+        {
+            if (!cholesky(matrix, d, mvn->factor.data()))
+            {
+                delete mvn;
+                return CURAND_STATUS_OUT_OF_RANGE;
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < d; i++)
+            {
+                for (size_t j = 0; j <= i; j++)
+                {
+                    mvn->factor[i * d + j] = matrix[i * d + j];
+                }
+            }
+        }
+        mvn->meanFloat.assign(mvn->mean.begin(), mvn->mean.end());
+        mvn->factorFloat.assign(mvn->factor.begin(), mvn->factor.end());
+    }
+    catch (const std::bad_alloc&)
+    {
+        delete mvn;
+        return CURAND_STATUS_ALLOCATION_FAILED;
+    }
+    *distribution = mvn;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandDestroyMultivariateNormal(curandMultivariateNormal_t distribution)
+{
+    if (distribution == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    delete distribution;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateMultivariateNormal(curandGenerator_t generator, float *outputPtr, size_t n, curandMultivariateNormal_t distribution, curandLayout_t layout)
+{
+    return generateMultivariateNormal(generator, outputPtr, n, distribution, layout);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateMultivariateNormalDouble(curandGenerator_t generator, double *outputPtr, size_t n, curandMultivariateNormal_t distribution, curandLayout_t layout)
+{
+    return generateMultivariateNormal(generator, outputPtr, n, distribution, layout);
+}
+
+curandStatus_t CURANDAPI cpuCurandCreateBrownianBridge(curandBrownianBridge_t *bridge, unsigned int steps, const double *times)
+{
+    if (steps < 1)
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    std::vector<double> t(steps);
+    for (unsigned int i = 0; i < steps; i++)
+    {
+        t[i] = times == NULL ? i + 1.0 : times[i];
+        if (!(t[i] > (i == 0 ? 0.0 : t[i - 1])) || !(t[i] < INFINITY))
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+    }
+    CpuBrownianBridge *b = new (std::nothrow) CpuBrownianBridge();
+    if (b == NULL)
+    {
+        return CURAND_STATUS_ALLOCATION_FAILED;
+    }
+    try
+    {
+        // The value at the last time comes first, followed by the
+        // midpoints of the intervals, in breadth-first order, so that
+        // the first samples determine the coarse shape of the path
+        b->steps = steps;
+        b->index.push_back(steps - 1);
+        b->left.push_back(-1);
+        b->right.push_back(-1);
+        b->weights.push_back(0.0);
+        b->weights.push_back(0.0);
+        b->weights.push_back(sqrt(t[steps - 1]));
+        std::vector<std::pair<int, int> > intervals(1, std::make_pair(-1, (int)steps - 1));
+        for (size_t q = 0; q < intervals.size(); q++)
+        {
+            int l = intervals[q].first;
+            int r = intervals[q].second;
+            if (r - l < 2)
+            {
+                continue;
+            }
+            int m = l + (r - l) / 2;
+            double tl = l < 0 ? 0.0 : t[l];
+            double tm = t[m];
+            double tr = t[r];
+            b->index.push_back(m);
+            b->left.push_back(l);
+            b->right.push_back(r);
+            b->weights.push_back((tr - tm) / (tr - tl));
+            b->weights.push_back((tm - tl) / (tr - tl));
+            b->weights.push_back(sqrt((tm - tl) * (tr - tm) / (tr - tl)));
+            intervals.push_back(std::make_pair(l, m));
+            intervals.push_back(std::make_pair(m, r));
+        }
+        b->weightsFloat.assign(b->weights.begin(), b->weights.end());
+    }
+    catch (const std::bad_alloc&)
+    {
+        delete b;
+        return CURAND_STATUS_ALLOCATION_FAILED;
+    }
+    *bridge = b;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandDestroyBrownianBridge(curandBrownianBridge_t bridge)
+{
+    if (bridge == NULL)
+    {
+        return CURAND_STATUS_NOT_INITIALIZED;
+    }
+    delete bridge;
+    return CURAND_STATUS_SUCCESS;
+}
+
+curandStatus_t CURANDAPI cpuCurandTransformBrownianBridge(curandBrownianBridge_t bridge, float *data, size_t n)
+{
+    return transformBrownianBridge(bridge, data, n);
+}
+
+curandStatus_t CURANDAPI cpuCurandTransformBrownianBridgeDouble(curandBrownianBridge_t bridge, double *data, size_t n)
+{
+    return transformBrownianBridge(bridge, data, n);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateBrownianBridge(curandGenerator_t generator, float *outputPtr, size_t n, curandBrownianBridge_t bridge, curandLayout_t layout)
+{
+    return generateBrownianBridge(generator, outputPtr, n, bridge, layout);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateBrownianBridgeDouble(curandGenerator_t generator, double *outputPtr, size_t n, curandBrownianBridge_t bridge, curandLayout_t layout)
+{
+    return generateBrownianBridge(generator, outputPtr, n, bridge, layout);
+}
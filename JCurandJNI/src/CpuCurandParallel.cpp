@@ -0,0 +1,185 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CpuCurandParallel.hpp"
+
+#include <stdlib.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * Whether the current thread is executing a task. Nested calls
+     * to cpuCurandParallelFor are executed sequentially.
+     */
+    thread_local bool insideTask = false;
+
+    /**
+     * A minimal pool of worker threads that executes one batch of
+     * indexed tasks at a time
+     */
+    class ThreadPool
+    {
+    public:
+        ThreadPool(int numWorkers)
+            : task(NULL), numTasks(0), nextTask(0),
+              generation(0), activeWorkers(0)
+        {
+            for (int i = 0; i < numWorkers; i++)
+            {
+                workers.push_back(std::thread(&ThreadPool::work, this));
+            }
+        }
+
+        /**
+         * Run the given batch, or return false if another batch
+         * is currently running
+         */
+        bool tryRun(size_t n, const std::function<void(size_t)> &t)
+        {
+            std::unique_lock<std::mutex> batchLock(batchMutex, std::try_to_lock);
+            if (!batchLock.owns_lock())
+            {
+                return false;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                task = &t;
+                numTasks = n;
+                nextTask = 0;
+                activeWorkers = (int)workers.size();
+                generation++;
+            }
+            started.notify_all();
+            runTasks(t, n);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [this] { return activeWorkers == 0; });
+            task = NULL;
+            return true;
+        }
+
+    private:
+        void runTasks(const std::function<void(size_t)> &t, size_t n)
+        {
+            insideTask = true;
+            size_t i;
+            while ((i = nextTask.fetch_add(1)) < n)
+            {
+                t(i);
+            }
+            insideTask = false;
+        }
+
+        void work()
+        {
+            unsigned long long seenGeneration = 0;
+            while (true)
+            {
+                const std::function<void(size_t)> *t;
+                size_t n;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    started.wait(lock, [&] { return generation != seenGeneration; });
+                    seenGeneration = generation;
+                    t = task;
+                    n = numTasks;
+                }
+                runTasks(*t, n);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    activeWorkers--;
+                }
+                finished.notify_one();
+            }
+        }
+
+        std::vector<std::thread> workers;
+        std::mutex batchMutex;
+        std::mutex mutex;
+        std::condition_variable started;
+        std::condition_variable finished;
+        const std::function<void(size_t)> *task;
+        size_t numTasks;
+        std::atomic<size_t> nextTask;
+        unsigned long long generation;
+        int activeWorkers;
+    };
+
+    int computeNumThreads()
+    {
+        const char *value = getenv("JCURAND_CPU_THREADS");
+        if (value != NULL)
+        {
+            int n = atoi(value);
+            if (n > 0)
+            {
+                return n;
+            }
+        }
+        int n = (int)std::thread::hardware_concurrency();
+        return n > 0 ? n : 1;
+    }
+
+    /**
+     * Returns the shared pool. It is created on first use and
+     * intentionally never destroyed, so that no worker thread has
+     * to be joined while the JVM is shutting down.
+     */
+    ThreadPool *getThreadPool()
+    {
+        static ThreadPool *pool = new ThreadPool(cpuCurandGetNumThreads() - 1);
+        return pool;
+    }
+}
+
+int cpuCurandGetNumThreads()
+{
+    static int numThreads = computeNumThreads();
+    return numThreads;
+}
+
+void cpuCurandParallelFor(size_t numTasks, const std::function<void(size_t)> &task)
+{
+    if (numTasks == 0)
+    {
+        return;
+    }
+    if (numTasks == 1 || insideTask || cpuCurandGetNumThreads() == 1 ||
+        !getThreadPool()->tryRun(numTasks, task))
+    {
+        for (size_t i = 0; i < numTasks; i++)
+        {
+            task(i);
+        }
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_CPU_CURAND_PARALLEL
+#define JCURAND_CPU_CURAND_PARALLEL
+
+#include <stddef.h>
+#include <functional>
+
+/**
+ * Returns the number of threads that are used by the CPU emulation
+ * of CURAND, including the calling thread. This is the number of
+ * hardware threads, unless the JCURAND_CPU_THREADS environment
+ * variable is set to a positive value.
+ */
+int cpuCurandGetNumThreads();
+
+/**
+ * Executes the given task for all indices in [0, numTasks), using
+ * the shared worker threads and the calling thread. The order in
+ * which the tasks are executed is unspecified, so each task must
+ * only write to memory that depends on its index.
+ *
+ * If the worker threads are currently busy with a task that was
+ * started by another thread, then all tasks are executed by the
+ * calling thread.
+ */
+void cpuCurandParallelFor(size_t numTasks, const std::function<void(size_t)> &task);
+
+#endif
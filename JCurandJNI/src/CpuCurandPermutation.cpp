@@ -0,0 +1,762 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CpuCurand.hpp"
+#include "CpuCurandGenerator.hpp"
+#include "CpuCurandMath.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace
+{
+    /**
+     * The number of elements that a bucket of a permutation should
+     * have on average, so that it can be shuffled in the L2 cache
+     */
+    const size_t PERMUTATION_BUCKET_SIZE = 1 << 15;
+
+    /**
+     * The maximum number of buckets of a permutation
+     */
+    const size_t PERMUTATION_MAX_BUCKETS = 1 << 14;
+
+    /**
+     * The maximum number of chunks of the input of a permutation that
+     * are scattered into the buckets independently. Each chunk has its
+     * own row of bucket counts.
+     */
+    const size_t PERMUTATION_MAX_CHUNKS = 256;
+
+    /**
+     * Reads the words for the swaps of a Fisher-Yates shuffle. The first
+     * attempts of the swaps use the 'planned' words at the given
+     * position, and the retries of the rejections use the following
+     * 'planned' words, so that a shuffle never reads the words of the
+     * next one. (The retries need more words than that only with a
+     * negligible probability, and then read beyond their region.) The
+     * words of a sequential engine are read with a single cursor that
+     * is only moved forward: All planned words are read at once, and
+     * the retries continue after them.
+     */
+    class ShuffleWords
+    {
+    public:
+        ShuffleWords(CpuEngine *engine, unsigned long long position, size_t planned)
+            : engine(engine), retryPosition(position + planned), planned(planned),
+            index(0), count(0), block(words)
+        {
+            cursor.reset(engine->newCursor());
+            cursor->seek(0, position);
+            if (!engine->isRandomAccess())
+            {
+                buffer.resize(planned < 1 ? 1 : planned);
+                cursor->next(buffer.data(), planned);
+                block = buffer.data();
+                count = planned;
+                this->planned = 0;
+            }
+        }
+
+        unsigned int next()
+        {
+            if (index == count)
+            {
+                count = planned < CPU_CURAND_CHUNK_SIZE ? planned : CPU_CURAND_CHUNK_SIZE;
+                count = count < 1 ? 1 : count;
+                planned -= planned < count ? planned : count;
+                cursor->next(words, count);
+                block = words;
+                index = 0;
+            }
+            return block[index++];
+        }
+
+        /**
+         * Returns a uniformly distributed integer in [0, range), with
+         * Lemire's multiply-shift method, from one word if the range
+         * is at most 2^32, and from two words otherwise
+         */
+        unsigned long long bounded(unsigned long long range)
+        {
+            if (range <= (1ull << 32))
+            {
+                unsigned long long m = (unsigned long long)next() * range;
+                if ((unsigned int)m < range)
+                {
+                    unsigned int threshold = (unsigned int)((1ull << 32) % range);
+                    while ((unsigned int)m < threshold)
+                    {
+                        m = (unsigned long long)nextRetry() * range;
+                    }
+                }
+                return m >> 32;
+            }
+            unsigned long long low;
+            unsigned long long high = cpuCurandMultiplyHigh(nextWide(), range, low);
+            if (low < range)
+            {
+                unsigned long long threshold = (0 - range) % range;
+                while (low < threshold)
+                {
+                    unsigned long long x = nextRetry();
+                    x |= (unsigned long long)nextRetry() << 32;
+                    high = cpuCurandMultiplyHigh(x, range, low);
+                }
+            }
+            return high;
+        }
+
+        /**
+         * Computes two independent, uniformly distributed integers in
+         * [0, range0) and [0, range1) from one word, where the product
+         * of the ranges is at most 2^32: The leftover low bits of the
+         * first product are used for the second value, which is the
+         * multiply-shift method for the product of the ranges.
+         */
+        void boundedPair(unsigned long long range0, unsigned long long range1,
+            size_t &value0, size_t &value1)
+        {
+            unsigned long long product = range0 * range1;
+            unsigned long long m0 = (unsigned long long)next() * range0;
+            unsigned long long m1 = (m0 & 0xFFFFFFFFull) * range1;
+            if ((unsigned int)m1 < product)
+            {
+                unsigned int threshold = (unsigned int)((1ull << 32) % product);
+                while ((unsigned int)m1 < threshold)
+                {
+                    m0 = (unsigned long long)nextRetry() * range0;
+                    m1 = (m0 & 0xFFFFFFFFull) * range1;
+                }
+            }
+            value0 = (size_t)(m0 >> 32);
+            value1 = (size_t)(m1 >> 32);
+        }
+
+    private:
+        unsigned long long nextWide()
+        {
+            unsigned long long x = next();
+            return x | ((unsigned long long)next() << 32);
+        }
+
+        /**
+         * Returns the next word of the retry region. The cursor of a
+         * sequential engine already is at its start.
+         */
+        unsigned int nextRetry()
+        {
+            if (!retryCursor && engine->isRandomAccess())
+            {
+                retryCursor.reset(engine->newCursor());
+                retryCursor->seek(0, retryPosition);
+            }
+            CpuEngineCursor *c = retryCursor ? retryCursor.get() : cursor.get();
+            unsigned int word;
+            c->next(&word, 1);
+            return word;
+        }
+
+        CpuEngine *engine;
+        std::unique_ptr<CpuEngineCursor> cursor;
+        std::unique_ptr<CpuEngineCursor> retryCursor;
+        unsigned long long retryPosition;
+        size_t planned;
+        size_t index;
+        size_t count;
+        unsigned int *block;
+        std::vector<unsigned int> buffer;
+        unsigned int words[CPU_CURAND_CHUNK_SIZE];
+    };
+
+    /**
+     * Shuffle the given array with Fisher-Yates. The swaps with the
+     * elements at i and i-1 use one word as long as (i+1)*i is at most
+     * 2^32.
+     */
+    template <typename T>
+    void shuffle(T *values, size_t size, ShuffleWords &words)
+    {
+        size_t i = size - 1;
+        while (i > 0)
+        {
+            unsigned long long range = (unsigned long long)i + 1;
+            size_t j;
+            if (i > 1 && range * i <= (1ull << 32))
+            {
+                size_t k;
+                words.boundedPair(range, i, j, k);
+                std::swap(values[i], values[j]);
+                std::swap(values[i - 1], values[k]);
+                i -= 2;
+            }
+            else
+            {
+                j = (size_t)words.bounded(range);
+                std::swap(values[i], values[j]);
+                i--;
+            }
+        }
+    }
+
+    /**
+     * The values of the identity permutation
+     */
+    template <typename T>
+    struct IdentitySource
+    {
+        T operator()(size_t i) const
+        {
+            return (T)i;
+        }
+    };
+
+    /**
+     * The values of an array
+     */
+    template <typename T>
+    struct ArraySource
+    {
+        const T *values;
+
+        T operator()(size_t i) const
+        {
+            return values[i];
+        }
+    };
+
+    /**
+     * Run the given task for all indices, in parallel if the engine
+     * is a random access engine, and in increasing order otherwise
+     */
+    template <typename Task>
+    void runTasks(CpuEngine *engine, size_t numTasks, const Task &task)
+    {
+        if (engine->isRandomAccess())
+        {
+            cpuCurandParallelFor(numTasks, task);
+        }
+        else
+        {
+            for (size_t t = 0; t < numTasks; t++)
+            {
+                task(t);
+            }
+        }
+    }
+
+    /**
+     * Write a random permutation of the n values of the given source
+     * into the output, with a bucketed scatter: Each value is moved
+     * into one of M buckets, chosen with 16 bits of a word, and then
+     * each bucket is shuffled with Fisher-Yates. Sorting by independent
+     * random keys with ties in random order gives every permutation
+     * with the same probability.
+     *
+     * The input is divided into chunks that count and scatter their
+     * values independently, and the buckets are shuffled independently,
+     * with the words after the ones for the buckets: Each bucket has
+     * the words for its swaps and for their retries, starting at twice
+     * the position of its first element. The numbers of buckets and
+     * chunks only depend on n, so the result does not depend on the
+     * number of threads.
+     */
+    template <typename T, typename Source>
+    void permute(CpuGenerator *g, T *output, size_t n, const Source &source)
+    {
+        unsigned int bucketBits = 0;
+        while (((size_t)1 << bucketBits) < PERMUTATION_MAX_BUCKETS
+            && ((size_t)1 << bucketBits) * PERMUTATION_BUCKET_SIZE < n)
+        {
+            bucketBits++;
+        }
+        const size_t numBuckets = (size_t)1 << bucketBits;
+        size_t chunkSize = (n + PERMUTATION_MAX_CHUNKS - 1) / PERMUTATION_MAX_CHUNKS;
+        chunkSize = (chunkSize + CPU_CURAND_CHUNK_SIZE - 1) / CPU_CURAND_CHUNK_SIZE * CPU_CURAND_CHUNK_SIZE;
+        chunkSize = chunkSize < CPU_CURAND_TASK_SIZE ? CPU_CURAND_TASK_SIZE : chunkSize;
+        const size_t numChunks = (n + chunkSize - 1) / chunkSize;
+        const size_t bucketWords = (n + 1) / 2;
+        const size_t wordsPerSwap = n > (1ull << 32) ? 2 : 1;
+
+        CpuEngine *engine = g->engine;
+        const unsigned long long base = g->offset + g->position;
+        std::vector<unsigned short> buckets(n);
+        std::vector<size_t> offsets(numChunks * numBuckets);
+
+        // Choose the buckets, with the upper bits of each half of a
+        // word, and count the elements of each bucket in each chunk
+        runTasks(engine, numChunks, [&](size_t c)
+        {
+            size_t begin = c * chunkSize;
+            size_t end = begin + chunkSize < n ? begin + chunkSize : n;
+            size_t *counts = offsets.data() + c * numBuckets;
+            std::unique_ptr<CpuEngineCursor> cursor(engine->newCursor());
+            cursor->seek(0, base + begin / 2);
+            unsigned int words[CPU_CURAND_CHUNK_SIZE];
+            for (size_t i = begin; i < end; i += 2 * CPU_CURAND_CHUNK_SIZE)
+            {
+                size_t count = end - i < 2 * CPU_CURAND_CHUNK_SIZE ? end - i : 2 * CPU_CURAND_CHUNK_SIZE;
+                cursor->next(words, (count + 1) / 2);
+                for (size_t j = 0; j < count; j++)
+                {
+                    unsigned int half = (words[j / 2] >> (16 * (j & 1))) & 0xFFFFu;
+                    unsigned int b = half >> (16 - bucketBits);
+                    buckets[i + j] = (unsigned short)b;
+                    counts[b]++;
+                }
+            }
+        });
+
+        // Turn the counts into the offsets where each chunk writes the
+        // elements of each bucket
+        std::vector<size_t> bucketStarts(numBuckets + 1);
+        size_t sum = 0;
+        for (size_t b = 0; b < numBuckets; b++)
+        {
+            bucketStarts[b] = sum;
+            for (size_t c = 0; c < numChunks; c++)
+            {
+                size_t count = offsets[c * numBuckets + b];
+                offsets[c * numBuckets + b] = sum;
+                sum += count;
+            }
+        }
+        bucketStarts[numBuckets] = n;
+
+        // Scatter the values of each chunk into the buckets, keeping
+        // their order within each chunk
+        cpuCurandParallelFor(numChunks, [&](size_t c)
+        {
+            size_t begin = c * chunkSize;
+            size_t end = begin + chunkSize < n ? begin + chunkSize : n;
+            size_t *next = offsets.data() + c * numBuckets;
+            for (size_t i = begin; i < end; i++)
+            {
+                output[next[buckets[i]]++] = source(i);
+            }
+        });
+
+        // Shuffle each bucket
+        const unsigned long long shuffleBase = base + bucketWords;
+        runTasks(engine, numBuckets, [&](size_t b)
+        {
+            size_t start = bucketStarts[b];
+            size_t size = bucketStarts[b + 1] - start;
+            if (size < 2)
+            {
+                return;
+            }
+            ShuffleWords words(engine, shuffleBase + 2 * start * wordsPerSwap, size * wordsPerSwap);
+            shuffle(output + start, size, words);
+        });
+        g->position += bucketWords + 2 * n * wordsPerSwap;
+    }
+
+    /**
+     * The number of points up to which the permutations of the
+     * dimensions of a Latin hypercube are shuffled in parallel, one
+     * dimension per task. The permutations of larger designs are
+     * computed one after the other, each with the bucketed permute.
+     */
+    const size_t LATIN_HYPERCUBE_TASK_POINTS = PERMUTATION_BUCKET_SIZE;
+
+    /**
+     * The number of random designs from which the one with the largest
+     * minimum distance between its points is chosen for the maximin
+     * variant, and the maximum number of points of such a design,
+     * because computing the distances takes quadratic time
+     */
+    const int LATIN_HYPERCUBE_MAXIMIN_CANDIDATES = 8;
+    const size_t LATIN_HYPERCUBE_MAXIMIN_MAX_POINTS = 1 << 16;
+
+    /**
+     * Write the coordinates of the points of one dimension of a Latin
+     * hypercube design, with the given strata of the points, and the
+     * offsets within the strata from the words of the given cursor,
+     * or the centers of the strata. Element i is written at i * stride.
+     */
+    template <typename T>
+    void placeInStrata(CpuEngineCursor *cursor, const T *strata, size_t count, size_t n,
+        bool centered, double *x, size_t stride)
+    {
+        const double scale = 1.0 / n;
+        unsigned int words[CPU_CURAND_CHUNK_SIZE];
+        for (size_t i = 0; i < count; i += CPU_CURAND_CHUNK_SIZE)
+        {
+            size_t chunk = count - i < CPU_CURAND_CHUNK_SIZE ? count - i : CPU_CURAND_CHUNK_SIZE;
+            cursor->next(words, chunk);
+            for (size_t k = 0; k < chunk; k++)
+            {
+                double u = centered ? 0.5 : cpuCurandUniformDouble(words[k]);
+                x[(i + k) * stride] = (strata[i + k] + u) * scale;
+            }
+        }
+    }
+
+    /**
+     * Write a random Latin hypercube design of n points in d dimensions
+     * into x, where coordinate j of point i is written at i * rowStride +
+     * j * columnStride. Small designs shuffle all dimensions in
+     * parallel, each with 3 * n words at a fixed position, so that the
+     * result does not depend on the number of threads: n words for
+     * shuffling the strata, n words for the retries of the shuffle,
+     * and n words for the offsets of the points within their strata.
+     * Larger designs use n words for the offsets of each dimension,
+     * and then the words of the permutation of its strata. The centered
+     * design has the same strata and uses the same words.
+     */
+    void latinHypercube(CpuGenerator *g, double *x, size_t n, size_t d, bool centered,
+        size_t rowStride, size_t columnStride)
+    {
+        CpuEngine *engine = g->engine;
+        if (n <= LATIN_HYPERCUBE_TASK_POINTS)
+        {
+            const unsigned long long base = g->offset + g->position;
+            runTasks(engine, d, [&](size_t j)
+            {
+                std::vector<unsigned int> strata(n);
+                for (size_t i = 0; i < n; i++)
+                {
+                    strata[i] = (unsigned int)i;
+                }
+                {
+                    ShuffleWords words(engine, base + j * 3 * n, n);
+                    shuffle(strata.data(), n, words);
+                }
+                std::unique_ptr<CpuEngineCursor> cursor(engine->newCursor());
+                cursor->seek(0, base + j * 3 * n + 2 * n);
+                placeInStrata(cursor.get(), strata.data(), n, n, centered,
+                    x + j * columnStride, rowStride);
+            });
+            g->position += 3 * n * d;
+            return;
+        }
+        std::vector<size_t> strata(n);
+        const size_t numTasks = (n + CPU_CURAND_TASK_SIZE - 1) / CPU_CURAND_TASK_SIZE;
+        for (size_t j = 0; j < d; j++)
+        {
+            const unsigned long long base = g->offset + g->position;
+            g->position += n;
+            permute(g, strata.data(), n, IdentitySource<size_t>());
+            runTasks(engine, numTasks, [&](size_t t)
+            {
+                size_t begin = t * CPU_CURAND_TASK_SIZE;
+                size_t count = n - begin < CPU_CURAND_TASK_SIZE ? n - begin : CPU_CURAND_TASK_SIZE;
+                std::unique_ptr<CpuEngineCursor> cursor(engine->newCursor());
+                cursor->seek(0, base + begin);
+                placeInStrata(cursor.get(), strata.data() + begin, count, n, centered,
+                    x + j * columnStride + begin * rowStride, rowStride);
+            });
+        }
+    }
+
+    /**
+     * Returns the smallest squared distance between two points of the
+     * given column-major design of n points in d dimensions
+     */
+    double minimumSquaredDistance(const double *x, size_t n, size_t d)
+    {
+        const size_t numTasks = n < 256 ? n : 256;
+        std::vector<double> minima(numTasks, std::numeric_limits<double>::infinity());
+        cpuCurandParallelFor(numTasks, [&](size_t t)
+        {
+            std::vector<double> distances(n);
+            for (size_t i = t; i < n; i += numTasks)
+            {
+                std::fill(distances.begin() + i + 1, distances.end(), 0.0);
+                for (size_t k = 0; k < d; k++)
+                {
+                    const double *column = x + k * n;
+                    const double xi = column[i];
+                    for (size_t j = i + 1; j < n; j++)
+                    {
+                        double difference = column[j] - xi;
+                        distances[j] += difference * difference;
+                    }
+                }
+                for (size_t j = i + 1; j < n; j++)
+                {
+                    minima[t] = std::min(minima[t], distances[j]);
+                }
+            }
+        });
+        return *std::min_element(minima.begin(), minima.end());
+    }
+
+    curandStatus_t generateLatinHypercube(curandGenerator_t generator, double *output,
+        size_t n, unsigned int dimensions, curandLatinHypercubeMode_t mode, curandLayout_t layout)
+    {
+        CpuGenerator *g = cpuCurandLane(reinterpret_cast<CpuGenerator*>(generator));
+        curandStatus_t status = cpuCurandPrepare(g);
+        if (status != CURAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if (cpuCurandIsQuasi(g))
+        {
+            return CURAND_STATUS_TYPE_ERROR;
+        }
+        if (dimensions == 0 ||
+            (layout != CURAND_LAYOUT_ROW_MAJOR && layout != CURAND_LAYOUT_COLUMN_MAJOR) ||
+            (mode != CURAND_LATIN_HYPERCUBE_RANDOM && mode != CURAND_LATIN_HYPERCUBE_CENTERED &&
+                mode != CURAND_LATIN_HYPERCUBE_MAXIMIN) ||
+            (mode == CURAND_LATIN_HYPERCUBE_MAXIMIN && n > LATIN_HYPERCUBE_MAXIMIN_MAX_POINTS))
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        if (n == 0)
+        {
+            return CURAND_STATUS_SUCCESS;
+        }
+        const size_t d = dimensions;
+        const bool rowMajor = layout == CURAND_LAYOUT_ROW_MAJOR;
+        try
+        {
+            if (mode != CURAND_LATIN_HYPERCUBE_MAXIMIN)
+            {
+                latinHypercube(g, output, n, d, mode == CURAND_LATIN_HYPERCUBE_CENTERED,
+                    rowMajor ? d : 1, rowMajor ? 1 : n);
+                return CURAND_STATUS_SUCCESS;
+            }
+            std::vector<double> best(n * d);
+            std::vector<double> candidate(n * d);
+            double bestDistance = -1.0;
+            for (int c = 0; c < LATIN_HYPERCUBE_MAXIMIN_CANDIDATES; c++)
+            {
+                latinHypercube(g, candidate.data(), n, d, false, 1, n);
+                double distance = minimumSquaredDistance(candidate.data(), n, d);
+                if (distance > bestDistance)
+                {
+                    bestDistance = distance;
+                    best.swap(candidate);
+                }
+            }
+            for (size_t j = 0; j < d; j++)
+            {
+                for (size_t i = 0; i < n; i++)
+                {
+                    output[rowMajor ? i * d + j : j * n + i] = best[j * n + i];
+                }
+            }
+        }
+        catch (const std::bad_alloc&)
+        {
+            return CURAND_STATUS_ALLOCATION_FAILED;
+        }
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * One draw of Floyd's sampling algorithm: A uniformly distributed
+     * integer in [0, n - k + unit], from two words
+     */
+    struct FloydSample
+    {
+        unsigned long long *draws;
+        unsigned long long first;
+
+        bool operator()(const unsigned int *words, size_t unit, bool retry) const
+        {
+            unsigned long long x = words[0] | ((unsigned long long)words[1] << 32);
+            unsigned long long range = first + unit;
+            unsigned long long low;
+            unsigned long long high = cpuCurandMultiplyHigh(x, range, low);
+            if (low < range && low < (0 - range) % range)
+            {
+                return false;
+            }
+            draws[unit] = high;
+            return true;
+        }
+    };
+
+    /**
+     * The marker of an empty slot of an IntegerSet. No value can be
+     * equal to it, because all values are smaller than n.
+     */
+    const unsigned long long EMPTY_SLOT = ~0ull;
+
+    /**
+     * A set of integers with open addressing, for Floyd's algorithm
+     */
+    class IntegerSet
+    {
+    public:
+        IntegerSet(size_t n)
+        {
+            shift = 64;
+            while (((size_t)1 << (64 - shift)) < 2 * n + 16)
+            {
+                shift--;
+            }
+            slots.assign((size_t)1 << (64 - shift), EMPTY_SLOT);
+        }
+
+        /**
+         * Insert the given value, and return whether it was inserted
+         */
+        bool insert(unsigned long long value)
+        {
+            size_t mask = slots.size() - 1;
+            size_t i = (size_t)((value * 0x9E3779B97F4A7C15ull) >> shift);
+            while (slots[i] != EMPTY_SLOT)
+            {
+                if (slots[i] == value)
+                {
+                    return false;
+                }
+                i = (i + 1) & mask;
+            }
+            slots[i] = value;
+            return true;
+        }
+
+    private:
+        unsigned int shift;
+        std::vector<unsigned long long> slots;
+    };
+
+    template <typename T>
+    curandStatus_t generatePermutation(curandGenerator_t generator, T *output, size_t n)
+    {
+        CpuGenerator *g = cpuCurandLane(reinterpret_cast<CpuGenerator*>(generator));
+        curandStatus_t status = cpuCurandPrepare(g);
+        if (status != CURAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if (cpuCurandIsQuasi(g))
+        {
+            return CURAND_STATUS_TYPE_ERROR;
+        }
+        if (n > (unsigned long long)std::numeric_limits<T>::max() + 1)
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        try
+        {
+            permute(g, output, n, IdentitySource<T>());
+        }
+        catch (const std::bad_alloc&)
+        {
+            return CURAND_STATUS_ALLOCATION_FAILED;
+        }
+        return CURAND_STATUS_SUCCESS;
+    }
+
+    /**
+     * Write k distinct values from [0, n) in random order into the
+     * output. If k is a large fraction of n, then these are the first
+     * k values of a permutation. Otherwise, the values are chosen with
+     * Floyd's algorithm, whose draws are computed in parallel and
+     * inserted into a set in order, and then permuted.
+     */
+    template <typename T>
+    curandStatus_t sampleWithoutReplacement(curandGenerator_t generator, T *output, size_t n, size_t k)
+    {
+        CpuGenerator *g = cpuCurandLane(reinterpret_cast<CpuGenerator*>(generator));
+        curandStatus_t status = cpuCurandPrepare(g);
+        if (status != CURAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if (cpuCurandIsQuasi(g))
+        {
+            return CURAND_STATUS_TYPE_ERROR;
+        }
+        if (k > n || n > (unsigned long long)std::numeric_limits<T>::max() + 1)
+        {
+            return CURAND_STATUS_OUT_OF_RANGE;
+        }
+        try
+        {
+            if (k == n)
+            {
+                permute(g, output, n, IdentitySource<T>());
+            }
+            else if (k > n / 8)
+            {
+                std::vector<T> permutation(n);
+                permute(g, permutation.data(), n, IdentitySource<T>());
+                std::copy(permutation.begin(), permutation.begin() + k, output);
+            }
+            else
+            {
+                std::vector<unsigned long long> draws(k);
+                FloydSample sample = { draws.data(), n - k + 1 };
+                cpuCurandGenerateRejection(g, k, 2, sample);
+                IntegerSet set(k);
+                std::vector<T> values(k);
+                for (size_t j = 0; j < k; j++)
+                {
+                    unsigned long long value = set.insert(draws[j]) ? draws[j] : n - k + j;
+                    if (value != draws[j])
+                    {
+                        set.insert(value);
+                    }
+                    values[j] = (T)value;
+                }
+                ArraySource<T> source = { values.data() };
+                permute(g, output, k, source);
+            }
+        }
+        catch (const std::bad_alloc&)
+        {
+            return CURAND_STATUS_ALLOCATION_FAILED;
+        }
+        return CURAND_STATUS_SUCCESS;
+    }
+}
+
+curandStatus_t CURANDAPI cpuCurandGeneratePermutation(curandGenerator_t generator, int *outputPtr, size_t n)
+{
+    return generatePermutation(generator, outputPtr, n);
+}
+
+curandStatus_t CURANDAPI cpuCurandGeneratePermutationLongLong(curandGenerator_t generator, long long *outputPtr, size_t n)
+{
+    return generatePermutation(generator, outputPtr, n);
+}
+
+curandStatus_t CURANDAPI cpuCurandSampleWithoutReplacement(curandGenerator_t generator, int *outputPtr, size_t n, size_t k)
+{
+    return sampleWithoutReplacement(generator, outputPtr, n, k);
+}
+
+curandStatus_t CURANDAPI cpuCurandSampleWithoutReplacementLongLong(curandGenerator_t generator, long long *outputPtr, size_t n, size_t k)
+{
+    return sampleWithoutReplacement(generator, outputPtr, n, k);
+}
+
+curandStatus_t CURANDAPI cpuCurandGenerateLatinHypercube(curandGenerator_t generator, double *outputPtr, size_t n, unsigned int dimensions, curandLatinHypercubeMode_t mode, curandLayout_t layout)
+{
+    return generateLatinHypercube(generator, outputPtr, n, dimensions, mode, layout);
+}
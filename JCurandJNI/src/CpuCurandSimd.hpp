@@ -0,0 +1,544 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_CPU_CURAND_SIMD
+#define JCURAND_CPU_CURAND_SIMD
+
+#include "CpuCurandMath.hpp"
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CPU_CURAND_AVX2
+#endif
+
+// The functions in this file compute exactly the same results for single
+// values and for the lanes of AVX2 vectors, so that the samples of the
+// files that include it do not depend on the instruction set. This
+// requires that products and sums are not contracted into fused
+// multiply-add instructions.
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+#define CPU_CURAND_SQRT2_FLOAT (1.41421356f)
+#define CPU_CURAND_SQRT2_DOUBLE (1.4142135623730951)
+#define CPU_CURAND_DOUBLE_MIN (2.2250738585072014e-308)
+#define CPU_CURAND_2POW54_DOUBLE (18014398509481984.0)
+#define CPU_CURAND_LOG2E_DOUBLE (1.4426950408889634)
+
+// The smallest argument of the exponential function below which the
+// results are 0
+#define CPU_CURAND_EXP_MIN_DOUBLE (-100.0)
+
+// ln(2), split into a part with trailing zero bits, so that its product
+// with an exponent is exact, and the remainder
+#define CPU_CURAND_LN2_HI_FLOAT (6.93145752e-01f)
+#define CPU_CURAND_LN2_LO_FLOAT (1.42860677e-06f)
+#define CPU_CURAND_LN2_HI_DOUBLE (6.93147180369123816490e-01)
+#define CPU_CURAND_LN2_LO_DOUBLE (1.90821492927058770002e-10)
+
+// The coefficients of the polynomials, starting with the highest power.
+// The logarithm is 2s + 2s * s^2 * P(s^2) for s = (m - 1) / (m + 1),
+// where P is the series 1/3 + s^2/5 + ..., and the sine and cosine of
+// an angle a in [-pi/4, pi/4] are a + a * a^2 * S(a^2) and 1 + a^2 * C(a^2)
+static const float CPU_CURAND_LOG_FLOAT[] =
+{
+    1.0f / 9, 1.0f / 7, 1.0f / 5, 1.0f / 3
+};
+static const double CPU_CURAND_LOG_DOUBLE[] =
+{
+    1.0 / 21, 1.0 / 19, 1.0 / 17, 1.0 / 15, 1.0 / 13,
+    1.0 / 11, 1.0 / 9, 1.0 / 7, 1.0 / 5, 1.0 / 3
+};
+static const float CPU_CURAND_SIN_FLOAT[] =
+{
+    1.0f / 362880, -1.0f / 5040, 1.0f / 120, -1.0f / 6
+};
+static const float CPU_CURAND_COS_FLOAT[] =
+{
+    -1.0f / 3628800, 1.0f / 40320, -1.0f / 720, 1.0f / 24, -1.0f / 2
+};
+static const double CPU_CURAND_SIN_DOUBLE[] =
+{
+    1.0 / 355687428096000.0, -1.0 / 1307674368000.0, 1.0 / 6227020800.0,
+    -1.0 / 39916800, 1.0 / 362880, -1.0 / 5040, 1.0 / 120, -1.0 / 6
+};
+static const double CPU_CURAND_COS_DOUBLE[] =
+{
+    1.0 / 20922789888000.0, -1.0 / 87178291200.0, 1.0 / 479001600,
+    -1.0 / 3628800, 1.0 / 40320, -1.0 / 720, 1.0 / 24, -1.0 / 2
+};
+
+static const double CPU_CURAND_EXP_DOUBLE[] =
+{
+    1.0 / 6227020800.0, 1.0 / 479001600, 1.0 / 39916800, 1.0 / 3628800,
+    1.0 / 362880, 1.0 / 40320, 1.0 / 5040, 1.0 / 720, 1.0 / 120, 1.0 / 24,
+    1.0 / 6, 1.0 / 2, 1.0, 1.0
+};
+
+// The coefficients of the rational approximations of the inverse of the
+// normal cumulative distribution function in cpuCurandNormalCdfInv, with
+// the constant terms 1 of the denominators
+static const double CPU_CURAND_NORMAL_CDF_INV_A[] =
+{
+    -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+    1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00
+};
+static const double CPU_CURAND_NORMAL_CDF_INV_B[] =
+{
+    -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+    6.680131188771972e+01, -1.328068155288572e+01, 1.0
+};
+static const double CPU_CURAND_NORMAL_CDF_INV_C[] =
+{
+    -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+    -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00
+};
+static const double CPU_CURAND_NORMAL_CDF_INV_D[] =
+{
+    7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+    3.754408661907416e+00, 1.0
+};
+#define CPU_CURAND_NORMAL_CDF_INV_P_LOW (0.02425)
+
+template <typename T, size_t N>
+inline T cpuCurandHorner(const T (&coefficients)[N], T x)
+{
+    T p = coefficients[0];
+    for (size_t i = 1; i < N; i++)
+    {
+        p = p * x + coefficients[i];
+    }
+    return p;
+}
+
+/**
+ * The uniform sample of cpuCurandUniform, for the words of AVX2 vectors
+ */
+inline float cpuCurandUniformSimd(unsigned int x)
+{
+    return (float)x * CPU_CURAND_2POW32_INV + (CPU_CURAND_2POW32_INV / 2.0f);
+}
+
+/**
+ * The uniform sample of cpuCurandUniformDouble(x, y)
+ */
+inline double cpuCurandUniformDoubleSimd(unsigned int x, unsigned int y)
+{
+    unsigned long long z = (unsigned long long)x ^ ((unsigned long long)y << (53 - 32));
+    return (double)z * CPU_CURAND_2POW53_INV_DOUBLE + (CPU_CURAND_2POW53_INV_DOUBLE / 2.0);
+}
+
+/**
+ * The natural logarithm of a positive, normal value, with an error of
+ * about one unit in the last place
+ */
+inline float cpuCurandLogSimd(float x)
+{
+    unsigned int bits;
+    memcpy(&bits, &x, sizeof(bits));
+    int e = (int)(bits >> 23) - 127;
+    bits = (bits & 0x007FFFFFu) | 0x3F800000u;
+    float m;
+    memcpy(&m, &bits, sizeof(m));
+    if (m > CPU_CURAND_SQRT2_FLOAT)
+    {
+        m = m * 0.5f;
+        e++;
+    }
+    float f = m - 1.0f;
+    float s = f / (2.0f + f);
+    float s2 = s * s;
+    float p = s2 * cpuCurandHorner(CPU_CURAND_LOG_FLOAT, s2);
+    float twoS = s + s;
+    float logM = twoS + twoS * p;
+    float ef = (float)e;
+    return ef * CPU_CURAND_LN2_HI_FLOAT + (ef * CPU_CURAND_LN2_LO_FLOAT + logM);
+}
+
+/**
+ * The natural logarithm of a positive value. Subnormal values are scaled
+ * into the normal range first.
+ */
+inline double cpuCurandLogSimd(double x)
+{
+    int shift = 0;
+    if (x < CPU_CURAND_DOUBLE_MIN)
+    {
+        x = x * CPU_CURAND_2POW54_DOUBLE;
+        shift = 54;
+    }
+    unsigned long long bits;
+    memcpy(&bits, &x, sizeof(bits));
+    int e = (int)(bits >> 52) - 1023 - shift;
+    bits = (bits & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull;
+    double m;
+    memcpy(&m, &bits, sizeof(m));
+    if (m > CPU_CURAND_SQRT2_DOUBLE)
+    {
+        m = m * 0.5;
+        e++;
+    }
+    double f = m - 1.0;
+    double s = f / (2.0 + f);
+    double s2 = s * s;
+    double p = s2 * cpuCurandHorner(CPU_CURAND_LOG_DOUBLE, s2);
+    double twoS = s + s;
+    double logM = twoS + twoS * p;
+    double ed = (double)e;
+    return ed * CPU_CURAND_LN2_HI_DOUBLE + (ed * CPU_CURAND_LN2_LO_DOUBLE + logM);
+}
+
+/**
+ * The exponential function for x <= 0, with an error of a few units in
+ * the last place. The results for x < CPU_CURAND_EXP_MIN_DOUBLE are 0.
+ */
+inline double cpuCurandExpSimd(double x)
+{
+    if (x < CPU_CURAND_EXP_MIN_DOUBLE)
+    {
+        return 0.0;
+    }
+    double n = nearbyint(x * CPU_CURAND_LOG2E_DOUBLE);
+    double r = (x - n * CPU_CURAND_LN2_HI_DOUBLE) - n * CPU_CURAND_LN2_LO_DOUBLE;
+    double p = cpuCurandHorner(CPU_CURAND_EXP_DOUBLE, r);
+    unsigned long long bits = (unsigned long long)((int)n + 1023) << 52;
+    double scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+/**
+ * The approximation of the inverse of the normal cumulative distribution
+ * function of cpuCurandNormalCdfInv, without the refinement, for p in
+ * (0, 1), with the logarithm of this file
+ */
+inline double cpuCurandNormalCdfInvSimd(double p)
+{
+    const double pLow = CPU_CURAND_NORMAL_CDF_INV_P_LOW;
+    if (p < pLow || p > 1.0 - pLow)
+    {
+        double pt = p < pLow ? p : 1.0 - p;
+        double q = sqrt(-2.0 * cpuCurandLogSimd(pt));
+        double tail = cpuCurandHorner(CPU_CURAND_NORMAL_CDF_INV_C, q) /
+            cpuCurandHorner(CPU_CURAND_NORMAL_CDF_INV_D, q);
+        return p < pLow ? tail : -tail;
+    }
+    double c = p - 0.5;
+    double r = c * c;
+    return cpuCurandHorner(CPU_CURAND_NORMAL_CDF_INV_A, r) * c /
+        cpuCurandHorner(CPU_CURAND_NORMAL_CDF_INV_B, r);
+}
+
+/**
+ * The sine and cosine of 2 pi v, for v in [0, 1]. The angle is reduced
+ * in turns, which is exact, to a quadrant and an angle in [-pi/4, pi/4].
+ */
+template <typename T, size_t NS, size_t NC>
+inline void cpuCurandSinCosTurnsSimd(T v, const T (&sinCoefficients)[NS],
+    const T (&cosCoefficients)[NC], T &sine, T &cosine)
+{
+    T q = (T)nearbyint(v * 4);
+    T a = (v - q * (T)0.25) * (T)(2 * CPU_CURAND_PI_DOUBLE);
+    T a2 = a * a;
+    T s = a + a * a2 * cpuCurandHorner(sinCoefficients, a2);
+    T c = 1 + a2 * cpuCurandHorner(cosCoefficients, a2);
+    int quadrant = (int)q;
+    sine = (quadrant & 1) ? c : s;
+    cosine = (quadrant & 1) ? s : c;
+    if (quadrant & 2)
+    {
+        sine = -sine;
+    }
+    if ((quadrant + 1) & 2)
+    {
+        cosine = -cosine;
+    }
+}
+
+inline void cpuCurandSinCosTurnsSimd(float v, float &sine, float &cosine)
+{
+    cpuCurandSinCosTurnsSimd(v, CPU_CURAND_SIN_FLOAT, CPU_CURAND_COS_FLOAT, sine, cosine);
+}
+
+inline void cpuCurandSinCosTurnsSimd(double v, double &sine, double &cosine)
+{
+    cpuCurandSinCosTurnsSimd(v, CPU_CURAND_SIN_DOUBLE, CPU_CURAND_COS_DOUBLE, sine, cosine);
+}
+
+/**
+ * The Box-Muller transform of cpuCurandBoxMuller, with the logarithm,
+ * sine and cosine of this file
+ */
+template <typename T>
+inline void cpuCurandBoxMullerSimd(T u, T v, T &a, T &b)
+{
+    T s = sqrt(-2 * cpuCurandLogSimd(u));
+    T sine, cosine;
+    cpuCurandSinCosTurnsSimd(v, sine, cosine);
+    a = sine * s;
+    b = cosine * s;
+}
+
+#ifdef CPU_CURAND_AVX2
+
+template <size_t N>
+__attribute__((target("avx2")))
+inline __m256 cpuCurandHorner(const float (&coefficients)[N], __m256 x)
+{
+    __m256 p = _mm256_set1_ps(coefficients[0]);
+    for (size_t i = 1; i < N; i++)
+    {
+        p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(coefficients[i]));
+    }
+    return p;
+}
+
+template <size_t N>
+__attribute__((target("avx2")))
+inline __m256d cpuCurandHorner(const double (&coefficients)[N], __m256d x)
+{
+    __m256d p = _mm256_set1_pd(coefficients[0]);
+    for (size_t i = 1; i < N; i++)
+    {
+        p = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(coefficients[i]));
+    }
+    return p;
+}
+
+/**
+ * The uniform samples of eight words. The words are converted in two
+ * halves, which is exact, and added with a single rounding.
+ */
+__attribute__((target("avx2")))
+inline __m256 cpuCurandUniformSimd(__m256i x)
+{
+    __m256 hi = _mm256_cvtepi32_ps(_mm256_srli_epi32(x, 16));
+    __m256 lo = _mm256_cvtepi32_ps(_mm256_and_si256(x, _mm256_set1_epi32(0xFFFF)));
+    __m256 f = _mm256_add_ps(_mm256_mul_ps(hi, _mm256_set1_ps(65536.0f)), lo);
+    return _mm256_add_ps(_mm256_mul_ps(f, _mm256_set1_ps(CPU_CURAND_2POW32_INV)),
+        _mm256_set1_ps(CPU_CURAND_2POW32_INV / 2.0f));
+}
+
+/**
+ * The uniform double samples of four pairs of words
+ */
+__attribute__((target("avx2")))
+inline __m256d cpuCurandUniformDoubleSimd(__m128i x, __m128i y)
+{
+    const __m256i magicBits = _mm256_set1_epi64x(0x4330000000000000ll);
+    const __m256d magic = _mm256_castsi256_pd(magicBits);
+    __m256i z = _mm256_xor_si256(_mm256_cvtepu32_epi64(x),
+        _mm256_slli_epi64(_mm256_cvtepu32_epi64(y), 53 - 32));
+    __m256d hi = _mm256_sub_pd(_mm256_castsi256_pd(
+        _mm256_or_si256(_mm256_srli_epi64(z, 32), magicBits)), magic);
+    __m256d lo = _mm256_sub_pd(_mm256_castsi256_pd(
+        _mm256_or_si256(_mm256_and_si256(z, _mm256_set1_epi64x(0xFFFFFFFFll)), magicBits)), magic);
+    __m256d f = _mm256_add_pd(_mm256_mul_pd(hi, _mm256_set1_pd(4294967296.0)), lo);
+    return _mm256_add_pd(_mm256_mul_pd(f, _mm256_set1_pd(CPU_CURAND_2POW53_INV_DOUBLE)),
+        _mm256_set1_pd(CPU_CURAND_2POW53_INV_DOUBLE / 2.0));
+}
+
+__attribute__((target("avx2")))
+inline __m256 cpuCurandLogSimd(__m256 x)
+{
+    __m256i bits = _mm256_castps_si256(x);
+    __m256i e = _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127));
+    __m256 m = _mm256_castsi256_ps(_mm256_or_si256(
+        _mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+    __m256 large = _mm256_cmp_ps(m, _mm256_set1_ps(CPU_CURAND_SQRT2_FLOAT), _CMP_GT_OQ);
+    m = _mm256_blendv_ps(m, _mm256_mul_ps(m, _mm256_set1_ps(0.5f)), large);
+    e = _mm256_sub_epi32(e, _mm256_castps_si256(large));
+    __m256 f = _mm256_sub_ps(m, _mm256_set1_ps(1.0f));
+    __m256 s = _mm256_div_ps(f, _mm256_add_ps(_mm256_set1_ps(2.0f), f));
+    __m256 s2 = _mm256_mul_ps(s, s);
+    __m256 p = _mm256_mul_ps(s2, cpuCurandHorner(CPU_CURAND_LOG_FLOAT, s2));
+    __m256 twoS = _mm256_add_ps(s, s);
+    __m256 logM = _mm256_add_ps(twoS, _mm256_mul_ps(twoS, p));
+    __m256 ef = _mm256_cvtepi32_ps(e);
+    return _mm256_add_ps(_mm256_mul_ps(ef, _mm256_set1_ps(CPU_CURAND_LN2_HI_FLOAT)),
+        _mm256_add_ps(_mm256_mul_ps(ef, _mm256_set1_ps(CPU_CURAND_LN2_LO_FLOAT)), logM));
+}
+
+__attribute__((target("avx2")))
+inline __m256d cpuCurandLogSimd(__m256d x)
+{
+    const __m256i magicBits = _mm256_set1_epi64x(0x4330000000000000ll);
+    __m256d small = _mm256_cmp_pd(x, _mm256_set1_pd(CPU_CURAND_DOUBLE_MIN), _CMP_LT_OQ);
+    x = _mm256_blendv_pd(x, _mm256_mul_pd(x, _mm256_set1_pd(CPU_CURAND_2POW54_DOUBLE)), small);
+    __m256i bits = _mm256_castpd_si256(x);
+    __m256d ed = _mm256_sub_pd(
+        _mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), magicBits)),
+        _mm256_set1_pd(4503599627370496.0 + 1023.0));
+    ed = _mm256_sub_pd(ed, _mm256_and_pd(small, _mm256_set1_pd(54.0)));
+    __m256d m = _mm256_castsi256_pd(_mm256_or_si256(
+        _mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFll)),
+        _mm256_set1_epi64x(0x3FF0000000000000ll)));
+    __m256d large = _mm256_cmp_pd(m, _mm256_set1_pd(CPU_CURAND_SQRT2_DOUBLE), _CMP_GT_OQ);
+    m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), large);
+    ed = _mm256_add_pd(ed, _mm256_and_pd(large, _mm256_set1_pd(1.0)));
+    __m256d f = _mm256_sub_pd(m, _mm256_set1_pd(1.0));
+    __m256d s = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+    __m256d s2 = _mm256_mul_pd(s, s);
+    __m256d p = _mm256_mul_pd(s2, cpuCurandHorner(CPU_CURAND_LOG_DOUBLE, s2));
+    __m256d twoS = _mm256_add_pd(s, s);
+    __m256d logM = _mm256_add_pd(twoS, _mm256_mul_pd(twoS, p));
+    return _mm256_add_pd(_mm256_mul_pd(ed, _mm256_set1_pd(CPU_CURAND_LN2_HI_DOUBLE)),
+        _mm256_add_pd(_mm256_mul_pd(ed, _mm256_set1_pd(CPU_CURAND_LN2_LO_DOUBLE)), logM));
+}
+
+__attribute__((target("avx2")))
+inline __m256d cpuCurandExpSimd(__m256d x)
+{
+    __m256d n = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(CPU_CURAND_LOG2E_DOUBLE)),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_sub_pd(_mm256_sub_pd(x, _mm256_mul_pd(n, _mm256_set1_pd(CPU_CURAND_LN2_HI_DOUBLE))),
+        _mm256_mul_pd(n, _mm256_set1_pd(CPU_CURAND_LN2_LO_DOUBLE)));
+    __m256d p = cpuCurandHorner(CPU_CURAND_EXP_DOUBLE, r);
+    __m256d underflow = _mm256_cmp_pd(x, _mm256_set1_pd(CPU_CURAND_EXP_MIN_DOUBLE), _CMP_LT_OQ);
+    n = _mm256_andnot_pd(underflow, n);
+    __m256i exponent = _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(n)),
+        _mm256_set1_epi64x(1023));
+    __m256d scale = _mm256_castsi256_pd(_mm256_slli_epi64(exponent, 52));
+    return _mm256_andnot_pd(underflow, _mm256_mul_pd(p, scale));
+}
+
+/**
+ * The approximation of the inverse of the normal cumulative distribution
+ * function for four values. The tails are only computed when one of the
+ * values is in a tail, and the quotient of the rational functions is
+ * computed with a single division for both cases.
+ */
+__attribute__((target("avx2")))
+inline __m256d cpuCurandNormalCdfInvSimd(__m256d p)
+{
+    __m256d c = _mm256_sub_pd(p, _mm256_set1_pd(0.5));
+    __m256d r = _mm256_mul_pd(c, c);
+    __m256d numerator = _mm256_mul_pd(cpuCurandHorner(CPU_CURAND_NORMAL_CDF_INV_A, r), c);
+    __m256d denominator = cpuCurandHorner(CPU_CURAND_NORMAL_CDF_INV_B, r);
+    __m256d low = _mm256_cmp_pd(p, _mm256_set1_pd(CPU_CURAND_NORMAL_CDF_INV_P_LOW), _CMP_LT_OQ);
+    __m256d high = _mm256_cmp_pd(p, _mm256_set1_pd(1.0 - CPU_CURAND_NORMAL_CDF_INV_P_LOW), _CMP_GT_OQ);
+    __m256d tails = _mm256_or_pd(low, high);
+    if (!_mm256_testz_pd(tails, tails))
+    {
+        __m256d pt = _mm256_blendv_pd(_mm256_sub_pd(_mm256_set1_pd(1.0), p), p, low);
+        __m256d q = _mm256_sqrt_pd(_mm256_mul_pd(_mm256_set1_pd(-2.0), cpuCurandLogSimd(pt)));
+        __m256d tailNumerator = _mm256_xor_pd(cpuCurandHorner(CPU_CURAND_NORMAL_CDF_INV_C, q),
+            _mm256_and_pd(high, _mm256_set1_pd(-0.0)));
+        numerator = _mm256_blendv_pd(numerator, tailNumerator, tails);
+        denominator = _mm256_blendv_pd(denominator, cpuCurandHorner(CPU_CURAND_NORMAL_CDF_INV_D, q), tails);
+    }
+    return _mm256_div_pd(numerator, denominator);
+}
+
+/**
+ * The uniform samples of four words, like cpuCurandUniformSimd(__m256i)
+ */
+__attribute__((target("avx2")))
+inline __m128 cpuCurandUniformSimd(__m128i x)
+{
+    __m128 hi = _mm_cvtepi32_ps(_mm_srli_epi32(x, 16));
+    __m128 lo = _mm_cvtepi32_ps(_mm_and_si128(x, _mm_set1_epi32(0xFFFF)));
+    __m128 f = _mm_add_ps(_mm_mul_ps(hi, _mm_set1_ps(65536.0f)), lo);
+    return _mm_add_ps(_mm_mul_ps(f, _mm_set1_ps(CPU_CURAND_2POW32_INV)),
+        _mm_set1_ps(CPU_CURAND_2POW32_INV / 2.0f));
+}
+
+__attribute__((target("avx2")))
+inline void cpuCurandSinCosTurnsSimd(__m256 v, __m256 &sine, __m256 &cosine)
+{
+    __m256 q = _mm256_round_ps(_mm256_mul_ps(v, _mm256_set1_ps(4.0f)),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 a = _mm256_mul_ps(_mm256_sub_ps(v, _mm256_mul_ps(q, _mm256_set1_ps(0.25f))),
+        _mm256_set1_ps((float)(2 * CPU_CURAND_PI_DOUBLE)));
+    __m256 a2 = _mm256_mul_ps(a, a);
+    __m256 s = _mm256_add_ps(a, _mm256_mul_ps(_mm256_mul_ps(a, a2),
+        cpuCurandHorner(CPU_CURAND_SIN_FLOAT, a2)));
+    __m256 c = _mm256_add_ps(_mm256_set1_ps(1.0f),
+        _mm256_mul_ps(a2, cpuCurandHorner(CPU_CURAND_COS_FLOAT, a2)));
+    __m256i quadrant = _mm256_cvtps_epi32(q);
+    __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+        _mm256_and_si256(quadrant, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+    __m256i sineSign = _mm256_slli_epi32(_mm256_and_si256(quadrant, _mm256_set1_epi32(2)), 30);
+    __m256i cosineSign = _mm256_slli_epi32(_mm256_and_si256(
+        _mm256_add_epi32(quadrant, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30);
+    sine = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), _mm256_castsi256_ps(sineSign));
+    cosine = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), _mm256_castsi256_ps(cosineSign));
+}
+
+__attribute__((target("avx2")))
+inline void cpuCurandSinCosTurnsSimd(__m256d v, __m256d &sine, __m256d &cosine)
+{
+    __m256d q = _mm256_round_pd(_mm256_mul_pd(v, _mm256_set1_pd(4.0)),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d a = _mm256_mul_pd(_mm256_sub_pd(v, _mm256_mul_pd(q, _mm256_set1_pd(0.25))),
+        _mm256_set1_pd(2 * CPU_CURAND_PI_DOUBLE));
+    __m256d a2 = _mm256_mul_pd(a, a);
+    __m256d s = _mm256_add_pd(a, _mm256_mul_pd(_mm256_mul_pd(a, a2),
+        cpuCurandHorner(CPU_CURAND_SIN_DOUBLE, a2)));
+    __m256d c = _mm256_add_pd(_mm256_set1_pd(1.0),
+        _mm256_mul_pd(a2, cpuCurandHorner(CPU_CURAND_COS_DOUBLE, a2)));
+    __m256i quadrant = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(q));
+    __m256d swap = _mm256_castsi256_pd(_mm256_cmpeq_epi64(
+        _mm256_and_si256(quadrant, _mm256_set1_epi64x(1)), _mm256_set1_epi64x(1)));
+    __m256i sineSign = _mm256_slli_epi64(_mm256_and_si256(quadrant, _mm256_set1_epi64x(2)), 62);
+    __m256i cosineSign = _mm256_slli_epi64(_mm256_and_si256(
+        _mm256_add_epi64(quadrant, _mm256_set1_epi64x(1)), _mm256_set1_epi64x(2)), 62);
+    sine = _mm256_xor_pd(_mm256_blendv_pd(s, c, swap), _mm256_castsi256_pd(sineSign));
+    cosine = _mm256_xor_pd(_mm256_blendv_pd(c, s, swap), _mm256_castsi256_pd(cosineSign));
+}
+
+__attribute__((target("avx2")))
+inline void cpuCurandBoxMullerSimd(__m256 u, __m256 v, __m256 &a, __m256 &b)
+{
+    __m256 s = _mm256_sqrt_ps(_mm256_mul_ps(_mm256_set1_ps(-2.0f), cpuCurandLogSimd(u)));
+    __m256 sine, cosine;
+    cpuCurandSinCosTurnsSimd(v, sine, cosine);
+    a = _mm256_mul_ps(sine, s);
+    b = _mm256_mul_ps(cosine, s);
+}
+
+__attribute__((target("avx2")))
+inline void cpuCurandBoxMullerSimd(__m256d u, __m256d v, __m256d &a, __m256d &b)
+{
+    __m256d s = _mm256_sqrt_pd(_mm256_mul_pd(_mm256_set1_pd(-2.0), cpuCurandLogSimd(u)));
+    __m256d sine, cosine;
+    cpuCurandSinCosTurnsSimd(v, sine, cosine);
+    a = _mm256_mul_pd(sine, s);
+    b = _mm256_mul_pd(cosine, s);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,286 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CpuCurandTruncatedNormal.hpp"
+#include "CpuCurandSimd.hpp"
+
+namespace
+{
+    /**
+     * The number of units that are tried at a time
+     */
+    const size_t BLOCK_SIZE = 256;
+
+    /**
+     * The parameters of the rejection methods
+     */
+    struct Tail
+    {
+        bool pairs;
+        bool robert;
+        double a;
+        double b;
+        double lambda;
+    };
+
+    /**
+     * The largest double value that is smaller than 1
+     */
+    const double ONE_BELOW = 1.0 - CPU_CURAND_2POW53_INV_DOUBLE;
+
+    inline double uniformAt(const unsigned int *words, size_t index, bool pairs)
+    {
+        if (pairs)
+        {
+            return cpuCurandUniformDoubleSimd(words[2 * index], words[2 * index + 1]);
+        }
+        return cpuCurandUniformSimd(words[index]);
+    }
+
+    inline double probability(double u, double qa, double qb)
+    {
+        double p = qb + u * (qa - qb);
+        return p < 1.0 ? p : ONE_BELOW;
+    }
+
+    struct Kernels
+    {
+        /**
+         * Tries the n given units with their uniform samples k and k+1.
+         * Writes whether they have been accepted into 'accepted', and
+         * the samples of the accepted units into z.
+         */
+        void (*attempt)(const unsigned int *words, size_t stride, const unsigned int *units,
+            size_t n, size_t k, const Tail &tail, double *z, unsigned char *accepted);
+
+        /**
+         * Computes the approximations of F^-1(p) for the n given
+         * uniform samples, without the refinement
+         */
+        void (*inverse)(const double *u, size_t n, double qa, double qb, double *x);
+    };
+
+    void attemptScalar(const unsigned int *words, size_t stride, const unsigned int *units,
+        size_t n, size_t k, const Tail &tail, double *z, unsigned char *accepted)
+    {
+        const double a = tail.a;
+        const double b = tail.b;
+        const double width = b - a;
+        for (size_t j = 0; j < n; j++)
+        {
+            unsigned int i = units[j];
+            double u = uniformAt(words + i * stride, k, tail.pairs);
+            double v = uniformAt(words + i * stride, k + 1, tail.pairs);
+            double x;
+            bool accept;
+            if (tail.robert)
+            {
+                x = a - cpuCurandLogSimd(u) / tail.lambda;
+                double t = x - tail.lambda;
+                accept = x <= b && v <= cpuCurandExpSimd(-0.5 * t * t);
+            }
+            else
+            {
+                x = a + u * width;
+                accept = v <= cpuCurandExpSimd(0.5 * (a - x) * (a + x));
+            }
+            accepted[j] = accept;
+            if (accept)
+            {
+                z[i] = x;
+            }
+        }
+    }
+
+    void inverseScalar(const double *u, size_t n, double qa, double qb, double *x)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = cpuCurandNormalCdfInvSimd(probability(u[i], qa, qb));
+        }
+    }
+
+#ifdef CPU_CURAND_AVX2
+    // The AVX2 functions clear the upper halves of the vector registers
+    // before the scalar code for the remaining values, for the reason
+    // that is given in CpuCurandGamma.cpp
+
+    __attribute__((target("avx2")))
+    inline __m256d uniformsAvx2(const unsigned int *words, __m128i wordIndex, size_t k, bool pairs)
+    {
+        const int *w = (const int*)words;
+        if (pairs)
+        {
+            __m128i index = _mm_add_epi32(wordIndex, _mm_set1_epi32((int)(2 * k)));
+            return cpuCurandUniformDoubleSimd(_mm_i32gather_epi32(w, index, 4),
+                _mm_i32gather_epi32(w + 1, index, 4));
+        }
+        __m128i index = _mm_add_epi32(wordIndex, _mm_set1_epi32((int)k));
+        return _mm256_cvtps_pd(cpuCurandUniformSimd(_mm_i32gather_epi32(w, index, 4)));
+    }
+
+    __attribute__((target("avx2")))
+    void attemptAvx2(const unsigned int *words, size_t stride, const unsigned int *units,
+        size_t n, size_t k, const Tail &tail, double *z, unsigned char *accepted)
+    {
+        const __m128i strides = _mm_set1_epi32((int)stride);
+        const __m256d a = _mm256_set1_pd(tail.a);
+        const __m256d b = _mm256_set1_pd(tail.b);
+        const __m256d width = _mm256_set1_pd(tail.b - tail.a);
+        const __m256d lambda = _mm256_set1_pd(tail.lambda);
+        size_t j = 0;
+        for (; j + 4 <= n; j += 4)
+        {
+            __m128i wordIndex = _mm_mullo_epi32(_mm_loadu_si128((const __m128i*)(units + j)), strides);
+            __m256d u = uniformsAvx2(words, wordIndex, k, tail.pairs);
+            __m256d v = uniformsAvx2(words, wordIndex, k + 1, tail.pairs);
+            __m256d x;
+            __m256d accept;
+            if (tail.robert)
+            {
+                x = _mm256_sub_pd(a, _mm256_div_pd(cpuCurandLogSimd(u), lambda));
+                __m256d t = _mm256_sub_pd(x, lambda);
+                __m256d e = cpuCurandExpSimd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(-0.5), t), t));
+                accept = _mm256_and_pd(_mm256_cmp_pd(x, b, _CMP_LE_OQ), _mm256_cmp_pd(v, e, _CMP_LE_OQ));
+            }
+            else
+            {
+                x = _mm256_add_pd(a, _mm256_mul_pd(u, width));
+                __m256d e = cpuCurandExpSimd(_mm256_mul_pd(
+                    _mm256_mul_pd(_mm256_set1_pd(0.5), _mm256_sub_pd(a, x)), _mm256_add_pd(a, x)));
+                accept = _mm256_cmp_pd(v, e, _CMP_LE_OQ);
+            }
+            int mask = _mm256_movemask_pd(accept);
+            double values[4];
+            _mm256_storeu_pd(values, x);
+            for (int l = 0; l < 4; l++)
+            {
+                accepted[j + l] = (mask >> l) & 1;
+                if (accepted[j + l])
+                {
+                    z[units[j + l]] = values[l];
+                }
+            }
+        }
+        _mm256_zeroupper();
+        attemptScalar(words, stride, units + j, n - j, k, tail, z, accepted + j);
+    }
+
+    __attribute__((target("avx2")))
+    void inverseAvx2(const double *u, size_t n, double qa, double qb, double *x)
+    {
+        const __m256d vqa = _mm256_set1_pd(qa);
+        const __m256d vqb = _mm256_set1_pd(qb);
+        const __m256d one = _mm256_set1_pd(1.0);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256d p = _mm256_add_pd(vqb, _mm256_mul_pd(_mm256_loadu_pd(u + i), _mm256_sub_pd(vqa, vqb)));
+            p = _mm256_blendv_pd(p, _mm256_set1_pd(ONE_BELOW), _mm256_cmp_pd(p, one, _CMP_GE_OQ));
+            _mm256_storeu_pd(x + i, cpuCurandNormalCdfInvSimd(p));
+        }
+        _mm256_zeroupper();
+        inverseScalar(u + i, n - i, qa, qb, x + i);
+    }
+#endif
+
+    Kernels selectKernels()
+    {
+        Kernels kernels;
+#ifdef CPU_CURAND_AVX2
+        if (__builtin_cpu_supports("avx2"))
+        {
+            kernels.attempt = attemptAvx2;
+            kernels.inverse = inverseAvx2;
+            return kernels;
+        }
+#endif
+        kernels.attempt = attemptScalar;
+        kernels.inverse = inverseScalar;
+        return kernels;
+    }
+
+    const Kernels &kernels()
+    {
+        static const Kernels kernels = selectKernels();
+        return kernels;
+    }
+}
+
+size_t cpuCurandTruncatedNormalTail(const unsigned int *words, size_t stride, size_t n,
+    size_t attempts, bool pairs, bool robert, double a, double b, double lambda,
+    double *z, size_t *rejected)
+{
+    const Kernels &k = kernels();
+    const Tail tail = { pairs, robert, a, b, lambda };
+    unsigned int units[BLOCK_SIZE];
+    unsigned char accepted[BLOCK_SIZE];
+    size_t numRejected = 0;
+    for (size_t begin = 0; begin < n; begin += BLOCK_SIZE)
+    {
+        size_t size = n - begin < BLOCK_SIZE ? n - begin : BLOCK_SIZE;
+        const unsigned int *blockWords = words + begin * stride;
+        for (size_t i = 0; i < size; i++)
+        {
+            units[i] = (unsigned int)i;
+        }
+        size_t pending = size;
+        for (size_t i = 0; i < attempts && pending > 0; i++)
+        {
+            k.attempt(blockWords, stride, units, pending, 2 * i, tail, z + begin, accepted);
+            size_t remaining = 0;
+            for (size_t j = 0; j < pending; j++)
+            {
+                if (!accepted[j])
+                {
+                    units[remaining++] = units[j];
+                }
+            }
+            pending = remaining;
+        }
+        for (size_t j = 0; j < pending; j++)
+        {
+            rejected[numRejected++] = begin + units[j];
+        }
+    }
+    return numRejected;
+}
+
+void cpuCurandTruncatedNormalInverse(const double *u, size_t n,
+    double qa, double qb, bool refine, double *x)
+{
+    kernels().inverse(u, n, qa, qb, x);
+    for (size_t i = 0; i < n; i++)
+    {
+        if (refine)
+        {
+            x[i] = cpuCurandNormalCdfInvRefine(x[i], probability(u[i], qa, qb));
+        }
+        x[i] = -x[i];
+    }
+}
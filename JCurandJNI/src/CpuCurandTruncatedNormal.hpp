@@ -0,0 +1,66 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_CPU_CURAND_TRUNCATED_NORMAL
+#define JCURAND_CPU_CURAND_TRUNCATED_NORMAL
+
+#include <stddef.h>
+
+/**
+ * Computes standard normal samples that are truncated to [a, b], with
+ * 0 <= a, by rejection, for n units whose words start 'stride' words
+ * apart. Attempt i of a unit uses its uniform samples 2i and 2i+1, which
+ * are single words converted to floats, or pairs of words if 'pairs' is
+ * true. If 'robert' is true, the proposal z = a - log(u) / lambda is
+ * accepted if z <= b and v <= exp(-(z - lambda)^2 / 2). Otherwise, the
+ * proposal z = a + u (b - a) is accepted if v <= exp((a - z) (a + z) / 2).
+ *
+ * All units are tried at once, and the units that are rejected are
+ * compacted for the next attempt. The samples of the accepted units are
+ * written into z. The indices of the units that are rejected in all
+ * 'attempts' attempts are written into 'rejected', in increasing order,
+ * and their number is returned.
+ *
+ * The results do not depend on whether AVX2 instructions are used.
+ */
+size_t cpuCurandTruncatedNormalTail(const unsigned int *words, size_t stride, size_t n,
+    size_t attempts, bool pairs, bool robert, double a, double b, double lambda,
+    double *z, size_t *rejected);
+
+/**
+ * Computes x = -F^-1(qb + u (qa - qb)) for the n given uniform samples u,
+ * where F^-1 is the inverse of the standard normal cumulative
+ * distribution function, as computed by cpuCurandNormalCdfInv. With
+ * 'refine', the refinement step is applied to each value.
+ *
+ * The results do not depend on whether AVX2 instructions are used.
+ */
+void cpuCurandTruncatedNormalInverse(const double *u, size_t n,
+    double qa, double qb, bool refine, double *x);
+
+#endif
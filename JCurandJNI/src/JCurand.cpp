@@ -28,8 +28,30 @@
 
 #include "JCurand.hpp"
 #include "JCurand_common.hpp"
+#include "JCurandBackend.hpp"
+#include "JCurandExport.hpp"
+#include <algorithm>
 #include <iostream>
+#include <new>
 #include <string>
+#include <vector>
+
+/**
+ * Returns whether the given function of the current backend is
+ * available. The extensions that are not part of CURAND are only
+ * provided by the CPU backend. If the function is not available,
+ * an error is logged.
+ */
+template <typename Function>
+static bool isSupported(Function function, const char *name)
+{
+    if (function != NULL)
+    {
+        return true;
+    }
+    Logger::log(LOG_ERROR, "%s is not supported by the %s backend\n", name, getCurandBackend()->name);
+    return false;
+}
 
 /**
  * Called when the library is loaded. Will initialize all
@@ -68,6 +90,412 @@ JNIEXPORT void JNICALL Java_jcuda_jcurand_JCurand_setLogLevelNative
     Logger::setLogLevel((LogLevel)logLevel);
 }
 
+/*
+ * Select the backend that executes the CURAND functions
+ *
+ * Class:     jcuda_jcurand_JCurand
+ * Method:    setBackendNative
+ * Signature: (I)I
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_setBackendNative
+  (JNIEnv *env, jclass cla, jint backend)
+{
+    Logger::log(LOG_TRACE, "Executing setBackend(backend=%d)\n", backend);
+
+    if (!setCurandBackend((int)backend))
+    {
+        Logger::log(LOG_ERROR, "Invalid backend: %d\n", backend);
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return CURAND_STATUS_SUCCESS;
+}
+
+/*
+ * Returns the backend that executes the CURAND functions
+ *
+ * Class:     jcuda_jcurand_JCurand
+ * Method:    getBackendNative
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_getBackendNative
+  (JNIEnv *env, jclass cla)
+{
+    return (jint)getCurandBackend()->id;
+}
+
+
+
+/**
+ * Writes the given values into the given region of a Java array
+ */
+static void setArrayRegion(JNIEnv *env, jarray array, jlong start, jlong count, const float *values)
+{
+    env->SetFloatArrayRegion((jfloatArray)array, (jsize)start, (jsize)count, values);
+}
+static void setArrayRegion(JNIEnv *env, jarray array, jlong start, jlong count, const double *values)
+{
+    env->SetDoubleArrayRegion((jdoubleArray)array, (jsize)start, (jsize)count, values);
+}
+
+/**
+ * Generates the values from the given start index to n in chunks of
+ * the given size into a native buffer, and copies each chunk into
+ * the given Java array. This is used when the JVM does not provide
+ * direct access to the array.
+ */
+template <typename T, typename Generate>
+static jint generateArrayRegions(JNIEnv *env, jarray array, jlong start, jlong n, jint chunkSize, const Generate &generate)
+{
+    T *buffer = new (std::nothrow) T[chunkSize];
+    if (buffer == NULL)
+    {
+        return CURAND_STATUS_ALLOCATION_FAILED;
+    }
+    curandStatus_t result = CURAND_STATUS_SUCCESS;
+    for (jlong i = start; i < n && result == CURAND_STATUS_SUCCESS; i += chunkSize)
+    {
+        jlong count = std::min((jlong)chunkSize, n - i);
+        result = generate(buffer, (size_t)count);
+        if (result == CURAND_STATUS_SUCCESS)
+        {
+            setArrayRegion(env, array, i, count, buffer);
+        }
+    }
+    delete[] buffer;
+    return result;
+}
+
+/**
+ * Generates the first n values of the given Java array in chunks of
+ * the given size. Each chunk is generated directly into the array,
+ * inside its own short critical region, so that the garbage collector
+ * is only blocked for the time of one chunk. If the JVM returns a copy
+ * of the array, then the chunks are generated into a native buffer
+ * instead, so that the array is not copied once for each chunk.
+ *
+ * The given function is called with (T *output, size_t count).
+ */
+template <typename T, typename Generate>
+static jint generateArrayChunks(JNIEnv *env, jarray array, jlong n, jint chunkSize, const Generate &generate)
+{
+    for (jlong i = 0; i < n; i += chunkSize)
+    {
+        jlong count = std::min((jlong)chunkSize, n - i);
+        jboolean isCopy = JNI_FALSE;
+        T *data = (T*)env->GetPrimitiveArrayCritical(array, &isCopy);
+        if (data == NULL)
+        {
+            return JCURAND_STATUS_INTERNAL_ERROR;
+        }
+        if (isCopy)
+        {
+            env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
+            return generateArrayRegions<T>(env, array, i, n, chunkSize, generate);
+        }
+        curandStatus_t result = generate(data + i, (size_t)count);
+        env->ReleasePrimitiveArrayCritical(array, data, 0);
+        if (result != CURAND_STATUS_SUCCESS)
+        {
+            return result;
+        }
+    }
+    return CURAND_STATUS_SUCCESS;
+}
+
+/**
+ * Checks the arguments of the functions that generate values into
+ * Java arrays, and throws an exception if they are not valid
+ */
+static bool checkArrayArguments(JNIEnv *env, jobject generator, jarray output, jint n, jint chunkSize, const char *name)
+{
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", (std::string("Parameter 'generator' is null for ") + name).c_str());
+        return false;
+    }
+    if (output == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", (std::string("Parameter 'output' is null for ") + name).c_str());
+        return false;
+    }
+    if (n < 0 || n > env->GetArrayLength(output))
+    {
+        ThrowByName(env, "java/lang/ArrayIndexOutOfBoundsException", (std::string("Invalid number of values for ") + name).c_str());
+        return false;
+    }
+    if (chunkSize <= 0)
+    {
+        ThrowByName(env, "java/lang/IllegalArgumentException", (std::string("Invalid chunk size for ") + name).c_str());
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Generate values into a Java array, in chunks
+ *
+ * Class:     jcuda_jcurand_JCurand
+ * Method:    curandGenerateUniformArrayNative
+ * Signature: (Ljcuda/jcurand/curandGenerator;[FII)I
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformArrayNative
+  (JNIEnv *env, jclass cls, jobject generator, jfloatArray output, jint n, jint chunkSize)
+{
+    if (!checkArrayArguments(env, generator, output, n, chunkSize, "curandGenerateUniformArray"))
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    Logger::log(LOG_TRACE, "Executing curandGenerateUniformArray(generator=%p, output=%p, n=%d, chunkSize=%d)\n",
+        generator, output, n, chunkSize);
+
+    curandGenerator_t generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    auto generate = [&](float *values, size_t count)
+    {
+        return getCurandBackend()->curandGenerateUniform(generator_native, values, count);
+    };
+    return generateArrayChunks<float>(env, output, n, chunkSize, generate);
+}
+
+/*
+ * Generate values into a Java array, in chunks
+ *
+ * Class:     jcuda_jcurand_JCurand
+ * Method:    curandGenerateUniformDoubleArrayNative
+ * Signature: (Ljcuda/jcurand/curandGenerator;[DII)I
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformDoubleArrayNative
+  (JNIEnv *env, jclass cls, jobject generator, jdoubleArray output, jint n, jint chunkSize)
+{
+    if (!checkArrayArguments(env, generator, output, n, chunkSize, "curandGenerateUniformDoubleArray"))
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    Logger::log(LOG_TRACE, "Executing curandGenerateUniformDoubleArray(generator=%p, output=%p, n=%d, chunkSize=%d)\n",
+        generator, output, n, chunkSize);
+
+    curandGenerator_t generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    auto generate = [&](double *values, size_t count)
+    {
+        return getCurandBackend()->curandGenerateUniformDouble(generator_native, values, count);
+    };
+    return generateArrayChunks<double>(env, output, n, chunkSize, generate);
+}
+
+/*
+ * Generate values into a Java array, in chunks
+ *
+ * Class:     jcuda_jcurand_JCurand
+ * Method:    curandGenerateNormalArrayNative
+ * Signature: (Ljcuda/jcurand/curandGenerator;[FIFFI)I
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalArrayNative
+  (JNIEnv *env, jclass cls, jobject generator, jfloatArray output, jint n, jfloat mean, jfloat stddev, jint chunkSize)
+{
+    if (!checkArrayArguments(env, generator, output, n, chunkSize, "curandGenerateNormalArray"))
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    Logger::log(LOG_TRACE, "Executing curandGenerateNormalArray(generator=%p, output=%p, n=%d, mean=%f, stddev=%f, chunkSize=%d)\n",
+        generator, output, n, mean, stddev, chunkSize);
+
+    // Normal values are generated in pairs
+    chunkSize = std::max(chunkSize & ~1, 2);
+
+    curandGenerator_t generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    auto generate = [&](float *values, size_t count)
+    {
+        return getCurandBackend()->curandGenerateNormal(generator_native, values, count, (float)mean, (float)stddev);
+    };
+    return generateArrayChunks<float>(env, output, n, chunkSize, generate);
+}
+
+/*
+ * Generate values into a Java array, in chunks
+ *
+ * Class:     jcuda_jcurand_JCurand
+ * Method:    curandGenerateNormalDoubleArrayNative
+ * Signature: (Ljcuda/jcurand/curandGenerator;[DIDDI)I
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalDoubleArrayNative
+  (JNIEnv *env, jclass cls, jobject generator, jdoubleArray output, jint n, jdouble mean, jdouble stddev, jint chunkSize)
+{
+    if (!checkArrayArguments(env, generator, output, n, chunkSize, "curandGenerateNormalDoubleArray"))
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    Logger::log(LOG_TRACE, "Executing curandGenerateNormalDoubleArray(generator=%p, output=%p, n=%d, mean=%f, stddev=%f, chunkSize=%d)\n",
+        generator, output, n, mean, stddev, chunkSize);
+
+    // Normal values are generated in pairs
+    chunkSize = std::max(chunkSize & ~1, 2);
+
+    curandGenerator_t generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    auto generate = [&](double *values, size_t count)
+    {
+        return getCurandBackend()->curandGenerateNormalDouble(generator_native, values, count, (double)mean, (double)stddev);
+    };
+    return generateArrayChunks<double>(env, output, n, chunkSize, generate);
+}
+
+/*
+ * Generate values into a Java array, in chunks
+ *
+ * Class:     jcuda_jcurand_JCurand
+ * Method:    curandGenerateLogNormalArrayNative
+ * Signature: (Ljcuda/jcurand/curandGenerator;[FIFFI)I
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLogNormalArrayNative
+  (JNIEnv *env, jclass cls, jobject generator, jfloatArray output, jint n, jfloat mean, jfloat stddev, jint chunkSize)
+{
+    if (!checkArrayArguments(env, generator, output, n, chunkSize, "curandGenerateLogNormalArray"))
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    Logger::log(LOG_TRACE, "Executing curandGenerateLogNormalArray(generator=%p, output=%p, n=%d, mean=%f, stddev=%f, chunkSize=%d)\n",
+        generator, output, n, mean, stddev, chunkSize);
+
+    // Normal values are generated in pairs
+    chunkSize = std::max(chunkSize & ~1, 2);
+
+    curandGenerator_t generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    auto generate = [&](float *values, size_t count)
+    {
+        return getCurandBackend()->curandGenerateLogNormal(generator_native, values, count, (float)mean, (float)stddev);
+    };
+    return generateArrayChunks<float>(env, output, n, chunkSize, generate);
+}
+
+/*
+ * Generate values into a Java array, in chunks
+ *
+ * Class:     jcuda_jcurand_JCurand
+ * Method:    curandGenerateLogNormalDoubleArrayNative
+ * Signature: (Ljcuda/jcurand/curandGenerator;[DIDDI)I
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLogNormalDoubleArrayNative
+  (JNIEnv *env, jclass cls, jobject generator, jdoubleArray output, jint n, jdouble mean, jdouble stddev, jint chunkSize)
+{
+    if (!checkArrayArguments(env, generator, output, n, chunkSize, "curandGenerateLogNormalDoubleArray"))
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    Logger::log(LOG_TRACE, "Executing curandGenerateLogNormalDoubleArray(generator=%p, output=%p, n=%d, mean=%f, stddev=%f, chunkSize=%d)\n",
+        generator, output, n, mean, stddev, chunkSize);
+
+    // Normal values are generated in pairs
+    chunkSize = std::max(chunkSize & ~1, 2);
+
+    curandGenerator_t generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    auto generate = [&](double *values, size_t count)
+    {
+        return getCurandBackend()->curandGenerateLogNormalDouble(generator_native, values, count, (double)mean, (double)stddev);
+    };
+    return generateArrayChunks<double>(env, output, n, chunkSize, generate);
+}
+
+/*
+ * Set the streams of several generators in one call
+ *
+ * Class:     jcuda_jcurand_JCurand
+ * Method:    curandSetGeneratorStreamsNative
+ * Signature: ([Ljcuda/jcurand/curandGenerator;IJ[JI)I
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorStreamsNative
+  (JNIEnv *env, jclass cls, jobjectArray generators, jint count, jlong seed, jlongArray paths, jint depth)
+{
+    if (generators == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generators' is null for curandSetGeneratorStreams");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (paths == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'paths' is null for curandSetGeneratorStreams");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (count < 0 || count > env->GetArrayLength(generators) ||
+        depth < 0 || (jlong)count * depth > env->GetArrayLength(paths))
+    {
+        ThrowByName(env, "java/lang/ArrayIndexOutOfBoundsException", "Invalid number of generators or depth for curandSetGeneratorStreams");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    Logger::log(LOG_TRACE, "Executing curandSetGeneratorStreams(generators=%p, count=%d, seed=%ld, paths=%p, depth=%d)\n",
+        generators, count, seed, paths, depth);
+
+    if (!isSupported(getCurandBackend()->curandSetGeneratorStreams, "curandSetGeneratorStreams"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    std::vector<curandGenerator_t> generators_native(count);
+    for (jint i = 0; i < count; i++)
+    {
+        jobject generator = env->GetObjectArrayElement(generators, i);
+        if (generator == NULL)
+        {
+            ThrowByName(env, "java/lang/NullPointerException", "Element of 'generators' is null for curandSetGeneratorStreams");
+            return JCURAND_STATUS_INTERNAL_ERROR;
+        }
+        generators_native[i] = (curandGenerator_t)getNativePointerValue(env, generator);
+        env->DeleteLocalRef(generator);
+    }
+    std::vector<unsigned long long> paths_native((size_t)count * depth);
+    env->GetLongArrayRegion(paths, 0, count * depth, (jlong*)paths_native.data());
+
+    curandStatus_t result_native = getCurandBackend()->curandSetGeneratorStreams(
+        generators_native.data(), (unsigned int)count, (unsigned long long)seed,
+        paths_native.data(), (unsigned int)depth);
+    return (jint)result_native;
+}
+
+/*
+ * Generate values into a file
+ *
+ * Class:     jcuda_jcurand_JCurand
+ * Method:    curandExportToFileNative
+ * Signature: (Ljcuda/jcurand/curandGenerator;Ljava/lang/String;IJDDI[D)I
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandExportToFileNative
+  (JNIEnv *env, jclass cls, jobject generator, jstring path, jint distribution, jlong n, jdouble mean, jdouble stddev, jint format, jdoubleArray gigabytesPerSecond)
+{
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandExportToFile");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (path == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'path' is null for curandExportToFile");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (n < 0 || (gigabytesPerSecond != NULL && env->GetArrayLength(gigabytesPerSecond) < 1))
+    {
+        ThrowByName(env, "java/lang/ArrayIndexOutOfBoundsException", "Invalid number of values or result array for curandExportToFile");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    Logger::log(LOG_TRACE, "Executing curandExportToFile(generator=%p, path=%p, distribution=%d, n=%ld, mean=%f, stddev=%f, format=%d, gigabytesPerSecond=%p)\n",
+        generator, path, distribution, n, mean, stddev, format, gigabytesPerSecond);
+
+    const char *path_native = env->GetStringUTFChars(path, NULL);
+    if (path_native == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    curandGenerator_t generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    double gigabytesPerSecond_native = 0.0;
+    curandStatus_t result_native = exportCurandFile(generator_native, path_native,
+        (curandExportDistribution_t)distribution, (size_t)n, (double)mean, (double)stddev,
+        (curandExportFormat_t)format, &gigabytesPerSecond_native);
+    env->ReleaseStringUTFChars(path, path_native);
+
+    if (gigabytesPerSecond != NULL)
+    {
+        jdouble value = (jdouble)gigabytesPerSecond_native;
+        env->SetDoubleArrayRegion(gigabytesPerSecond, 0, 1, &value);
+    }
+    return (jint)result_native;
+}
+
 
 
 
@@ -141,7 +569,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGetPropertyNative(JNIEnv
     // value is write-only
 
     // Native function call
-    curandStatus_t jniResult_native = curandGetProperty(type_native, &value_native);
+    curandStatus_t jniResult_native = getCurandBackend()->curandGetProperty(type_native, &value_native);
 
     // Write back native variable values
     // type is primitive
@@ -239,7 +667,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandCreateGeneratorNative(JN
     rng_type_native = (curandRngType_t)rng_type;
 
     // Native function call
-    curandStatus_t result_native = curandCreateGenerator(&generator_native, rng_type_native);
+    curandStatus_t result_native = getCurandBackend()->curandCreateGenerator(&generator_native, rng_type_native);
 
     // Write back native variable values
     setNativePointerValue(env, generator, (jlong)generator_native);
@@ -325,7 +753,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandCreateGeneratorHostNativ
     rng_type_native = (curandRngType_t)rng_type;
 
     // Native function call
-    curandStatus_t result_native = curandCreateGeneratorHost(&generator_native, rng_type_native);
+    curandStatus_t result_native = getCurandBackend()->curandCreateGeneratorHost(&generator_native, rng_type_native);
 
     // Write back native variable values
     setNativePointerValue(env, generator, (jlong)generator_native);
@@ -368,7 +796,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandDestroyGeneratorNative(J
     generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
 
     // Native function call
-    curandStatus_t result_native = curandDestroyGenerator(generator_native);
+    curandStatus_t result_native = getCurandBackend()->curandDestroyGenerator(generator_native);
 
     // Return the result
     return (jint)result_native;
@@ -407,7 +835,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGetVersionNative(JNIEnv
     int version_native;
 
     // Native function call
-    curandStatus_t result_native = curandGetVersion(&version_native);
+    curandStatus_t result_native = getCurandBackend()->curandGetVersion(&version_native);
 
     // Write back native variable values
     set(env, version, 0, (jint)version_native);
@@ -459,7 +887,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetStreamNative(JNIEnv *
     stream_native = (cudaStream_t)getNativePointerValue(env, stream);
 
     // Native function call
-    curandStatus_t result_native = curandSetStream(generator_native, stream_native);
+    curandStatus_t result_native = getCurandBackend()->curandSetStream(generator_native, stream_native);
 
     // Return the result
     return (jint)result_native;
@@ -506,7 +934,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetPseudoRandomGenerator
     seed_native = (unsigned long long)seed;
 
     // Native function call
-    curandStatus_t result_native = curandSetPseudoRandomGeneratorSeed(generator_native, seed_native);
+    curandStatus_t result_native = getCurandBackend()->curandSetPseudoRandomGeneratorSeed(generator_native, seed_native);
 
     // Return the result
     return (jint)result_native;
@@ -552,7 +980,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorOffsetNative
     offset_native = (unsigned long long)offset;
 
     // Native function call
-    curandStatus_t result_native = curandSetGeneratorOffset(generator_native, offset_native);
+    curandStatus_t result_native = getCurandBackend()->curandSetGeneratorOffset(generator_native, offset_native);
 
     // Return the result
     return (jint)result_native;
@@ -604,7 +1032,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorOrderingNati
     order_native = (curandOrdering_t)order;
 
     // Native function call
-    curandStatus_t result_native = curandSetGeneratorOrdering(generator_native, order_native);
+    curandStatus_t result_native = getCurandBackend()->curandSetGeneratorOrdering(generator_native, order_native);
 
     // Return the result
     return (jint)result_native;
@@ -652,7 +1080,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetQuasiRandomGeneratorD
     num_dimensions_native = (unsigned int)num_dimensions;
 
     // Native function call
-    curandStatus_t result_native = curandSetQuasiRandomGeneratorDimensions(generator_native, num_dimensions_native);
+    curandStatus_t result_native = getCurandBackend()->curandSetQuasiRandomGeneratorDimensions(generator_native, num_dimensions_native);
 
     // Return the result
     return (jint)result_native;
@@ -719,7 +1147,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNative(JNIEnv *e
     num_native = (size_t)num;
 
     // Native function call
-    curandStatus_t result_native = curandGenerate(generator_native, outputPtr_native, num_native);
+    curandStatus_t result_native = getCurandBackend()->curandGenerate(generator_native, outputPtr_native, num_native);
 
     // Write back native variable values
     if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
@@ -789,7 +1217,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLongLongNative(J
     num_native = (size_t)num;
 
     // Native function call
-    curandStatus_t result_native = curandGenerateLongLong(generator_native, outputPtr_native, num_native);
+    curandStatus_t result_native = getCurandBackend()->curandGenerateLongLong(generator_native, outputPtr_native, num_native);
 
     // Write back native variable values
     if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
@@ -860,7 +1288,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformNative(JN
     num_native = (size_t)num;
 
     // Native function call
-    curandStatus_t result_native = curandGenerateUniform(generator_native, outputPtr_native, num_native);
+    curandStatus_t result_native = getCurandBackend()->curandGenerateUniform(generator_native, outputPtr_native, num_native);
 
     // Write back native variable values
     if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
@@ -932,7 +1360,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformDoubleNat
     num_native = (size_t)num;
 
     // Native function call
-    curandStatus_t result_native = curandGenerateUniformDouble(generator_native, outputPtr_native, num_native);
+    curandStatus_t result_native = getCurandBackend()->curandGenerateUniformDouble(generator_native, outputPtr_native, num_native);
 
     // Write back native variable values
     if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
@@ -1024,7 +1452,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalNative(JNI
     stddev_native = (float)stddev;
 
     // Native function call
-    curandStatus_t result_native = curandGenerateNormal(generator_native, outputPtr_native, n_native, mean_native, stddev_native);
+    curandStatus_t result_native = getCurandBackend()->curandGenerateNormal(generator_native, outputPtr_native, n_native, mean_native, stddev_native);
 
     // Write back native variable values
     if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
@@ -1117,7 +1545,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalDoubleNati
     stddev_native = (double)stddev;
 
     // Native function call
-    curandStatus_t result_native = curandGenerateNormalDouble(generator_native, outputPtr_native, n_native, mean_native, stddev_native);
+    curandStatus_t result_native = getCurandBackend()->curandGenerateNormalDouble(generator_native, outputPtr_native, n_native, mean_native, stddev_native);
 
     // Write back native variable values
     if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
@@ -1210,7 +1638,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLogNormalNative(
     stddev_native = (float)stddev;
 
     // Native function call
-    curandStatus_t result_native = curandGenerateLogNormal(generator_native, outputPtr_native, n_native, mean_native, stddev_native);
+    curandStatus_t result_native = getCurandBackend()->curandGenerateLogNormal(generator_native, outputPtr_native, n_native, mean_native, stddev_native);
 
     // Write back native variable values
     if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
@@ -1304,7 +1732,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLogNormalDoubleN
     stddev_native = (double)stddev;
 
     // Native function call
-    curandStatus_t result_native = curandGenerateLogNormalDouble(generator_native, outputPtr_native, n_native, mean_native, stddev_native);
+    curandStatus_t result_native = getCurandBackend()->curandGenerateLogNormalDouble(generator_native, outputPtr_native, n_native, mean_native, stddev_native);
 
     // Write back native variable values
     if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
@@ -1344,7 +1772,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandCreatePoissonDistributio
     discrete_distribution_native = NULL;
 
     // Native function call
-    curandStatus_t result_native = curandCreatePoissonDistribution(lambda, &discrete_distribution_native);
+    curandStatus_t result_native = getCurandBackend()->curandCreatePoissonDistribution(lambda, &discrete_distribution_native);
 
     // Write back native variable values
     setNativePointerValue(env, discrete_distribution, (jlong)discrete_distribution_native);
@@ -1380,7 +1808,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandDestroyDistributionNativ
     discrete_distribution_native = (curandDiscreteDistribution_t)getNativePointerValue(env, discrete_distribution);
 
     // Native function call
-    curandStatus_t result_native = curandDestroyDistribution(discrete_distribution_native);
+    curandStatus_t result_native = getCurandBackend()->curandDestroyDistribution(discrete_distribution_native);
 
     // Return the result
     return (jint)result_native;
@@ -1429,7 +1857,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGeneratePoissonNative
     lambda_native = (double)lambda;
 
     // Native function call
-    curandStatus_t result_native = curandGeneratePoisson(generator_native, outputPtr_native, n_native, lambda_native);
+    curandStatus_t result_native = getCurandBackend()->curandGeneratePoisson(generator_native, outputPtr_native, n_native, lambda_native);
 
     // Write back native variable values
     if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
@@ -1484,7 +1912,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateSeedsNative(JNIE
     generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
 
     // Native function call
-    curandStatus_t result_native = curandGenerateSeeds(generator_native);
+    curandStatus_t result_native = getCurandBackend()->curandGenerateSeeds(generator_native);
 
     // Return the result
     return (jint)result_native;
@@ -1542,7 +1970,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGetDirectionVectors32Nat
     set_native = (curandDirectionVectorSet_t)set;
 
     // Native function call
-    curandStatus_t result = curandGetDirectionVectors32(&vectors_native, set_native);
+    curandStatus_t result = getCurandBackend()->curandGetDirectionVectors32(&vectors_native, set_native);
 
     if (set_native != CURAND_DIRECTION_VECTORS_32_JOEKUO6 &&
         set_native != CURAND_SCRAMBLED_DIRECTION_VECTORS_32_JOEKUO6)
@@ -1551,6 +1979,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGetDirectionVectors32Nat
         return JCURAND_STATUS_INTERNAL_ERROR;
     }
 
+    if (result != CURAND_STATUS_SUCCESS)
+    {
+        return (jint)result;
+    }
+
     // Write back native variable values
     int dimensions = 20000;
     int numVectors = 32;
@@ -1642,7 +2075,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGetScrambleConstants32Na
     unsigned int* constants_native;
 
     // Native function call
-    curandStatus_t result = curandGetScrambleConstants32(&constants_native);
+    curandStatus_t result = getCurandBackend()->curandGetScrambleConstants32(&constants_native);
+
+    if (result != CURAND_STATUS_SUCCESS)
+    {
+        return (jint)result;
+    }
 
     // Write back native variable values
 
@@ -1731,7 +2169,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGetDirectionVectors64Nat
     set_native = (curandDirectionVectorSet_t)set;
 
     // Native function call
-    curandStatus_t result = curandGetDirectionVectors64(&vectors_native, set_native);
+    curandStatus_t result = getCurandBackend()->curandGetDirectionVectors64(&vectors_native, set_native);
 
     if (set_native != CURAND_DIRECTION_VECTORS_64_JOEKUO6 &&
         set_native != CURAND_SCRAMBLED_DIRECTION_VECTORS_64_JOEKUO6)
@@ -1740,6 +2178,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGetDirectionVectors64Nat
         return JCURAND_STATUS_INTERNAL_ERROR;
     }
 
+    if (result != CURAND_STATUS_SUCCESS)
+    {
+        return (jint)result;
+    }
+
     // Write back native variable values
     int dimensions = 20000;
     int numVectors = 64;
@@ -1831,7 +2274,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGetScrambleConstants64Na
     unsigned long long *constants_native;
 
     // Native function call
-    curandStatus_t result = curandGetScrambleConstants64(&constants_native);
+    curandStatus_t result = getCurandBackend()->curandGetScrambleConstants64(&constants_native);
+
+    if (result != CURAND_STATUS_SUCCESS)
+    {
+        return (jint)result;
+    }
 
     // Write back native variable values
 
@@ -1868,3 +2316,4639 @@ JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGetScrambleConstants64Na
     return (jint)result;
 }
 
+/**
+ * <pre>
+ * \brief Generate uniformly distributed half precision values.
+ *
+ * Use \p generator to generate \p num uniformly distributed half precision
+ * values into the host memory at \p outputPtr. Each value is stored
+ * as the 16 bits of an IEEE 754 half precision value.
+ *
+ * The results are the values of ::curandGenerateUniform, rounded to
+ * the nearest half precision value (ties to even) in the same pass.
+ * Values below 2^-25 are rounded to 0.0.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param num - Number of values to generate
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    16 bit floating point generation \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+ *    not a multiple of the quasirandom dimension \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformHalfNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong num)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateUniformHalf");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateUniformHalf");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateUniformHalf(generator=%p, outputPtr=%p, num=%ld)\n",
+        generator, outputPtr, num);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateUniformHalf, "curandGenerateUniformHalf"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    unsigned short* outputPtr_native = NULL;
+    size_t num_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (unsigned short*)outputPtrPointerData->getPointer(env);
+    num_native = (size_t)num;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateUniformHalf(generator_native, outputPtr_native, num_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate uniformly distributed bfloat16 values.
+ *
+ * Use \p generator to generate \p num uniformly distributed bfloat16
+ * values into the host memory at \p outputPtr. Each value is stored
+ * as the 16 bits of a bfloat16 value.
+ *
+ * The results are the values of ::curandGenerateUniform, rounded to
+ * the nearest bfloat16 value (ties to even) in the same pass.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param num - Number of values to generate
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    16 bit floating point generation \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+ *    not a multiple of the quasirandom dimension \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformBF16Native(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong num)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateUniformBF16");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateUniformBF16");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateUniformBF16(generator=%p, outputPtr=%p, num=%ld)\n",
+        generator, outputPtr, num);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateUniformBF16, "curandGenerateUniformBF16"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    unsigned short* outputPtr_native = NULL;
+    size_t num_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (unsigned short*)outputPtrPointerData->getPointer(env);
+    num_native = (size_t)num;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateUniformBF16(generator_native, outputPtr_native, num_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate normally distributed half precision values.
+ *
+ * Use \p generator to generate \p n normally distributed half precision
+ * values with mean \p mean and standard deviation \p stddev into the
+ * host memory at \p outputPtr. Each value is stored as the 16 bits
+ * of an IEEE 754 half precision value.
+ *
+ * The results are the values of ::curandGenerateNormal, rounded to
+ * the nearest half precision value (ties to even) in the same pass.
+ * Pseudorandom generators require \p n to be even.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of values to generate
+ * @param mean - Mean of normal distribution
+ * @param stddev - Standard deviation of normal distribution
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    16 bit floating point generation \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+ *    not a multiple of the quasirandom dimension, or is not even for
+ *    a pseudorandom generator \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalHalfNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jfloat mean, jfloat stddev)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateNormalHalf");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateNormalHalf");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateNormalHalf(generator=%p, outputPtr=%p, n=%ld, mean=%f, stddev=%f)\n",
+        generator, outputPtr, n, mean, stddev);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateNormalHalf, "curandGenerateNormalHalf"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    unsigned short* outputPtr_native = NULL;
+    size_t n_native = 0;
+    float mean_native = 0.0f;
+    float stddev_native = 0.0f;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (unsigned short*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    mean_native = (float)mean;
+    stddev_native = (float)stddev;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateNormalHalf(generator_native, outputPtr_native, n_native, mean_native, stddev_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate normally distributed bfloat16 values.
+ *
+ * Use \p generator to generate \p n normally distributed bfloat16
+ * values with mean \p mean and standard deviation \p stddev into the
+ * host memory at \p outputPtr. Each value is stored as the 16 bits
+ * of a bfloat16 value.
+ *
+ * The results are the values of ::curandGenerateNormal, rounded to
+ * the nearest bfloat16 value (ties to even) in the same pass.
+ * Pseudorandom generators require \p n to be even.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of values to generate
+ * @param mean - Mean of normal distribution
+ * @param stddev - Standard deviation of normal distribution
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    16 bit floating point generation \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+ *    not a multiple of the quasirandom dimension, or is not even for
+ *    a pseudorandom generator \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalBF16Native(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jfloat mean, jfloat stddev)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateNormalBF16");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateNormalBF16");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateNormalBF16(generator=%p, outputPtr=%p, n=%ld, mean=%f, stddev=%f)\n",
+        generator, outputPtr, n, mean, stddev);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateNormalBF16, "curandGenerateNormalBF16"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    unsigned short* outputPtr_native = NULL;
+    size_t n_native = 0;
+    float mean_native = 0.0f;
+    float stddev_native = 0.0f;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (unsigned short*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    mean_native = (float)mean;
+    stddev_native = (float)stddev;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateNormalBF16(generator_native, outputPtr_native, n_native, mean_native, stddev_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate uniformly distributed 32-bit integers in a range.
+ *
+ * Use \p generator to generate \p n 32-bit integers into the host memory
+ * at \p outputPtr. The results are uniformly distributed in the range
+ * from \p lo to \p hi, including both bounds.
+ *
+ * Pseudorandom generators use Lemire's multiply-shift method, with
+ * a rare rejection that makes the results exactly uniform. For ranges
+ * up to 2^16, each 32-bit value of the generator is used for two
+ * results. Values that have been rejected are replaced by the values
+ * that follow the results in the sequence, so the generator may advance
+ * by slightly more values than the number of results.
+ *
+ * Quasirandom generators scale their values to the range, which
+ * preserves their uniformity.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of integers to generate
+ * @param lo - The smallest value
+ * @param hi - The largest value
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    integer range generation \n
+ * CURAND_STATUS_OUT_OF_RANGE if hi is smaller than lo \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+ *    not a multiple of the quasirandom dimension \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateIntRangeNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jint lo, jint hi)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateIntRange");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateIntRange");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateIntRange(generator=%p, outputPtr=%p, n=%ld, lo=%d, hi=%d)\n",
+        generator, outputPtr, n, lo, hi);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateIntRange, "curandGenerateIntRange"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    int* outputPtr_native = NULL;
+    size_t n_native = 0;
+    int lo_native = 0;
+    int hi_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (int*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    lo_native = (int)lo;
+    hi_native = (int)hi;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateIntRange(generator_native, outputPtr_native, n_native, lo_native, hi_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate uniformly distributed 64-bit integers in a range.
+ *
+ * Use \p generator to generate \p n 64-bit integers into the host memory
+ * at \p outputPtr. The results are uniformly distributed in the range
+ * from \p lo to \p hi, including both bounds.
+ *
+ * Pseudorandom generators use Lemire's multiply-shift method, with
+ * a rare rejection that makes the results exactly uniform. For ranges
+ * up to 2^16, each 32-bit value of the generator is used for two
+ * results, and ranges above 2^32 use two 32-bit values for each
+ * result. Values that have been rejected are replaced by the values
+ * that follow the results in the sequence, so the generator may advance
+ * by slightly more values than the number of results.
+ *
+ * Quasirandom generators scale their values to the range, which
+ * preserves their uniformity. The 64-bit quasirandom generators use
+ * their 64-bit values.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of integers to generate
+ * @param lo - The smallest value
+ * @param hi - The largest value
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    integer range generation \n
+ * CURAND_STATUS_OUT_OF_RANGE if hi is smaller than lo \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+ *    not a multiple of the quasirandom dimension \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLongLongRangeNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jlong lo, jlong hi)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateLongLongRange");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateLongLongRange");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateLongLongRange(generator=%p, outputPtr=%p, n=%ld, lo=%ld, hi=%ld)\n",
+        generator, outputPtr, n, lo, hi);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateLongLongRange, "curandGenerateLongLongRange"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    long long* outputPtr_native = NULL;
+    size_t n_native = 0;
+    long long lo_native = 0;
+    long long hi_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (long long*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    lo_native = (long long)lo;
+    hi_native = (long long)hi;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateLongLongRange(generator_native, outputPtr_native, n_native, lo_native, hi_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate packed Bernoulli distributed bits.
+ *
+ * Use \p generator to generate \p nBits bits into the host memory at
+ * \p outputPtr, where each bit is 1 with the probability \p p. The bits
+ * are packed into 32-bit integers, starting at the least significant
+ * bit, so the memory must hold (nBits + 31) / 32 integers. Unused bits
+ * of the last integer are set to 0.
+ *
+ * The bits are computed by comparing uniform random numbers with
+ * \p p, one binary digit at a time, for 32 bits at once. This is exact
+ * for every double value of \p p. For p = 2^-k with k <= 32, each bit
+ * uses k random bits. Only pseudorandom generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param nBits - Number of bits to generate
+ * @param p - The probability of a bit being 1, in [0, 1]
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    Bernoulli bit generation, or the generator is a quasirandom
+ *    generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if p is not in [0, 1] \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateBernoulliBitsNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong nBits, jdouble p)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateBernoulliBits");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateBernoulliBits");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateBernoulliBits(generator=%p, outputPtr=%p, nBits=%ld, p=%f)\n",
+        generator, outputPtr, nBits, p);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateBernoulliBits, "curandGenerateBernoulliBits"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    unsigned int* outputPtr_native = NULL;
+    size_t nBits_native = 0;
+    double p_native = 0.0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (unsigned int*)outputPtrPointerData->getPointer(env);
+    nBits_native = (size_t)nBits;
+    p_native = (double)p;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateBernoulliBits(generator_native, outputPtr_native, nBits_native, p_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate exponentially distributed floats.
+ *
+ * Use \p generator to generate \p n floats into the host memory at
+ * \p outputPtr. The results are exponentially distributed with the rate
+ * \p lambda, and computed by inversion of uniform values.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of floats to generate
+ * @param lambda - The rate, which is the reciprocal of the mean
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    this distribution \n
+ * CURAND_STATUS_OUT_OF_RANGE if lambda is not positive \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+ *    not a multiple of the quasirandom dimension \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateExponentialNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jfloat lambda)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateExponential");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateExponential");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateExponential(generator=%p, outputPtr=%p, n=%ld, lambda=%f)\n",
+        generator, outputPtr, n, lambda);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateExponential, "curandGenerateExponential"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t n_native = 0;
+    float lambda_native = 0.0f;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    lambda_native = (float)lambda;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateExponential(generator_native, outputPtr_native, n_native, lambda_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate exponentially distributed doubles.
+ *
+ * Use \p generator to generate \p n doubles into the host memory at
+ * \p outputPtr. The results are exponentially distributed with the rate
+ * \p lambda, and computed by inversion of uniform values.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of doubles to generate
+ * @param lambda - The rate, which is the reciprocal of the mean
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    this distribution \n
+ * CURAND_STATUS_OUT_OF_RANGE if lambda is not positive \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+ *    not a multiple of the quasirandom dimension \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateExponentialDoubleNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jdouble lambda)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateExponentialDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateExponentialDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateExponentialDouble(generator=%p, outputPtr=%p, n=%ld, lambda=%f)\n",
+        generator, outputPtr, n, lambda);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateExponentialDouble, "curandGenerateExponentialDouble"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t n_native = 0;
+    double lambda_native = 0.0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    lambda_native = (double)lambda;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateExponentialDouble(generator_native, outputPtr_native, n_native, lambda_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate gamma distributed floats.
+ *
+ * Use \p generator to generate \p n floats into the host memory at
+ * \p outputPtr. The results are gamma distributed with the given
+ * \p shape and \p scale, and computed with the method of Marsaglia and
+ * Tsang. Values that have been rejected are replaced by values that
+ * follow the results in the sequence, so the generator may advance by
+ * slightly more values than the number of results. Only pseudorandom
+ * generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of floats to generate
+ * @param shape - The shape parameter
+ * @param scale - The scale parameter
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    this distribution, or the generator is a quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if shape or scale is not positive \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateGammaNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jfloat shape, jfloat scale)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateGamma");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateGamma");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateGamma(generator=%p, outputPtr=%p, n=%ld, shape=%f, scale=%f)\n",
+        generator, outputPtr, n, shape, scale);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateGamma, "curandGenerateGamma"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t n_native = 0;
+    float shape_native = 0.0f;
+    float scale_native = 0.0f;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    shape_native = (float)shape;
+    scale_native = (float)scale;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateGamma(generator_native, outputPtr_native, n_native, shape_native, scale_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate gamma distributed doubles.
+ *
+ * Use \p generator to generate \p n doubles into the host memory at
+ * \p outputPtr. The results are gamma distributed with the given
+ * \p shape and \p scale, and computed with the method of Marsaglia and
+ * Tsang. Values that have been rejected are replaced by values that
+ * follow the results in the sequence, so the generator may advance by
+ * slightly more values than the number of results. Only pseudorandom
+ * generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of doubles to generate
+ * @param shape - The shape parameter
+ * @param scale - The scale parameter
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    this distribution, or the generator is a quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if shape or scale is not positive \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateGammaDoubleNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jdouble shape, jdouble scale)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateGammaDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateGammaDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateGammaDouble(generator=%p, outputPtr=%p, n=%ld, shape=%f, scale=%f)\n",
+        generator, outputPtr, n, shape, scale);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateGammaDouble, "curandGenerateGammaDouble"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t n_native = 0;
+    double shape_native = 0.0;
+    double scale_native = 0.0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    shape_native = (double)shape;
+    scale_native = (double)scale;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateGammaDouble(generator_native, outputPtr_native, n_native, shape_native, scale_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate beta distributed floats.
+ *
+ * Use \p generator to generate \p n floats into the host memory at
+ * \p outputPtr. The results are beta distributed with the shape
+ * parameters \p alpha and \p beta, and computed from two gamma
+ * distributed values. Values that have been rejected are replaced by
+ * values that follow the results in the sequence, so the generator may
+ * advance by slightly more values than the number of results. Only
+ * pseudorandom generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of floats to generate
+ * @param alpha - The first shape parameter
+ * @param beta - The second shape parameter
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    this distribution, or the generator is a quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if alpha or beta is not positive \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateBetaNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jfloat alpha, jfloat beta)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateBeta");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateBeta");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateBeta(generator=%p, outputPtr=%p, n=%ld, alpha=%f, beta=%f)\n",
+        generator, outputPtr, n, alpha, beta);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateBeta, "curandGenerateBeta"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t n_native = 0;
+    float alpha_native = 0.0f;
+    float beta_native = 0.0f;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    alpha_native = (float)alpha;
+    beta_native = (float)beta;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateBeta(generator_native, outputPtr_native, n_native, alpha_native, beta_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate beta distributed doubles.
+ *
+ * Use \p generator to generate \p n doubles into the host memory at
+ * \p outputPtr. The results are beta distributed with the shape
+ * parameters \p alpha and \p beta, and computed from two gamma
+ * distributed values. Values that have been rejected are replaced by
+ * values that follow the results in the sequence, so the generator may
+ * advance by slightly more values than the number of results. Only
+ * pseudorandom generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of doubles to generate
+ * @param alpha - The first shape parameter
+ * @param beta - The second shape parameter
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    this distribution, or the generator is a quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if alpha or beta is not positive \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateBetaDoubleNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jdouble alpha, jdouble beta)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateBetaDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateBetaDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateBetaDouble(generator=%p, outputPtr=%p, n=%ld, alpha=%f, beta=%f)\n",
+        generator, outputPtr, n, alpha, beta);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateBetaDouble, "curandGenerateBetaDouble"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t n_native = 0;
+    double alpha_native = 0.0;
+    double beta_native = 0.0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    alpha_native = (double)alpha;
+    beta_native = (double)beta;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateBetaDouble(generator_native, outputPtr_native, n_native, alpha_native, beta_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate chi-squared distributed floats.
+ *
+ * Use \p generator to generate \p n floats into the host memory at
+ * \p outputPtr. The results are chi-squared distributed with \p k
+ * degrees of freedom, and computed as gamma distributed values with the
+ * shape k/2 and the scale 2. Values that have been rejected are replaced
+ * by values that follow the results in the sequence, so the generator
+ * may advance by slightly more values than the number of results. Only
+ * pseudorandom generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of floats to generate
+ * @param k - The degrees of freedom, which do not have to be an integer
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    this distribution, or the generator is a quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if k is not positive \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateChiSquaredNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jfloat k)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateChiSquared");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateChiSquared");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateChiSquared(generator=%p, outputPtr=%p, n=%ld, k=%f)\n",
+        generator, outputPtr, n, k);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateChiSquared, "curandGenerateChiSquared"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t n_native = 0;
+    float k_native = 0.0f;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    k_native = (float)k;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateChiSquared(generator_native, outputPtr_native, n_native, k_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate chi-squared distributed doubles.
+ *
+ * Use \p generator to generate \p n doubles into the host memory at
+ * \p outputPtr. The results are chi-squared distributed with \p k
+ * degrees of freedom, and computed as gamma distributed values with the
+ * shape k/2 and the scale 2. Values that have been rejected are replaced
+ * by values that follow the results in the sequence, so the generator
+ * may advance by slightly more values than the number of results. Only
+ * pseudorandom generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of doubles to generate
+ * @param k - The degrees of freedom, which do not have to be an integer
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    this distribution, or the generator is a quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if k is not positive \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateChiSquaredDoubleNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jdouble k)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateChiSquaredDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateChiSquaredDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateChiSquaredDouble(generator=%p, outputPtr=%p, n=%ld, k=%f)\n",
+        generator, outputPtr, n, k);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateChiSquaredDouble, "curandGenerateChiSquaredDouble"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t n_native = 0;
+    double k_native = 0.0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    k_native = (double)k;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateChiSquaredDouble(generator_native, outputPtr_native, n_native, k_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate Student's t distributed floats.
+ *
+ * Use \p generator to generate \p n floats into the host memory at
+ * \p outputPtr. The results follow Student's t distribution with \p nu
+ * degrees of freedom, and are computed from a normal and a gamma
+ * distributed value. Values that have been rejected are replaced by
+ * values that follow the results in the sequence, so the generator may
+ * advance by slightly more values than the number of results. Only
+ * pseudorandom generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of floats to generate
+ * @param nu - The degrees of freedom, which do not have to be an integer
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    this distribution, or the generator is a quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if nu is not positive \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateStudentTNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jfloat nu)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateStudentT");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateStudentT");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateStudentT(generator=%p, outputPtr=%p, n=%ld, nu=%f)\n",
+        generator, outputPtr, n, nu);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateStudentT, "curandGenerateStudentT"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t n_native = 0;
+    float nu_native = 0.0f;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    nu_native = (float)nu;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateStudentT(generator_native, outputPtr_native, n_native, nu_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate Student's t distributed doubles.
+ *
+ * Use \p generator to generate \p n doubles into the host memory at
+ * \p outputPtr. The results follow Student's t distribution with \p nu
+ * degrees of freedom, and are computed from a normal and a gamma
+ * distributed value. Values that have been rejected are replaced by
+ * values that follow the results in the sequence, so the generator may
+ * advance by slightly more values than the number of results. Only
+ * pseudorandom generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of doubles to generate
+ * @param nu - The degrees of freedom, which do not have to be an integer
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    this distribution, or the generator is a quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if nu is not positive \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateStudentTDoubleNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jdouble nu)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateStudentTDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateStudentTDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateStudentTDouble(generator=%p, outputPtr=%p, n=%ld, nu=%f)\n",
+        generator, outputPtr, n, nu);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateStudentTDouble, "curandGenerateStudentTDouble"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t n_native = 0;
+    double nu_native = 0.0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    nu_native = (double)nu;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateStudentTDouble(generator_native, outputPtr_native, n_native, nu_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate truncated normally distributed floats.
+ *
+ * Use \p generator to generate \p n floats into the host memory at
+ * \p outputPtr. The results are normally distributed with the mean
+ * \p mean and the standard deviation \p stddev, conditioned on being in
+ * the interval from \p lo to \p hi. The bounds may be infinite.
+ *
+ * For pseudorandom generators, the method depends on the interval:
+ * Intervals that contain at least a quarter of the probability use the
+ * rejection of normal values. Intervals in the tail use the rejection
+ * method of Robert, with an exponential proposal. Other intervals use
+ * the inverse of the cumulative distribution function. Values that have
+ * been rejected are replaced by values that follow the results in the
+ * sequence, so the generator may advance by more values than the number
+ * of results.
+ *
+ * Quasirandom generators always use the inverse of the cumulative
+ * distribution function.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of floats to generate
+ * @param mean - Mean of the normal distribution
+ * @param stddev - Standard deviation of the normal distribution
+ * @param lo - The lower bound of the interval
+ * @param hi - The upper bound of the interval
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    truncated normal generation \n
+ * CURAND_STATUS_OUT_OF_RANGE if stddev is not positive, or hi is
+ *    smaller than lo \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+ *    not a multiple of the quasirandom dimension \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateTruncatedNormalNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jfloat mean, jfloat stddev, jfloat lo, jfloat hi)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateTruncatedNormal");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateTruncatedNormal");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateTruncatedNormal(generator=%p, outputPtr=%p, n=%ld, mean=%f, stddev=%f, lo=%f, hi=%f)\n",
+        generator, outputPtr, n, mean, stddev, lo, hi);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateTruncatedNormal, "curandGenerateTruncatedNormal"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t n_native = 0;
+    float mean_native = 0.0f;
+    float stddev_native = 0.0f;
+    float lo_native = 0.0f;
+    float hi_native = 0.0f;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    mean_native = (float)mean;
+    stddev_native = (float)stddev;
+    lo_native = (float)lo;
+    hi_native = (float)hi;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateTruncatedNormal(generator_native, outputPtr_native, n_native, mean_native, stddev_native, lo_native, hi_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate truncated normally distributed doubles.
+ *
+ * Use \p generator to generate \p n doubles into the host memory at
+ * \p outputPtr. The results are normally distributed with the mean
+ * \p mean and the standard deviation \p stddev, conditioned on being in
+ * the interval from \p lo to \p hi. The bounds may be infinite.
+ *
+ * For pseudorandom generators, the method depends on the interval:
+ * Intervals that contain at least a quarter of the probability use the
+ * rejection of normal values. Intervals in the tail use the rejection
+ * method of Robert, with an exponential proposal. Other intervals use
+ * the inverse of the cumulative distribution function. Values that have
+ * been rejected are replaced by values that follow the results in the
+ * sequence, so the generator may advance by more values than the number
+ * of results.
+ *
+ * Quasirandom generators always use the inverse of the cumulative
+ * distribution function.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of doubles to generate
+ * @param mean - Mean of the normal distribution
+ * @param stddev - Standard deviation of the normal distribution
+ * @param lo - The lower bound of the interval
+ * @param hi - The upper bound of the interval
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    truncated normal generation \n
+ * CURAND_STATUS_OUT_OF_RANGE if stddev is not positive, or hi is
+ *    smaller than lo \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+ *    not a multiple of the quasirandom dimension \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateTruncatedNormalDoubleNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jdouble mean, jdouble stddev, jdouble lo, jdouble hi)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateTruncatedNormalDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateTruncatedNormalDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateTruncatedNormalDouble(generator=%p, outputPtr=%p, n=%ld, mean=%f, stddev=%f, lo=%f, hi=%f)\n",
+        generator, outputPtr, n, mean, stddev, lo, hi);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateTruncatedNormalDouble, "curandGenerateTruncatedNormalDouble"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t n_native = 0;
+    double mean_native = 0.0;
+    double stddev_native = 0.0;
+    double lo_native = 0.0;
+    double hi_native = 0.0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    mean_native = (double)mean;
+    stddev_native = (double)stddev;
+    lo_native = (double)lo;
+    hi_native = (double)hi;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateTruncatedNormalDouble(generator_native, outputPtr_native, n_native, mean_native, stddev_native, lo_native, hi_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Construct a multivariate normal distribution.
+ *
+ * Construct the distribution of vectors with \p dimensions elements that
+ * are normally distributed with the given mean vector and covariance
+ * matrix. The \p mean is a vector with \p dimensions elements in host
+ * memory, or null for a mean of zero. The \p matrix is a row-major
+ * matrix with \p dimensions rows and columns in host memory. Only its
+ * lower triangle (including the diagonal) is used.
+ *
+ * If the \p matrixType is CURAND_MATRIX_COVARIANCE, then the matrix is
+ * the covariance matrix, and its Cholesky factor is computed once, when
+ * the distribution is created. If the \p matrixType is
+ * CURAND_MATRIX_CHOLESKY_FACTOR, then the matrix is the lower triangular
+ * factor L of the covariance matrix L*L^T.
+ *
+ * @param distribution - Pointer to the distribution
+ * @param dimensions - The number of elements of each vector
+ * @param mean - The mean vector in host memory, or null
+ * @param matrix - The matrix in host memory
+ * @param matrixType - The curandMatrixType of the matrix
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    multivariate normal distributions \n
+ * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * CURAND_STATUS_OUT_OF_RANGE if the dimensions are zero, the matrix type
+ *    is not valid, or the covariance matrix is not positive definite \n
+ * CURAND_STATUS_SUCCESS if the distribution was created successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandCreateMultivariateNormalNative(JNIEnv *env, jclass cls, jobject distribution, jint dimensions, jobject mean, jobject matrix, jint matrixType)
+{
+    // Null-checks for non-primitive arguments
+    if (distribution == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'distribution' is null for curandCreateMultivariateNormal");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (matrix == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'matrix' is null for curandCreateMultivariateNormal");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandCreateMultivariateNormal(distribution=%p, dimensions=%d, mean=%p, matrix=%p, matrixType=%d)\n",
+        distribution, dimensions, mean, matrix, matrixType);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandCreateMultivariateNormal, "curandCreateMultivariateNormal"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandMultivariateNormal_t distribution_native = NULL;
+    unsigned int dimensions_native = 0;
+    const double* mean_native = NULL;
+    const double* matrix_native = NULL;
+    curandMatrixType_t matrixType_native;
+
+    // Obtain native variable values
+    dimensions_native = (unsigned int)dimensions;
+    PointerData *meanPointerData = NULL;
+    if (mean != NULL)
+    {
+        meanPointerData = initPointerData(env, mean);
+        if (meanPointerData == NULL)
+        {
+            return JCURAND_STATUS_INTERNAL_ERROR;
+        }
+        mean_native = (const double*)meanPointerData->getPointer(env);
+    }
+    PointerData *matrixPointerData = initPointerData(env, matrix);
+    if (matrixPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    matrix_native = (const double*)matrixPointerData->getPointer(env);
+    matrixType_native = (curandMatrixType_t)matrixType;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandCreateMultivariateNormal(&distribution_native, dimensions_native, mean_native, matrix_native, matrixType_native);
+
+    // Write back native variable values
+    setNativePointerValue(env, distribution, (jlong)distribution_native);
+    if (meanPointerData != NULL && !releasePointerData(env, meanPointerData, JNI_ABORT)) return JCURAND_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, matrixPointerData, JNI_ABORT)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Destroy a multivariate normal distribution.
+ *
+ * Destroy the distribution that was created with
+ * curandCreateMultivariateNormal.
+ *
+ * @param distribution - The distribution to destroy
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    multivariate normal distributions \n
+ * CURAND_STATUS_NOT_INITIALIZED if the distribution was never created \n
+ * CURAND_STATUS_SUCCESS if the distribution was destroyed successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandDestroyMultivariateNormalNative(JNIEnv *env, jclass cls, jobject distribution)
+{
+    // Null-checks for non-primitive arguments
+    if (distribution == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'distribution' is null for curandDestroyMultivariateNormal");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandDestroyMultivariateNormal(distribution=%p)\n",
+        distribution);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandDestroyMultivariateNormal, "curandDestroyMultivariateNormal"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandMultivariateNormal_t distribution_native;
+
+    // Obtain native variable values
+    distribution_native = (curandMultivariateNormal_t)getNativePointerValue(env, distribution);
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandDestroyMultivariateNormal(distribution_native);
+
+    // Write back native variable values
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate multivariate normally distributed floats.
+ *
+ * Use \p generator to generate \p n vectors of the given \p distribution
+ * into the host memory at \p outputPtr. The output must have space for
+ * \p n times d floats, where d is the number of dimensions of the
+ * distribution. If the \p layout is CURAND_LAYOUT_ROW_MAJOR, then each
+ * vector is stored contiguously. If the \p layout is
+ * CURAND_LAYOUT_COLUMN_MAJOR, then each element of the vectors is stored
+ * contiguously, as a column with \p n floats.
+ *
+ * The normal samples are generated and transformed with the Cholesky
+ * factor in one pass, in blocks of vectors that remain in the cache. For
+ * pseudorandom generators, each vector consumes the values for an even
+ * number of normal samples. For quasirandom generators, each vector is
+ * one point, and the dimensions of the generator must be the dimensions
+ * of the distribution.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of vectors to generate
+ * @param distribution - The distribution
+ * @param layout - The curandLayout of the results
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator or the distribution was
+ *    never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    multivariate normal distributions \n
+ * CURAND_STATUS_OUT_OF_RANGE if the layout is not valid \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the dimensions of a quasirandom
+ *    generator are not the dimensions of the distribution \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateMultivariateNormalNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jobject distribution, jint layout)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateMultivariateNormal");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateMultivariateNormal");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (distribution == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'distribution' is null for curandGenerateMultivariateNormal");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateMultivariateNormal(generator=%p, outputPtr=%p, n=%ld, distribution=%p, layout=%d)\n",
+        generator, outputPtr, n, distribution, layout);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateMultivariateNormal, "curandGenerateMultivariateNormal"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t n_native = 0;
+    curandMultivariateNormal_t distribution_native;
+    curandLayout_t layout_native;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    distribution_native = (curandMultivariateNormal_t)getNativePointerValue(env, distribution);
+    layout_native = (curandLayout_t)layout;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateMultivariateNormal(generator_native, outputPtr_native, n_native, distribution_native, layout_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate multivariate normally distributed doubles.
+ *
+ * Use \p generator to generate \p n vectors of the given \p distribution
+ * into the host memory at \p outputPtr. The output must have space for
+ * \p n times d doubles, where d is the number of dimensions of the
+ * distribution. If the \p layout is CURAND_LAYOUT_ROW_MAJOR, then each
+ * vector is stored contiguously. If the \p layout is
+ * CURAND_LAYOUT_COLUMN_MAJOR, then each element of the vectors is stored
+ * contiguously, as a column with \p n doubles.
+ *
+ * The normal samples are generated and transformed with the Cholesky
+ * factor in one pass, in blocks of vectors that remain in the cache. For
+ * pseudorandom generators, each vector consumes the values for an even
+ * number of normal samples. For quasirandom generators, each vector is
+ * one point, and the dimensions of the generator must be the dimensions
+ * of the distribution.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of vectors to generate
+ * @param distribution - The distribution
+ * @param layout - The curandLayout of the results
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator or the distribution was
+ *    never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    multivariate normal distributions \n
+ * CURAND_STATUS_OUT_OF_RANGE if the layout is not valid \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the dimensions of a quasirandom
+ *    generator are not the dimensions of the distribution \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateMultivariateNormalDoubleNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jobject distribution, jint layout)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateMultivariateNormalDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateMultivariateNormalDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (distribution == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'distribution' is null for curandGenerateMultivariateNormalDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateMultivariateNormalDouble(generator=%p, outputPtr=%p, n=%ld, distribution=%p, layout=%d)\n",
+        generator, outputPtr, n, distribution, layout);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateMultivariateNormalDouble, "curandGenerateMultivariateNormalDouble"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t n_native = 0;
+    curandMultivariateNormal_t distribution_native;
+    curandLayout_t layout_native;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    distribution_native = (curandMultivariateNormal_t)getNativePointerValue(env, distribution);
+    layout_native = (curandLayout_t)layout;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateMultivariateNormalDouble(generator_native, outputPtr_native, n_native, distribution_native, layout_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate a random permutation of ints.
+ *
+ * Use \p generator to generate a uniformly distributed random
+ * permutation of the values from 0 to n-1 into the host memory at
+ * \p outputPtr.
+ *
+ * Each value is moved into a bucket that is chosen with 16 random bits,
+ * and each bucket is then shuffled with the Fisher-Yates method, in the
+ * cache. The buckets are shuffled in parallel, and the result does not
+ * depend on the number of threads. The generator is advanced by n/2
+ * values for the buckets and n values for the shuffle, or 2*n values if
+ * n is larger than 2^32. Only pseudorandom generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of values to permute
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    permutations, or the generator is a quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if n-1 is not a valid int value \n
+ * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGeneratePermutationNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGeneratePermutation");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGeneratePermutation");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGeneratePermutation(generator=%p, outputPtr=%p, n=%ld)\n",
+        generator, outputPtr, n);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGeneratePermutation, "curandGeneratePermutation"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    int* outputPtr_native = NULL;
+    size_t n_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (int*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGeneratePermutation(generator_native, outputPtr_native, n_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate a random permutation of long longs.
+ *
+ * Use \p generator to generate a uniformly distributed random
+ * permutation of the values from 0 to n-1 into the host memory at
+ * \p outputPtr.
+ *
+ * Each value is moved into a bucket that is chosen with 16 random bits,
+ * and each bucket is then shuffled with the Fisher-Yates method, in the
+ * cache. The buckets are shuffled in parallel, and the result does not
+ * depend on the number of threads. The generator is advanced by n/2
+ * values for the buckets and n values for the shuffle, or 2*n values if
+ * n is larger than 2^32. Only pseudorandom generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of values to permute
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    permutations, or the generator is a quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if n-1 is not a valid long long value \n
+ * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGeneratePermutationLongLongNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGeneratePermutationLongLong");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGeneratePermutationLongLong");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGeneratePermutationLongLong(generator=%p, outputPtr=%p, n=%ld)\n",
+        generator, outputPtr, n);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGeneratePermutationLongLong, "curandGeneratePermutationLongLong"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    long long* outputPtr_native = NULL;
+    size_t n_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (long long*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGeneratePermutationLongLong(generator_native, outputPtr_native, n_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Sample ints without replacement.
+ *
+ * Use \p generator to choose \p k distinct values from 0 to n-1, with
+ * the same probability for each subset, and write them in random order
+ * into the host memory at \p outputPtr.
+ *
+ * If \p k is more than an eighth of \p n, then the results are the first
+ * \p k values of a random permutation of \p n values, which temporarily
+ * requires memory for \p n values. Otherwise, the values are chosen with
+ * the algorithm of Floyd, and then permuted. The result does not depend
+ * on the number of threads. Only pseudorandom generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - The number of values to choose from
+ * @param k - The number of values to choose
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    sampling without replacement, or the generator is a quasirandom
+ *    generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if k is larger than n, or n-1 is not a
+ *    valid int value \n
+ * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSampleWithoutReplacementNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jlong k)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandSampleWithoutReplacement");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandSampleWithoutReplacement");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandSampleWithoutReplacement(generator=%p, outputPtr=%p, n=%ld, k=%ld)\n",
+        generator, outputPtr, n, k);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandSampleWithoutReplacement, "curandSampleWithoutReplacement"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    int* outputPtr_native = NULL;
+    size_t n_native = 0;
+    size_t k_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (int*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    k_native = (size_t)k;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandSampleWithoutReplacement(generator_native, outputPtr_native, n_native, k_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Sample long longs without replacement.
+ *
+ * Use \p generator to choose \p k distinct values from 0 to n-1, with
+ * the same probability for each subset, and write them in random order
+ * into the host memory at \p outputPtr.
+ *
+ * If \p k is more than an eighth of \p n, then the results are the first
+ * \p k values of a random permutation of \p n values, which temporarily
+ * requires memory for \p n values. Otherwise, the values are chosen with
+ * the algorithm of Floyd, and then permuted. The result does not depend
+ * on the number of threads. Only pseudorandom generators are supported.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - The number of values to choose from
+ * @param k - The number of values to choose
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    sampling without replacement, or the generator is a quasirandom
+ *    generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if k is larger than n, or n-1 is not a
+ *    valid long long value \n
+ * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSampleWithoutReplacementLongLongNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jlong k)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandSampleWithoutReplacementLongLong");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandSampleWithoutReplacementLongLong");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandSampleWithoutReplacementLongLong(generator=%p, outputPtr=%p, n=%ld, k=%ld)\n",
+        generator, outputPtr, n, k);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandSampleWithoutReplacementLongLong, "curandSampleWithoutReplacementLongLong"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    long long* outputPtr_native = NULL;
+    size_t n_native = 0;
+    size_t k_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (long long*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    k_native = (size_t)k;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandSampleWithoutReplacementLongLong(generator_native, outputPtr_native, n_native, k_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Construct a Brownian bridge.
+ *
+ * Construct a Brownian bridge for paths with \p steps values, at the
+ * given \p times, which are a strictly increasing array of \p steps
+ * positive values in host memory, or null for the times 1, 2, ...,
+ * steps. The paths start with the value 0 at the time 0.
+ *
+ * The weights of the bridge are computed once. The value at the last
+ * time is computed from the first normal sample, followed by the values
+ * at the midpoints of the intervals, in breadth-first order, so that the
+ * first samples determine the coarse shape of the paths. With
+ * quasirandom generators, this concentrates the variance of the paths in
+ * the low dimensions.
+ *
+ * @param bridge - Pointer to the bridge
+ * @param steps - The number of values of each path
+ * @param times - The times in host memory, or null
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    Brownian bridges \n
+ * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * CURAND_STATUS_OUT_OF_RANGE if the steps are zero, or the times are not
+ *    positive and strictly increasing \n
+ * CURAND_STATUS_SUCCESS if the bridge was created successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandCreateBrownianBridgeNative(JNIEnv *env, jclass cls, jobject bridge, jint steps, jobject times)
+{
+    // Null-checks for non-primitive arguments
+    if (bridge == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'bridge' is null for curandCreateBrownianBridge");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandCreateBrownianBridge(bridge=%p, steps=%d, times=%p)\n",
+        bridge, steps, times);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandCreateBrownianBridge, "curandCreateBrownianBridge"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandBrownianBridge_t bridge_native = NULL;
+    unsigned int steps_native = 0;
+    const double* times_native = NULL;
+
+    // Obtain native variable values
+    steps_native = (unsigned int)steps;
+    PointerData *timesPointerData = NULL;
+    if (times != NULL)
+    {
+        timesPointerData = initPointerData(env, times);
+        if (timesPointerData == NULL)
+        {
+            return JCURAND_STATUS_INTERNAL_ERROR;
+        }
+        times_native = (const double*)timesPointerData->getPointer(env);
+    }
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandCreateBrownianBridge(&bridge_native, steps_native, times_native);
+
+    // Write back native variable values
+    setNativePointerValue(env, bridge, (jlong)bridge_native);
+    if (timesPointerData != NULL && !releasePointerData(env, timesPointerData, JNI_ABORT)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Destroy a Brownian bridge.
+ *
+ * Destroy the bridge that was created with curandCreateBrownianBridge.
+ *
+ * @param bridge - The bridge to destroy
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    Brownian bridges \n
+ * CURAND_STATUS_NOT_INITIALIZED if the bridge was never created \n
+ * CURAND_STATUS_SUCCESS if the bridge was destroyed successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandDestroyBrownianBridgeNative(JNIEnv *env, jclass cls, jobject bridge)
+{
+    // Null-checks for non-primitive arguments
+    if (bridge == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'bridge' is null for curandDestroyBrownianBridge");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandDestroyBrownianBridge(bridge=%p)\n",
+        bridge);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandDestroyBrownianBridge, "curandDestroyBrownianBridge"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandBrownianBridge_t bridge_native;
+
+    // Obtain native variable values
+    bridge_native = (curandBrownianBridge_t)getNativePointerValue(env, bridge);
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandDestroyBrownianBridge(bridge_native);
+
+    // Write back native variable values
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Transform normally distributed floats into Brownian paths.
+ *
+ * Transform the standard normal samples of \p n paths at \p data in host
+ * memory into the values of the paths, in place. The samples are given
+ * in the dimension-major order of CURAND, as they are generated by
+ * curandGenerateNormal with a quasirandom generator with as many
+ * dimensions as the bridge has steps: The first \p n floats are the
+ * first samples of all paths, followed by their second samples, and so
+ * on. Afterwards, the first \p n floats are the values of all paths at
+ * the first time, and so on.
+ *
+ * The paths are transformed in parallel, in blocks of paths, so that
+ * each step of the bridge is applied to many paths at once.
+ *
+ * @param bridge - The bridge
+ * @param data - Pointer to the samples in host memory
+ * @param n - The number of paths
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    Brownian bridges \n
+ * CURAND_STATUS_NOT_INITIALIZED if the bridge was never created \n
+ * CURAND_STATUS_SUCCESS if the paths were transformed successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandTransformBrownianBridgeNative(JNIEnv *env, jclass cls, jobject bridge, jobject data, jlong n)
+{
+    // Null-checks for non-primitive arguments
+    if (bridge == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'bridge' is null for curandTransformBrownianBridge");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (data == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'data' is null for curandTransformBrownianBridge");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandTransformBrownianBridge(bridge=%p, data=%p, n=%ld)\n",
+        bridge, data, n);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandTransformBrownianBridge, "curandTransformBrownianBridge"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandBrownianBridge_t bridge_native;
+    float* data_native = NULL;
+    size_t n_native = 0;
+
+    // Obtain native variable values
+    bridge_native = (curandBrownianBridge_t)getNativePointerValue(env, bridge);
+    PointerData *dataPointerData = initPointerData(env, data);
+    if (dataPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    data_native = (float*)dataPointerData->getPointer(env);
+    n_native = (size_t)n;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandTransformBrownianBridge(bridge_native, data_native, n_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, dataPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Transform normally distributed doubles into Brownian paths.
+ *
+ * Transform the standard normal samples of \p n paths at \p data in host
+ * memory into the values of the paths, in place. The samples are given
+ * in the dimension-major order of CURAND, as they are generated by
+ * curandGenerateNormal with a quasirandom generator with as many
+ * dimensions as the bridge has steps: The first \p n doubles are the
+ * first samples of all paths, followed by their second samples, and so
+ * on. Afterwards, the first \p n doubles are the values of all paths at
+ * the first time, and so on.
+ *
+ * The paths are transformed in parallel, in blocks of paths, so that
+ * each step of the bridge is applied to many paths at once.
+ *
+ * @param bridge - The bridge
+ * @param data - Pointer to the samples in host memory
+ * @param n - The number of paths
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    Brownian bridges \n
+ * CURAND_STATUS_NOT_INITIALIZED if the bridge was never created \n
+ * CURAND_STATUS_SUCCESS if the paths were transformed successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandTransformBrownianBridgeDoubleNative(JNIEnv *env, jclass cls, jobject bridge, jobject data, jlong n)
+{
+    // Null-checks for non-primitive arguments
+    if (bridge == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'bridge' is null for curandTransformBrownianBridgeDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (data == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'data' is null for curandTransformBrownianBridgeDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandTransformBrownianBridgeDouble(bridge=%p, data=%p, n=%ld)\n",
+        bridge, data, n);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandTransformBrownianBridgeDouble, "curandTransformBrownianBridgeDouble"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandBrownianBridge_t bridge_native;
+    double* data_native = NULL;
+    size_t n_native = 0;
+
+    // Obtain native variable values
+    bridge_native = (curandBrownianBridge_t)getNativePointerValue(env, bridge);
+    PointerData *dataPointerData = initPointerData(env, data);
+    if (dataPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    data_native = (double*)dataPointerData->getPointer(env);
+    n_native = (size_t)n;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandTransformBrownianBridgeDouble(bridge_native, data_native, n_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, dataPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate Brownian paths of floats.
+ *
+ * Use \p generator to generate \p n paths of the given \p bridge into
+ * the host memory at \p outputPtr. The output must have space for \p n
+ * times the number of steps floats. If the \p layout is
+ * CURAND_LAYOUT_ROW_MAJOR, then each path is stored contiguously. If the
+ * \p layout is CURAND_LAYOUT_COLUMN_MAJOR, then the values of all paths
+ * at one time are stored contiguously, which is the layout of
+ * curandTransformBrownianBridge.
+ *
+ * The normal samples are generated and transformed in one pass, in
+ * blocks of paths that remain in the cache. For quasirandom generators,
+ * each path is one point, and the dimensions of the generator must be
+ * the steps of the bridge. The results are then the same as the ones of
+ * curandGenerateNormal followed by curandTransformBrownianBridge. For
+ * pseudorandom generators, each path consumes the values for an even
+ * number of normal samples.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of paths to generate
+ * @param bridge - The bridge
+ * @param layout - The curandLayout of the results
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator or the bridge was never
+ *    created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    Brownian bridges \n
+ * CURAND_STATUS_OUT_OF_RANGE if the layout is not valid \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the dimensions of a quasirandom
+ *    generator are not the steps of the bridge \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateBrownianBridgeNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jobject bridge, jint layout)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateBrownianBridge");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateBrownianBridge");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (bridge == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'bridge' is null for curandGenerateBrownianBridge");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateBrownianBridge(generator=%p, outputPtr=%p, n=%ld, bridge=%p, layout=%d)\n",
+        generator, outputPtr, n, bridge, layout);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateBrownianBridge, "curandGenerateBrownianBridge"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t n_native = 0;
+    curandBrownianBridge_t bridge_native;
+    curandLayout_t layout_native;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    bridge_native = (curandBrownianBridge_t)getNativePointerValue(env, bridge);
+    layout_native = (curandLayout_t)layout;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateBrownianBridge(generator_native, outputPtr_native, n_native, bridge_native, layout_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate Brownian paths of doubles.
+ *
+ * Use \p generator to generate \p n paths of the given \p bridge into
+ * the host memory at \p outputPtr. The output must have space for \p n
+ * times the number of steps doubles. If the \p layout is
+ * CURAND_LAYOUT_ROW_MAJOR, then each path is stored contiguously. If the
+ * \p layout is CURAND_LAYOUT_COLUMN_MAJOR, then the values of all paths
+ * at one time are stored contiguously, which is the layout of
+ * curandTransformBrownianBridge.
+ *
+ * The normal samples are generated and transformed in one pass, in
+ * blocks of paths that remain in the cache. For quasirandom generators,
+ * each path is one point, and the dimensions of the generator must be
+ * the steps of the bridge. The results are then the same as the ones of
+ * curandGenerateNormal followed by curandTransformBrownianBridge. For
+ * pseudorandom generators, each path consumes the values for an even
+ * number of normal samples.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of paths to generate
+ * @param bridge - The bridge
+ * @param layout - The curandLayout of the results
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator or the bridge was never
+ *    created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    Brownian bridges \n
+ * CURAND_STATUS_OUT_OF_RANGE if the layout is not valid \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the dimensions of a quasirandom
+ *    generator are not the steps of the bridge \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateBrownianBridgeDoubleNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jobject bridge, jint layout)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateBrownianBridgeDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateBrownianBridgeDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (bridge == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'bridge' is null for curandGenerateBrownianBridgeDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateBrownianBridgeDouble(generator=%p, outputPtr=%p, n=%ld, bridge=%p, layout=%d)\n",
+        generator, outputPtr, n, bridge, layout);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateBrownianBridgeDouble, "curandGenerateBrownianBridgeDouble"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t n_native = 0;
+    curandBrownianBridge_t bridge_native;
+    curandLayout_t layout_native;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    bridge_native = (curandBrownianBridge_t)getNativePointerValue(env, bridge);
+    layout_native = (curandLayout_t)layout;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateBrownianBridgeDouble(generator_native, outputPtr_native, n_native, bridge_native, layout_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Set the antithetic mode of a pseudorandom generator.
+ *
+ * Set the curandAntitheticMode of \p generator. In the modes
+ * CURAND_ANTITHETIC_INTERLEAVED and CURAND_ANTITHETIC_BLOCKED, the
+ * functions curandGenerateUniform, curandGenerateNormal,
+ * curandGenerateLogNormal and their double versions generate only half
+ * of the requested samples, and write each sample x together with its
+ * antithetic partner in one pass. The partner of a uniform value u is
+ * 1-u, and the partner of a normal value x is 2*mean-x. For log-normal
+ * values, it is the exponential of the partner of the underlying normal
+ * value.
+ *
+ * In the mode CURAND_ANTITHETIC_INTERLEAVED, each sample is directly
+ * followed by its partner. In the mode CURAND_ANTITHETIC_BLOCKED, the
+ * first half of the output contains the samples, and the second half
+ * contains their partners, in the same order. The number of values must
+ * be even, and the generator is advanced only by the values for the
+ * samples. The mode CURAND_ANTITHETIC_NONE, which is the default,
+ * restores the regular behavior. Other generation functions are not
+ * affected by the mode.
+ *
+ * @param generator - Generator to modify
+ * @param mode - The curandAntitheticMode
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    antithetic modes, or the generator is a quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if the mode is not valid \n
+ * CURAND_STATUS_SUCCESS if the mode was set successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorAntitheticModeNative(JNIEnv *env, jclass cls, jobject generator, jint mode)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandSetGeneratorAntitheticMode");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandSetGeneratorAntitheticMode(generator=%p, mode=%d)\n",
+        generator, mode);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandSetGeneratorAntitheticMode, "curandSetGeneratorAntitheticMode"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    curandAntitheticMode_t mode_native;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    mode_native = (curandAntitheticMode_t)mode;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandSetGeneratorAntitheticMode(generator_native, mode_native);
+
+    // Write back native variable values
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate uniformly distributed floats into a pitched output.
+ *
+ * Use \p generator to generate \p rows times \p cols uniformly
+ * distributed floats into the rows of the host memory at \p outputPtr.
+ *
+ * The values are the same as the ones of curandGenerateUniform for
+ * \p rows times \p cols values, in the same order. Each row of \p cols
+ * values is stored at \p outputPtr plus the row index times \p pitch, so
+ * that a column of a row-major matrix can be filled with \p cols=1 and
+ * \p pitch being the leading dimension. The values of each chunk are
+ * computed in the cache, and then copied to the rows that they cover.
+ * The antithetic mode of the generator is not applied.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param rows - Number of rows
+ * @param cols - Number of values in each row
+ * @param pitch - Number of elements between the starts of two rows
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    pitched output \n
+ * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+ *    columns \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+ *    generator and rows times cols is not a multiple of the dimensions \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniform2DNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong rows, jlong cols, jlong pitch)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateUniform2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateUniform2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateUniform2D(generator=%p, outputPtr=%p, rows=%ld, cols=%ld, pitch=%ld)\n",
+        generator, outputPtr, rows, cols, pitch);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateUniform2D, "curandGenerateUniform2D"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t rows_native = 0;
+    size_t cols_native = 0;
+    size_t pitch_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    rows_native = (size_t)rows;
+    cols_native = (size_t)cols;
+    pitch_native = (size_t)pitch;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateUniform2D(generator_native, outputPtr_native, rows_native, cols_native, pitch_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate uniformly distributed doubles into a pitched output.
+ *
+ * Use \p generator to generate \p rows times \p cols uniformly
+ * distributed doubles into the rows of the host memory at \p outputPtr.
+ *
+ * The values are the same as the ones of curandGenerateUniformDouble for
+ * \p rows times \p cols values, in the same order. Each row of \p cols
+ * values is stored at \p outputPtr plus the row index times \p pitch, so
+ * that a column of a row-major matrix can be filled with \p cols=1 and
+ * \p pitch being the leading dimension. The values of each chunk are
+ * computed in the cache, and then copied to the rows that they cover.
+ * The antithetic mode of the generator is not applied.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param rows - Number of rows
+ * @param cols - Number of values in each row
+ * @param pitch - Number of elements between the starts of two rows
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    pitched output \n
+ * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+ *    columns \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+ *    generator and rows times cols is not a multiple of the dimensions \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformDouble2DNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong rows, jlong cols, jlong pitch)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateUniformDouble2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateUniformDouble2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateUniformDouble2D(generator=%p, outputPtr=%p, rows=%ld, cols=%ld, pitch=%ld)\n",
+        generator, outputPtr, rows, cols, pitch);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateUniformDouble2D, "curandGenerateUniformDouble2D"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t rows_native = 0;
+    size_t cols_native = 0;
+    size_t pitch_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    rows_native = (size_t)rows;
+    cols_native = (size_t)cols;
+    pitch_native = (size_t)pitch;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateUniformDouble2D(generator_native, outputPtr_native, rows_native, cols_native, pitch_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate normally distributed floats into a pitched output.
+ *
+ * Use \p generator to generate \p rows times \p cols normally
+ * distributed floats with the given \p mean and \p stddev into the rows
+ * of the host memory at \p outputPtr.
+ *
+ * The values are the same as the ones of curandGenerateNormal for
+ * \p rows times \p cols values, in the same order. Each row of \p cols
+ * values is stored at \p outputPtr plus the row index times \p pitch, so
+ * that a column of a row-major matrix can be filled with \p cols=1 and
+ * \p pitch being the leading dimension. The values of each chunk are
+ * computed in the cache, and then copied to the rows that they cover.
+ * The antithetic mode of the generator is not applied.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param rows - Number of rows
+ * @param cols - Number of values in each row
+ * @param pitch - Number of elements between the starts of two rows
+ * @param mean - Mean of normal distribution
+ * @param stddev - Standard deviation of normal distribution
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    pitched output \n
+ * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+ *    columns \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+ *    generator and rows times cols is not a multiple of the dimensions \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a pseudorandom
+ *    generator and rows times cols is not a multiple of two \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormal2DNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong rows, jlong cols, jlong pitch, jfloat mean, jfloat stddev)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateNormal2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateNormal2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateNormal2D(generator=%p, outputPtr=%p, rows=%ld, cols=%ld, pitch=%ld, mean=%f, stddev=%f)\n",
+        generator, outputPtr, rows, cols, pitch, mean, stddev);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateNormal2D, "curandGenerateNormal2D"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t rows_native = 0;
+    size_t cols_native = 0;
+    size_t pitch_native = 0;
+    float mean_native = 0.0f;
+    float stddev_native = 0.0f;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    rows_native = (size_t)rows;
+    cols_native = (size_t)cols;
+    pitch_native = (size_t)pitch;
+    mean_native = (float)mean;
+    stddev_native = (float)stddev;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateNormal2D(generator_native, outputPtr_native, rows_native, cols_native, pitch_native, mean_native, stddev_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate normally distributed doubles into a pitched output.
+ *
+ * Use \p generator to generate \p rows times \p cols normally
+ * distributed doubles with the given \p mean and \p stddev into the rows
+ * of the host memory at \p outputPtr.
+ *
+ * The values are the same as the ones of curandGenerateNormalDouble for
+ * \p rows times \p cols values, in the same order. Each row of \p cols
+ * values is stored at \p outputPtr plus the row index times \p pitch, so
+ * that a column of a row-major matrix can be filled with \p cols=1 and
+ * \p pitch being the leading dimension. The values of each chunk are
+ * computed in the cache, and then copied to the rows that they cover.
+ * The antithetic mode of the generator is not applied.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param rows - Number of rows
+ * @param cols - Number of values in each row
+ * @param pitch - Number of elements between the starts of two rows
+ * @param mean - Mean of normal distribution
+ * @param stddev - Standard deviation of normal distribution
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    pitched output \n
+ * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+ *    columns \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+ *    generator and rows times cols is not a multiple of the dimensions \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a pseudorandom
+ *    generator and rows times cols is not a multiple of two \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalDouble2DNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong rows, jlong cols, jlong pitch, jdouble mean, jdouble stddev)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateNormalDouble2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateNormalDouble2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateNormalDouble2D(generator=%p, outputPtr=%p, rows=%ld, cols=%ld, pitch=%ld, mean=%f, stddev=%f)\n",
+        generator, outputPtr, rows, cols, pitch, mean, stddev);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateNormalDouble2D, "curandGenerateNormalDouble2D"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t rows_native = 0;
+    size_t cols_native = 0;
+    size_t pitch_native = 0;
+    double mean_native = 0.0;
+    double stddev_native = 0.0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    rows_native = (size_t)rows;
+    cols_native = (size_t)cols;
+    pitch_native = (size_t)pitch;
+    mean_native = (double)mean;
+    stddev_native = (double)stddev;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateNormalDouble2D(generator_native, outputPtr_native, rows_native, cols_native, pitch_native, mean_native, stddev_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate log-normally distributed floats into a pitched output.
+ *
+ * Use \p generator to generate \p rows times \p cols log-normally
+ * distributed floats with the given \p mean and \p stddev into the rows
+ * of the host memory at \p outputPtr.
+ *
+ * The values are the same as the ones of curandGenerateLogNormal for
+ * \p rows times \p cols values, in the same order. Each row of \p cols
+ * values is stored at \p outputPtr plus the row index times \p pitch, so
+ * that a column of a row-major matrix can be filled with \p cols=1 and
+ * \p pitch being the leading dimension. The values of each chunk are
+ * computed in the cache, and then copied to the rows that they cover.
+ * The antithetic mode of the generator is not applied.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param rows - Number of rows
+ * @param cols - Number of values in each row
+ * @param pitch - Number of elements between the starts of two rows
+ * @param mean - Mean of the associated normal distribution
+ * @param stddev - Standard deviation of the associated normal distribution
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    pitched output \n
+ * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+ *    columns \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+ *    generator and rows times cols is not a multiple of the dimensions \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a pseudorandom
+ *    generator and rows times cols is not a multiple of two \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLogNormal2DNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong rows, jlong cols, jlong pitch, jfloat mean, jfloat stddev)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateLogNormal2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateLogNormal2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateLogNormal2D(generator=%p, outputPtr=%p, rows=%ld, cols=%ld, pitch=%ld, mean=%f, stddev=%f)\n",
+        generator, outputPtr, rows, cols, pitch, mean, stddev);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateLogNormal2D, "curandGenerateLogNormal2D"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t rows_native = 0;
+    size_t cols_native = 0;
+    size_t pitch_native = 0;
+    float mean_native = 0.0f;
+    float stddev_native = 0.0f;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    rows_native = (size_t)rows;
+    cols_native = (size_t)cols;
+    pitch_native = (size_t)pitch;
+    mean_native = (float)mean;
+    stddev_native = (float)stddev;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateLogNormal2D(generator_native, outputPtr_native, rows_native, cols_native, pitch_native, mean_native, stddev_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate log-normally distributed doubles into a pitched output.
+ *
+ * Use \p generator to generate \p rows times \p cols log-normally
+ * distributed doubles with the given \p mean and \p stddev into the rows
+ * of the host memory at \p outputPtr.
+ *
+ * The values are the same as the ones of curandGenerateLogNormalDouble
+ * for \p rows times \p cols values, in the same order. Each row of
+ * \p cols values is stored at \p outputPtr plus the row index times
+ * \p pitch, so that a column of a row-major matrix can be filled with
+ * \p cols=1 and \p pitch being the leading dimension. The values of each
+ * chunk are computed in the cache, and then copied to the rows that they
+ * cover. The antithetic mode of the generator is not applied.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param rows - Number of rows
+ * @param cols - Number of values in each row
+ * @param pitch - Number of elements between the starts of two rows
+ * @param mean - Mean of the associated normal distribution
+ * @param stddev - Standard deviation of the associated normal distribution
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    pitched output \n
+ * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+ *    columns \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+ *    generator and rows times cols is not a multiple of the dimensions \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a pseudorandom
+ *    generator and rows times cols is not a multiple of two \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLogNormalDouble2DNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong rows, jlong cols, jlong pitch, jdouble mean, jdouble stddev)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateLogNormalDouble2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateLogNormalDouble2D");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateLogNormalDouble2D(generator=%p, outputPtr=%p, rows=%ld, cols=%ld, pitch=%ld, mean=%f, stddev=%f)\n",
+        generator, outputPtr, rows, cols, pitch, mean, stddev);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateLogNormalDouble2D, "curandGenerateLogNormalDouble2D"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t rows_native = 0;
+    size_t cols_native = 0;
+    size_t pitch_native = 0;
+    double mean_native = 0.0;
+    double stddev_native = 0.0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    rows_native = (size_t)rows;
+    cols_native = (size_t)cols;
+    pitch_native = (size_t)pitch;
+    mean_native = (double)mean;
+    stddev_native = (double)stddev;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateLogNormalDouble2D(generator_native, outputPtr_native, rows_native, cols_native, pitch_native, mean_native, stddev_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Set the layout of the points of a quasirandom generator.
+ *
+ * Set the curandLayout in which \p generator stores the points that are
+ * generated by curandGenerateUniform, curandGenerateNormal and the other
+ * generation functions. The default is CURAND_LAYOUT_COLUMN_MAJOR, which
+ * is the dimension-major order of CURAND: The first coordinates of all
+ * points are followed by their second coordinates, and so on. With
+ * CURAND_LAYOUT_ROW_MAJOR, the coordinates of each point are stored
+ * contiguously, so that each point is one vector of the given number of
+ * dimensions.
+ *
+ * The point-major output is generated directly, by transposing the raw
+ * values of tiles of dimensions in the cache, and does not require a
+ * separate transposition. The values are otherwise the same. Functions
+ * that have their own layout parameter are not affected.
+ *
+ * @param generator - Generator to modify
+ * @param layout - The curandLayout of the points
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    layouts of quasirandom generators, or the generator is not a
+ *    quasirandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if the layout is not valid \n
+ * CURAND_STATUS_SUCCESS if the layout was set successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetQuasiRandomGeneratorLayoutNative(JNIEnv *env, jclass cls, jobject generator, jint layout)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandSetQuasiRandomGeneratorLayout");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandSetQuasiRandomGeneratorLayout(generator=%p, layout=%d)\n",
+        generator, layout);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandSetQuasiRandomGeneratorLayout, "curandSetQuasiRandomGeneratorLayout"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    curandLayout_t layout_native;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    layout_native = (curandLayout_t)layout;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandSetQuasiRandomGeneratorLayout(generator_native, layout_native);
+
+    // Write back native variable values
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Set whether a pseudorandom generator may be used by several threads at once.
+ *
+ * If \p concurrent is nonzero, then \p generator is switched into the
+ * concurrent mode. In this mode, each thread that calls a generation
+ * function with \p generator gets its own lane: A generator with the
+ * same settings that takes its values from its own subsequence, like a
+ * CURAND device API state that was initialized with curand_init(seed,
+ * lane, 0, &state). The lanes are numbered in the order in which the
+ * threads first use \p generator, unless a thread chooses its lane with
+ * curandSetGeneratorThreadLane. The threads then generate their values
+ * in parallel, without locks, and the values of each lane only depend on
+ * the seed, the offset and the number of values that have been generated
+ * in the lane before.
+ *
+ * Setting the seed, the offset or the ordering moves all lanes back to
+ * the start of their subsequences. These settings must not be changed
+ * while other threads are generating values. The concurrent mode must
+ * not be switched off or on while other threads are generating values,
+ * but calls that are still running when it is switched off finish in
+ * their lanes. The lanes, also those of threads that have terminated,
+ * are kept until \p generator is destroyed. Switching the concurrent
+ * mode on again numbers the lanes again, and moves them back to the
+ * start of their subsequences. The concurrent mode is supported for
+ * CURAND_RNG_PSEUDO_XORWOW, CURAND_RNG_PSEUDO_MRG32K3A and
+ * CURAND_RNG_PSEUDO_PHILOX4_32_10.
+ *
+ * @param generator - Generator to modify
+ * @param concurrent - Whether the generator should be in the concurrent mode
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support the
+ *    concurrent mode, or the generator type does not have subsequences \n
+ * CURAND_STATUS_ALLOCATION_FAILED if the lanes could not be allocated \n
+ * CURAND_STATUS_SUCCESS if the mode was set successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorConcurrentNative(JNIEnv *env, jclass cls, jobject generator, jint concurrent)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandSetGeneratorConcurrent");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandSetGeneratorConcurrent(generator=%p, concurrent=%d)\n",
+        generator, concurrent);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandSetGeneratorConcurrent, "curandSetGeneratorConcurrent"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    int concurrent_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    concurrent_native = (int)concurrent;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandSetGeneratorConcurrent(generator_native, concurrent_native);
+
+    // Write back native variable values
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Set the lane of the calling thread for a generator in the concurrent mode.
+ *
+ * Make the calling thread generate its values from the subsequence
+ * \p lane of \p generator, starting at the beginning of the subsequence.
+ * This allows each thread to use a fixed lane, for example the index of
+ * a worker, so that the values that each thread receives do not depend
+ * on the order in which the threads start. Different threads should use
+ * different lanes, and threads that choose their lanes should not be
+ * mixed with threads that are numbered automatically.
+ *
+ * @param generator - Generator to modify
+ * @param lane - The lane for the calling thread
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support the
+ *    concurrent mode, or the generator is not in the concurrent mode \n
+ * CURAND_STATUS_SUCCESS if the lane was set successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorThreadLaneNative(JNIEnv *env, jclass cls, jobject generator, jint lane)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandSetGeneratorThreadLane");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandSetGeneratorThreadLane(generator=%p, lane=%d)\n",
+        generator, lane);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandSetGeneratorThreadLane, "curandSetGeneratorThreadLane"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    unsigned int lane_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    lane_native = (unsigned int)lane;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandSetGeneratorThreadLane(generator_native, lane_native);
+
+    // Write back native variable values
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate uniformly distributed floats with Philox4x32-10, without a generator.
+ *
+ * Write \p num uniformly distributed floats to \p outputPtr that are
+ * computed directly from the seed, the subsequence and the offset,
+ * without creating a generator. The results match the generators of
+ * the type CURAND_RNG_PSEUDO_PHILOX4_32_10 of the CPU backend, and the
+ * stream of a CURAND device API state that was initialized with
+ * curand_init(seed, subsequence, offset, &state): For subsequence 0,
+ * they are the values of a generator of the CPU backend that was
+ * created with the given seed and offset, and other subsequences give
+ * the values of its lanes in the concurrent mode. They are not
+ * necessarily the same as the ones of a CURAND_RNG_PSEUDO_PHILOX4_32_10
+ * generator of the CUDA backend, which distributes the stream over its
+ * threads in its own order.
+ *
+ * Because the Philox4x32-10 generator is counter based, any value of any
+ * stream can be computed without computing the values before it. This
+ * allows many logical streams, for example one for each task of a
+ * simulation, without keeping any state. The blocks are computed four at
+ * a time with SIMD instructions where available.
+ *
+ * @param seed - The seed, which is the Philox key
+ * @param subsequence - The subsequence
+ * @param offset - The position of the first word in the stream
+ * @param outputPtr - Pointer to host memory to store results
+ * @param num - Number of values to generate
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    stateless generation \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandPhiloxUniformNative(JNIEnv *env, jclass cls, jlong seed, jlong subsequence, jlong offset, jobject outputPtr, jlong num)
+{
+    // Null-checks for non-primitive arguments
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandPhiloxUniform");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandPhiloxUniform(seed=%ld, subsequence=%ld, offset=%ld, outputPtr=%p, num=%ld)\n",
+        seed, subsequence, offset, outputPtr, num);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandPhiloxUniform, "curandPhiloxUniform"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    unsigned long long seed_native = 0;
+    unsigned long long subsequence_native = 0;
+    unsigned long long offset_native = 0;
+    float* outputPtr_native = NULL;
+    size_t num_native = 0;
+
+    // Obtain native variable values
+    seed_native = (unsigned long long)seed;
+    subsequence_native = (unsigned long long)subsequence;
+    offset_native = (unsigned long long)offset;
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    num_native = (size_t)num;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandPhiloxUniform(seed_native, subsequence_native, offset_native, outputPtr_native, num_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate uniformly distributed doubles with Philox4x32-10, without a generator.
+ *
+ * Write \p num uniformly distributed doubles to \p outputPtr that are
+ * computed directly from the seed, the subsequence and the offset,
+ * without creating a generator. The results match the generators of
+ * the type CURAND_RNG_PSEUDO_PHILOX4_32_10 of the CPU backend, and the
+ * stream of a CURAND device API state that was initialized with
+ * curand_init(seed, subsequence, offset, &state): For subsequence 0,
+ * they are the values of a generator of the CPU backend that was
+ * created with the given seed and offset, and other subsequences give
+ * the values of its lanes in the concurrent mode. They are not
+ * necessarily the same as the ones of a CURAND_RNG_PSEUDO_PHILOX4_32_10
+ * generator of the CUDA backend, which distributes the stream over its
+ * threads in its own order.
+ *
+ * Because the Philox4x32-10 generator is counter based, any value of any
+ * stream can be computed without computing the values before it. This
+ * allows many logical streams, for example one for each task of a
+ * simulation, without keeping any state. The blocks are computed four at
+ * a time with SIMD instructions where available.
+ *
+ * @param seed - The seed, which is the Philox key
+ * @param subsequence - The subsequence
+ * @param offset - The position of the first word in the stream
+ * @param outputPtr - Pointer to host memory to store results
+ * @param num - Number of values to generate
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    stateless generation \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandPhiloxUniformDoubleNative(JNIEnv *env, jclass cls, jlong seed, jlong subsequence, jlong offset, jobject outputPtr, jlong num)
+{
+    // Null-checks for non-primitive arguments
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandPhiloxUniformDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandPhiloxUniformDouble(seed=%ld, subsequence=%ld, offset=%ld, outputPtr=%p, num=%ld)\n",
+        seed, subsequence, offset, outputPtr, num);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandPhiloxUniformDouble, "curandPhiloxUniformDouble"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    unsigned long long seed_native = 0;
+    unsigned long long subsequence_native = 0;
+    unsigned long long offset_native = 0;
+    double* outputPtr_native = NULL;
+    size_t num_native = 0;
+
+    // Obtain native variable values
+    seed_native = (unsigned long long)seed;
+    subsequence_native = (unsigned long long)subsequence;
+    offset_native = (unsigned long long)offset;
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    num_native = (size_t)num;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandPhiloxUniformDouble(seed_native, subsequence_native, offset_native, outputPtr_native, num_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate uniformly distributed floats at arbitrary positions with Philox4x32-10, without a generator.
+ *
+ * Write \p num uniformly distributed floats to \p outputPtr, where value
+ * i is the value of the stream of curandPhiloxUniform for the given seed
+ * and subsequence at the offset offsets[i]. Each value consumes
+ * one word of the stream, starting at its offset. The offsets may be in
+ * any order, and the blocks for four offsets are computed at once with
+ * SIMD instructions where available.
+ *
+ * @param seed - The seed, which is the Philox key
+ * @param subsequence - The subsequence
+ * @param offsets - Pointer to host memory with the offsets of the values
+ * @param outputPtr - Pointer to host memory to store results
+ * @param num - Number of values to generate
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    stateless generation \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandPhiloxUniformGatherNative(JNIEnv *env, jclass cls, jlong seed, jlong subsequence, jobject offsets, jobject outputPtr, jlong num)
+{
+    // Null-checks for non-primitive arguments
+    if (offsets == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'offsets' is null for curandPhiloxUniformGather");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandPhiloxUniformGather");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandPhiloxUniformGather(seed=%ld, subsequence=%ld, offsets=%p, outputPtr=%p, num=%ld)\n",
+        seed, subsequence, offsets, outputPtr, num);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandPhiloxUniformGather, "curandPhiloxUniformGather"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    unsigned long long seed_native = 0;
+    unsigned long long subsequence_native = 0;
+    const unsigned long long* offsets_native = NULL;
+    float* outputPtr_native = NULL;
+    size_t num_native = 0;
+
+    // Obtain native variable values
+    seed_native = (unsigned long long)seed;
+    subsequence_native = (unsigned long long)subsequence;
+    PointerData *offsetsPointerData = initPointerData(env, offsets);
+    if (offsetsPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    offsets_native = (const unsigned long long*)offsetsPointerData->getPointer(env);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    num_native = (size_t)num;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandPhiloxUniformGather(seed_native, subsequence_native, offsets_native, outputPtr_native, num_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, offsetsPointerData, JNI_ABORT)) return JCURAND_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate uniformly distributed doubles at arbitrary positions with Philox4x32-10, without a generator.
+ *
+ * Write \p num uniformly distributed doubles to \p outputPtr, where
+ * value i is the value of the stream of curandPhiloxUniformDouble for
+ * the given seed and subsequence at the offset offsets[i]. Each value
+ * consumes two words of the stream, starting at its offset. The offsets
+ * may be in any order, and the blocks for four offsets are computed at
+ * once with SIMD instructions where available.
+ *
+ * @param seed - The seed, which is the Philox key
+ * @param subsequence - The subsequence
+ * @param offsets - Pointer to host memory with the offsets of the values
+ * @param outputPtr - Pointer to host memory to store results
+ * @param num - Number of values to generate
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    stateless generation \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandPhiloxUniformDoubleGatherNative(JNIEnv *env, jclass cls, jlong seed, jlong subsequence, jobject offsets, jobject outputPtr, jlong num)
+{
+    // Null-checks for non-primitive arguments
+    if (offsets == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'offsets' is null for curandPhiloxUniformDoubleGather");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandPhiloxUniformDoubleGather");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandPhiloxUniformDoubleGather(seed=%ld, subsequence=%ld, offsets=%p, outputPtr=%p, num=%ld)\n",
+        seed, subsequence, offsets, outputPtr, num);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandPhiloxUniformDoubleGather, "curandPhiloxUniformDoubleGather"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    unsigned long long seed_native = 0;
+    unsigned long long subsequence_native = 0;
+    const unsigned long long* offsets_native = NULL;
+    double* outputPtr_native = NULL;
+    size_t num_native = 0;
+
+    // Obtain native variable values
+    seed_native = (unsigned long long)seed;
+    subsequence_native = (unsigned long long)subsequence;
+    PointerData *offsetsPointerData = initPointerData(env, offsets);
+    if (offsetsPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    offsets_native = (const unsigned long long*)offsetsPointerData->getPointer(env);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    num_native = (size_t)num;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandPhiloxUniformDoubleGather(seed_native, subsequence_native, offsets_native, outputPtr_native, num_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, offsetsPointerData, JNI_ABORT)) return JCURAND_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Compute the subsequence for a path in the tree of streams.
+ *
+ * Write the subsequence that curandSetGeneratorStream uses for the path
+ * of \p depth indices at \p path to \p subsequence. This allows the
+ * stateless functions like curandPhiloxUniform to use the same streams
+ * as a generator. The subsequence for an empty path is 0.
+ *
+ * @param path - Pointer to host memory with the indices of the path
+ * @param depth - The number of indices of the path
+ * @param subsequence - Pointer to host memory to store the subsequence
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    streams \n
+ * CURAND_STATUS_OUT_OF_RANGE if the path is NULL and the depth is not 0 \n
+ * CURAND_STATUS_SUCCESS if the subsequence was computed successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandDeriveStreamSubsequenceNative(JNIEnv *env, jclass cls, jobject path, jint depth, jobject subsequence)
+{
+    // Null-checks for non-primitive arguments
+    if (subsequence == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'subsequence' is null for curandDeriveStreamSubsequence");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandDeriveStreamSubsequence(path=%p, depth=%d, subsequence=%p)\n",
+        path, depth, subsequence);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandDeriveStreamSubsequence, "curandDeriveStreamSubsequence"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    const unsigned long long* path_native = NULL;
+    unsigned int depth_native = 0;
+    unsigned long long* subsequence_native = NULL;
+
+    // Obtain native variable values
+    PointerData *pathPointerData = NULL;
+    if (path != NULL)
+    {
+        pathPointerData = initPointerData(env, path);
+        if (pathPointerData == NULL)
+        {
+            return JCURAND_STATUS_INTERNAL_ERROR;
+        }
+        path_native = (const unsigned long long*)pathPointerData->getPointer(env);
+    }
+    depth_native = (unsigned int)depth;
+    PointerData *subsequencePointerData = initPointerData(env, subsequence);
+    if (subsequencePointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    subsequence_native = (unsigned long long*)subsequencePointerData->getPointer(env);
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandDeriveStreamSubsequence(path_native, depth_native, subsequence_native);
+
+    // Write back native variable values
+    if (pathPointerData != NULL && !releasePointerData(env, pathPointerData, JNI_ABORT)) return JCURAND_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, subsequencePointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Set the seed of a pseudorandom generator and the stream for a path in a tree of streams.
+ *
+ * Make \p generator produce the stream for the path of \p depth indices
+ * at \p path, which is a hierarchical task id like (job, task, step),
+ * below the given \p seed. The stream is a subsequence of the generator
+ * for the seed, like for a CURAND device API state that was initialized
+ * with curand_init(seed, subsequence, 0, &state). Each level of the
+ * path mixes its index into the subsequence of the parent with a
+ * bijective function, so that all children of one parent always get
+ * different subsequences, and other paths only get the same subsequence
+ * with a probability of 2^-64. The subsequences are 2^66
+ * (Philox4x32-10), 2^67 (XORWOW) or 2^76 (MRG32k3a) values apart, so
+ * that different streams do not overlap. The empty path gives the
+ * regular stream of the seed.
+ *
+ * The generator is moved back to the start of the stream, and keeps its
+ * offset. In the concurrent mode, lane k uses the subsequence of the
+ * stream plus k. Setting the seed with
+ * curandSetPseudoRandomGeneratorSeed returns the generator to the
+ * regular stream of the seed. Streams are supported for
+ * CURAND_RNG_PSEUDO_XORWOW, CURAND_RNG_PSEUDO_MRG32K3A and
+ * CURAND_RNG_PSEUDO_PHILOX4_32_10.
+ *
+ * @param generator - Generator to modify
+ * @param seed - The seed at the root of the tree
+ * @param path - Pointer to host memory with the indices of the path
+ * @param depth - The number of indices of the path
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    streams, or the generator type does not have subsequences \n
+ * CURAND_STATUS_OUT_OF_RANGE if the path is NULL and the depth is not 0 \n
+ * CURAND_STATUS_SUCCESS if the stream was set successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorStreamNative(JNIEnv *env, jclass cls, jobject generator, jlong seed, jobject path, jint depth)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandSetGeneratorStream");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandSetGeneratorStream(generator=%p, seed=%ld, path=%p, depth=%d)\n",
+        generator, seed, path, depth);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandSetGeneratorStream, "curandSetGeneratorStream"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    unsigned long long seed_native = 0;
+    const unsigned long long* path_native = NULL;
+    unsigned int depth_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    seed_native = (unsigned long long)seed;
+    PointerData *pathPointerData = NULL;
+    if (path != NULL)
+    {
+        pathPointerData = initPointerData(env, path);
+        if (pathPointerData == NULL)
+        {
+            return JCURAND_STATUS_INTERNAL_ERROR;
+        }
+        path_native = (const unsigned long long*)pathPointerData->getPointer(env);
+    }
+    depth_native = (unsigned int)depth;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandSetGeneratorStream(generator_native, seed_native, path_native, depth_native);
+
+    // Write back native variable values
+    if (pathPointerData != NULL && !releasePointerData(env, pathPointerData, JNI_ABORT)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Convert a table of Sobol direction numbers into a direction file.
+ *
+ * Read the text table at \p joeKuoPath, in the format of the tables by
+ * Joe and Kuo, and write the Sobol direction vectors with the given
+ * number of \p bits (32 or 64) for the first \p dimensions dimensions
+ * into a binary file at \p path, which can be loaded with
+ * curandLoadDirectionFile. Each line of the table contains the dimension
+ * d (starting at 2), the degree s and the coefficients a of the
+ * primitive polynomial, and the initial direction numbers m_1 ... m_s.
+ * Lines that do not start with a number, like the header line, are
+ * skipped. The first dimension is the van der Corput sequence. If
+ * \p dimensions is 0, then all dimensions of the table are written.
+ *
+ * The file consists of a header of 64 bytes and the direction vectors of
+ * all dimensions, in the byte order of the platform.
+ *
+ * @param joeKuoPath - The path of the table of direction numbers
+ * @param path - The path of the direction file
+ * @param bits - The number of bits of the direction vectors, 32 or 64
+ * @param dimensions - The number of dimensions, or 0 for all dimensions of the table
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    direction files \n
+ * CURAND_STATUS_OUT_OF_RANGE if the number of bits is not valid, the
+ *    table contains an invalid line, or it has fewer dimensions than
+ *    requested \n
+ * CURAND_STATUS_INTERNAL_ERROR if the files can not be read or written \n
+ * CURAND_STATUS_SUCCESS if the file was written successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandWriteDirectionFileNative(JNIEnv *env, jclass cls, jstring joeKuoPath, jstring path, jint bits, jint dimensions)
+{
+    // Null-checks for non-primitive arguments
+    if (joeKuoPath == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'joeKuoPath' is null for curandWriteDirectionFile");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (path == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'path' is null for curandWriteDirectionFile");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandWriteDirectionFile(joeKuoPath=%p, path=%p, bits=%d, dimensions=%d)\n",
+        joeKuoPath, path, bits, dimensions);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandWriteDirectionFile, "curandWriteDirectionFile"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    const char *joeKuoPath_native = NULL;
+    const char *path_native = NULL;
+    unsigned int bits_native = 0;
+    unsigned int dimensions_native = 0;
+
+    // Obtain native variable values
+    joeKuoPath_native = env->GetStringUTFChars(joeKuoPath, NULL);
+    if (joeKuoPath_native == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    path_native = env->GetStringUTFChars(path, NULL);
+    if (path_native == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    bits_native = (unsigned int)bits;
+    dimensions_native = (unsigned int)dimensions;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandWriteDirectionFile(joeKuoPath_native, path_native, bits_native, dimensions_native);
+
+    // Write back native variable values
+    env->ReleaseStringUTFChars(joeKuoPath, joeKuoPath_native);
+    env->ReleaseStringUTFChars(path, path_native);
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Load a file with Sobol direction vectors.
+ *
+ * Map the direction file at \p path, which was written with
+ * curandWriteDirectionFile, into memory, and write a handle for it to
+ * \p file. The file is mapped read-only and is not copied, so the time
+ * for loading it does not depend on the number of dimensions, and the
+ * pages are only read when the dimensions are used. Processes that load
+ * the same file share its pages.
+ *
+ * @param file - Pointer to the handle of the direction file
+ * @param path - The path of the direction file
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    direction files \n
+ * CURAND_STATUS_OUT_OF_RANGE if the file is not a valid direction file \n
+ * CURAND_STATUS_INTERNAL_ERROR if the file can not be mapped \n
+ * CURAND_STATUS_SUCCESS if the file was loaded successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandLoadDirectionFileNative(JNIEnv *env, jclass cls, jobject file, jstring path)
+{
+    // Null-checks for non-primitive arguments
+    if (file == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'file' is null for curandLoadDirectionFile");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (path == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'path' is null for curandLoadDirectionFile");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandLoadDirectionFile(file=%p, path=%p)\n",
+        file, path);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandLoadDirectionFile, "curandLoadDirectionFile"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandDirectionFile_t file_native = NULL;
+    const char *path_native = NULL;
+
+    // Obtain native variable values
+    path_native = env->GetStringUTFChars(path, NULL);
+    if (path_native == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandLoadDirectionFile(&file_native, path_native);
+
+    // Write back native variable values
+    setNativePointerValue(env, file, (jlong)file_native);
+    env->ReleaseStringUTFChars(path, path_native);
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Destroy a direction file.
+ *
+ * Unmap the direction file that was loaded with curandLoadDirectionFile.
+ * The file must not be used by any generator any more.
+ *
+ * @param file - The direction file
+ *
+ * @return
+ *
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    direction files \n
+ * CURAND_STATUS_NOT_INITIALIZED if the file was never loaded \n
+ * CURAND_STATUS_SUCCESS if the file was destroyed successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandDestroyDirectionFileNative(JNIEnv *env, jclass cls, jobject file)
+{
+    // Null-checks for non-primitive arguments
+    if (file == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'file' is null for curandDestroyDirectionFile");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandDestroyDirectionFile(file=%p)\n",
+        file);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandDestroyDirectionFile, "curandDestroyDirectionFile"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandDirectionFile_t file_native;
+
+    // Obtain native variable values
+    file_native = (curandDirectionFile_t)getNativePointerValue(env, file);
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandDestroyDirectionFile(file_native);
+
+    // Write back native variable values
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Set the direction vectors of a Sobol generator.
+ *
+ * Make the Sobol generator \p generator use the direction vectors of the
+ * given direction \p file, instead of the built-in direction vectors.
+ * The generator uses the mapped vectors directly, and supports as many
+ * dimensions as the file contains, which may be more than the 20000
+ * dimensions of the built-in vectors of CURAND and of the CPU backend.
+ * The
+ * vectors must have 32 bits for CURAND_RNG_QUASI_SOBOL32 and
+ * CURAND_RNG_QUASI_SCRAMBLED_SOBOL32, and 64 bits for
+ * CURAND_RNG_QUASI_SOBOL64 and CURAND_RNG_QUASI_SCRAMBLED_SOBOL64. If
+ * \p file is NULL, the built-in direction vectors are used again. The
+ * generator is moved back to the start of the sequence.
+ *
+ * @param generator - Generator to modify
+ * @param file - The direction file, or NULL
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    direction files, the generator is not a Sobol generator, or the number
+ *    of bits of the file does not match the generator type \n
+ * CURAND_STATUS_OUT_OF_RANGE if the generator has more dimensions than
+ *    the direction vectors \n
+ * CURAND_STATUS_SUCCESS if the direction file was set successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetQuasiRandomGeneratorDirectionFileNative(JNIEnv *env, jclass cls, jobject generator, jobject file)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandSetQuasiRandomGeneratorDirectionFile");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandSetQuasiRandomGeneratorDirectionFile(generator=%p, file=%p)\n",
+        generator, file);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandSetQuasiRandomGeneratorDirectionFile, "curandSetQuasiRandomGeneratorDirectionFile"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    curandDirectionFile_t file_native = NULL;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    if (file != NULL)
+    {
+        file_native = (curandDirectionFile_t)getNativePointerValue(env, file);
+    }
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandSetQuasiRandomGeneratorDirectionFile(generator_native, file_native);
+
+    // Write back native variable values
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Set the scrambling of a quasirandom generator.
+ *
+ * With CURAND_SCRAMBLING_OWEN, the points of the Sobol generator
+ * \p generator are Owen scrambled (nested uniform scrambling): For each
+ * dimension, the digits of each coordinate are flipped depending on the
+ * more significant digits, using a hash of the coordinate and of a seed
+ * for the dimension that is derived from \p seed. The scrambled points
+ * are still a (t,m,s)-net with the same t, so their stratification is
+ * kept, but the error of integrals of smooth functions decreases faster
+ * than with the digital shift of the scrambled Sobol types, which the
+ * Owen scrambling replaces. Generators with the same \p seed produce the
+ * same points, independent of how they are requested.
+ *
+ * With CURAND_SCRAMBLING_DEFAULT, the points are scrambled as defined by
+ * the generator type. For CURAND_RNG_QUASI_HALTON and
+ * CURAND_RNG_QUASI_LATTICE generators, only CURAND_SCRAMBLING_DEFAULT is
+ * supported, and \p seed selects the random digit permutations of the
+ * Halton sequence or the random shift of the lattice. The generator is
+ * moved back to the start of the sequence.
+ *
+ * @param generator - Generator to modify
+ * @param mode - The curandScramblingMode
+ * @param seed - The seed of the scrambling
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support the
+ *    scrambling, the generator is not a quasirandom generator, or the
+ *    mode is CURAND_SCRAMBLING_OWEN and the generator is not a Sobol
+ *    generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if the mode is not valid \n
+ * CURAND_STATUS_SUCCESS if the scrambling was set successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetQuasiRandomGeneratorScramblingNative(JNIEnv *env, jclass cls, jobject generator, jint mode, jlong seed)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandSetQuasiRandomGeneratorScrambling");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandSetQuasiRandomGeneratorScrambling(generator=%p, mode=%d, seed=%ld)\n",
+        generator, mode, seed);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandSetQuasiRandomGeneratorScrambling, "curandSetQuasiRandomGeneratorScrambling"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    curandScramblingMode_t mode_native;
+    unsigned long long seed_native = 0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    mode_native = (curandScramblingMode_t)mode;
+    seed_native = (unsigned long long)seed;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandSetQuasiRandomGeneratorScrambling(generator_native, mode_native, seed_native);
+
+    // Write back native variable values
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate a Latin hypercube design.
+ *
+ * Use \p generator to generate \p n points in \p dimensions dimensions
+ * into the host memory at \p outputPtr, so that in each dimension, each
+ * of the \p n intervals [k/n, (k+1)/n) contains exactly one point. The
+ * intervals of each dimension are assigned to the points by an
+ * independent random permutation. With CURAND_LATIN_HYPERCUBE_RANDOM,
+ * each point is uniformly distributed within its intervals. With
+ * CURAND_LATIN_HYPERCUBE_CENTERED, each point is at the center of its
+ * intervals, with the same permutations as for
+ * CURAND_LATIN_HYPERCUBE_RANDOM. With CURAND_LATIN_HYPERCUBE_MAXIMIN, 8
+ * random designs are generated, and the one with the largest minimum
+ * distance between two points is written. This takes quadratic time, and
+ * is only supported for at most 65536 points.
+ *
+ * The points are written in the given curandLayout: With
+ * CURAND_LAYOUT_ROW_MAJOR, the coordinates of each point are stored
+ * contiguously, and with CURAND_LAYOUT_COLUMN_MAJOR, the coordinates of
+ * each dimension are stored contiguously. The permutations of the
+ * dimensions are computed in parallel, and the design only depends on
+ * the seed and the position of the generator, and not on the number of
+ * threads.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the n * dimensions results
+ * @param n - Number of points
+ * @param dimensions - Number of dimensions
+ * @param mode - The curandLatinHypercubeMode
+ * @param layout - The curandLayout of the output
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support Latin
+ *    hypercube designs, or the generator is not a pseudorandom generator \n
+ * CURAND_STATUS_OUT_OF_RANGE if the number of dimensions is 0, the mode
+ *    or layout is not valid, or the mode is CURAND_LATIN_HYPERCUBE_MAXIMIN
+ *    and there are more than 65536 points \n
+ * CURAND_STATUS_ALLOCATION_FAILED if the memory for the permutations
+ *    could not be allocated \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLatinHypercubeNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jint dimensions, jint mode, jint layout)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateLatinHypercube");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateLatinHypercube");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateLatinHypercube(generator=%p, outputPtr=%p, n=%ld, dimensions=%d, mode=%d, layout=%d)\n",
+        generator, outputPtr, n, dimensions, mode, layout);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateLatinHypercube, "curandGenerateLatinHypercube"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t n_native = 0;
+    unsigned int dimensions_native = 0;
+    curandLatinHypercubeMode_t mode_native;
+    curandLayout_t layout_native;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    dimensions_native = (unsigned int)dimensions;
+    mode_native = (curandLatinHypercubeMode_t)mode;
+    layout_native = (curandLayout_t)layout;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateLatinHypercube(generator_native, outputPtr_native, n_native, dimensions_native, mode_native, layout_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate uniformly distributed floats in a range.
+ *
+ * Use \p generator to generate \p n float results into the host memory
+ * at \p outputPtr. The results are uniformly distributed in [\p a,
+ * \p b), excluding \p b. They are computed from the same random bits as
+ * the results of curandGenerateUniform(), which are uniformly
+ * distributed in (0.0, 1.0], and the mapping to the range is applied in
+ * the same pass. The fraction in [0.0, 1.0) from the upper 32 bits is
+ * mapped to the range, so that \p a is a possible result, and a result
+ * that would be rounded to \p b is replaced with the largest float below
+ * \p b.
+ *
+ * For pseudorandom generators in an antithetic mode, \p n must be even,
+ * and the partner of each result is mirrored in the range. For
+ * quasirandom generators, \p n must be a multiple of the number of
+ * dimensions.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of floats to generate
+ * @param a - Lower bound of the range, inclusive
+ * @param b - Upper bound of the range, exclusive
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    ranges \n
+ * CURAND_STATUS_OUT_OF_RANGE if a is not less than b, or one of them is
+ *    not finite \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+ *    generator and n is not a multiple of the number of dimensions, or the
+ *    generator is in an antithetic mode and n is odd \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformRangeNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jfloat a, jfloat b)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateUniformRange");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateUniformRange");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateUniformRange(generator=%p, outputPtr=%p, n=%ld, a=%f, b=%f)\n",
+        generator, outputPtr, n, a, b);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateUniformRange, "curandGenerateUniformRange"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    float* outputPtr_native = NULL;
+    size_t n_native = 0;
+    float a_native = 0.0f;
+    float b_native = 0.0f;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (float*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    a_native = (float)a;
+    b_native = (float)b;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateUniformRange(generator_native, outputPtr_native, n_native, a_native, b_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
+
+/**
+ * <pre>
+ * \brief Generate uniformly distributed doubles in a range.
+ *
+ * Use \p generator to generate \p n double results into the host memory
+ * at \p outputPtr. The results are uniformly distributed in [\p a,
+ * \p b), excluding \p b. They are computed from the same random bits as
+ * the results of curandGenerateUniformDouble(), which are uniformly
+ * distributed in (0.0, 1.0], and the mapping to the range is applied in
+ * the same pass. The fraction in [0.0, 1.0) from the upper 53 bits is
+ * mapped to the range, so that \p a is a possible result, and a result
+ * that would be rounded to \p b is replaced with the largest double
+ * below \p b.
+ *
+ * For pseudorandom generators in an antithetic mode, \p n must be even,
+ * and the partner of each result is mirrored in the range. For
+ * quasirandom generators, \p n must be a multiple of the number of
+ * dimensions.
+ *
+ * @param generator - Generator to use
+ * @param outputPtr - Pointer to host memory to store the results
+ * @param n - Number of doubles to generate
+ * @param a - Lower bound of the range, inclusive
+ * @param b - Upper bound of the range, exclusive
+ *
+ * @return
+ *
+ * CURAND_STATUS_NOT_INITIALIZED if the generator was never created \n
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ *    ranges \n
+ * CURAND_STATUS_OUT_OF_RANGE if a is not less than b, or one of them is
+ *    not finite \n
+ * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+ *    generator and n is not a multiple of the number of dimensions, or the
+ *    generator is in an antithetic mode and n is odd \n
+ * CURAND_STATUS_SUCCESS if the results were generated successfully \n
+ * </pre>
+ */
+JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformRangeDoubleNative(JNIEnv *env, jclass cls, jobject generator, jobject outputPtr, jlong n, jdouble a, jdouble b)
+{
+    // Null-checks for non-primitive arguments
+    if (generator == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'generator' is null for curandGenerateUniformRangeDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (outputPtr == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'outputPtr' is null for curandGenerateUniformRangeDouble");
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing curandGenerateUniformRangeDouble(generator=%p, outputPtr=%p, n=%ld, a=%f, b=%f)\n",
+        generator, outputPtr, n, a, b);
+
+    // Check whether the current backend provides the function
+    if (!isSupported(getCurandBackend()->curandGenerateUniformRangeDouble, "curandGenerateUniformRangeDouble"))
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+
+    // Native variable declarations
+    curandGenerator_t generator_native;
+    double* outputPtr_native = NULL;
+    size_t n_native = 0;
+    double a_native = 0.0;
+    double b_native = 0.0;
+
+    // Obtain native variable values
+    generator_native = (curandGenerator_t)getNativePointerValue(env, generator);
+    PointerData *outputPtrPointerData = initPointerData(env, outputPtr);
+    if (outputPtrPointerData == NULL)
+    {
+        return JCURAND_STATUS_INTERNAL_ERROR;
+    }
+    outputPtr_native = (double*)outputPtrPointerData->getPointer(env);
+    n_native = (size_t)n;
+    a_native = (double)a;
+    b_native = (double)b;
+
+    // Native function call
+    curandStatus_t result_native = getCurandBackend()->curandGenerateUniformRangeDouble(generator_native, outputPtr_native, n_native, a_native, b_native);
+
+    // Write back native variable values
+    if (!releasePointerData(env, outputPtrPointerData)) return JCURAND_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result_native;
+}
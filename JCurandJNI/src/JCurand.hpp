@@ -43,6 +43,86 @@ extern "C" {
     JNIEXPORT void JNICALL Java_jcuda_jcurand_JCurand_setLogLevelNative
         (JNIEnv *, jclass, jint);
 
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    setBackendNative
+    * Signature: (I)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_setBackendNative
+        (JNIEnv *, jclass, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    getBackendNative
+    * Signature: ()I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_getBackendNative
+        (JNIEnv *, jclass);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateUniformArrayNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;[FII)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformArrayNative
+        (JNIEnv *, jclass, jobject, jfloatArray, jint, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateUniformDoubleArrayNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;[DII)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformDoubleArrayNative
+        (JNIEnv *, jclass, jobject, jdoubleArray, jint, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateNormalArrayNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;[FIFFI)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalArrayNative
+        (JNIEnv *, jclass, jobject, jfloatArray, jint, jfloat, jfloat, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateNormalDoubleArrayNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;[DIDDI)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalDoubleArrayNative
+        (JNIEnv *, jclass, jobject, jdoubleArray, jint, jdouble, jdouble, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateLogNormalArrayNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;[FIFFI)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLogNormalArrayNative
+        (JNIEnv *, jclass, jobject, jfloatArray, jint, jfloat, jfloat, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateLogNormalDoubleArrayNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;[DIDDI)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLogNormalDoubleArrayNative
+        (JNIEnv *, jclass, jobject, jdoubleArray, jint, jdouble, jdouble, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandSetGeneratorStreamsNative
+    * Signature: ([Ljcuda/jcurand/curandGenerator;IJ[JI)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorStreamsNative
+        (JNIEnv *, jclass, jobjectArray, jint, jlong, jlongArray, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandExportToFileNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljava/lang/String;IJDDI[D)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandExportToFileNative
+        (JNIEnv *, jclass, jobject, jstring, jint, jlong, jdouble, jdouble, jint, jdoubleArray);
+
     /*
     * Class:     jcuda_jcurand_JCurand
     * Method:    curandCreateGeneratorNative
@@ -251,6 +331,462 @@ extern "C" {
     JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGetScrambleConstants64Native
         (JNIEnv *, jclass, jobjectArray);
 
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateUniformHalfNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;J)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformHalfNative
+        (JNIEnv *, jclass, jobject, jobject, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateUniformBF16Native
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;J)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformBF16Native
+        (JNIEnv *, jclass, jobject, jobject, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateNormalHalfNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JFF)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalHalfNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jfloat, jfloat);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateNormalBF16Native
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JFF)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalBF16Native
+        (JNIEnv *, jclass, jobject, jobject, jlong, jfloat, jfloat);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateIntRangeNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JII)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateIntRangeNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jint, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateLongLongRangeNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JJJ)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLongLongRangeNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jlong, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateBernoulliBitsNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JD)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateBernoulliBitsNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jdouble);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateExponentialNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JF)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateExponentialNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jfloat);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateExponentialDoubleNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JD)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateExponentialDoubleNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jdouble);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateGammaNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JFF)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateGammaNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jfloat, jfloat);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateGammaDoubleNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JDD)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateGammaDoubleNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jdouble, jdouble);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateBetaNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JFF)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateBetaNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jfloat, jfloat);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateBetaDoubleNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JDD)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateBetaDoubleNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jdouble, jdouble);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateChiSquaredNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JF)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateChiSquaredNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jfloat);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateChiSquaredDoubleNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JD)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateChiSquaredDoubleNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jdouble);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateStudentTNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JF)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateStudentTNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jfloat);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateStudentTDoubleNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JD)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateStudentTDoubleNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jdouble);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateTruncatedNormalNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JFFFF)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateTruncatedNormalNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jfloat, jfloat, jfloat, jfloat);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateTruncatedNormalDoubleNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JDDDD)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateTruncatedNormalDoubleNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jdouble, jdouble, jdouble, jdouble);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandCreateMultivariateNormalNative
+    * Signature: (Ljcuda/jcurand/curandMultivariateNormal;ILjcuda/Pointer;Ljcuda/Pointer;I)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandCreateMultivariateNormalNative
+        (JNIEnv *, jclass, jobject, jint, jobject, jobject, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandDestroyMultivariateNormalNative
+    * Signature: (Ljcuda/jcurand/curandMultivariateNormal;)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandDestroyMultivariateNormalNative
+        (JNIEnv *, jclass, jobject);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateMultivariateNormalNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JLjcuda/jcurand/curandMultivariateNormal;I)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateMultivariateNormalNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jobject, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateMultivariateNormalDoubleNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JLjcuda/jcurand/curandMultivariateNormal;I)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateMultivariateNormalDoubleNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jobject, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGeneratePermutationNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;J)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGeneratePermutationNative
+        (JNIEnv *, jclass, jobject, jobject, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGeneratePermutationLongLongNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;J)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGeneratePermutationLongLongNative
+        (JNIEnv *, jclass, jobject, jobject, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandSampleWithoutReplacementNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JJ)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSampleWithoutReplacementNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandSampleWithoutReplacementLongLongNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JJ)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSampleWithoutReplacementLongLongNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandCreateBrownianBridgeNative
+    * Signature: (Ljcuda/jcurand/curandBrownianBridge;ILjcuda/Pointer;)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandCreateBrownianBridgeNative
+        (JNIEnv *, jclass, jobject, jint, jobject);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandDestroyBrownianBridgeNative
+    * Signature: (Ljcuda/jcurand/curandBrownianBridge;)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandDestroyBrownianBridgeNative
+        (JNIEnv *, jclass, jobject);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandTransformBrownianBridgeNative
+    * Signature: (Ljcuda/jcurand/curandBrownianBridge;Ljcuda/Pointer;J)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandTransformBrownianBridgeNative
+        (JNIEnv *, jclass, jobject, jobject, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandTransformBrownianBridgeDoubleNative
+    * Signature: (Ljcuda/jcurand/curandBrownianBridge;Ljcuda/Pointer;J)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandTransformBrownianBridgeDoubleNative
+        (JNIEnv *, jclass, jobject, jobject, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateBrownianBridgeNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JLjcuda/jcurand/curandBrownianBridge;I)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateBrownianBridgeNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jobject, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateBrownianBridgeDoubleNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JLjcuda/jcurand/curandBrownianBridge;I)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateBrownianBridgeDoubleNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jobject, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandSetGeneratorAntitheticModeNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;I)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorAntitheticModeNative
+        (JNIEnv *, jclass, jobject, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateUniform2DNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JJJ)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniform2DNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jlong, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateUniformDouble2DNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JJJ)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformDouble2DNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jlong, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateNormal2DNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JJJFF)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormal2DNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jlong, jlong, jfloat, jfloat);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateNormalDouble2DNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JJJDD)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateNormalDouble2DNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jlong, jlong, jdouble, jdouble);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateLogNormal2DNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JJJFF)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLogNormal2DNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jlong, jlong, jfloat, jfloat);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateLogNormalDouble2DNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JJJDD)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLogNormalDouble2DNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jlong, jlong, jdouble, jdouble);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandSetQuasiRandomGeneratorLayoutNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;I)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetQuasiRandomGeneratorLayoutNative
+        (JNIEnv *, jclass, jobject, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandSetGeneratorConcurrentNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;I)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorConcurrentNative
+        (JNIEnv *, jclass, jobject, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandSetGeneratorThreadLaneNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;I)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorThreadLaneNative
+        (JNIEnv *, jclass, jobject, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandPhiloxUniformNative
+    * Signature: (JJJLjcuda/Pointer;J)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandPhiloxUniformNative
+        (JNIEnv *, jclass, jlong, jlong, jlong, jobject, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandPhiloxUniformDoubleNative
+    * Signature: (JJJLjcuda/Pointer;J)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandPhiloxUniformDoubleNative
+        (JNIEnv *, jclass, jlong, jlong, jlong, jobject, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandPhiloxUniformGatherNative
+    * Signature: (JJLjcuda/Pointer;Ljcuda/Pointer;J)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandPhiloxUniformGatherNative
+        (JNIEnv *, jclass, jlong, jlong, jobject, jobject, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandPhiloxUniformDoubleGatherNative
+    * Signature: (JJLjcuda/Pointer;Ljcuda/Pointer;J)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandPhiloxUniformDoubleGatherNative
+        (JNIEnv *, jclass, jlong, jlong, jobject, jobject, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandDeriveStreamSubsequenceNative
+    * Signature: (Ljcuda/Pointer;ILjcuda/Pointer;)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandDeriveStreamSubsequenceNative
+        (JNIEnv *, jclass, jobject, jint, jobject);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandSetGeneratorStreamNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;JLjcuda/Pointer;I)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetGeneratorStreamNative
+        (JNIEnv *, jclass, jobject, jlong, jobject, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandWriteDirectionFileNative
+    * Signature: (Ljava/lang/String;Ljava/lang/String;II)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandWriteDirectionFileNative
+        (JNIEnv *, jclass, jstring, jstring, jint, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandLoadDirectionFileNative
+    * Signature: (Ljcuda/jcurand/curandDirectionFile;Ljava/lang/String;)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandLoadDirectionFileNative
+        (JNIEnv *, jclass, jobject, jstring);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandDestroyDirectionFileNative
+    * Signature: (Ljcuda/jcurand/curandDirectionFile;)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandDestroyDirectionFileNative
+        (JNIEnv *, jclass, jobject);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandSetQuasiRandomGeneratorDirectionFileNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/jcurand/curandDirectionFile;)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetQuasiRandomGeneratorDirectionFileNative
+        (JNIEnv *, jclass, jobject, jobject);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandSetQuasiRandomGeneratorScramblingNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;IJ)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandSetQuasiRandomGeneratorScramblingNative
+        (JNIEnv *, jclass, jobject, jint, jlong);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateLatinHypercubeNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JIII)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateLatinHypercubeNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jint, jint, jint);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateUniformRangeNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JFF)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformRangeNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jfloat, jfloat);
+
+    /*
+    * Class:     jcuda_jcurand_JCurand
+    * Method:    curandGenerateUniformRangeDoubleNative
+    * Signature: (Ljcuda/jcurand/curandGenerator;Ljcuda/Pointer;JDD)I
+    */
+    JNIEXPORT jint JNICALL Java_jcuda_jcurand_JCurand_curandGenerateUniformRangeDoubleNative
+        (JNIEnv *, jclass, jobject, jobject, jlong, jdouble, jdouble);
+
 #ifdef __cplusplus
 }
 #endif
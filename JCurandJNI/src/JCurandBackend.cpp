@@ -0,0 +1,294 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "JCurandBackend.hpp"
+#include "CpuCurand.hpp"
+#include "Logger.hpp"
+
+#include <stdlib.h>
+#include <atomic>
+#include <mutex>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace
+{
+#ifdef _WIN32
+    const char *curandLibraryNames[] = { "curand64_10.dll", NULL };
+
+    void *openLibrary(const char *name)
+    {
+        return (void*)LoadLibraryA(name);
+    }
+
+    void *resolveSymbol(void *library, const char *name)
+    {
+        return (void*)GetProcAddress((HMODULE)library, name);
+    }
+#else
+    const char *curandLibraryNames[] = { "libcurand.so.10", "libcurand.so", NULL };
+
+    void *openLibrary(const char *name)
+    {
+        return dlopen(name, RTLD_NOW | RTLD_LOCAL);
+    }
+
+    void *resolveSymbol(void *library, const char *name)
+    {
+        return dlsym(library, name);
+    }
+#endif
+
+    /**
+     * The CUDA backend. Its functions are resolved from the CURAND
+     * library when it is used for the first time.
+     */
+    CurandBackend cudaBackend =
+    {
+        JCURAND_BACKEND_CUDA,
+        "CUDA"
+    };
+
+    const CurandBackend cpuBackend =
+    {
+        JCURAND_BACKEND_CPU,
+        "CPU",
+        cpuCurandCreateGenerator,
+        cpuCurandCreateGeneratorHost,
+        cpuCurandDestroyGenerator,
+        cpuCurandGetVersion,
+        cpuCurandGetProperty,
+        cpuCurandSetStream,
+        cpuCurandSetPseudoRandomGeneratorSeed,
+        cpuCurandSetGeneratorOffset,
+        cpuCurandSetGeneratorOrdering,
+        cpuCurandSetQuasiRandomGeneratorDimensions,
+        cpuCurandGenerate,
+        cpuCurandGenerateLongLong,
+        cpuCurandGenerateUniform,
+        cpuCurandGenerateUniformDouble,
+        cpuCurandGenerateNormal,
+        cpuCurandGenerateNormalDouble,
+        cpuCurandGenerateLogNormal,
+        cpuCurandGenerateLogNormalDouble,
+        cpuCurandCreatePoissonDistribution,
+        cpuCurandDestroyDistribution,
+        cpuCurandGeneratePoisson,
+        cpuCurandGenerateSeeds,
+        cpuCurandGetDirectionVectors32,
+        cpuCurandGetScrambleConstants32,
+        cpuCurandGetDirectionVectors64,
+        cpuCurandGetScrambleConstants64,
+        cpuCurandGenerateUniformHalf,
+        cpuCurandGenerateUniformBF16,
+        cpuCurandGenerateNormalHalf,
+        cpuCurandGenerateNormalBF16,
+        cpuCurandGenerateIntRange,
+        cpuCurandGenerateLongLongRange,
+        cpuCurandGenerateBernoulliBits,
+        cpuCurandGenerateExponential,
+        cpuCurandGenerateExponentialDouble,
+        cpuCurandGenerateGamma,
+        cpuCurandGenerateGammaDouble,
+        cpuCurandGenerateBeta,
+        cpuCurandGenerateBetaDouble,
+        cpuCurandGenerateChiSquared,
+        cpuCurandGenerateChiSquaredDouble,
+        cpuCurandGenerateStudentT,
+        cpuCurandGenerateStudentTDouble,
+        cpuCurandGenerateTruncatedNormal,
+        cpuCurandGenerateTruncatedNormalDouble,
+        cpuCurandCreateMultivariateNormal,
+        cpuCurandDestroyMultivariateNormal,
+        cpuCurandGenerateMultivariateNormal,
+        cpuCurandGenerateMultivariateNormalDouble,
+        cpuCurandGeneratePermutation,
+        cpuCurandGeneratePermutationLongLong,
+        cpuCurandSampleWithoutReplacement,
+        cpuCurandSampleWithoutReplacementLongLong,
+        cpuCurandCreateBrownianBridge,
+        cpuCurandDestroyBrownianBridge,
+        cpuCurandTransformBrownianBridge,
+        cpuCurandTransformBrownianBridgeDouble,
+        cpuCurandGenerateBrownianBridge,
+        cpuCurandGenerateBrownianBridgeDouble,
+        cpuCurandSetGeneratorAntitheticMode,
+        cpuCurandGenerateUniform2D,
+        cpuCurandGenerateUniformDouble2D,
+        cpuCurandGenerateNormal2D,
+        cpuCurandGenerateNormalDouble2D,
+        cpuCurandGenerateLogNormal2D,
+        cpuCurandGenerateLogNormalDouble2D,
+        cpuCurandSetQuasiRandomGeneratorLayout,
+        cpuCurandSetGeneratorConcurrent,
+        cpuCurandSetGeneratorThreadLane,
+        cpuCurandPhiloxUniform,
+        cpuCurandPhiloxUniformDouble,
+        cpuCurandPhiloxUniformGather,
+        cpuCurandPhiloxUniformDoubleGather,
+        cpuCurandDeriveStreamSubsequence,
+        cpuCurandSetGeneratorStream,
+        cpuCurandSetGeneratorStreams,
+        cpuCurandWriteDirectionFile,
+        cpuCurandLoadDirectionFile,
+        cpuCurandDestroyDirectionFile,
+        cpuCurandSetQuasiRandomGeneratorDirectionFile,
+        cpuCurandSetQuasiRandomGeneratorScrambling,
+        cpuCurandGenerateLatinHypercube,
+        cpuCurandGenerateUniformRange,
+        cpuCurandGenerateUniformRangeDouble,
+        cpuCurandGetGeneratorDimensions
+    };
+
+    /**
+     * The backend that was selected with setCurandBackend
+     */
+    int selectedBackend = JCURAND_BACKEND_CUDA;
+
+    /**
+     * The backend that is used, or NULL if it has not been determined
+     * since the last call to setCurandBackend
+     */
+    std::atomic<const CurandBackend*> currentBackend(NULL);
+
+    std::mutex backendMutex;
+
+    #define JCURAND_RESOLVE(name) \
+        cudaBackend.name = (decltype(cudaBackend.name))resolveSymbol(library, #name); \
+        if (cudaBackend.name == NULL) \
+        { \
+            Logger::log(LOG_ERROR, "Could not resolve %s in the CURAND library\n", #name); \
+            return false; \
+        }
+
+    /**
+     * Load the CURAND library and resolve the functions of the CUDA
+     * backend. Returns whether this succeeded. The library is never
+     * unloaded.
+     */
+    bool loadCurandLibrary()
+    {
+        static int loaded = -1;
+        if (loaded != -1)
+        {
+            return loaded == 1;
+        }
+        loaded = 0;
+
+        void *library = NULL;
+        const char *libraryName = getenv("JCURAND_CURAND_LIBRARY");
+        if (libraryName != NULL)
+        {
+            library = openLibrary(libraryName);
+        }
+        for (int i = 0; library == NULL && curandLibraryNames[i] != NULL; i++)
+        {
+            libraryName = curandLibraryNames[i];
+            library = openLibrary(libraryName);
+        }
+        if (library == NULL)
+        {
+            return false;
+        }
+        Logger::log(LOG_DEBUG, "Loaded CURAND library %s\n", libraryName);
+
+        JCURAND_RESOLVE(curandCreateGenerator);
+        JCURAND_RESOLVE(curandCreateGeneratorHost);
+        JCURAND_RESOLVE(curandDestroyGenerator);
+        JCURAND_RESOLVE(curandGetVersion);
+        JCURAND_RESOLVE(curandGetProperty);
+        JCURAND_RESOLVE(curandSetStream);
+        JCURAND_RESOLVE(curandSetPseudoRandomGeneratorSeed);
+        JCURAND_RESOLVE(curandSetGeneratorOffset);
+        JCURAND_RESOLVE(curandSetGeneratorOrdering);
+        JCURAND_RESOLVE(curandSetQuasiRandomGeneratorDimensions);
+        JCURAND_RESOLVE(curandGenerate);
+        JCURAND_RESOLVE(curandGenerateLongLong);
+        JCURAND_RESOLVE(curandGenerateUniform);
+        JCURAND_RESOLVE(curandGenerateUniformDouble);
+        JCURAND_RESOLVE(curandGenerateNormal);
+        JCURAND_RESOLVE(curandGenerateNormalDouble);
+        JCURAND_RESOLVE(curandGenerateLogNormal);
+        JCURAND_RESOLVE(curandGenerateLogNormalDouble);
+        JCURAND_RESOLVE(curandCreatePoissonDistribution);
+        JCURAND_RESOLVE(curandDestroyDistribution);
+        JCURAND_RESOLVE(curandGeneratePoisson);
+        JCURAND_RESOLVE(curandGenerateSeeds);
+        JCURAND_RESOLVE(curandGetDirectionVectors32);
+        JCURAND_RESOLVE(curandGetScrambleConstants32);
+        JCURAND_RESOLVE(curandGetDirectionVectors64);
+        JCURAND_RESOLVE(curandGetScrambleConstants64);
+        loaded = 1;
+        return true;
+    }
+}
+
+const CurandBackend *getCurandBackend()
+{
+    const CurandBackend *backend = currentBackend.load(std::memory_order_acquire);
+    if (backend != NULL)
+    {
+        return backend;
+    }
+    std::lock_guard<std::mutex> lock(backendMutex);
+    backend = currentBackend.load(std::memory_order_relaxed);
+    if (backend == NULL)
+    {
+        if (selectedBackend == JCURAND_BACKEND_CPU)
+        {
+            backend = &cpuBackend;
+        }
+        else if (loadCurandLibrary())
+        {
+            backend = &cudaBackend;
+        }
+        else
+        {
+            Logger::log(LOG_WARNING, "Could not load the CURAND library, using the CPU backend\n");
+            backend = &cpuBackend;
+        }
+        currentBackend.store(backend, std::memory_order_release);
+    }
+    return backend;
+}
+
+bool setCurandBackend(int backend)
+{
+    if (backend != JCURAND_BACKEND_CUDA && backend != JCURAND_BACKEND_CPU)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(backendMutex);
+    selectedBackend = backend;
+    currentBackend.store(NULL, std::memory_order_release);
+    return true;
+}
@@ -0,0 +1,162 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_BACKEND
+#define JCURAND_BACKEND
+
+#include <curand.h>
+#include "JCurandExtensions.hpp"
+
+/**
+ * The backends that may execute the CURAND functions. These values
+ * correspond to the constants in the JCurandBackend Java class.
+ */
+#define JCURAND_BACKEND_CUDA 0
+#define JCURAND_BACKEND_CPU 1
+
+/**
+ * The table of the CURAND host API functions that are called by
+ * JCurand. All native functions call CURAND through the table of
+ * the current backend, so that the same calls can be executed by
+ * the CURAND library or by its CPU emulation. The library is not
+ * linked, but loaded at runtime, so that the process only pays for
+ * loading it when it is actually used.
+ */
+struct CurandBackend
+{
+    int id;
+    const char *name;
+    curandStatus_t (CURANDAPI *curandCreateGenerator)(curandGenerator_t *generator, curandRngType_t rng_type);
+    curandStatus_t (CURANDAPI *curandCreateGeneratorHost)(curandGenerator_t *generator, curandRngType_t rng_type);
+    curandStatus_t (CURANDAPI *curandDestroyGenerator)(curandGenerator_t generator);
+    curandStatus_t (CURANDAPI *curandGetVersion)(int *version);
+    curandStatus_t (CURANDAPI *curandGetProperty)(libraryPropertyType type, int *value);
+    curandStatus_t (CURANDAPI *curandSetStream)(curandGenerator_t generator, cudaStream_t stream);
+    curandStatus_t (CURANDAPI *curandSetPseudoRandomGeneratorSeed)(curandGenerator_t generator, unsigned long long seed);
+    curandStatus_t (CURANDAPI *curandSetGeneratorOffset)(curandGenerator_t generator, unsigned long long offset);
+    curandStatus_t (CURANDAPI *curandSetGeneratorOrdering)(curandGenerator_t generator, curandOrdering_t order);
+    curandStatus_t (CURANDAPI *curandSetQuasiRandomGeneratorDimensions)(curandGenerator_t generator, unsigned int num_dimensions);
+    curandStatus_t (CURANDAPI *curandGenerate)(curandGenerator_t generator, unsigned int *outputPtr, size_t num);
+    curandStatus_t (CURANDAPI *curandGenerateLongLong)(curandGenerator_t generator, unsigned long long *outputPtr, size_t num);
+    curandStatus_t (CURANDAPI *curandGenerateUniform)(curandGenerator_t generator, float *outputPtr, size_t num);
+    curandStatus_t (CURANDAPI *curandGenerateUniformDouble)(curandGenerator_t generator, double *outputPtr, size_t num);
+    curandStatus_t (CURANDAPI *curandGenerateNormal)(curandGenerator_t generator, float *outputPtr, size_t n, float mean, float stddev);
+    curandStatus_t (CURANDAPI *curandGenerateNormalDouble)(curandGenerator_t generator, double *outputPtr, size_t n, double mean, double stddev);
+    curandStatus_t (CURANDAPI *curandGenerateLogNormal)(curandGenerator_t generator, float *outputPtr, size_t n, float mean, float stddev);
+    curandStatus_t (CURANDAPI *curandGenerateLogNormalDouble)(curandGenerator_t generator, double *outputPtr, size_t n, double mean, double stddev);
+    curandStatus_t (CURANDAPI *curandCreatePoissonDistribution)(double lambda, curandDiscreteDistribution_t *discrete_distribution);
+    curandStatus_t (CURANDAPI *curandDestroyDistribution)(curandDiscreteDistribution_t discrete_distribution);
+    curandStatus_t (CURANDAPI *curandGeneratePoisson)(curandGenerator_t generator, unsigned int *outputPtr, size_t n, double lambda);
+    curandStatus_t (CURANDAPI *curandGenerateSeeds)(curandGenerator_t generator);
+    curandStatus_t (CURANDAPI *curandGetDirectionVectors32)(curandDirectionVectors32_t **vectors, curandDirectionVectorSet_t set);
+    curandStatus_t (CURANDAPI *curandGetScrambleConstants32)(unsigned int **constants);
+    curandStatus_t (CURANDAPI *curandGetDirectionVectors64)(curandDirectionVectors64_t **vectors, curandDirectionVectorSet_t set);
+    curandStatus_t (CURANDAPI *curandGetScrambleConstants64)(unsigned long long **constants);
+
+    // Extensions that are not part of CURAND. These are only provided
+    // by the CPU backend, and NULL for the CUDA backend.
+    curandStatus_t (CURANDAPI *curandGenerateUniformHalf)(curandGenerator_t generator, unsigned short *outputPtr, size_t num);
+    curandStatus_t (CURANDAPI *curandGenerateUniformBF16)(curandGenerator_t generator, unsigned short *outputPtr, size_t num);
+    curandStatus_t (CURANDAPI *curandGenerateNormalHalf)(curandGenerator_t generator, unsigned short *outputPtr, size_t n, float mean, float stddev);
+    curandStatus_t (CURANDAPI *curandGenerateNormalBF16)(curandGenerator_t generator, unsigned short *outputPtr, size_t n, float mean, float stddev);
+    curandStatus_t (CURANDAPI *curandGenerateIntRange)(curandGenerator_t generator, int *outputPtr, size_t n, int lo, int hi);
+    curandStatus_t (CURANDAPI *curandGenerateLongLongRange)(curandGenerator_t generator, long long *outputPtr, size_t n, long long lo, long long hi);
+    curandStatus_t (CURANDAPI *curandGenerateBernoulliBits)(curandGenerator_t generator, unsigned int *outputPtr, size_t nBits, double p);
+    curandStatus_t (CURANDAPI *curandGenerateExponential)(curandGenerator_t generator, float *outputPtr, size_t n, float lambda);
+    curandStatus_t (CURANDAPI *curandGenerateExponentialDouble)(curandGenerator_t generator, double *outputPtr, size_t n, double lambda);
+    curandStatus_t (CURANDAPI *curandGenerateGamma)(curandGenerator_t generator, float *outputPtr, size_t n, float shape, float scale);
+    curandStatus_t (CURANDAPI *curandGenerateGammaDouble)(curandGenerator_t generator, double *outputPtr, size_t n, double shape, double scale);
+    curandStatus_t (CURANDAPI *curandGenerateBeta)(curandGenerator_t generator, float *outputPtr, size_t n, float alpha, float beta);
+    curandStatus_t (CURANDAPI *curandGenerateBetaDouble)(curandGenerator_t generator, double *outputPtr, size_t n, double alpha, double beta);
+    curandStatus_t (CURANDAPI *curandGenerateChiSquared)(curandGenerator_t generator, float *outputPtr, size_t n, float k);
+    curandStatus_t (CURANDAPI *curandGenerateChiSquaredDouble)(curandGenerator_t generator, double *outputPtr, size_t n, double k);
+    curandStatus_t (CURANDAPI *curandGenerateStudentT)(curandGenerator_t generator, float *outputPtr, size_t n, float nu);
+    curandStatus_t (CURANDAPI *curandGenerateStudentTDouble)(curandGenerator_t generator, double *outputPtr, size_t n, double nu);
+    curandStatus_t (CURANDAPI *curandGenerateTruncatedNormal)(curandGenerator_t generator, float *outputPtr, size_t n, float mean, float stddev, float lo, float hi);
+    curandStatus_t (CURANDAPI *curandGenerateTruncatedNormalDouble)(curandGenerator_t generator, double *outputPtr, size_t n, double mean, double stddev, double lo, double hi);
+    curandStatus_t (CURANDAPI *curandCreateMultivariateNormal)(curandMultivariateNormal_t *distribution, unsigned int dimensions, const double *mean, const double *matrix, curandMatrixType_t matrixType);
+    curandStatus_t (CURANDAPI *curandDestroyMultivariateNormal)(curandMultivariateNormal_t distribution);
+    curandStatus_t (CURANDAPI *curandGenerateMultivariateNormal)(curandGenerator_t generator, float *outputPtr, size_t n, curandMultivariateNormal_t distribution, curandLayout_t layout);
+    curandStatus_t (CURANDAPI *curandGenerateMultivariateNormalDouble)(curandGenerator_t generator, double *outputPtr, size_t n, curandMultivariateNormal_t distribution, curandLayout_t layout);
+    curandStatus_t (CURANDAPI *curandGeneratePermutation)(curandGenerator_t generator, int *outputPtr, size_t n);
+    curandStatus_t (CURANDAPI *curandGeneratePermutationLongLong)(curandGenerator_t generator, long long *outputPtr, size_t n);
+    curandStatus_t (CURANDAPI *curandSampleWithoutReplacement)(curandGenerator_t generator, int *outputPtr, size_t n, size_t k);
+    curandStatus_t (CURANDAPI *curandSampleWithoutReplacementLongLong)(curandGenerator_t generator, long long *outputPtr, size_t n, size_t k);
+    curandStatus_t (CURANDAPI *curandCreateBrownianBridge)(curandBrownianBridge_t *bridge, unsigned int steps, const double *times);
+    curandStatus_t (CURANDAPI *curandDestroyBrownianBridge)(curandBrownianBridge_t bridge);
+    curandStatus_t (CURANDAPI *curandTransformBrownianBridge)(curandBrownianBridge_t bridge, float *data, size_t n);
+    curandStatus_t (CURANDAPI *curandTransformBrownianBridgeDouble)(curandBrownianBridge_t bridge, double *data, size_t n);
+    curandStatus_t (CURANDAPI *curandGenerateBrownianBridge)(curandGenerator_t generator, float *outputPtr, size_t n, curandBrownianBridge_t bridge, curandLayout_t layout);
+    curandStatus_t (CURANDAPI *curandGenerateBrownianBridgeDouble)(curandGenerator_t generator, double *outputPtr, size_t n, curandBrownianBridge_t bridge, curandLayout_t layout);
+    curandStatus_t (CURANDAPI *curandSetGeneratorAntitheticMode)(curandGenerator_t generator, curandAntitheticMode_t mode);
+    curandStatus_t (CURANDAPI *curandGenerateUniform2D)(curandGenerator_t generator, float *outputPtr, size_t rows, size_t cols, size_t pitch);
+    curandStatus_t (CURANDAPI *curandGenerateUniformDouble2D)(curandGenerator_t generator, double *outputPtr, size_t rows, size_t cols, size_t pitch);
+    curandStatus_t (CURANDAPI *curandGenerateNormal2D)(curandGenerator_t generator, float *outputPtr, size_t rows, size_t cols, size_t pitch, float mean, float stddev);
+    curandStatus_t (CURANDAPI *curandGenerateNormalDouble2D)(curandGenerator_t generator, double *outputPtr, size_t rows, size_t cols, size_t pitch, double mean, double stddev);
+    curandStatus_t (CURANDAPI *curandGenerateLogNormal2D)(curandGenerator_t generator, float *outputPtr, size_t rows, size_t cols, size_t pitch, float mean, float stddev);
+    curandStatus_t (CURANDAPI *curandGenerateLogNormalDouble2D)(curandGenerator_t generator, double *outputPtr, size_t rows, size_t cols, size_t pitch, double mean, double stddev);
+    curandStatus_t (CURANDAPI *curandSetQuasiRandomGeneratorLayout)(curandGenerator_t generator, curandLayout_t layout);
+    curandStatus_t (CURANDAPI *curandSetGeneratorConcurrent)(curandGenerator_t generator, int concurrent);
+    curandStatus_t (CURANDAPI *curandSetGeneratorThreadLane)(curandGenerator_t generator, unsigned int lane);
+    curandStatus_t (CURANDAPI *curandPhiloxUniform)(unsigned long long seed, unsigned long long subsequence, unsigned long long offset, float *outputPtr, size_t num);
+    curandStatus_t (CURANDAPI *curandPhiloxUniformDouble)(unsigned long long seed, unsigned long long subsequence, unsigned long long offset, double *outputPtr, size_t num);
+    curandStatus_t (CURANDAPI *curandPhiloxUniformGather)(unsigned long long seed, unsigned long long subsequence, const unsigned long long *offsets, float *outputPtr, size_t num);
+    curandStatus_t (CURANDAPI *curandPhiloxUniformDoubleGather)(unsigned long long seed, unsigned long long subsequence, const unsigned long long *offsets, double *outputPtr, size_t num);
+    curandStatus_t (CURANDAPI *curandDeriveStreamSubsequence)(const unsigned long long *path, unsigned int depth, unsigned long long *subsequence);
+    curandStatus_t (CURANDAPI *curandSetGeneratorStream)(curandGenerator_t generator, unsigned long long seed, const unsigned long long *path, unsigned int depth);
+    curandStatus_t (CURANDAPI *curandSetGeneratorStreams)(const curandGenerator_t *generators, unsigned int count, unsigned long long seed, const unsigned long long *paths, unsigned int depth);
+    curandStatus_t (CURANDAPI *curandWriteDirectionFile)(const char *joeKuoPath, const char *path, unsigned int bits, unsigned int dimensions);
+    curandStatus_t (CURANDAPI *curandLoadDirectionFile)(curandDirectionFile_t *file, const char *path);
+    curandStatus_t (CURANDAPI *curandDestroyDirectionFile)(curandDirectionFile_t file);
+    curandStatus_t (CURANDAPI *curandSetQuasiRandomGeneratorDirectionFile)(curandGenerator_t generator, curandDirectionFile_t file);
+    curandStatus_t (CURANDAPI *curandSetQuasiRandomGeneratorScrambling)(curandGenerator_t generator, curandScramblingMode_t mode, unsigned long long seed);
+    curandStatus_t (CURANDAPI *curandGenerateLatinHypercube)(curandGenerator_t generator, double *outputPtr, size_t n, unsigned int dimensions, curandLatinHypercubeMode_t mode, curandLayout_t layout);
+    curandStatus_t (CURANDAPI *curandGenerateUniformRange)(curandGenerator_t generator, float *outputPtr, size_t n, float a, float b);
+    curandStatus_t (CURANDAPI *curandGenerateUniformRangeDouble)(curandGenerator_t generator, double *outputPtr, size_t n, double a, double b);
+    curandStatus_t (CURANDAPI *curandGetGeneratorDimensions)(curandGenerator_t generator, unsigned int *dimensions);
+};
+
+/**
+ * Returns the backend that is currently used.
+ *
+ * Unless the CPU backend was selected with setCurandBackend, the
+ * first call to this function loads the CURAND library and resolves
+ * its functions. If the library can not be loaded, then the CPU
+ * backend is used instead. The name of the library may be given with
+ * the JCURAND_CURAND_LIBRARY environment variable.
+ */
+const CurandBackend *getCurandBackend();
+
+/**
+ * Select the given backend. Returns false if the given value is not
+ * a valid backend. Generators and distributions that have been
+ * created with one backend may not be used with another one.
+ */
+bool setCurandBackend(int backend);
+
+#endif
@@ -0,0 +1,405 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "JCurandExport.hpp"
+#include "JCurandBackend.hpp"
+
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    /**
+     * The size of each of the two buffers, in bytes. It is a multiple
+     * of the size of all element types, and keeps the number of
+     * values in a buffer even, as required for normal distributions.
+     */
+    const size_t EXPORT_BUFFER_SIZE = (size_t)1 << 23;
+
+    size_t elementSize(curandExportDistribution_t distribution)
+    {
+        switch (distribution)
+        {
+            case CURAND_EXPORT_UNSIGNED_INT:
+            case CURAND_EXPORT_UNIFORM:
+            case CURAND_EXPORT_NORMAL:
+            case CURAND_EXPORT_LOG_NORMAL:
+                return 4;
+            case CURAND_EXPORT_UNSIGNED_LONG_LONG:
+            case CURAND_EXPORT_UNIFORM_DOUBLE:
+            case CURAND_EXPORT_NORMAL_DOUBLE:
+            case CURAND_EXPORT_LOG_NORMAL_DOUBLE:
+                return 8;
+        }
+        return 0;
+    }
+
+    /**
+     * Returns the NumPy type description of the given distribution,
+     * without the byte order
+     */
+    const char *npyType(curandExportDistribution_t distribution)
+    {
+        switch (distribution)
+        {
+            case CURAND_EXPORT_UNSIGNED_INT: return "u4";
+            case CURAND_EXPORT_UNSIGNED_LONG_LONG: return "u8";
+            case CURAND_EXPORT_UNIFORM_DOUBLE:
+            case CURAND_EXPORT_NORMAL_DOUBLE:
+            case CURAND_EXPORT_LOG_NORMAL_DOUBLE:
+                return "f8";
+            default:
+                return "f4";
+        }
+    }
+
+    curandStatus_t generate(const CurandBackend *backend, curandGenerator_t generator,
+        curandExportDistribution_t distribution, void *output, size_t n, double mean, double stddev)
+    {
+        switch (distribution)
+        {
+            case CURAND_EXPORT_UNSIGNED_INT:
+                return backend->curandGenerate(generator, (unsigned int*)output, n);
+            case CURAND_EXPORT_UNSIGNED_LONG_LONG:
+                return backend->curandGenerateLongLong(generator, (unsigned long long*)output, n);
+            case CURAND_EXPORT_UNIFORM:
+                return backend->curandGenerateUniform(generator, (float*)output, n);
+            case CURAND_EXPORT_UNIFORM_DOUBLE:
+                return backend->curandGenerateUniformDouble(generator, (double*)output, n);
+            case CURAND_EXPORT_NORMAL:
+                return backend->curandGenerateNormal(generator, (float*)output, n, (float)mean, (float)stddev);
+            case CURAND_EXPORT_NORMAL_DOUBLE:
+                return backend->curandGenerateNormalDouble(generator, (double*)output, n, mean, stddev);
+            case CURAND_EXPORT_LOG_NORMAL:
+                return backend->curandGenerateLogNormal(generator, (float*)output, n, (float)mean, (float)stddev);
+            case CURAND_EXPORT_LOG_NORMAL_DOUBLE:
+                return backend->curandGenerateLogNormalDouble(generator, (double*)output, n, mean, stddev);
+        }
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+
+    /**
+     * Creates the header of a .npy file (version 1.0) for a
+     * one-dimensional array with n elements of the given distribution.
+     * The header is padded to a multiple of 64 bytes, so that the
+     * data is aligned.
+     */
+    std::string npyHeader(curandExportDistribution_t distribution, size_t n)
+    {
+        const unsigned short one = 1;
+        bool littleEndian = *(const unsigned char*)&one == 1;
+        std::string dictionary = std::string("{'descr': '") + (littleEndian ? "<" : ">") +
+            npyType(distribution) + "', 'fortran_order': False, 'shape': (" +
+            std::to_string((unsigned long long)n) + ",), }";
+        size_t size = 10 + dictionary.size() + 1;
+        size_t padded = (size + 63) / 64 * 64;
+        dictionary.append(padded - size, ' ');
+        dictionary.push_back('\n');
+        size_t length = padded - 10;
+        std::string header("\x93NUMPY\x01\x00", 8);
+        header.push_back((char)(length & 0xFF));
+        header.push_back((char)(length >> 8));
+        return header + dictionary;
+    }
+
+    /**
+     * A file that is written sequentially. On POSIX systems, the data
+     * is written with pwrite and the file is preallocated, otherwise
+     * with an unbuffered stdio file.
+     */
+    class ExportFile
+    {
+    public:
+        ExportFile() : position(0)
+        {
+#ifdef _WIN32
+            file = NULL;
+#else
+            fd = -1;
+#endif
+        }
+
+        ~ExportFile()
+        {
+            close();
+        }
+
+        bool open(const char *path, unsigned long long size)
+        {
+#ifdef _WIN32
+            file = fopen(path, "wb");
+            if (file == NULL)
+            {
+                return false;
+            }
+            setvbuf(file, NULL, _IONBF, 0);
+#else
+            fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0)
+            {
+                return false;
+            }
+#if defined(__linux__)
+            // Reserve the blocks, so that the file system does not have
+            // to extend the file for each write. Failures are ignored,
+            // because not all file systems support it.
+            if (size > 0)
+            {
+                posix_fallocate(fd, 0, (off_t)size);
+            }
+#else
+            (void)size;
+#endif
+#endif
+            return true;
+        }
+
+        bool write(const void *data, size_t size)
+        {
+            const char *bytes = (const char*)data;
+#ifdef _WIN32
+            if (fwrite(bytes, 1, size, file) != size)
+            {
+                return false;
+            }
+            position += size;
+#else
+            while (size > 0)
+            {
+                ssize_t written = pwrite(fd, bytes, size, (off_t)position);
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    return false;
+                }
+                bytes += written;
+                size -= (size_t)written;
+                position += (unsigned long long)written;
+            }
+#endif
+            return true;
+        }
+
+        bool close()
+        {
+            bool success = true;
+#ifdef _WIN32
+            if (file != NULL)
+            {
+                success = fclose(file) == 0;
+                file = NULL;
+            }
+#else
+            if (fd >= 0)
+            {
+                // Remove the preallocated blocks that have not been
+                // written, if the export failed
+                success = ftruncate(fd, (off_t)position) == 0;
+                success = ::close(fd) == 0 && success;
+                fd = -1;
+            }
+#endif
+            return success;
+        }
+
+    private:
+#ifdef _WIN32
+        FILE *file;
+#else
+        int fd;
+#endif
+        unsigned long long position;
+    };
+
+    /**
+     * The state that is shared between the generating thread and the
+     * writing thread. A buffer is full when it has been generated and
+     * not yet been written.
+     */
+    struct ExportPipeline
+    {
+        std::mutex mutex;
+        std::condition_variable condition;
+        size_t sizes[2];
+        bool full[2];
+        bool done;
+        bool failed;
+    };
+
+    void writeBuffers(ExportPipeline &pipeline, ExportFile &file, unsigned char *buffers[2])
+    {
+        int index = 0;
+        while (true)
+        {
+            size_t size;
+            {
+                std::unique_lock<std::mutex> lock(pipeline.mutex);
+                pipeline.condition.wait(lock, [&] { return pipeline.full[index] || pipeline.done; });
+                if (!pipeline.full[index])
+                {
+                    return;
+                }
+                size = pipeline.sizes[index];
+            }
+            bool written = file.write(buffers[index], size);
+            {
+                std::lock_guard<std::mutex> lock(pipeline.mutex);
+                pipeline.full[index] = false;
+                if (!written)
+                {
+                    pipeline.failed = true;
+                    pipeline.done = true;
+                }
+            }
+            pipeline.condition.notify_all();
+            if (!written)
+            {
+                return;
+            }
+            index = 1 - index;
+        }
+    }
+}
+
+curandStatus_t exportCurandFile(curandGenerator_t generator, const char *path,
+    curandExportDistribution_t distribution, size_t n, double mean, double stddev,
+    curandExportFormat_t format, double *gigabytesPerSecond)
+{
+    size_t size = elementSize(distribution);
+    if (size == 0 || (format != CURAND_EXPORT_FORMAT_RAW && format != CURAND_EXPORT_FORMAT_NPY))
+    {
+        return CURAND_STATUS_OUT_OF_RANGE;
+    }
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandGetGeneratorDimensions != NULL)
+    {
+        unsigned int dimensions = 1;
+        curandStatus_t status = backend->curandGetGeneratorDimensions(generator, &dimensions);
+        if (status != CURAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if (dimensions > 1)
+        {
+            return CURAND_STATUS_TYPE_ERROR;
+        }
+    }
+    std::chrono::steady_clock::time_point before = std::chrono::steady_clock::now();
+
+    std::string header;
+    if (format == CURAND_EXPORT_FORMAT_NPY)
+    {
+        header = npyHeader(distribution, n);
+    }
+    ExportFile file;
+    if (!file.open(path, header.size() + (unsigned long long)n * size) ||
+        !file.write(header.data(), header.size()))
+    {
+        return CURAND_STATUS_INTERNAL_ERROR;
+    }
+
+    size_t bufferValues = EXPORT_BUFFER_SIZE / size;
+    size_t bufferSize = std::min(bufferValues, n) * size;
+    unsigned char *memory = new (std::nothrow) unsigned char[2 * std::max(bufferSize, (size_t)1)];
+    if (memory == NULL)
+    {
+        return CURAND_STATUS_ALLOCATION_FAILED;
+    }
+    unsigned char *buffers[2] = { memory, memory + bufferSize };
+
+    ExportPipeline pipeline;
+    pipeline.full[0] = pipeline.full[1] = false;
+    pipeline.done = pipeline.failed = false;
+    std::thread writer(writeBuffers, std::ref(pipeline), std::ref(file), buffers);
+
+    curandStatus_t result = CURAND_STATUS_SUCCESS;
+    int index = 0;
+    for (size_t i = 0; i < n; i += bufferValues)
+    {
+        {
+            std::unique_lock<std::mutex> lock(pipeline.mutex);
+            pipeline.condition.wait(lock, [&] { return !pipeline.full[index] || pipeline.failed; });
+            if (pipeline.failed)
+            {
+                break;
+            }
+        }
+        size_t count = std::min(bufferValues, n - i);
+        result = generate(backend, generator, distribution, buffers[index], count, mean, stddev);
+        if (result != CURAND_STATUS_SUCCESS)
+        {
+            break;
+        }
+        {
+            std::lock_guard<std::mutex> lock(pipeline.mutex);
+            pipeline.sizes[index] = count * size;
+            pipeline.full[index] = true;
+        }
+        pipeline.condition.notify_all();
+        index = 1 - index;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pipeline.mutex);
+        pipeline.done = true;
+    }
+    pipeline.condition.notify_all();
+    writer.join();
+    delete[] memory;
+
+    bool closed = file.close();
+    if (result != CURAND_STATUS_SUCCESS)
+    {
+        return result;
+    }
+    if (pipeline.failed || !closed)
+    {
+        return CURAND_STATUS_INTERNAL_ERROR;
+    }
+    if (gigabytesPerSecond != NULL)
+    {
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - before;
+        double bytes = (double)header.size() + (double)n * size;
+        *gigabytesPerSecond = seconds.count() > 0 ? bytes / 1e9 / seconds.count() : 0.0;
+    }
+    return CURAND_STATUS_SUCCESS;
+}
@@ -0,0 +1,72 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_EXPORT
+#define JCURAND_EXPORT
+
+#include <stddef.h>
+#include <curand.h>
+#include "JCurandExtensions.hpp"
+
+/**
+ * Generates n values of the given distribution with the given host
+ * generator and writes them into the file with the given path, as
+ * raw values in the byte order of the platform, or as a NumPy .npy
+ * file with a one-dimensional array. The mean and stddev are only
+ * used for the normal and log-normal distributions.
+ *
+ * The values are generated with the functions of the current backend,
+ * one buffer at a time, while a worker thread writes the previous
+ * buffer. For pseudorandom generators, and for quasirandom generators
+ * with one dimension, the file contains the same values as a single
+ * call of the generation function, and n has the same restrictions.
+ * Quasirandom generators with more than one dimension are not
+ * supported, because the buffers do not hold whole points. The CPU
+ * backend rejects them with CURAND_STATUS_TYPE_ERROR. The CUDA backend
+ * can not report the dimensions of a generator, so they are not
+ * detected there.
+ *
+ * The buffers are host memory. A generator that was created with
+ * curandCreateGenerator of the CUDA backend generates into device
+ * memory, and fails with the status of its generation function.
+ *
+ * If gigabytesPerSecond is not NULL, then the number of bytes that
+ * have been written, divided by 1e9 and by the time of the whole call
+ * in seconds, is written to it.
+ *
+ * Returns CURAND_STATUS_OUT_OF_RANGE for an invalid distribution or
+ * format, CURAND_STATUS_TYPE_ERROR for a quasirandom generator with
+ * more than one dimension, the status of the generation function if
+ * it fails, and CURAND_STATUS_INTERNAL_ERROR if the file can not be
+ * written.
+ */
+curandStatus_t exportCurandFile(curandGenerator_t generator, const char *path,
+    curandExportDistribution_t distribution, size_t n, double mean, double stddev,
+    curandExportFormat_t format, double *gigabytesPerSecond);
+
+#endif
@@ -0,0 +1,148 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_EXTENSIONS
+#define JCURAND_EXTENSIONS
+
+#include <curand.h>
+
+/**
+ * Types of the extensions that are not part of CURAND. They are
+ * declared in the style of the CURAND types, and the values of the
+ * enums correspond to the constants in the Java classes with the
+ * same name.
+ */
+
+/**
+ * A multivariate normal distribution, described by its mean vector
+ * and by the Cholesky factor of its covariance matrix
+ */
+struct CpuMultivariateNormal;
+typedef struct CpuMultivariateNormal *curandMultivariateNormal_t;
+
+/**
+ * A Brownian bridge for a fixed time grid
+ */
+struct CpuBrownianBridge;
+typedef struct CpuBrownianBridge *curandBrownianBridge_t;
+
+/**
+ * A memory-mapped file with Sobol direction vectors
+ */
+struct CpuDirectionFile;
+typedef struct CpuDirectionFile *curandDirectionFile_t;
+
+/**
+ * The meaning of the matrix that defines a multivariate normal
+ * distribution
+ */
+enum curandMatrixType
+{
+    CURAND_MATRIX_COVARIANCE = 0,
+    CURAND_MATRIX_CHOLESKY_FACTOR = 1
+};
+typedef enum curandMatrixType curandMatrixType_t;
+
+/**
+ * The layout of the vectors that are generated from a multivariate
+ * distribution
+ */
+enum curandLayout
+{
+    CURAND_LAYOUT_ROW_MAJOR = 0,
+    CURAND_LAYOUT_COLUMN_MAJOR = 1
+};
+typedef enum curandLayout curandLayout_t;
+
+/**
+ * Whether and how a pseudorandom generator writes antithetic pairs
+ */
+enum curandAntitheticMode
+{
+    CURAND_ANTITHETIC_NONE = 0,
+    CURAND_ANTITHETIC_INTERLEAVED = 1,
+    CURAND_ANTITHETIC_BLOCKED = 2
+};
+typedef enum curandAntitheticMode curandAntitheticMode_t;
+
+/**
+ * The kind of the points of a Latin hypercube design
+ */
+enum curandLatinHypercubeMode
+{
+    CURAND_LATIN_HYPERCUBE_RANDOM = 0,
+    CURAND_LATIN_HYPERCUBE_CENTERED = 1,
+    CURAND_LATIN_HYPERCUBE_MAXIMIN = 2
+};
+typedef enum curandLatinHypercubeMode curandLatinHypercubeMode_t;
+
+/**
+ * The quasirandom generator types that are not part of CURAND. They
+ * continue the values of curandRngType.
+ */
+#define CURAND_RNG_QUASI_HALTON ((curandRngType_t)205)
+#define CURAND_RNG_QUASI_LATTICE ((curandRngType_t)206)
+
+/**
+ * The scrambling of the points of a Sobol generator
+ */
+enum curandScramblingMode
+{
+    CURAND_SCRAMBLING_DEFAULT = 0,
+    CURAND_SCRAMBLING_OWEN = 1
+};
+typedef enum curandScramblingMode curandScramblingMode_t;
+
+/**
+ * The values that are written into a file by curandExportToFile,
+ * with the generation function that is used for them
+ */
+enum curandExportDistribution
+{
+    CURAND_EXPORT_UNSIGNED_INT = 0,
+    CURAND_EXPORT_UNSIGNED_LONG_LONG = 1,
+    CURAND_EXPORT_UNIFORM = 2,
+    CURAND_EXPORT_UNIFORM_DOUBLE = 3,
+    CURAND_EXPORT_NORMAL = 4,
+    CURAND_EXPORT_NORMAL_DOUBLE = 5,
+    CURAND_EXPORT_LOG_NORMAL = 6,
+    CURAND_EXPORT_LOG_NORMAL_DOUBLE = 7
+};
+typedef enum curandExportDistribution curandExportDistribution_t;
+
+/**
+ * The format of the files that are written by curandExportToFile
+ */
+enum curandExportFormat
+{
+    CURAND_EXPORT_FORMAT_RAW = 0,
+    CURAND_EXPORT_FORMAT_NPY = 1
+};
+typedef enum curandExportFormat curandExportFormat_t;
+
+#endif
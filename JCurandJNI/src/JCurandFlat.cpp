@@ -0,0 +1,306 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "JCurandFlat.h"
+#include "JCurandBackend.hpp"
+#include "JCurandExport.hpp"
+
+JCURAND_FLAT_API int jcurand_set_backend(int backend)
+{
+    return setCurandBackend(backend) ? CURAND_STATUS_SUCCESS : CURAND_STATUS_TYPE_ERROR;
+}
+
+JCURAND_FLAT_API int jcurand_get_backend(void)
+{
+    return getCurandBackend()->id;
+}
+
+JCURAND_FLAT_API int jcurand_create_generator(void **generator, int rngType)
+{
+    return getCurandBackend()->curandCreateGenerator((curandGenerator_t*)generator, (curandRngType_t)rngType);
+}
+
+JCURAND_FLAT_API int jcurand_create_generator_host(void **generator, int rngType)
+{
+    return getCurandBackend()->curandCreateGeneratorHost((curandGenerator_t*)generator, (curandRngType_t)rngType);
+}
+
+JCURAND_FLAT_API int jcurand_destroy_generator(void *generator)
+{
+    return getCurandBackend()->curandDestroyGenerator((curandGenerator_t)generator);
+}
+
+JCURAND_FLAT_API int jcurand_set_pseudo_random_generator_seed(void *generator, unsigned long long seed)
+{
+    return getCurandBackend()->curandSetPseudoRandomGeneratorSeed((curandGenerator_t)generator, seed);
+}
+
+JCURAND_FLAT_API int jcurand_set_generator_offset(void *generator, unsigned long long offset)
+{
+    return getCurandBackend()->curandSetGeneratorOffset((curandGenerator_t)generator, offset);
+}
+
+JCURAND_FLAT_API int jcurand_set_generator_ordering(void *generator, int order)
+{
+    return getCurandBackend()->curandSetGeneratorOrdering((curandGenerator_t)generator, (curandOrdering_t)order);
+}
+
+JCURAND_FLAT_API int jcurand_set_quasi_random_generator_dimensions(void *generator, unsigned int dimensions)
+{
+    return getCurandBackend()->curandSetQuasiRandomGeneratorDimensions((curandGenerator_t)generator, dimensions);
+}
+
+JCURAND_FLAT_API int jcurand_set_generator_antithetic_mode(void *generator, int mode)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandSetGeneratorAntitheticMode == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandSetGeneratorAntitheticMode((curandGenerator_t)generator, (curandAntitheticMode_t)mode);
+}
+
+JCURAND_FLAT_API int jcurand_set_quasi_random_generator_layout(void *generator, int layout)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandSetQuasiRandomGeneratorLayout == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandSetQuasiRandomGeneratorLayout((curandGenerator_t)generator, (curandLayout_t)layout);
+}
+
+JCURAND_FLAT_API int jcurand_set_generator_concurrent(void *generator, int concurrent)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandSetGeneratorConcurrent == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandSetGeneratorConcurrent((curandGenerator_t)generator, concurrent);
+}
+
+JCURAND_FLAT_API int jcurand_set_generator_thread_lane(void *generator, unsigned int lane)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandSetGeneratorThreadLane == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandSetGeneratorThreadLane((curandGenerator_t)generator, lane);
+}
+
+JCURAND_FLAT_API int jcurand_set_generator_stream(void *generator, unsigned long long seed, const unsigned long long *path, unsigned int depth)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandSetGeneratorStream == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandSetGeneratorStream((curandGenerator_t)generator, seed, path, depth);
+}
+
+JCURAND_FLAT_API int jcurand_set_generator_streams(void **generators, unsigned int count, unsigned long long seed, const unsigned long long *paths, unsigned int depth)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandSetGeneratorStreams == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandSetGeneratorStreams((const curandGenerator_t*)generators, count, seed, paths, depth);
+}
+
+JCURAND_FLAT_API int jcurand_generate(void *generator, unsigned int *output, size_t n)
+{
+    return getCurandBackend()->curandGenerate((curandGenerator_t)generator, output, n);
+}
+
+JCURAND_FLAT_API int jcurand_generate_long_long(void *generator, unsigned long long *output, size_t n)
+{
+    return getCurandBackend()->curandGenerateLongLong((curandGenerator_t)generator, output, n);
+}
+
+JCURAND_FLAT_API int jcurand_generate_uniform(void *generator, float *output, size_t n)
+{
+    return getCurandBackend()->curandGenerateUniform((curandGenerator_t)generator, output, n);
+}
+
+JCURAND_FLAT_API int jcurand_generate_uniform_double(void *generator, double *output, size_t n)
+{
+    return getCurandBackend()->curandGenerateUniformDouble((curandGenerator_t)generator, output, n);
+}
+
+JCURAND_FLAT_API int jcurand_generate_normal(void *generator, float *output, size_t n, float mean, float stddev)
+{
+    return getCurandBackend()->curandGenerateNormal((curandGenerator_t)generator, output, n, mean, stddev);
+}
+
+JCURAND_FLAT_API int jcurand_generate_normal_double(void *generator, double *output, size_t n, double mean, double stddev)
+{
+    return getCurandBackend()->curandGenerateNormalDouble((curandGenerator_t)generator, output, n, mean, stddev);
+}
+
+JCURAND_FLAT_API int jcurand_generate_log_normal(void *generator, float *output, size_t n, float mean, float stddev)
+{
+    return getCurandBackend()->curandGenerateLogNormal((curandGenerator_t)generator, output, n, mean, stddev);
+}
+
+JCURAND_FLAT_API int jcurand_generate_log_normal_double(void *generator, double *output, size_t n, double mean, double stddev)
+{
+    return getCurandBackend()->curandGenerateLogNormalDouble((curandGenerator_t)generator, output, n, mean, stddev);
+}
+
+JCURAND_FLAT_API int jcurand_generate_poisson(void *generator, unsigned int *output, size_t n, double lambda)
+{
+    return getCurandBackend()->curandGeneratePoisson((curandGenerator_t)generator, output, n, lambda);
+}
+
+JCURAND_FLAT_API int jcurand_philox_uniform(unsigned long long seed, unsigned long long subsequence, unsigned long long offset, float *output, size_t n)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandPhiloxUniform == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandPhiloxUniform(seed, subsequence, offset, output, n);
+}
+
+JCURAND_FLAT_API int jcurand_philox_uniform_double(unsigned long long seed, unsigned long long subsequence, unsigned long long offset, double *output, size_t n)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandPhiloxUniformDouble == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandPhiloxUniformDouble(seed, subsequence, offset, output, n);
+}
+
+JCURAND_FLAT_API int jcurand_philox_uniform_gather(unsigned long long seed, unsigned long long subsequence, const unsigned long long *offsets, float *output, size_t n)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandPhiloxUniformGather == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandPhiloxUniformGather(seed, subsequence, offsets, output, n);
+}
+
+JCURAND_FLAT_API int jcurand_philox_uniform_double_gather(unsigned long long seed, unsigned long long subsequence, const unsigned long long *offsets, double *output, size_t n)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandPhiloxUniformDoubleGather == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandPhiloxUniformDoubleGather(seed, subsequence, offsets, output, n);
+}
+
+JCURAND_FLAT_API int jcurand_write_direction_file(const char *joeKuoPath, const char *path, unsigned int bits, unsigned int dimensions)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandWriteDirectionFile == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandWriteDirectionFile(joeKuoPath, path, bits, dimensions);
+}
+
+JCURAND_FLAT_API int jcurand_load_direction_file(void **file, const char *path)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandLoadDirectionFile == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandLoadDirectionFile((curandDirectionFile_t*)file, path);
+}
+
+JCURAND_FLAT_API int jcurand_destroy_direction_file(void *file)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandDestroyDirectionFile == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandDestroyDirectionFile((curandDirectionFile_t)file);
+}
+
+JCURAND_FLAT_API int jcurand_set_quasi_random_generator_direction_file(void *generator, void *file)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandSetQuasiRandomGeneratorDirectionFile == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandSetQuasiRandomGeneratorDirectionFile((curandGenerator_t)generator, (curandDirectionFile_t)file);
+}
+
+JCURAND_FLAT_API int jcurand_set_quasi_random_generator_scrambling(void *generator, int mode, unsigned long long seed)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandSetQuasiRandomGeneratorScrambling == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandSetQuasiRandomGeneratorScrambling((curandGenerator_t)generator, (curandScramblingMode_t)mode, seed);
+}
+
+JCURAND_FLAT_API int jcurand_generate_latin_hypercube(void *generator, double *output, size_t n, unsigned int dimensions, int mode, int layout)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandGenerateLatinHypercube == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandGenerateLatinHypercube((curandGenerator_t)generator, output, n, dimensions, (curandLatinHypercubeMode_t)mode, (curandLayout_t)layout);
+}
+
+JCURAND_FLAT_API int jcurand_generate_uniform_range(void *generator, float *output, size_t n, float a, float b)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandGenerateUniformRange == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandGenerateUniformRange((curandGenerator_t)generator, output, n, a, b);
+}
+
+JCURAND_FLAT_API int jcurand_generate_uniform_range_double(void *generator, double *output, size_t n, double a, double b)
+{
+    const CurandBackend *backend = getCurandBackend();
+    if (backend->curandGenerateUniformRangeDouble == NULL)
+    {
+        return CURAND_STATUS_TYPE_ERROR;
+    }
+    return backend->curandGenerateUniformRangeDouble((curandGenerator_t)generator, output, n, a, b);
+}
+
+JCURAND_FLAT_API int jcurand_export_to_file(void *generator, const char *path, int distribution, size_t n, double mean, double stddev, int format, double *gigabytesPerSecond)
+{
+    return exportCurandFile((curandGenerator_t)generator, path, (curandExportDistribution_t)distribution, n, mean, stddev, (curandExportFormat_t)format, gigabytesPerSecond);
+}
@@ -0,0 +1,280 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCURAND_FLAT
+#define JCURAND_FLAT
+
+#include <stddef.h>
+
+/**
+ * A flat C interface to the functions of JCurand, for callers that do
+ * not use JNI, like the Foreign Function and Memory API of Java. The
+ * functions take the handles that are created with this interface and
+ * plain addresses, and return the curandStatus values. They call the
+ * same backend as the JNI functions, without logging and without any
+ * checks of the arguments, so that the cost of a call is as low as
+ * possible.
+ */
+
+#if defined(_WIN32)
+#define JCURAND_FLAT_API __declspec(dllexport)
+#else
+#define JCURAND_FLAT_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Select the backend, with the values of the JCurandBackend class.
+ * Returns CURAND_STATUS_TYPE_ERROR if the backend is not valid.
+ */
+JCURAND_FLAT_API int jcurand_set_backend(int backend);
+
+/**
+ * Returns the backend that is currently used
+ */
+JCURAND_FLAT_API int jcurand_get_backend(void);
+
+/**
+ * Create a generator that generates into device memory, like
+ * curandCreateGenerator. The handle is written to the given address.
+ */
+JCURAND_FLAT_API int jcurand_create_generator(void **generator, int rngType);
+
+/**
+ * Create a generator that generates into host memory, like
+ * curandCreateGeneratorHost. The handle is written to the given
+ * address.
+ */
+JCURAND_FLAT_API int jcurand_create_generator_host(void **generator, int rngType);
+
+/**
+ * Destroy the given generator
+ */
+JCURAND_FLAT_API int jcurand_destroy_generator(void *generator);
+
+/**
+ * Set the seed of a pseudorandom generator
+ */
+JCURAND_FLAT_API int jcurand_set_pseudo_random_generator_seed(void *generator, unsigned long long seed);
+
+/**
+ * Set the offset of a generator
+ */
+JCURAND_FLAT_API int jcurand_set_generator_offset(void *generator, unsigned long long offset);
+
+/**
+ * Set the ordering of a generator
+ */
+JCURAND_FLAT_API int jcurand_set_generator_ordering(void *generator, int order);
+
+/**
+ * Set the dimensions of a quasirandom generator
+ */
+JCURAND_FLAT_API int jcurand_set_quasi_random_generator_dimensions(void *generator, unsigned int dimensions);
+
+/**
+ * Set the antithetic mode of a pseudorandom generator. Returns
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ * it.
+ */
+JCURAND_FLAT_API int jcurand_set_generator_antithetic_mode(void *generator, int mode);
+
+/**
+ * Set the layout of the points of a quasirandom generator. Returns
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ * it.
+ */
+JCURAND_FLAT_API int jcurand_set_quasi_random_generator_layout(void *generator, int layout);
+
+/**
+ * Set whether a pseudorandom generator is in the concurrent mode,
+ * where each calling thread has its own lane. Returns
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ * it.
+ */
+JCURAND_FLAT_API int jcurand_set_generator_concurrent(void *generator, int concurrent);
+
+/**
+ * Set the lane of the calling thread for a generator in the
+ * concurrent mode. Returns CURAND_STATUS_TYPE_ERROR if the current
+ * backend does not support it.
+ */
+JCURAND_FLAT_API int jcurand_set_generator_thread_lane(void *generator, unsigned int lane);
+
+/**
+ * Set the seed of a pseudorandom generator and the stream for the
+ * given path in the tree of streams below it. Returns
+ * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+ * it.
+ */
+JCURAND_FLAT_API int jcurand_set_generator_stream(void *generator, unsigned long long seed, const unsigned long long *path, unsigned int depth);
+
+/**
+ * Set the streams of the given number of generators, where generator
+ * i gets the path of the given depth that starts at paths[i * depth]
+ */
+JCURAND_FLAT_API int jcurand_set_generator_streams(void **generators, unsigned int count, unsigned long long seed, const unsigned long long *paths, unsigned int depth);
+
+/**
+ * Generate 32 bit words
+ */
+JCURAND_FLAT_API int jcurand_generate(void *generator, unsigned int *output, size_t n);
+
+/**
+ * Generate 64 bit words
+ */
+JCURAND_FLAT_API int jcurand_generate_long_long(void *generator, unsigned long long *output, size_t n);
+
+/**
+ * Generate uniformly distributed floats
+ */
+JCURAND_FLAT_API int jcurand_generate_uniform(void *generator, float *output, size_t n);
+
+/**
+ * Generate uniformly distributed doubles
+ */
+JCURAND_FLAT_API int jcurand_generate_uniform_double(void *generator, double *output, size_t n);
+
+/**
+ * Generate normally distributed floats
+ */
+JCURAND_FLAT_API int jcurand_generate_normal(void *generator, float *output, size_t n, float mean, float stddev);
+
+/**
+ * Generate normally distributed doubles
+ */
+JCURAND_FLAT_API int jcurand_generate_normal_double(void *generator, double *output, size_t n, double mean, double stddev);
+
+/**
+ * Generate log-normally distributed floats
+ */
+JCURAND_FLAT_API int jcurand_generate_log_normal(void *generator, float *output, size_t n, float mean, float stddev);
+
+/**
+ * Generate log-normally distributed doubles
+ */
+JCURAND_FLAT_API int jcurand_generate_log_normal_double(void *generator, double *output, size_t n, double mean, double stddev);
+
+/**
+ * Generate Poisson distributed integers
+ */
+JCURAND_FLAT_API int jcurand_generate_poisson(void *generator, unsigned int *output, size_t n, double lambda);
+
+/**
+ * Generate uniformly distributed floats of the Philox4x32-10 stream
+ * for the given seed and subsequence, starting at the given offset,
+ * without a generator. Returns CURAND_STATUS_TYPE_ERROR if the
+ * current backend does not support it.
+ */
+JCURAND_FLAT_API int jcurand_philox_uniform(unsigned long long seed, unsigned long long subsequence, unsigned long long offset, float *output, size_t n);
+
+/**
+ * Generate uniformly distributed doubles of the Philox4x32-10 stream
+ * for the given seed and subsequence, starting at the given offset,
+ * without a generator
+ */
+JCURAND_FLAT_API int jcurand_philox_uniform_double(unsigned long long seed, unsigned long long subsequence, unsigned long long offset, double *output, size_t n);
+
+/**
+ * Generate uniformly distributed floats of the Philox4x32-10 stream
+ * for the given seed and subsequence at the given offsets, without a
+ * generator
+ */
+JCURAND_FLAT_API int jcurand_philox_uniform_gather(unsigned long long seed, unsigned long long subsequence, const unsigned long long *offsets, float *output, size_t n);
+
+/**
+ * Generate uniformly distributed doubles of the Philox4x32-10 stream
+ * for the given seed and subsequence at the given offsets, without a
+ * generator
+ */
+JCURAND_FLAT_API int jcurand_philox_uniform_double_gather(unsigned long long seed, unsigned long long subsequence, const unsigned long long *offsets, double *output, size_t n);
+
+/**
+ * Convert the table of Sobol direction numbers in the format of Joe
+ * and Kuo at the given path into a direction file with vectors of
+ * the given number of bits, for the given number of dimensions, or
+ * all dimensions of the table if it is 0
+ */
+JCURAND_FLAT_API int jcurand_write_direction_file(const char *joeKuoPath, const char *path, unsigned int bits, unsigned int dimensions);
+
+/**
+ * Map the direction file at the given path into memory. The handle is
+ * written to the given address.
+ */
+JCURAND_FLAT_API int jcurand_load_direction_file(void **file, const char *path);
+
+/**
+ * Unmap the given direction file
+ */
+JCURAND_FLAT_API int jcurand_destroy_direction_file(void *file);
+
+/**
+ * Make a Sobol generator use the vectors of the given direction file,
+ * or the built-in vectors if the file is NULL
+ */
+JCURAND_FLAT_API int jcurand_set_quasi_random_generator_direction_file(void *generator, void *file);
+
+/**
+ * Set the curandScramblingMode of a Sobol generator, with the seed
+ * that the Owen scrambling is derived from
+ */
+JCURAND_FLAT_API int jcurand_set_quasi_random_generator_scrambling(void *generator, int mode, unsigned long long seed);
+
+/**
+ * Generate a Latin hypercube design of n points in the given number
+ * of dimensions, with the given curandLatinHypercubeMode and
+ * curandLayout
+ */
+JCURAND_FLAT_API int jcurand_generate_latin_hypercube(void *generator, double *output, size_t n, unsigned int dimensions, int mode, int layout);
+
+/**
+ * Generate n uniformly distributed values in [a, b), in float or
+ * double precision
+ */
+JCURAND_FLAT_API int jcurand_generate_uniform_range(void *generator, float *output, size_t n, float a, float b);
+JCURAND_FLAT_API int jcurand_generate_uniform_range_double(void *generator, double *output, size_t n, double a, double b);
+
+/**
+ * Generate n values of the given curandExportDistribution with the
+ * given host generator, and write them into the file with the given
+ * path, in the given curandExportFormat. If gigabytesPerSecond is not
+ * NULL, the throughput of the export is written to it. Returns
+ * CURAND_STATUS_TYPE_ERROR for a quasirandom generator with more than
+ * one dimension. A device generator of the CUDA backend can not
+ * generate into the host buffers, and fails.
+ */
+JCURAND_FLAT_API int jcurand_export_to_file(void *generator, const char *path, int distribution, size_t n, double mean, double stddev, int format, double *gigabytesPerSecond);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -58,6 +58,12 @@ public class JCurand
      */
     private static boolean exceptionsEnabled = false;
 
+    /**
+     * The number of values that the methods for Java arrays generate
+     * inside one critical region
+     */
+    private static int heapArrayChunkSize = 1 << 20;
+
     /* Private constructor to prevent instantiation */
     private JCurand()
     {
@@ -83,9 +89,51 @@ public class JCurand
                 LibUtils.createPlatformLibraryName(libraryBaseName);
             LibUtilsCuda.loadLibrary(libraryName);
             initialized = true;
+
+            String backend = 
+                System.getProperty(JCurandBackend.BACKEND_PROPERTY_NAME);
+            if (backend != null)
+            {
+                setBackend(JCurandBackend.forName(backend));
+            }
         }
     }
 
+    /**
+     * Select the backend that executes all CURAND functions. This must
+     * be called before any generator or distribution is created, because
+     * objects that have been created with one backend can not be used
+     * with another one. The backend may also be selected by setting the
+     * system property <code>jcuda.jcurand.backend</code> before this
+     * class is loaded.
+     *
+     * @param backend The {@link JCurandBackend}
+     * @return CURAND_STATUS_SUCCESS, or CURAND_STATUS_TYPE_ERROR if
+     * the given backend is not valid
+     */
+    public static int setBackend(int backend)
+    {
+        return checkResult(setBackendNative(backend));
+    }
+    private static native int setBackendNative(int backend);
+
+    /**
+     * Returns the {@link JCurandBackend} that executes all CURAND
+     * functions.<br />
+     * <br />
+     * The CURAND library is only loaded when it is used for the first
+     * time. If it can not be loaded, then the CPU backend is used 
+     * instead. So unless the CPU backend was selected explicitly, 
+     * calling this method will load the CURAND library.
+     *
+     * @return The backend
+     */
+    public static int getBackend()
+    {
+        return getBackendNative();
+    }
+    private static native int getBackendNative();
+
     /**
      * Set the specified log level for the JCurand library.<br />
      * <br />
@@ -140,6 +188,214 @@ public class JCurand
         return result;
     }
 
+    /**
+     * Set the number of values that the methods for Java arrays, like
+     * {@link #curandGenerateUniformArray}, generate at once. These
+     * methods write the values directly into the array, without copying
+     * it, and hold a critical region of the JVM only while generating
+     * one chunk. The garbage collector is blocked during this time, so
+     * smaller chunks give shorter pauses, and larger chunks give a higher
+     * throughput. Chunks of normally distributed values are rounded to
+     * an even size. The default is 2^20 values.<br>
+     * <br>
+     * The values are generated with one call for each chunk. For
+     * pseudorandom generators, the results are the same as the ones of
+     * a single call. For quasirandom generators, the chunk size must be
+     * a multiple of the dimensions, and the results are only the same
+     * as the ones of a single call if the generator uses the layout
+     * {@link curandLayout#CURAND_LAYOUT_ROW_MAJOR}.
+     *
+     * @param chunkSize The chunk size
+     * @throws IllegalArgumentException If the chunk size is not positive
+     */
+    public static void setHeapArrayChunkSize(int chunkSize)
+    {
+        if (chunkSize <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The chunk size must be positive, but is " + chunkSize);
+        }
+        heapArrayChunkSize = chunkSize;
+    }
+
+    /**
+     * Returns the chunk size that was set with
+     * {@link #setHeapArrayChunkSize(int)}
+     *
+     * @return The chunk size
+     */
+    public static int getHeapArrayChunkSize()
+    {
+        return heapArrayChunkSize;
+    }
+
+    /**
+     * Generates the first n values of the given Java array like
+     * {@link #curandGenerateUniform}, in chunks of the size that was
+     * set with {@link #setHeapArrayChunkSize(int)}.
+     *
+     * @param generator The generator
+     * @param output The array for the results
+     * @param n The number of values
+     * @return The curandStatus
+     */
+    public static int curandGenerateUniformArray(curandGenerator generator, float output[], int n)
+    {
+        return checkResult(curandGenerateUniformArrayNative(generator, output, n, heapArrayChunkSize));
+    }
+    private static native int curandGenerateUniformArrayNative(curandGenerator generator, float output[], int n, int chunkSize);
+
+    /**
+     * Generates the first n values of the given Java array like
+     * {@link #curandGenerateUniformDouble}, in chunks of the size that was
+     * set with {@link #setHeapArrayChunkSize(int)}.
+     *
+     * @param generator The generator
+     * @param output The array for the results
+     * @param n The number of values
+     * @return The curandStatus
+     */
+    public static int curandGenerateUniformDoubleArray(curandGenerator generator, double output[], int n)
+    {
+        return checkResult(curandGenerateUniformDoubleArrayNative(generator, output, n, heapArrayChunkSize));
+    }
+    private static native int curandGenerateUniformDoubleArrayNative(curandGenerator generator, double output[], int n, int chunkSize);
+
+    /**
+     * Generates the first n values of the given Java array like
+     * {@link #curandGenerateNormal}, in chunks of the size that was
+     * set with {@link #setHeapArrayChunkSize(int)}.
+     *
+     * @param generator The generator
+     * @param output The array for the results
+     * @param n The number of values
+     * @param mean The mean of the normal distribution
+     * @param stddev The standard deviation of the normal distribution
+     * @return The curandStatus
+     */
+    public static int curandGenerateNormalArray(curandGenerator generator, float output[], int n, float mean, float stddev)
+    {
+        return checkResult(curandGenerateNormalArrayNative(generator, output, n, mean, stddev, heapArrayChunkSize));
+    }
+    private static native int curandGenerateNormalArrayNative(curandGenerator generator, float output[], int n, float mean, float stddev, int chunkSize);
+
+    /**
+     * Generates the first n values of the given Java array like
+     * {@link #curandGenerateNormalDouble}, in chunks of the size that was
+     * set with {@link #setHeapArrayChunkSize(int)}.
+     *
+     * @param generator The generator
+     * @param output The array for the results
+     * @param n The number of values
+     * @param mean The mean of the normal distribution
+     * @param stddev The standard deviation of the normal distribution
+     * @return The curandStatus
+     */
+    public static int curandGenerateNormalDoubleArray(curandGenerator generator, double output[], int n, double mean, double stddev)
+    {
+        return checkResult(curandGenerateNormalDoubleArrayNative(generator, output, n, mean, stddev, heapArrayChunkSize));
+    }
+    private static native int curandGenerateNormalDoubleArrayNative(curandGenerator generator, double output[], int n, double mean, double stddev, int chunkSize);
+
+    /**
+     * Generates the first n values of the given Java array like
+     * {@link #curandGenerateLogNormal}, in chunks of the size that was
+     * set with {@link #setHeapArrayChunkSize(int)}.
+     *
+     * @param generator The generator
+     * @param output The array for the results
+     * @param n The number of values
+     * @param mean The mean of the associated normal distribution
+     * @param stddev The standard deviation of the associated normal distribution
+     * @return The curandStatus
+     */
+    public static int curandGenerateLogNormalArray(curandGenerator generator, float output[], int n, float mean, float stddev)
+    {
+        return checkResult(curandGenerateLogNormalArrayNative(generator, output, n, mean, stddev, heapArrayChunkSize));
+    }
+    private static native int curandGenerateLogNormalArrayNative(curandGenerator generator, float output[], int n, float mean, float stddev, int chunkSize);
+
+    /**
+     * Generates the first n values of the given Java array like
+     * {@link #curandGenerateLogNormalDouble}, in chunks of the size that was
+     * set with {@link #setHeapArrayChunkSize(int)}.
+     *
+     * @param generator The generator
+     * @param output The array for the results
+     * @param n The number of values
+     * @param mean The mean of the associated normal distribution
+     * @param stddev The standard deviation of the associated normal distribution
+     * @return The curandStatus
+     */
+    public static int curandGenerateLogNormalDoubleArray(curandGenerator generator, double output[], int n, double mean, double stddev)
+    {
+        return checkResult(curandGenerateLogNormalDoubleArrayNative(generator, output, n, mean, stddev, heapArrayChunkSize));
+    }
+    private static native int curandGenerateLogNormalDoubleArrayNative(curandGenerator generator, double output[], int n, double mean, double stddev, int chunkSize);
+
+    /**
+     * Sets the streams of several generators in one call, like
+     * {@link #curandSetGeneratorStream} for each generator. Generator i
+     * gets the stream for the path that consists of the depth elements
+     * of the paths array that start at index i * depth, below the given
+     * seed. This may be used to configure a pool of generators for the
+     * tasks of one job.
+     *
+     * @param generators The generators
+     * @param count The number of generators
+     * @param seed The seed at the root of the tree of streams
+     * @param paths The paths of all generators, one after the other
+     * @param depth The number of indices of each path
+     * @return The curandStatus
+     */
+    public static int curandSetGeneratorStreams(curandGenerator generators[], int count, long seed, long paths[], int depth)
+    {
+        return checkResult(curandSetGeneratorStreamsNative(generators, count, seed, paths, depth));
+    }
+    private static native int curandSetGeneratorStreamsNative(curandGenerator generators[], int count, long seed, long paths[], int depth);
+
+    /**
+     * Generates n values of the given {@link curandExportDistribution}
+     * with the given host generator, and writes them into the file with
+     * the given path, in the given {@link curandExportFormat}. The values
+     * are generated natively, one buffer at a time, while a worker thread
+     * writes the previous buffer, so they are never copied into Java.<br>
+     * <br>
+     * For pseudorandom generators, and for quasirandom generators with
+     * one dimension, the file contains the same values as a single call
+     * of the generation function. Quasirandom generators with more than
+     * one dimension are not supported, because the buffers do not hold
+     * whole points. The CPU backend rejects them with
+     * CURAND_STATUS_TYPE_ERROR. The CUDA backend can not report the
+     * dimensions of a generator, so they are not detected there.<br>
+     * <br>
+     * The buffers are in host memory. The generator has to be created
+     * with {@link #curandCreateGeneratorHost}. A CUDA device generator,
+     * created with {@link #curandCreateGenerator}, is handed these host
+     * buffers, and the export fails with the status of its generation
+     * function.
+     *
+     * @param generator The host generator
+     * @param path The path of the file. An existing file is overwritten.
+     * @param distribution The {@link curandExportDistribution}
+     * @param n The number of values
+     * @param mean The mean of the (associated) normal distribution. Only
+     * used for normal and log-normal distributions.
+     * @param stddev The standard deviation of the (associated) normal
+     * distribution. Only used for normal and log-normal distributions.
+     * @param format The {@link curandExportFormat}
+     * @param gigabytesPerSecond An optional array that receives the
+     * number of gigabytes (10^9 bytes) written per second, or null
+     * @return The curandStatus. CURAND_STATUS_TYPE_ERROR for a quasirandom
+     * generator with more than one dimension, and
+     * CURAND_STATUS_INTERNAL_ERROR if the file could not be written.
+     */
+    public static int curandExportToFile(curandGenerator generator, String path, int distribution, long n, double mean, double stddev, int format, double gigabytesPerSecond[])
+    {
+        return checkResult(curandExportToFileNative(generator, path, distribution, n, mean, stddev, format, gigabytesPerSecond));
+    }
+    private static native int curandExportToFileNative(curandGenerator generator, String path, int distribution, long n, double mean, double stddev, int format, double gigabytesPerSecond[]);
+
 
 
 
@@ -1083,5 +1339,2116 @@ public class JCurand
     }
     private native static int curandGetScrambleConstants64Native(long[][] constants);
 
+    /**
+     * <pre>
+     * Generate uniformly distributed half precision values.
+     *
+     * Use generator to generate num uniformly distributed half precision
+     * values into the host memory at outputPtr. Each value is stored
+     * as the 16 bits of an IEEE 754 half precision value.
+     *
+     * The results are the values of ::curandGenerateUniform, rounded to
+     * the nearest half precision value (ties to even) in the same pass.
+     * Values below 2^-25 are rounded to 0.0.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param num - Number of values to generate
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    16 bit floating point generation
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+     *    not a multiple of the quasirandom dimension
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateUniformHalf(curandGenerator generator, Pointer outputPtr, long num)
+    {
+        return checkResult(curandGenerateUniformHalfNative(generator, outputPtr, num));
+    }
+    private native static int curandGenerateUniformHalfNative(curandGenerator generator, Pointer outputPtr, long num);
+
+    /**
+     * <pre>
+     * Generate uniformly distributed bfloat16 values.
+     *
+     * Use generator to generate num uniformly distributed bfloat16
+     * values into the host memory at outputPtr. Each value is stored
+     * as the 16 bits of a bfloat16 value.
+     *
+     * The results are the values of ::curandGenerateUniform, rounded to
+     * the nearest bfloat16 value (ties to even) in the same pass.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param num - Number of values to generate
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    16 bit floating point generation
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+     *    not a multiple of the quasirandom dimension
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateUniformBF16(curandGenerator generator, Pointer outputPtr, long num)
+    {
+        return checkResult(curandGenerateUniformBF16Native(generator, outputPtr, num));
+    }
+    private native static int curandGenerateUniformBF16Native(curandGenerator generator, Pointer outputPtr, long num);
+
+    /**
+     * <pre>
+     * Generate normally distributed half precision values.
+     *
+     * Use generator to generate n normally distributed half precision
+     * values with mean mean and standard deviation stddev into the
+     * host memory at outputPtr. Each value is stored as the 16 bits
+     * of an IEEE 754 half precision value.
+     *
+     * The results are the values of ::curandGenerateNormal, rounded to
+     * the nearest half precision value (ties to even) in the same pass.
+     * Pseudorandom generators require n to be even.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of values to generate
+     * @param mean - Mean of normal distribution
+     * @param stddev - Standard deviation of normal distribution
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    16 bit floating point generation
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+     *    not a multiple of the quasirandom dimension, or is not even for
+     *    a pseudorandom generator
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateNormalHalf(curandGenerator generator, Pointer outputPtr, long n, float mean, float stddev)
+    {
+        return checkResult(curandGenerateNormalHalfNative(generator, outputPtr, n, mean, stddev));
+    }
+    private native static int curandGenerateNormalHalfNative(curandGenerator generator, Pointer outputPtr, long n, float mean, float stddev);
+
+    /**
+     * <pre>
+     * Generate normally distributed bfloat16 values.
+     *
+     * Use generator to generate n normally distributed bfloat16
+     * values with mean mean and standard deviation stddev into the
+     * host memory at outputPtr. Each value is stored as the 16 bits
+     * of a bfloat16 value.
+     *
+     * The results are the values of ::curandGenerateNormal, rounded to
+     * the nearest bfloat16 value (ties to even) in the same pass.
+     * Pseudorandom generators require n to be even.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of values to generate
+     * @param mean - Mean of normal distribution
+     * @param stddev - Standard deviation of normal distribution
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    16 bit floating point generation
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+     *    not a multiple of the quasirandom dimension, or is not even for
+     *    a pseudorandom generator
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateNormalBF16(curandGenerator generator, Pointer outputPtr, long n, float mean, float stddev)
+    {
+        return checkResult(curandGenerateNormalBF16Native(generator, outputPtr, n, mean, stddev));
+    }
+    private native static int curandGenerateNormalBF16Native(curandGenerator generator, Pointer outputPtr, long n, float mean, float stddev);
+
+    /**
+     * <pre>
+     * Generate uniformly distributed 32-bit integers in a range.
+     *
+     * Use generator to generate n 32-bit integers into the host memory
+     * at outputPtr. The results are uniformly distributed in the range
+     * from lo to hi, including both bounds.
+     *
+     * Pseudorandom generators use Lemire's multiply-shift method, with
+     * a rare rejection that makes the results exactly uniform. For ranges
+     * up to 2^16, each 32-bit value of the generator is used for two
+     * results. Values that have been rejected are replaced by the values
+     * that follow the results in the sequence, so the generator may advance
+     * by slightly more values than the number of results.
+     *
+     * Quasirandom generators scale their values to the range, which
+     * preserves their uniformity.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of integers to generate
+     * @param lo - The smallest value
+     * @param hi - The largest value
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    integer range generation
+     * CURAND_STATUS_OUT_OF_RANGE if hi is smaller than lo
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+     *    not a multiple of the quasirandom dimension
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateIntRange(curandGenerator generator, Pointer outputPtr, long n, int lo, int hi)
+    {
+        return checkResult(curandGenerateIntRangeNative(generator, outputPtr, n, lo, hi));
+    }
+    private native static int curandGenerateIntRangeNative(curandGenerator generator, Pointer outputPtr, long n, int lo, int hi);
+
+    /**
+     * <pre>
+     * Generate uniformly distributed 64-bit integers in a range.
+     *
+     * Use generator to generate n 64-bit integers into the host memory
+     * at outputPtr. The results are uniformly distributed in the range
+     * from lo to hi, including both bounds.
+     *
+     * Pseudorandom generators use Lemire's multiply-shift method, with
+     * a rare rejection that makes the results exactly uniform. For ranges
+     * up to 2^16, each 32-bit value of the generator is used for two
+     * results, and ranges above 2^32 use two 32-bit values for each
+     * result. Values that have been rejected are replaced by the values
+     * that follow the results in the sequence, so the generator may advance
+     * by slightly more values than the number of results.
+     *
+     * Quasirandom generators scale their values to the range, which
+     * preserves their uniformity. The 64-bit quasirandom generators use
+     * their 64-bit values.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of integers to generate
+     * @param lo - The smallest value
+     * @param hi - The largest value
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    integer range generation
+     * CURAND_STATUS_OUT_OF_RANGE if hi is smaller than lo
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+     *    not a multiple of the quasirandom dimension
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateLongLongRange(curandGenerator generator, Pointer outputPtr, long n, long lo, long hi)
+    {
+        return checkResult(curandGenerateLongLongRangeNative(generator, outputPtr, n, lo, hi));
+    }
+    private native static int curandGenerateLongLongRangeNative(curandGenerator generator, Pointer outputPtr, long n, long lo, long hi);
+
+    /**
+     * <pre>
+     * Generate packed Bernoulli distributed bits.
+     *
+     * Use generator to generate nBits bits into the host memory at
+     * outputPtr, where each bit is 1 with the probability p. The bits
+     * are packed into 32-bit integers, starting at the least significant
+     * bit, so the memory must hold (nBits + 31) / 32 integers. Unused bits
+     * of the last integer are set to 0.
+     *
+     * The bits are computed by comparing uniform random numbers with
+     * p, one binary digit at a time, for 32 bits at once. This is exact
+     * for every double value of p. For p = 2^-k with k <= 32, each bit
+     * uses k random bits. Only pseudorandom generators are supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param nBits - Number of bits to generate
+     * @param p - The probability of a bit being 1, in [0, 1]
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    Bernoulli bit generation, or the generator is a quasirandom
+     *    generator
+     * CURAND_STATUS_OUT_OF_RANGE if p is not in [0, 1]
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateBernoulliBits(curandGenerator generator, Pointer outputPtr, long nBits, double p)
+    {
+        return checkResult(curandGenerateBernoulliBitsNative(generator, outputPtr, nBits, p));
+    }
+    private native static int curandGenerateBernoulliBitsNative(curandGenerator generator, Pointer outputPtr, long nBits, double p);
+
+    /**
+     * <pre>
+     * Generate exponentially distributed floats.
+     *
+     * Use generator to generate n floats into the host memory at
+     * outputPtr. The results are exponentially distributed with the rate
+     * lambda, and computed by inversion of uniform values.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of floats to generate
+     * @param lambda - The rate, which is the reciprocal of the mean
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    this distribution
+     * CURAND_STATUS_OUT_OF_RANGE if lambda is not positive
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+     *    not a multiple of the quasirandom dimension
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateExponential(curandGenerator generator, Pointer outputPtr, long n, float lambda)
+    {
+        return checkResult(curandGenerateExponentialNative(generator, outputPtr, n, lambda));
+    }
+    private native static int curandGenerateExponentialNative(curandGenerator generator, Pointer outputPtr, long n, float lambda);
+
+    /**
+     * <pre>
+     * Generate exponentially distributed doubles.
+     *
+     * Use generator to generate n doubles into the host memory at
+     * outputPtr. The results are exponentially distributed with the rate
+     * lambda, and computed by inversion of uniform values.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of doubles to generate
+     * @param lambda - The rate, which is the reciprocal of the mean
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    this distribution
+     * CURAND_STATUS_OUT_OF_RANGE if lambda is not positive
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+     *    not a multiple of the quasirandom dimension
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateExponentialDouble(curandGenerator generator, Pointer outputPtr, long n, double lambda)
+    {
+        return checkResult(curandGenerateExponentialDoubleNative(generator, outputPtr, n, lambda));
+    }
+    private native static int curandGenerateExponentialDoubleNative(curandGenerator generator, Pointer outputPtr, long n, double lambda);
+
+    /**
+     * <pre>
+     * Generate gamma distributed floats.
+     *
+     * Use generator to generate n floats into the host memory at
+     * outputPtr. The results are gamma distributed with the given shape
+     * and scale, and computed with the method of Marsaglia and Tsang.
+     * Values that have been rejected are replaced by values that follow
+     * the results in the sequence, so the generator may advance by
+     * slightly more values than the number of results. Only pseudorandom
+     * generators are supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of floats to generate
+     * @param shape - The shape parameter
+     * @param scale - The scale parameter
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    this distribution, or the generator is a quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if shape or scale is not positive
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateGamma(curandGenerator generator, Pointer outputPtr, long n, float shape, float scale)
+    {
+        return checkResult(curandGenerateGammaNative(generator, outputPtr, n, shape, scale));
+    }
+    private native static int curandGenerateGammaNative(curandGenerator generator, Pointer outputPtr, long n, float shape, float scale);
+
+    /**
+     * <pre>
+     * Generate gamma distributed doubles.
+     *
+     * Use generator to generate n doubles into the host memory at
+     * outputPtr. The results are gamma distributed with the given shape
+     * and scale, and computed with the method of Marsaglia and Tsang.
+     * Values that have been rejected are replaced by values that follow
+     * the results in the sequence, so the generator may advance by
+     * slightly more values than the number of results. Only pseudorandom
+     * generators are supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of doubles to generate
+     * @param shape - The shape parameter
+     * @param scale - The scale parameter
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    this distribution, or the generator is a quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if shape or scale is not positive
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateGammaDouble(curandGenerator generator, Pointer outputPtr, long n, double shape, double scale)
+    {
+        return checkResult(curandGenerateGammaDoubleNative(generator, outputPtr, n, shape, scale));
+    }
+    private native static int curandGenerateGammaDoubleNative(curandGenerator generator, Pointer outputPtr, long n, double shape, double scale);
+
+    /**
+     * <pre>
+     * Generate beta distributed floats.
+     *
+     * Use generator to generate n floats into the host memory at
+     * outputPtr. The results are beta distributed with the shape
+     * parameters alpha and beta, and computed from two gamma distributed
+     * values. Values that have been rejected are replaced by values that
+     * follow the results in the sequence, so the generator may advance by
+     * slightly more values than the number of results. Only pseudorandom
+     * generators are supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of floats to generate
+     * @param alpha - The first shape parameter
+     * @param beta - The second shape parameter
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    this distribution, or the generator is a quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if alpha or beta is not positive
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateBeta(curandGenerator generator, Pointer outputPtr, long n, float alpha, float beta)
+    {
+        return checkResult(curandGenerateBetaNative(generator, outputPtr, n, alpha, beta));
+    }
+    private native static int curandGenerateBetaNative(curandGenerator generator, Pointer outputPtr, long n, float alpha, float beta);
+
+    /**
+     * <pre>
+     * Generate beta distributed doubles.
+     *
+     * Use generator to generate n doubles into the host memory at
+     * outputPtr. The results are beta distributed with the shape
+     * parameters alpha and beta, and computed from two gamma distributed
+     * values. Values that have been rejected are replaced by values that
+     * follow the results in the sequence, so the generator may advance by
+     * slightly more values than the number of results. Only pseudorandom
+     * generators are supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of doubles to generate
+     * @param alpha - The first shape parameter
+     * @param beta - The second shape parameter
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    this distribution, or the generator is a quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if alpha or beta is not positive
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateBetaDouble(curandGenerator generator, Pointer outputPtr, long n, double alpha, double beta)
+    {
+        return checkResult(curandGenerateBetaDoubleNative(generator, outputPtr, n, alpha, beta));
+    }
+    private native static int curandGenerateBetaDoubleNative(curandGenerator generator, Pointer outputPtr, long n, double alpha, double beta);
+
+    /**
+     * <pre>
+     * Generate chi-squared distributed floats.
+     *
+     * Use generator to generate n floats into the host memory at
+     * outputPtr. The results are chi-squared distributed with k degrees of
+     * freedom, and computed as gamma distributed values with the shape k/2
+     * and the scale 2. Values that have been rejected are replaced by
+     * values that follow the results in the sequence, so the generator may
+     * advance by slightly more values than the number of results. Only
+     * pseudorandom generators are supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of floats to generate
+     * @param k - The degrees of freedom, which do not have to be an integer
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    this distribution, or the generator is a quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if k is not positive
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateChiSquared(curandGenerator generator, Pointer outputPtr, long n, float k)
+    {
+        return checkResult(curandGenerateChiSquaredNative(generator, outputPtr, n, k));
+    }
+    private native static int curandGenerateChiSquaredNative(curandGenerator generator, Pointer outputPtr, long n, float k);
+
+    /**
+     * <pre>
+     * Generate chi-squared distributed doubles.
+     *
+     * Use generator to generate n doubles into the host memory at
+     * outputPtr. The results are chi-squared distributed with k degrees of
+     * freedom, and computed as gamma distributed values with the shape k/2
+     * and the scale 2. Values that have been rejected are replaced by
+     * values that follow the results in the sequence, so the generator may
+     * advance by slightly more values than the number of results. Only
+     * pseudorandom generators are supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of doubles to generate
+     * @param k - The degrees of freedom, which do not have to be an integer
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    this distribution, or the generator is a quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if k is not positive
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateChiSquaredDouble(curandGenerator generator, Pointer outputPtr, long n, double k)
+    {
+        return checkResult(curandGenerateChiSquaredDoubleNative(generator, outputPtr, n, k));
+    }
+    private native static int curandGenerateChiSquaredDoubleNative(curandGenerator generator, Pointer outputPtr, long n, double k);
+
+    /**
+     * <pre>
+     * Generate Student's t distributed floats.
+     *
+     * Use generator to generate n floats into the host memory at
+     * outputPtr. The results follow Student's t distribution with nu
+     * degrees of freedom, and are computed from a normal and a gamma
+     * distributed value. Values that have been rejected are replaced by
+     * values that follow the results in the sequence, so the generator may
+     * advance by slightly more values than the number of results. Only
+     * pseudorandom generators are supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of floats to generate
+     * @param nu - The degrees of freedom, which do not have to be an integer
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    this distribution, or the generator is a quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if nu is not positive
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateStudentT(curandGenerator generator, Pointer outputPtr, long n, float nu)
+    {
+        return checkResult(curandGenerateStudentTNative(generator, outputPtr, n, nu));
+    }
+    private native static int curandGenerateStudentTNative(curandGenerator generator, Pointer outputPtr, long n, float nu);
+
+    /**
+     * <pre>
+     * Generate Student's t distributed doubles.
+     *
+     * Use generator to generate n doubles into the host memory at
+     * outputPtr. The results follow Student's t distribution with nu
+     * degrees of freedom, and are computed from a normal and a gamma
+     * distributed value. Values that have been rejected are replaced by
+     * values that follow the results in the sequence, so the generator may
+     * advance by slightly more values than the number of results. Only
+     * pseudorandom generators are supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of doubles to generate
+     * @param nu - The degrees of freedom, which do not have to be an integer
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    this distribution, or the generator is a quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if nu is not positive
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateStudentTDouble(curandGenerator generator, Pointer outputPtr, long n, double nu)
+    {
+        return checkResult(curandGenerateStudentTDoubleNative(generator, outputPtr, n, nu));
+    }
+    private native static int curandGenerateStudentTDoubleNative(curandGenerator generator, Pointer outputPtr, long n, double nu);
+
+    /**
+     * <pre>
+     * Generate truncated normally distributed floats.
+     *
+     * Use generator to generate n floats into the host memory at
+     * outputPtr. The results are normally distributed with the given mean
+     * and standard deviation stddev, conditioned on being in the
+     * interval from lo to hi. The bounds may be infinite.
+     *
+     * For pseudorandom generators, the method depends on the interval:
+     * Intervals that contain at least a quarter of the probability use the
+     * rejection of normal values. Intervals in the tail use the rejection
+     * method of Robert, with an exponential proposal. Other intervals use
+     * the inverse of the cumulative distribution function. Values that
+     * have been rejected are replaced by values that follow the results in
+     * the sequence, so the generator may advance by more values than the
+     * number of results.
+     *
+     * Quasirandom generators always use the inverse of the cumulative
+     * distribution function.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of floats to generate
+     * @param mean - Mean of the normal distribution
+     * @param stddev - Standard deviation of the normal distribution
+     * @param lo - The lower bound of the interval
+     * @param hi - The upper bound of the interval
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    truncated normal generation
+     * CURAND_STATUS_OUT_OF_RANGE if stddev is not positive, or hi is
+     *    smaller than lo
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+     *    not a multiple of the quasirandom dimension
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateTruncatedNormal(curandGenerator generator, Pointer outputPtr, long n, float mean, float stddev, float lo, float hi)
+    {
+        return checkResult(curandGenerateTruncatedNormalNative(generator, outputPtr, n, mean, stddev, lo, hi));
+    }
+    private native static int curandGenerateTruncatedNormalNative(curandGenerator generator, Pointer outputPtr, long n, float mean, float stddev, float lo, float hi);
+
+    /**
+     * <pre>
+     * Generate truncated normally distributed doubles.
+     *
+     * Use generator to generate n doubles into the host memory at
+     * outputPtr. The results are normally distributed with the given mean
+     * and standard deviation stddev, conditioned on being in the
+     * interval from lo to hi. The bounds may be infinite.
+     *
+     * For pseudorandom generators, the method depends on the interval:
+     * Intervals that contain at least a quarter of the probability use the
+     * rejection of normal values. Intervals in the tail use the rejection
+     * method of Robert, with an exponential proposal. Other intervals use
+     * the inverse of the cumulative distribution function. Values that
+     * have been rejected are replaced by values that follow the results in
+     * the sequence, so the generator may advance by more values than the
+     * number of results.
+     *
+     * Quasirandom generators always use the inverse of the cumulative
+     * distribution function.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of doubles to generate
+     * @param mean - Mean of the normal distribution
+     * @param stddev - Standard deviation of the normal distribution
+     * @param lo - The lower bound of the interval
+     * @param hi - The upper bound of the interval
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    truncated normal generation
+     * CURAND_STATUS_OUT_OF_RANGE if stddev is not positive, or hi is
+     *    smaller than lo
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the number of output samples is
+     *    not a multiple of the quasirandom dimension
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateTruncatedNormalDouble(curandGenerator generator, Pointer outputPtr, long n, double mean, double stddev, double lo, double hi)
+    {
+        return checkResult(curandGenerateTruncatedNormalDoubleNative(generator, outputPtr, n, mean, stddev, lo, hi));
+    }
+    private native static int curandGenerateTruncatedNormalDoubleNative(curandGenerator generator, Pointer outputPtr, long n, double mean, double stddev, double lo, double hi);
+
+    /**
+     * <pre>
+     * Construct a multivariate normal distribution.
+     *
+     * Construct the distribution of vectors with dimensions elements that
+     * are normally distributed with the given mean vector and covariance
+     * matrix. The mean is a vector with dimensions elements in host
+     * memory, or null for a mean of zero. The matrix is a row-major matrix
+     * with dimensions rows and columns in host memory. Only its lower
+     * triangle (including the diagonal) is used.
+     *
+     * If the matrixType is CURAND_MATRIX_COVARIANCE, then the matrix is
+     * the covariance matrix, and its Cholesky factor is computed once,
+     * when the distribution is created. If the matrixType is
+     * CURAND_MATRIX_CHOLESKY_FACTOR, then the matrix is the lower
+     * triangular factor L of the covariance matrix L*L^T.
+     *
+     * @param distribution - Pointer to the distribution
+     * @param dimensions - The number of elements of each vector
+     * @param mean - The mean vector in host memory, or null
+     * @param matrix - The matrix in host memory
+     * @param matrixType - The curandMatrixType of the matrix
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    multivariate normal distributions
+     * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated
+     * CURAND_STATUS_OUT_OF_RANGE if the dimensions are zero, the matrix type
+     *    is not valid, or the covariance matrix is not positive definite
+     * CURAND_STATUS_SUCCESS if the distribution was created successfully
+     * </pre>
+     */
+    public static int curandCreateMultivariateNormal(curandMultivariateNormal distribution, int dimensions, Pointer mean, Pointer matrix, int matrixType)
+    {
+        return checkResult(curandCreateMultivariateNormalNative(distribution, dimensions, mean, matrix, matrixType));
+    }
+    private native static int curandCreateMultivariateNormalNative(curandMultivariateNormal distribution, int dimensions, Pointer mean, Pointer matrix, int matrixType);
+
+    /**
+     * <pre>
+     * Destroy a multivariate normal distribution.
+     *
+     * Destroy the distribution that was created with
+     * curandCreateMultivariateNormal.
+     *
+     * @param distribution - The distribution to destroy
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    multivariate normal distributions
+     * CURAND_STATUS_NOT_INITIALIZED if the distribution was never created
+     * CURAND_STATUS_SUCCESS if the distribution was destroyed successfully
+     * </pre>
+     */
+    public static int curandDestroyMultivariateNormal(curandMultivariateNormal distribution)
+    {
+        return checkResult(curandDestroyMultivariateNormalNative(distribution));
+    }
+    private native static int curandDestroyMultivariateNormalNative(curandMultivariateNormal distribution);
+
+    /**
+     * <pre>
+     * Generate multivariate normally distributed floats.
+     *
+     * Use generator to generate n vectors of the given distribution into
+     * the host memory at outputPtr. The output must have space for n times
+     * d floats, where d is the number of dimensions of the distribution.
+     * If the layout is CURAND_LAYOUT_ROW_MAJOR, then each vector is stored
+     * contiguously. If the layout is CURAND_LAYOUT_COLUMN_MAJOR, then each
+     * element of the vectors is stored contiguously, as a column with n
+     * floats.
+     *
+     * The normal samples are generated and transformed with the Cholesky
+     * factor in one pass, in blocks of vectors that remain in the cache.
+     * For pseudorandom generators, each vector consumes the values for an
+     * even number of normal samples. For quasirandom generators, each
+     * vector is one point, and the dimensions of the generator must be the
+     * dimensions of the distribution.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of vectors to generate
+     * @param distribution - The distribution
+     * @param layout - The curandLayout of the results
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator or the distribution was
+     *    never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    multivariate normal distributions
+     * CURAND_STATUS_OUT_OF_RANGE if the layout is not valid
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the dimensions of a quasirandom
+     *    generator are not the dimensions of the distribution
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateMultivariateNormal(curandGenerator generator, Pointer outputPtr, long n, curandMultivariateNormal distribution, int layout)
+    {
+        return checkResult(curandGenerateMultivariateNormalNative(generator, outputPtr, n, distribution, layout));
+    }
+    private native static int curandGenerateMultivariateNormalNative(curandGenerator generator, Pointer outputPtr, long n, curandMultivariateNormal distribution, int layout);
+
+    /**
+     * <pre>
+     * Generate multivariate normally distributed doubles.
+     *
+     * Use generator to generate n vectors of the given distribution into
+     * the host memory at outputPtr. The output must have space for n times
+     * d doubles, where d is the number of dimensions of the distribution.
+     * If the layout is CURAND_LAYOUT_ROW_MAJOR, then each vector is stored
+     * contiguously. If the layout is CURAND_LAYOUT_COLUMN_MAJOR, then each
+     * element of the vectors is stored contiguously, as a column with n
+     * doubles.
+     *
+     * The normal samples are generated and transformed with the Cholesky
+     * factor in one pass, in blocks of vectors that remain in the cache.
+     * For pseudorandom generators, each vector consumes the values for an
+     * even number of normal samples. For quasirandom generators, each
+     * vector is one point, and the dimensions of the generator must be the
+     * dimensions of the distribution.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of vectors to generate
+     * @param distribution - The distribution
+     * @param layout - The curandLayout of the results
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator or the distribution was
+     *    never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    multivariate normal distributions
+     * CURAND_STATUS_OUT_OF_RANGE if the layout is not valid
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the dimensions of a quasirandom
+     *    generator are not the dimensions of the distribution
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateMultivariateNormalDouble(curandGenerator generator, Pointer outputPtr, long n, curandMultivariateNormal distribution, int layout)
+    {
+        return checkResult(curandGenerateMultivariateNormalDoubleNative(generator, outputPtr, n, distribution, layout));
+    }
+    private native static int curandGenerateMultivariateNormalDoubleNative(curandGenerator generator, Pointer outputPtr, long n, curandMultivariateNormal distribution, int layout);
+
+    /**
+     * <pre>
+     * Generate a random permutation of ints.
+     *
+     * Use generator to generate a uniformly distributed random permutation
+     * of the values from 0 to n-1 into the host memory at outputPtr.
+     *
+     * Each value is moved into a bucket that is chosen with 16 random
+     * bits, and each bucket is then shuffled with the Fisher-Yates method,
+     * in the cache. The buckets are shuffled in parallel, and the result
+     * does not depend on the number of threads. The generator is advanced
+     * by n/2 values for the buckets and n values for the shuffle, or 2*n
+     * values if n is larger than 2^32. Only pseudorandom generators are
+     * supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of values to permute
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    permutations, or the generator is a quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if n-1 is not a valid int value
+     * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGeneratePermutation(curandGenerator generator, Pointer outputPtr, long n)
+    {
+        return checkResult(curandGeneratePermutationNative(generator, outputPtr, n));
+    }
+    private native static int curandGeneratePermutationNative(curandGenerator generator, Pointer outputPtr, long n);
+
+    /**
+     * <pre>
+     * Generate a random permutation of long longs.
+     *
+     * Use generator to generate a uniformly distributed random permutation
+     * of the values from 0 to n-1 into the host memory at outputPtr.
+     *
+     * Each value is moved into a bucket that is chosen with 16 random
+     * bits, and each bucket is then shuffled with the Fisher-Yates method,
+     * in the cache. The buckets are shuffled in parallel, and the result
+     * does not depend on the number of threads. The generator is advanced
+     * by n/2 values for the buckets and n values for the shuffle, or 2*n
+     * values if n is larger than 2^32. Only pseudorandom generators are
+     * supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of values to permute
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    permutations, or the generator is a quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if n-1 is not a valid long long value
+     * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGeneratePermutationLongLong(curandGenerator generator, Pointer outputPtr, long n)
+    {
+        return checkResult(curandGeneratePermutationLongLongNative(generator, outputPtr, n));
+    }
+    private native static int curandGeneratePermutationLongLongNative(curandGenerator generator, Pointer outputPtr, long n);
+
+    /**
+     * <pre>
+     * Sample ints without replacement.
+     *
+     * Use generator to choose k distinct values from 0 to n-1, with the
+     * same probability for each subset, and write them in random order
+     * into the host memory at outputPtr.
+     *
+     * If k is more than an eighth of n, then the results are the first k
+     * values of a random permutation of n values, which temporarily
+     * requires memory for n values. Otherwise, the values are chosen with
+     * the algorithm of Floyd, and then permuted. The result does not
+     * depend on the number of threads. Only pseudorandom generators are
+     * supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - The number of values to choose from
+     * @param k - The number of values to choose
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    sampling without replacement, or the generator is a quasirandom
+     *    generator
+     * CURAND_STATUS_OUT_OF_RANGE if k is larger than n, or n-1 is not a
+     *    valid int value
+     * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandSampleWithoutReplacement(curandGenerator generator, Pointer outputPtr, long n, long k)
+    {
+        return checkResult(curandSampleWithoutReplacementNative(generator, outputPtr, n, k));
+    }
+    private native static int curandSampleWithoutReplacementNative(curandGenerator generator, Pointer outputPtr, long n, long k);
+
+    /**
+     * <pre>
+     * Sample long longs without replacement.
+     *
+     * Use generator to choose k distinct values from 0 to n-1, with the
+     * same probability for each subset, and write them in random order
+     * into the host memory at outputPtr.
+     *
+     * If k is more than an eighth of n, then the results are the first k
+     * values of a random permutation of n values, which temporarily
+     * requires memory for n values. Otherwise, the values are chosen with
+     * the algorithm of Floyd, and then permuted. The result does not
+     * depend on the number of threads. Only pseudorandom generators are
+     * supported.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - The number of values to choose from
+     * @param k - The number of values to choose
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    sampling without replacement, or the generator is a quasirandom
+     *    generator
+     * CURAND_STATUS_OUT_OF_RANGE if k is larger than n, or n-1 is not a
+     *    valid long long value
+     * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandSampleWithoutReplacementLongLong(curandGenerator generator, Pointer outputPtr, long n, long k)
+    {
+        return checkResult(curandSampleWithoutReplacementLongLongNative(generator, outputPtr, n, k));
+    }
+    private native static int curandSampleWithoutReplacementLongLongNative(curandGenerator generator, Pointer outputPtr, long n, long k);
+
+    /**
+     * <pre>
+     * Construct a Brownian bridge.
+     *
+     * Construct a Brownian bridge for paths with steps values, at the
+     * given times, which are a strictly increasing array of steps positive
+     * values in host memory, or null for the times 1, 2, ..., steps. The
+     * paths start with the value 0 at the time 0.
+     *
+     * The weights of the bridge are computed once. The value at the last
+     * time is computed from the first normal sample, followed by the
+     * values at the midpoints of the intervals, in breadth-first order, so
+     * that the first samples determine the coarse shape of the paths. With
+     * quasirandom generators, this concentrates the variance of the paths
+     * in the low dimensions.
+     *
+     * @param bridge - Pointer to the bridge
+     * @param steps - The number of values of each path
+     * @param times - The times in host memory, or null
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    Brownian bridges
+     * CURAND_STATUS_ALLOCATION_FAILED if memory could not be allocated
+     * CURAND_STATUS_OUT_OF_RANGE if the steps are zero, or the times are not
+     *    positive and strictly increasing
+     * CURAND_STATUS_SUCCESS if the bridge was created successfully
+     * </pre>
+     */
+    public static int curandCreateBrownianBridge(curandBrownianBridge bridge, int steps, Pointer times)
+    {
+        return checkResult(curandCreateBrownianBridgeNative(bridge, steps, times));
+    }
+    private native static int curandCreateBrownianBridgeNative(curandBrownianBridge bridge, int steps, Pointer times);
+
+    /**
+     * <pre>
+     * Destroy a Brownian bridge.
+     *
+     * Destroy the bridge that was created with curandCreateBrownianBridge.
+     *
+     * @param bridge - The bridge to destroy
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    Brownian bridges
+     * CURAND_STATUS_NOT_INITIALIZED if the bridge was never created
+     * CURAND_STATUS_SUCCESS if the bridge was destroyed successfully
+     * </pre>
+     */
+    public static int curandDestroyBrownianBridge(curandBrownianBridge bridge)
+    {
+        return checkResult(curandDestroyBrownianBridgeNative(bridge));
+    }
+    private native static int curandDestroyBrownianBridgeNative(curandBrownianBridge bridge);
+
+    /**
+     * <pre>
+     * Transform normally distributed floats into Brownian paths.
+     *
+     * Transform the standard normal samples of n paths at data in host
+     * memory into the values of the paths, in place. The samples are given
+     * in the dimension-major order of CURAND, as they are generated by
+     * curandGenerateNormal with a quasirandom generator with as many
+     * dimensions as the bridge has steps: The first n floats are the first
+     * samples of all paths, followed by their second samples, and so on.
+     * Afterwards, the first n floats are the values of all paths at the
+     * first time, and so on.
+     *
+     * The paths are transformed in parallel, in blocks of paths, so that
+     * each step of the bridge is applied to many paths at once.
+     *
+     * @param bridge - The bridge
+     * @param data - Pointer to the samples in host memory
+     * @param n - The number of paths
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    Brownian bridges
+     * CURAND_STATUS_NOT_INITIALIZED if the bridge was never created
+     * CURAND_STATUS_SUCCESS if the paths were transformed successfully
+     * </pre>
+     */
+    public static int curandTransformBrownianBridge(curandBrownianBridge bridge, Pointer data, long n)
+    {
+        return checkResult(curandTransformBrownianBridgeNative(bridge, data, n));
+    }
+    private native static int curandTransformBrownianBridgeNative(curandBrownianBridge bridge, Pointer data, long n);
+
+    /**
+     * <pre>
+     * Transform normally distributed doubles into Brownian paths.
+     *
+     * Transform the standard normal samples of n paths at data in host
+     * memory into the values of the paths, in place. The samples are given
+     * in the dimension-major order of CURAND, as they are generated by
+     * curandGenerateNormal with a quasirandom generator with as many
+     * dimensions as the bridge has steps: The first n doubles are the
+     * first samples of all paths, followed by their second samples, and so
+     * on. Afterwards, the first n doubles are the values of all paths at
+     * the first time, and so on.
+     *
+     * The paths are transformed in parallel, in blocks of paths, so that
+     * each step of the bridge is applied to many paths at once.
+     *
+     * @param bridge - The bridge
+     * @param data - Pointer to the samples in host memory
+     * @param n - The number of paths
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    Brownian bridges
+     * CURAND_STATUS_NOT_INITIALIZED if the bridge was never created
+     * CURAND_STATUS_SUCCESS if the paths were transformed successfully
+     * </pre>
+     */
+    public static int curandTransformBrownianBridgeDouble(curandBrownianBridge bridge, Pointer data, long n)
+    {
+        return checkResult(curandTransformBrownianBridgeDoubleNative(bridge, data, n));
+    }
+    private native static int curandTransformBrownianBridgeDoubleNative(curandBrownianBridge bridge, Pointer data, long n);
+
+    /**
+     * <pre>
+     * Generate Brownian paths of floats.
+     *
+     * Use generator to generate n paths of the given bridge into the host
+     * memory at outputPtr. The output must have space for n times the
+     * number of steps floats. If the layout is CURAND_LAYOUT_ROW_MAJOR,
+     * then each path is stored contiguously. If the layout is
+     * CURAND_LAYOUT_COLUMN_MAJOR, then the values of all paths at one time
+     * are stored contiguously, which is the layout of
+     * curandTransformBrownianBridge.
+     *
+     * The normal samples are generated and transformed in one pass, in
+     * blocks of paths that remain in the cache. For quasirandom
+     * generators, each path is one point, and the dimensions of the
+     * generator must be the steps of the bridge. The results are then the
+     * same as the ones of curandGenerateNormal followed by
+     * curandTransformBrownianBridge. For pseudorandom generators, each
+     * path consumes the values for an even number of normal samples.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of paths to generate
+     * @param bridge - The bridge
+     * @param layout - The curandLayout of the results
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator or the bridge was never
+     *    created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    Brownian bridges
+     * CURAND_STATUS_OUT_OF_RANGE if the layout is not valid
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the dimensions of a quasirandom
+     *    generator are not the steps of the bridge
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateBrownianBridge(curandGenerator generator, Pointer outputPtr, long n, curandBrownianBridge bridge, int layout)
+    {
+        return checkResult(curandGenerateBrownianBridgeNative(generator, outputPtr, n, bridge, layout));
+    }
+    private native static int curandGenerateBrownianBridgeNative(curandGenerator generator, Pointer outputPtr, long n, curandBrownianBridge bridge, int layout);
+
+    /**
+     * <pre>
+     * Generate Brownian paths of doubles.
+     *
+     * Use generator to generate n paths of the given bridge into the host
+     * memory at outputPtr. The output must have space for n times the
+     * number of steps doubles. If the layout is CURAND_LAYOUT_ROW_MAJOR,
+     * then each path is stored contiguously. If the layout is
+     * CURAND_LAYOUT_COLUMN_MAJOR, then the values of all paths at one time
+     * are stored contiguously, which is the layout of
+     * curandTransformBrownianBridge.
+     *
+     * The normal samples are generated and transformed in one pass, in
+     * blocks of paths that remain in the cache. For quasirandom
+     * generators, each path is one point, and the dimensions of the
+     * generator must be the steps of the bridge. The results are then the
+     * same as the ones of curandGenerateNormal followed by
+     * curandTransformBrownianBridge. For pseudorandom generators, each
+     * path consumes the values for an even number of normal samples.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of paths to generate
+     * @param bridge - The bridge
+     * @param layout - The curandLayout of the results
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator or the bridge was never
+     *    created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    Brownian bridges
+     * CURAND_STATUS_OUT_OF_RANGE if the layout is not valid
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the dimensions of a quasirandom
+     *    generator are not the steps of the bridge
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateBrownianBridgeDouble(curandGenerator generator, Pointer outputPtr, long n, curandBrownianBridge bridge, int layout)
+    {
+        return checkResult(curandGenerateBrownianBridgeDoubleNative(generator, outputPtr, n, bridge, layout));
+    }
+    private native static int curandGenerateBrownianBridgeDoubleNative(curandGenerator generator, Pointer outputPtr, long n, curandBrownianBridge bridge, int layout);
+
+    /**
+     * <pre>
+     * Set the antithetic mode of a pseudorandom generator.
+     *
+     * Set the curandAntitheticMode of generator. In the modes
+     * CURAND_ANTITHETIC_INTERLEAVED and CURAND_ANTITHETIC_BLOCKED, the
+     * functions curandGenerateUniform, curandGenerateNormal,
+     * curandGenerateLogNormal and their double versions generate only half
+     * of the requested samples, and write each sample x together with its
+     * antithetic partner in one pass. The partner of a uniform value u is
+     * 1-u, and the partner of a normal value x is 2*mean-x. For log-normal
+     * values, it is the exponential of the partner of the underlying
+     * normal value.
+     *
+     * In the mode CURAND_ANTITHETIC_INTERLEAVED, each sample is directly
+     * followed by its partner. In the mode CURAND_ANTITHETIC_BLOCKED, the
+     * first half of the output contains the samples, and the second half
+     * contains their partners, in the same order. The number of values
+     * must be even, and the generator is advanced only by the values for
+     * the samples. The mode CURAND_ANTITHETIC_NONE, which is the default,
+     * restores the regular behavior. Other generation functions are not
+     * affected by the mode.
+     *
+     * @param generator - Generator to modify
+     * @param mode - The curandAntitheticMode
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    antithetic modes, or the generator is a quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if the mode is not valid
+     * CURAND_STATUS_SUCCESS if the mode was set successfully
+     * </pre>
+     */
+    public static int curandSetGeneratorAntitheticMode(curandGenerator generator, int mode)
+    {
+        return checkResult(curandSetGeneratorAntitheticModeNative(generator, mode));
+    }
+    private native static int curandSetGeneratorAntitheticModeNative(curandGenerator generator, int mode);
+
+    /**
+     * <pre>
+     * Generate uniformly distributed floats into a pitched output.
+     *
+     * Use generator to generate rows times cols uniformly distributed
+     * floats into the rows of the host memory at outputPtr.
+     *
+     * The values are the same as the ones of curandGenerateUniform for
+     * rows times cols values, in the same order. Each row of cols values
+     * is stored at outputPtr plus the row index times pitch, so that a
+     * column of a row-major matrix can be filled with cols=1 and pitch
+     * being the leading dimension. The values of each chunk are computed
+     * in the cache, and then copied to the rows that they cover. The
+     * antithetic mode of the generator is not applied.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param rows - Number of rows
+     * @param cols - Number of values in each row
+     * @param pitch - Number of elements between the starts of two rows
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    pitched output
+     * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+     *    columns
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+     *    generator and rows times cols is not a multiple of the dimensions
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateUniform2D(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch)
+    {
+        return checkResult(curandGenerateUniform2DNative(generator, outputPtr, rows, cols, pitch));
+    }
+    private native static int curandGenerateUniform2DNative(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch);
+
+    /**
+     * <pre>
+     * Generate uniformly distributed doubles into a pitched output.
+     *
+     * Use generator to generate rows times cols uniformly distributed
+     * doubles into the rows of the host memory at outputPtr.
+     *
+     * The values are the same as the ones of curandGenerateUniformDouble
+     * for rows times cols values, in the same order. Each row of cols
+     * values is stored at outputPtr plus the row index times pitch, so
+     * that a column of a row-major matrix can be filled with cols=1 and
+     * pitch being the leading dimension. The values of each chunk are
+     * computed in the cache, and then copied to the rows that they cover.
+     * The antithetic mode of the generator is not applied.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param rows - Number of rows
+     * @param cols - Number of values in each row
+     * @param pitch - Number of elements between the starts of two rows
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    pitched output
+     * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+     *    columns
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+     *    generator and rows times cols is not a multiple of the dimensions
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateUniformDouble2D(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch)
+    {
+        return checkResult(curandGenerateUniformDouble2DNative(generator, outputPtr, rows, cols, pitch));
+    }
+    private native static int curandGenerateUniformDouble2DNative(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch);
+
+    /**
+     * <pre>
+     * Generate normally distributed floats into a pitched output.
+     *
+     * Use generator to generate rows times cols normally distributed
+     * floats with the given mean and stddev into the rows of the host
+     * memory at outputPtr.
+     *
+     * The values are the same as the ones of curandGenerateNormal for rows
+     * times cols values, in the same order. Each row of cols values is
+     * stored at outputPtr plus the row index times pitch, so that a column
+     * of a row-major matrix can be filled with cols=1 and pitch being the
+     * leading dimension. The values of each chunk are computed in the
+     * cache, and then copied to the rows that they cover. The antithetic
+     * mode of the generator is not applied.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param rows - Number of rows
+     * @param cols - Number of values in each row
+     * @param pitch - Number of elements between the starts of two rows
+     * @param mean - Mean of normal distribution
+     * @param stddev - Standard deviation of normal distribution
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    pitched output
+     * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+     *    columns
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+     *    generator and rows times cols is not a multiple of the dimensions
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a pseudorandom
+     *    generator and rows times cols is not a multiple of two
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateNormal2D(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch, float mean, float stddev)
+    {
+        return checkResult(curandGenerateNormal2DNative(generator, outputPtr, rows, cols, pitch, mean, stddev));
+    }
+    private native static int curandGenerateNormal2DNative(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch, float mean, float stddev);
+
+    /**
+     * <pre>
+     * Generate normally distributed doubles into a pitched output.
+     *
+     * Use generator to generate rows times cols normally distributed
+     * doubles with the given mean and stddev into the rows of the host
+     * memory at outputPtr.
+     *
+     * The values are the same as the ones of curandGenerateNormalDouble
+     * for rows times cols values, in the same order. Each row of cols
+     * values is stored at outputPtr plus the row index times pitch, so
+     * that a column of a row-major matrix can be filled with cols=1 and
+     * pitch being the leading dimension. The values of each chunk are
+     * computed in the cache, and then copied to the rows that they cover.
+     * The antithetic mode of the generator is not applied.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param rows - Number of rows
+     * @param cols - Number of values in each row
+     * @param pitch - Number of elements between the starts of two rows
+     * @param mean - Mean of normal distribution
+     * @param stddev - Standard deviation of normal distribution
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    pitched output
+     * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+     *    columns
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+     *    generator and rows times cols is not a multiple of the dimensions
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a pseudorandom
+     *    generator and rows times cols is not a multiple of two
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateNormalDouble2D(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch, double mean, double stddev)
+    {
+        return checkResult(curandGenerateNormalDouble2DNative(generator, outputPtr, rows, cols, pitch, mean, stddev));
+    }
+    private native static int curandGenerateNormalDouble2DNative(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch, double mean, double stddev);
+
+    /**
+     * <pre>
+     * Generate log-normally distributed floats into a pitched output.
+     *
+     * Use generator to generate rows times cols log-normally distributed
+     * floats with the given mean and stddev into the rows of the host
+     * memory at outputPtr.
+     *
+     * The values are the same as the ones of curandGenerateLogNormal for
+     * rows times cols values, in the same order. Each row of cols values
+     * is stored at outputPtr plus the row index times pitch, so that a
+     * column of a row-major matrix can be filled with cols=1 and pitch
+     * being the leading dimension. The values of each chunk are computed
+     * in the cache, and then copied to the rows that they cover. The
+     * antithetic mode of the generator is not applied.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param rows - Number of rows
+     * @param cols - Number of values in each row
+     * @param pitch - Number of elements between the starts of two rows
+     * @param mean - Mean of the associated normal distribution
+     * @param stddev - Standard deviation of the associated normal distribution
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    pitched output
+     * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+     *    columns
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+     *    generator and rows times cols is not a multiple of the dimensions
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a pseudorandom
+     *    generator and rows times cols is not a multiple of two
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateLogNormal2D(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch, float mean, float stddev)
+    {
+        return checkResult(curandGenerateLogNormal2DNative(generator, outputPtr, rows, cols, pitch, mean, stddev));
+    }
+    private native static int curandGenerateLogNormal2DNative(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch, float mean, float stddev);
+
+    /**
+     * <pre>
+     * Generate log-normally distributed doubles into a pitched output.
+     *
+     * Use generator to generate rows times cols log-normally distributed
+     * doubles with the given mean and stddev into the rows of the host
+     * memory at outputPtr.
+     *
+     * The values are the same as the ones of curandGenerateLogNormalDouble
+     * for rows times cols values, in the same order. Each row of cols
+     * values is stored at outputPtr plus the row index times pitch, so
+     * that a column of a row-major matrix can be filled with cols=1 and
+     * pitch being the leading dimension. The values of each chunk are
+     * computed in the cache, and then copied to the rows that they cover.
+     * The antithetic mode of the generator is not applied.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param rows - Number of rows
+     * @param cols - Number of values in each row
+     * @param pitch - Number of elements between the starts of two rows
+     * @param mean - Mean of the associated normal distribution
+     * @param stddev - Standard deviation of the associated normal distribution
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    pitched output
+     * CURAND_STATUS_OUT_OF_RANGE if the pitch is smaller than the number of
+     *    columns
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+     *    generator and rows times cols is not a multiple of the dimensions
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a pseudorandom
+     *    generator and rows times cols is not a multiple of two
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateLogNormalDouble2D(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch, double mean, double stddev)
+    {
+        return checkResult(curandGenerateLogNormalDouble2DNative(generator, outputPtr, rows, cols, pitch, mean, stddev));
+    }
+    private native static int curandGenerateLogNormalDouble2DNative(curandGenerator generator, Pointer outputPtr, long rows, long cols, long pitch, double mean, double stddev);
+
+    /**
+     * <pre>
+     * Set the layout of the points of a quasirandom generator.
+     *
+     * Set the curandLayout in which generator stores the points that are
+     * generated by curandGenerateUniform, curandGenerateNormal and the
+     * other generation functions. The default is
+     * CURAND_LAYOUT_COLUMN_MAJOR, which is the dimension-major order of
+     * CURAND: The first coordinates of all points are followed by their
+     * second coordinates, and so on. With CURAND_LAYOUT_ROW_MAJOR, the
+     * coordinates of each point are stored contiguously, so that each
+     * point is one vector of the given number of dimensions.
+     *
+     * The point-major output is generated directly, by transposing the raw
+     * values of tiles of dimensions in the cache, and does not require a
+     * separate transposition. The values are otherwise the same. Functions
+     * that have their own layout parameter are not affected.
+     *
+     * @param generator - Generator to modify
+     * @param layout - The curandLayout of the points
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    layouts of quasirandom generators, or the generator is not a
+     *    quasirandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if the layout is not valid
+     * CURAND_STATUS_SUCCESS if the layout was set successfully
+     * </pre>
+     */
+    public static int curandSetQuasiRandomGeneratorLayout(curandGenerator generator, int layout)
+    {
+        return checkResult(curandSetQuasiRandomGeneratorLayoutNative(generator, layout));
+    }
+    private native static int curandSetQuasiRandomGeneratorLayoutNative(curandGenerator generator, int layout);
+
+    /**
+     * <pre>
+     * Set whether a pseudorandom generator may be used by several threads at once.
+     *
+     * If concurrent is nonzero, then generator is switched into the
+     * concurrent mode. In this mode, each thread that calls a generation
+     * function with generator gets its own lane: A generator with the same
+     * settings that takes its values from its own subsequence, like a
+     * CURAND device API state that was initialized with curand_init(seed,
+     * lane, 0, &amp;state). The lanes are numbered in the order in which the
+     * threads first use generator, unless a thread chooses its lane with
+     * curandSetGeneratorThreadLane. The threads then generate their values
+     * in parallel, without locks, and the values of each lane only depend
+     * on the seed, the offset and the number of values that have been
+     * generated in the lane before.
+     *
+     * Setting the seed, the offset or the ordering moves all lanes back to
+     * the start of their subsequences. These settings must not be changed
+     * while other threads are generating values. The concurrent mode must
+     * not be switched off or on while other threads are generating values,
+     * but calls that are still running when it is switched off finish in
+     * their lanes. The lanes, also those of threads that have terminated,
+     * are kept until generator is destroyed. Switching the concurrent
+     * mode on again numbers the lanes again, and moves them back to the
+     * start of their subsequences. The concurrent mode is supported for
+     * CURAND_RNG_PSEUDO_XORWOW, CURAND_RNG_PSEUDO_MRG32K3A and
+     * CURAND_RNG_PSEUDO_PHILOX4_32_10.
+     *
+     * @param generator - Generator to modify
+     * @param concurrent - Whether the generator should be in the concurrent mode
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support the
+     *    concurrent mode, or the generator type does not have subsequences
+     * CURAND_STATUS_ALLOCATION_FAILED if the lanes could not be allocated
+     * CURAND_STATUS_SUCCESS if the mode was set successfully
+     * </pre>
+     */
+    public static int curandSetGeneratorConcurrent(curandGenerator generator, int concurrent)
+    {
+        return checkResult(curandSetGeneratorConcurrentNative(generator, concurrent));
+    }
+    private native static int curandSetGeneratorConcurrentNative(curandGenerator generator, int concurrent);
+
+    /**
+     * <pre>
+     * Set the lane of the calling thread for a generator in the concurrent mode.
+     *
+     * Make the calling thread generate its values from the subsequence
+     * lane of generator, starting at the beginning of the subsequence.
+     * This allows each thread to use a fixed lane, for example the index
+     * of a worker, so that the values that each thread receives do not
+     * depend on the order in which the threads start. Different threads
+     * should use different lanes, and threads that choose their lanes
+     * should not be mixed with threads that are numbered automatically.
+     *
+     * @param generator - Generator to modify
+     * @param lane - The lane for the calling thread
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support the
+     *    concurrent mode, or the generator is not in the concurrent mode
+     * CURAND_STATUS_SUCCESS if the lane was set successfully
+     * </pre>
+     */
+    public static int curandSetGeneratorThreadLane(curandGenerator generator, int lane)
+    {
+        return checkResult(curandSetGeneratorThreadLaneNative(generator, lane));
+    }
+    private native static int curandSetGeneratorThreadLaneNative(curandGenerator generator, int lane);
+
+    /**
+     * <pre>
+     * Generate uniformly distributed floats with Philox4x32-10, without a generator.
+     *
+     * Write num uniformly distributed floats to outputPtr that are
+     * computed directly from the seed, the subsequence and the offset,
+     * without creating a generator. The results match the generators of
+     * the type CURAND_RNG_PSEUDO_PHILOX4_32_10 of the CPU backend, and the
+     * stream of a CURAND device API state that was initialized with
+     * curand_init(seed, subsequence, offset, &amp;state): For subsequence
+     * 0, they are the values of a generator of the CPU backend that was
+     * created with the given seed and offset, and other subsequences give
+     * the values of its lanes in the concurrent mode. They are not
+     * necessarily the same as the ones of a CURAND_RNG_PSEUDO_PHILOX4_32_10
+     * generator of the CUDA backend, which distributes the stream over its
+     * threads in its own order.
+     *
+     * Because the Philox4x32-10 generator is counter based, any value of
+     * any stream can be computed without computing the values before it.
+     * This allows many logical streams, for example one for each task of a
+     * simulation, without keeping any state. The blocks are computed four
+     * at a time with SIMD instructions where available.
+     *
+     * @param seed - The seed, which is the Philox key
+     * @param subsequence - The subsequence
+     * @param offset - The position of the first word in the stream
+     * @param outputPtr - Pointer to host memory to store results
+     * @param num - Number of values to generate
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    stateless generation
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandPhiloxUniform(long seed, long subsequence, long offset, Pointer outputPtr, long num)
+    {
+        return checkResult(curandPhiloxUniformNative(seed, subsequence, offset, outputPtr, num));
+    }
+    private native static int curandPhiloxUniformNative(long seed, long subsequence, long offset, Pointer outputPtr, long num);
+
+    /**
+     * <pre>
+     * Generate uniformly distributed doubles with Philox4x32-10, without a generator.
+     *
+     * Write num uniformly distributed doubles to outputPtr that are
+     * computed directly from the seed, the subsequence and the offset,
+     * without creating a generator. The results match the generators of
+     * the type CURAND_RNG_PSEUDO_PHILOX4_32_10 of the CPU backend, and the
+     * stream of a CURAND device API state that was initialized with
+     * curand_init(seed, subsequence, offset, &amp;state): For subsequence
+     * 0, they are the values of a generator of the CPU backend that was
+     * created with the given seed and offset, and other subsequences give
+     * the values of its lanes in the concurrent mode. They are not
+     * necessarily the same as the ones of a CURAND_RNG_PSEUDO_PHILOX4_32_10
+     * generator of the CUDA backend, which distributes the stream over its
+     * threads in its own order.
+     *
+     * Because the Philox4x32-10 generator is counter based, any value of
+     * any stream can be computed without computing the values before it.
+     * This allows many logical streams, for example one for each task of a
+     * simulation, without keeping any state. The blocks are computed four
+     * at a time with SIMD instructions where available.
+     *
+     * @param seed - The seed, which is the Philox key
+     * @param subsequence - The subsequence
+     * @param offset - The position of the first word in the stream
+     * @param outputPtr - Pointer to host memory to store results
+     * @param num - Number of values to generate
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    stateless generation
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandPhiloxUniformDouble(long seed, long subsequence, long offset, Pointer outputPtr, long num)
+    {
+        return checkResult(curandPhiloxUniformDoubleNative(seed, subsequence, offset, outputPtr, num));
+    }
+    private native static int curandPhiloxUniformDoubleNative(long seed, long subsequence, long offset, Pointer outputPtr, long num);
+
+    /**
+     * <pre>
+     * Generate uniformly distributed floats at arbitrary positions with Philox4x32-10, without a generator.
+     *
+     * Write num uniformly distributed floats to outputPtr, where value i
+     * is the value of the stream of curandPhiloxUniform for the given seed
+     * and subsequence at the offset offsets[i]. Each value
+     * consumes one word of the stream, starting at its offset. The offsets
+     * may be in any order, and the blocks for four offsets are computed at
+     * once with SIMD instructions where available.
+     *
+     * @param seed - The seed, which is the Philox key
+     * @param subsequence - The subsequence
+     * @param offsets - Pointer to host memory with the offsets of the values
+     * @param outputPtr - Pointer to host memory to store results
+     * @param num - Number of values to generate
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    stateless generation
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandPhiloxUniformGather(long seed, long subsequence, Pointer offsets, Pointer outputPtr, long num)
+    {
+        return checkResult(curandPhiloxUniformGatherNative(seed, subsequence, offsets, outputPtr, num));
+    }
+    private native static int curandPhiloxUniformGatherNative(long seed, long subsequence, Pointer offsets, Pointer outputPtr, long num);
+
+    /**
+     * <pre>
+     * Generate uniformly distributed doubles at arbitrary positions with Philox4x32-10, without a generator.
+     *
+     * Write num uniformly distributed doubles to outputPtr, where value i
+     * is the value of the stream of curandPhiloxUniformDouble for the
+     * given seed and subsequence at the offset offsets[i]. Each value
+     * consumes two words of the stream, starting at its offset. The
+     * offsets may be in any order, and the blocks for four offsets are
+     * computed at once with SIMD instructions where available.
+     *
+     * @param seed - The seed, which is the Philox key
+     * @param subsequence - The subsequence
+     * @param offsets - Pointer to host memory with the offsets of the values
+     * @param outputPtr - Pointer to host memory to store results
+     * @param num - Number of values to generate
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    stateless generation
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandPhiloxUniformDoubleGather(long seed, long subsequence, Pointer offsets, Pointer outputPtr, long num)
+    {
+        return checkResult(curandPhiloxUniformDoubleGatherNative(seed, subsequence, offsets, outputPtr, num));
+    }
+    private native static int curandPhiloxUniformDoubleGatherNative(long seed, long subsequence, Pointer offsets, Pointer outputPtr, long num);
+
+    /**
+     * <pre>
+     * Compute the subsequence for a path in the tree of streams.
+     *
+     * Write the subsequence that curandSetGeneratorStream uses for the
+     * path of depth indices at path to subsequence. This allows the
+     * stateless functions like curandPhiloxUniform to use the same streams
+     * as a generator. The subsequence for an empty path is 0.
+     *
+     * @param path - Pointer to host memory with the indices of the path
+     * @param depth - The number of indices of the path
+     * @param subsequence - Pointer to host memory to store the subsequence
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    streams
+     * CURAND_STATUS_OUT_OF_RANGE if the path is NULL and the depth is not 0
+     * CURAND_STATUS_SUCCESS if the subsequence was computed successfully
+     * </pre>
+     */
+    public static int curandDeriveStreamSubsequence(Pointer path, int depth, Pointer subsequence)
+    {
+        return checkResult(curandDeriveStreamSubsequenceNative(path, depth, subsequence));
+    }
+    private native static int curandDeriveStreamSubsequenceNative(Pointer path, int depth, Pointer subsequence);
+
+    /**
+     * <pre>
+     * Set the seed of a pseudorandom generator and the stream for a path in a tree of streams.
+     *
+     * Make generator produce the stream for the path of depth indices at
+     * path, which is a hierarchical task id like (job, task, step), below
+     * the given seed. The stream is a subsequence of the generator for the
+     * seed, like for a CURAND device API state that was initialized with
+     * curand_init(seed, subsequence, 0, &amp;state). Each level of the
+     * path mixes its index into the subsequence of the parent with a
+     * bijective function, so that all children of one parent always get
+     * different subsequences, and other paths only get the same
+     * subsequence with a probability of 2^-64. The subsequences are 2^66
+     * (Philox4x32-10), 2^67 (XORWOW) or 2^76 (MRG32k3a) values apart, so
+     * that different streams do not overlap. The empty path gives the
+     * regular stream of the seed.
+     *
+     * The generator is moved back to the start of the stream, and keeps
+     * its offset. In the concurrent mode, lane k uses the subsequence of
+     * the stream plus k. Setting the seed with
+     * curandSetPseudoRandomGeneratorSeed returns the generator to the
+     * regular stream of the seed. Streams are supported for
+     * CURAND_RNG_PSEUDO_XORWOW, CURAND_RNG_PSEUDO_MRG32K3A and
+     * CURAND_RNG_PSEUDO_PHILOX4_32_10.
+     *
+     * @param generator - Generator to modify
+     * @param seed - The seed at the root of the tree
+     * @param path - Pointer to host memory with the indices of the path
+     * @param depth - The number of indices of the path
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    streams, or the generator type does not have subsequences
+     * CURAND_STATUS_OUT_OF_RANGE if the path is NULL and the depth is not 0
+     * CURAND_STATUS_SUCCESS if the stream was set successfully
+     * </pre>
+     */
+    public static int curandSetGeneratorStream(curandGenerator generator, long seed, Pointer path, int depth)
+    {
+        return checkResult(curandSetGeneratorStreamNative(generator, seed, path, depth));
+    }
+    private native static int curandSetGeneratorStreamNative(curandGenerator generator, long seed, Pointer path, int depth);
+
+    /**
+     * <pre>
+     * Convert a table of Sobol direction numbers into a direction file.
+     *
+     * Read the text table at joeKuoPath, in the format of the tables by
+     * Joe and Kuo, and write the Sobol direction vectors with the given
+     * number of bits (32 or 64) for the first dimensions dimensions into a
+     * binary file at path, which can be loaded with
+     * curandLoadDirectionFile. Each line of the table contains the
+     * dimension d (starting at 2), the degree s and the coefficients a of
+     * the primitive polynomial, and the initial direction numbers m_1 ...
+     * m_s. Lines that do not start with a number, like the header line,
+     * are skipped. The first dimension is the van der Corput sequence. If
+     * dimensions is 0, then all dimensions of the table are written.
+     *
+     * The file consists of a header of 64 bytes and the direction vectors
+     * of all dimensions, in the byte order of the platform.
+     *
+     * @param joeKuoPath - The path of the table of direction numbers
+     * @param path - The path of the direction file
+     * @param bits - The number of bits of the direction vectors, 32 or 64
+     * @param dimensions - The number of dimensions, or 0 for all dimensions of the table
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    direction files
+     * CURAND_STATUS_OUT_OF_RANGE if the number of bits is not valid, the
+     *    table contains an invalid line, or it has fewer dimensions than
+     *    requested
+     * CURAND_STATUS_INTERNAL_ERROR if the files can not be read or written
+     * CURAND_STATUS_SUCCESS if the file was written successfully
+     * </pre>
+     */
+    public static int curandWriteDirectionFile(String joeKuoPath, String path, int bits, int dimensions)
+    {
+        return checkResult(curandWriteDirectionFileNative(joeKuoPath, path, bits, dimensions));
+    }
+    private native static int curandWriteDirectionFileNative(String joeKuoPath, String path, int bits, int dimensions);
+
+    /**
+     * <pre>
+     * Load a file with Sobol direction vectors.
+     *
+     * Map the direction file at path, which was written with
+     * curandWriteDirectionFile, into memory, and write a handle for it to
+     * file. The file is mapped read-only and is not copied, so the time
+     * for loading it does not depend on the number of dimensions, and the
+     * pages are only read when the dimensions are used. Processes that
+     * load the same file share its pages.
+     *
+     * @param file - Pointer to the handle of the direction file
+     * @param path - The path of the direction file
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    direction files
+     * CURAND_STATUS_OUT_OF_RANGE if the file is not a valid direction file
+     * CURAND_STATUS_INTERNAL_ERROR if the file can not be mapped
+     * CURAND_STATUS_SUCCESS if the file was loaded successfully
+     * </pre>
+     */
+    public static int curandLoadDirectionFile(curandDirectionFile file, String path)
+    {
+        return checkResult(curandLoadDirectionFileNative(file, path));
+    }
+    private native static int curandLoadDirectionFileNative(curandDirectionFile file, String path);
+
+    /**
+     * <pre>
+     * Destroy a direction file.
+     *
+     * Unmap the direction file that was loaded with
+     * curandLoadDirectionFile. The file must not be used by any generator
+     * any more.
+     *
+     * @param file - The direction file
+     *
+     * @return
+     *
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    direction files
+     * CURAND_STATUS_NOT_INITIALIZED if the file was never loaded
+     * CURAND_STATUS_SUCCESS if the file was destroyed successfully
+     * </pre>
+     */
+    public static int curandDestroyDirectionFile(curandDirectionFile file)
+    {
+        return checkResult(curandDestroyDirectionFileNative(file));
+    }
+    private native static int curandDestroyDirectionFileNative(curandDirectionFile file);
+
+    /**
+     * <pre>
+     * Set the direction vectors of a Sobol generator.
+     *
+     * Make the Sobol generator generator use the direction vectors of the
+     * given direction file, instead of the built-in direction vectors. The
+     * generator uses the mapped vectors directly, and supports as many
+     * dimensions as the file contains, which may be more than the 20000
+     * dimensions of the built-in vectors of CURAND and of the CPU backend.
+     * The
+     * vectors must have 32 bits for CURAND_RNG_QUASI_SOBOL32 and
+     * CURAND_RNG_QUASI_SCRAMBLED_SOBOL32, and 64 bits for
+     * CURAND_RNG_QUASI_SOBOL64 and CURAND_RNG_QUASI_SCRAMBLED_SOBOL64. If
+     * file is NULL, the built-in direction vectors are used again. The
+     * generator is moved back to the start of the sequence.
+     *
+     * @param generator - Generator to modify
+     * @param file - The direction file, or NULL
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    direction files, the generator is not a Sobol generator, or the number
+     *    of bits of the file does not match the generator type
+     * CURAND_STATUS_OUT_OF_RANGE if the generator has more dimensions than
+     *    the direction vectors
+     * CURAND_STATUS_SUCCESS if the direction file was set successfully
+     * </pre>
+     */
+    public static int curandSetQuasiRandomGeneratorDirectionFile(curandGenerator generator, curandDirectionFile file)
+    {
+        return checkResult(curandSetQuasiRandomGeneratorDirectionFileNative(generator, file));
+    }
+    private native static int curandSetQuasiRandomGeneratorDirectionFileNative(curandGenerator generator, curandDirectionFile file);
+
+    /**
+     * <pre>
+     * Set the scrambling of a quasirandom generator.
+     *
+     * With CURAND_SCRAMBLING_OWEN, the points of the Sobol generator
+     * generator are Owen scrambled (nested uniform scrambling): For each
+     * dimension, the digits of each coordinate are flipped depending on
+     * the more significant digits, using a hash of the coordinate and of a
+     * seed for the dimension that is derived from seed. The scrambled
+     * points are still a (t,m,s)-net with the same t, so their
+     * stratification is kept, but the error of integrals of smooth
+     * functions decreases faster than with the digital shift of the
+     * scrambled Sobol types, which the Owen scrambling replaces.
+     * Generators with the same seed produce the same points, independent
+     * of how they are requested.
+     *
+     * With CURAND_SCRAMBLING_DEFAULT, the points are scrambled as defined by
+     * the generator type. For CURAND_RNG_QUASI_HALTON and
+     * CURAND_RNG_QUASI_LATTICE generators, only CURAND_SCRAMBLING_DEFAULT is
+     * supported, and seed selects the random digit permutations of the
+     * Halton sequence or the random shift of the lattice. The generator is
+     * moved back to the start of the sequence.
+     *
+     * @param generator - Generator to modify
+     * @param mode - The curandScramblingMode
+     * @param seed - The seed of the scrambling
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support the
+     *    scrambling, the generator is not a quasirandom generator, or the
+     *    mode is CURAND_SCRAMBLING_OWEN and the generator is not a Sobol
+     *    generator
+     * CURAND_STATUS_OUT_OF_RANGE if the mode is not valid
+     * CURAND_STATUS_SUCCESS if the scrambling was set successfully
+     * </pre>
+     */
+    public static int curandSetQuasiRandomGeneratorScrambling(curandGenerator generator, int mode, long seed)
+    {
+        return checkResult(curandSetQuasiRandomGeneratorScramblingNative(generator, mode, seed));
+    }
+    private native static int curandSetQuasiRandomGeneratorScramblingNative(curandGenerator generator, int mode, long seed);
+
+    /**
+     * <pre>
+     * Generate a Latin hypercube design.
+     *
+     * Use generator to generate n points in dimensions dimensions into the
+     * host memory at outputPtr, so that in each dimension, each of the n
+     * intervals [k/n, (k+1)/n) contains exactly one point. The intervals
+     * of each dimension are assigned to the points by an independent
+     * random permutation. With CURAND_LATIN_HYPERCUBE_RANDOM, each point
+     * is uniformly distributed within its intervals. With
+     * CURAND_LATIN_HYPERCUBE_CENTERED, each point is at the center of its
+     * intervals, with the same permutations as for
+     * CURAND_LATIN_HYPERCUBE_RANDOM. With CURAND_LATIN_HYPERCUBE_MAXIMIN,
+     * 8 random designs are generated, and the one with the largest minimum
+     * distance between two points is written. This takes quadratic time,
+     * and is only supported for at most 65536 points.
+     *
+     * The points are written in the given curandLayout: With
+     * CURAND_LAYOUT_ROW_MAJOR, the coordinates of each point are stored
+     * contiguously, and with CURAND_LAYOUT_COLUMN_MAJOR, the coordinates
+     * of each dimension are stored contiguously. The permutations of the
+     * dimensions are computed in parallel, and the design only depends on
+     * the seed and the position of the generator, and not on the number of
+     * threads.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the n * dimensions results
+     * @param n - Number of points
+     * @param dimensions - Number of dimensions
+     * @param mode - The curandLatinHypercubeMode
+     * @param layout - The curandLayout of the output
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support Latin
+     *    hypercube designs, or the generator is not a pseudorandom generator
+     * CURAND_STATUS_OUT_OF_RANGE if the number of dimensions is 0, the mode
+     *    or layout is not valid, or the mode is CURAND_LATIN_HYPERCUBE_MAXIMIN
+     *    and there are more than 65536 points
+     * CURAND_STATUS_ALLOCATION_FAILED if the memory for the permutations
+     *    could not be allocated
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateLatinHypercube(curandGenerator generator, Pointer outputPtr, long n, int dimensions, int mode, int layout)
+    {
+        return checkResult(curandGenerateLatinHypercubeNative(generator, outputPtr, n, dimensions, mode, layout));
+    }
+    private native static int curandGenerateLatinHypercubeNative(curandGenerator generator, Pointer outputPtr, long n, int dimensions, int mode, int layout);
+
+    /**
+     * <pre>
+     * Generate uniformly distributed floats in a range.
+     *
+     * Use generator to generate n float results into the host memory at
+     * outputPtr. The results are uniformly distributed in [a, b),
+     * excluding b. They are computed from the same random bits as the
+     * results of curandGenerateUniform(), which are uniformly distributed
+     * in (0.0, 1.0], and the mapping to the range is applied in the same
+     * pass. The fraction in [0.0, 1.0) from the upper 32 bits is mapped to
+     * the range, so that a is a possible result, and a result that would
+     * be rounded to b is replaced with the largest float below b.
+     *
+     * For pseudorandom generators in an antithetic mode, n must be even,
+     * and the partner of each result is mirrored in the range. For
+     * quasirandom generators, n must be a multiple of the number of
+     * dimensions.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of floats to generate
+     * @param a - Lower bound of the range, inclusive
+     * @param b - Upper bound of the range, exclusive
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    uniform ranges
+     * CURAND_STATUS_OUT_OF_RANGE if a is not less than b, or one of them is
+     *    not finite
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+     *    generator and n is not a multiple of the number of dimensions, or the
+     *    generator is in an antithetic mode and n is odd
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateUniformRange(curandGenerator generator, Pointer outputPtr, long n, float a, float b)
+    {
+        return checkResult(curandGenerateUniformRangeNative(generator, outputPtr, n, a, b));
+    }
+    private native static int curandGenerateUniformRangeNative(curandGenerator generator, Pointer outputPtr, long n, float a, float b);
+
+    /**
+     * <pre>
+     * Generate uniformly distributed doubles in a range.
+     *
+     * Use generator to generate n double results into the host memory at
+     * outputPtr. The results are uniformly distributed in [a, b),
+     * excluding b. They are computed from the same random bits as the
+     * results of curandGenerateUniformDouble(), which are uniformly
+     * distributed in (0.0, 1.0], and the mapping to the range is applied
+     * in the same pass. The fraction in [0.0, 1.0) from the upper 53 bits
+     * is mapped to the range, so that a is a possible result, and a result
+     * that would be rounded to b is replaced with the largest double below
+     * b.
+     *
+     * For pseudorandom generators in an antithetic mode, n must be even,
+     * and the partner of each result is mirrored in the range. For
+     * quasirandom generators, n must be a multiple of the number of
+     * dimensions.
+     *
+     * @param generator - Generator to use
+     * @param outputPtr - Pointer to host memory to store the results
+     * @param n - Number of doubles to generate
+     * @param a - Lower bound of the range, inclusive
+     * @param b - Upper bound of the range, exclusive
+     *
+     * @return
+     *
+     * CURAND_STATUS_NOT_INITIALIZED if the generator was never created
+     * CURAND_STATUS_TYPE_ERROR if the current backend does not support
+     *    uniform ranges
+     * CURAND_STATUS_OUT_OF_RANGE if a is not less than b, or one of them is
+     *    not finite
+     * CURAND_STATUS_LENGTH_NOT_MULTIPLE if the generator is a quasirandom
+     *    generator and n is not a multiple of the number of dimensions, or the
+     *    generator is in an antithetic mode and n is odd
+     * CURAND_STATUS_SUCCESS if the results were generated successfully
+     * </pre>
+     */
+    public static int curandGenerateUniformRangeDouble(curandGenerator generator, Pointer outputPtr, long n, double a, double b)
+    {
+        return checkResult(curandGenerateUniformRangeDoubleNative(generator, outputPtr, n, a, b));
+    }
+    private native static int curandGenerateUniformRangeDoubleNative(curandGenerator generator, Pointer outputPtr, long n, double a, double b);
+
 
 }
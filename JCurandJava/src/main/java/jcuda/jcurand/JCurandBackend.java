@@ -0,0 +1,104 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcurand;
+
+/**
+ * The backends that may execute the CURAND functions of JCurand.
+ * The backend may be selected with {@link JCurand#setBackend(int)},
+ * or when the library is loaded, by setting the system property
+ * <code>jcuda.jcurand.backend</code> to <code>"CUDA"</code> or
+ * <code>"CPU"</code>.
+ */
+public class JCurandBackend
+{
+    /**
+     * The CURAND library. This is the default backend.
+     */
+    public static final int JCURAND_BACKEND_CUDA = 0;
+
+    /**
+     * The CPU emulation of the CURAND host API, which does not require
+     * a CUDA capable device. All generators of this backend are host
+     * generators, so all output pointers must point to host memory.
+     * The sequences are statistically equivalent to, but not the same
+     * as the sequences of CURAND.
+     */
+    public static final int JCURAND_BACKEND_CPU = 1;
+
+    /**
+     * The name of the system property that selects the backend when
+     * the library is loaded
+     */
+    public static final String BACKEND_PROPERTY_NAME = "jcuda.jcurand.backend";
+
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private JCurandBackend()
+    {
+        // Private constructor to prevent instantiation
+    }
+
+    /**
+     * Returns the backend constant for the given name, which is the
+     * name of the constant without the <code>JCURAND_BACKEND_</code>
+     * prefix, ignoring the case.
+     *
+     * @param name The name
+     * @return The backend constant
+     * @throws IllegalArgumentException If the name is not valid
+     */
+    public static int forName(String name)
+    {
+        if ("CUDA".equalsIgnoreCase(name))
+        {
+            return JCURAND_BACKEND_CUDA;
+        }
+        if ("CPU".equalsIgnoreCase(name))
+        {
+            return JCURAND_BACKEND_CPU;
+        }
+        throw new IllegalArgumentException("Invalid JCurand backend: " + name);
+    }
+
+    /**
+     * Returns a string representation of the given constant
+     *
+     * @return A string representation of the given constant
+     */
+    public static String stringFor(int n)
+    {
+        switch (n)
+        {
+            case JCURAND_BACKEND_CUDA: return "JCURAND_BACKEND_CUDA";
+            case JCURAND_BACKEND_CPU: return "JCURAND_BACKEND_CPU";
+        }
+        return "INVALID JCurandBackend: "+n;
+    }
+}
+
@@ -0,0 +1,100 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcurand;
+
+/**
+ * The values that are written into a file by curandExportToFile. This
+ * is an extension that is not part of CURAND.
+ *
+ * @see JCurand#curandExportToFile
+ */
+public class curandExportDistribution
+{
+    /**
+     * 32 bit integers, as generated by curandGenerate
+     */
+    public static final int CURAND_EXPORT_UNSIGNED_INT = 0;
+    /**
+     * 64 bit integers, as generated by curandGenerateLongLong
+     */
+    public static final int CURAND_EXPORT_UNSIGNED_LONG_LONG = 1;
+    /**
+     * Uniformly distributed floats
+     */
+    public static final int CURAND_EXPORT_UNIFORM = 2;
+    /**
+     * Uniformly distributed doubles
+     */
+    public static final int CURAND_EXPORT_UNIFORM_DOUBLE = 3;
+    /**
+     * Normally distributed floats
+     */
+    public static final int CURAND_EXPORT_NORMAL = 4;
+    /**
+     * Normally distributed doubles
+     */
+    public static final int CURAND_EXPORT_NORMAL_DOUBLE = 5;
+    /**
+     * Log-normally distributed floats
+     */
+    public static final int CURAND_EXPORT_LOG_NORMAL = 6;
+    /**
+     * Log-normally distributed doubles
+     */
+    public static final int CURAND_EXPORT_LOG_NORMAL_DOUBLE = 7;
+
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private curandExportDistribution()
+    {
+        // Private constructor to prevent instantiation
+    }
+
+    /**
+     * Returns a string representation of the given constant
+     *
+     * @return A string representation of the given constant
+     */
+    public static String stringFor(int n)
+    {
+        switch (n)
+        {
+            case CURAND_EXPORT_UNSIGNED_INT: return "CURAND_EXPORT_UNSIGNED_INT";
+            case CURAND_EXPORT_UNSIGNED_LONG_LONG: return "CURAND_EXPORT_UNSIGNED_LONG_LONG";
+            case CURAND_EXPORT_UNIFORM: return "CURAND_EXPORT_UNIFORM";
+            case CURAND_EXPORT_UNIFORM_DOUBLE: return "CURAND_EXPORT_UNIFORM_DOUBLE";
+            case CURAND_EXPORT_NORMAL: return "CURAND_EXPORT_NORMAL";
+            case CURAND_EXPORT_NORMAL_DOUBLE: return "CURAND_EXPORT_NORMAL_DOUBLE";
+            case CURAND_EXPORT_LOG_NORMAL: return "CURAND_EXPORT_LOG_NORMAL";
+            case CURAND_EXPORT_LOG_NORMAL_DOUBLE: return "CURAND_EXPORT_LOG_NORMAL_DOUBLE";
+        }
+        return "INVALID curandExportDistribution: "+n;
+    }
+}
+
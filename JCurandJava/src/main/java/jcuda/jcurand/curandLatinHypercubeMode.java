@@ -0,0 +1,75 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcurand;
+
+/**
+ * The kind of the points of a Latin hypercube design. This is an
+ * extension that is not part of CURAND.
+ *
+ * @see JCurand#curandGenerateLatinHypercube
+ */
+public class curandLatinHypercubeMode
+{
+    /**
+     * Each point is uniformly distributed within its strata
+     */
+    public static final int CURAND_LATIN_HYPERCUBE_RANDOM = 0;
+    /**
+     * Each point is at the center of its strata
+     */
+    public static final int CURAND_LATIN_HYPERCUBE_CENTERED = 1;
+    /**
+     * The random design with the largest minimum distance between its
+     * points, out of several candidates
+     */
+    public static final int CURAND_LATIN_HYPERCUBE_MAXIMIN = 2;
+
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private curandLatinHypercubeMode()
+    {
+        // Private constructor to prevent instantiation
+    }
+
+    /**
+     * Returns a string representation of the given constant
+     *
+     * @return A string representation of the given constant
+     */
+    public static String stringFor(int n)
+    {
+        switch (n)
+        {
+            case CURAND_LATIN_HYPERCUBE_RANDOM: return "CURAND_LATIN_HYPERCUBE_RANDOM";
+            case CURAND_LATIN_HYPERCUBE_CENTERED: return "CURAND_LATIN_HYPERCUBE_CENTERED";
+            case CURAND_LATIN_HYPERCUBE_MAXIMIN: return "CURAND_LATIN_HYPERCUBE_MAXIMIN";
+        }
+        return "INVALID curandLatinHypercubeMode: "+n;
+    }
+}
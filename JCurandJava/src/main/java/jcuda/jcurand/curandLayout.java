@@ -0,0 +1,73 @@
+/*
+ * JCurand - Java bindings for CURAND, the NVIDIA CUDA random
+ * number generation library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcurand;
+
+/**
+ * The layout of the vectors that are generated from a multivariate
+ * distribution, a Brownian bridge or a quasirandom generator. This is
+ * an extension that is not part of CURAND.
+ *
+ * @see JCurand#curandGenerateMultivariateNormal
+ * @see JCurand#curandGenerateBrownianBridge
+ * @see JCurand#curandSetQuasiRandomGeneratorLayout
+ */
+public class curandLayout
+{
+    /**
+     * Each vector is stored contiguously
+     */
+    public static final int CURAND_LAYOUT_ROW_MAJOR = 0;
+    /**
+     * Each element of the vectors is stored contiguously, as a column
+     */
+    public static final int CURAND_LAYOUT_COLUMN_MAJOR = 1;
+
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private curandLayout()
+    {
+        // Private constructor to prevent instantiation
+    }
+
+    /**
+     * Returns a string representation of the given constant
+     *
+     * @return A string representation of the given constant
+     */
+    public static String stringFor(int n)
+    {
+        switch (n)
+        {
+            case CURAND_LAYOUT_ROW_MAJOR: return "CURAND_LAYOUT_ROW_MAJOR";
+            case CURAND_LAYOUT_COLUMN_MAJOR: return "CURAND_LAYOUT_COLUMN_MAJOR";
+        }
+        return "INVALID curandLayout: "+n;
+    }
+}
+
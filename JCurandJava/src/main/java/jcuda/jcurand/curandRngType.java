@@ -77,6 +77,18 @@ public class curandRngType
      * Scrambled Sobol64 quasirandom generator
      */
     public static final int CURAND_RNG_QUASI_SCRAMBLED_SOBOL64 = 204;
+    /**
+     * Halton quasirandom generator, with random digit permutations.
+     * This is an extension that is not part of CURAND, and is only
+     * supported by the CPU backend.
+     */
+    public static final int CURAND_RNG_QUASI_HALTON = 205;
+    /**
+     * Extensible rank-1 lattice quasirandom generator, with a random
+     * shift. This is an extension that is not part of CURAND, and is
+     * only supported by the CPU backend.
+     */
+    public static final int CURAND_RNG_QUASI_LATTICE = 206;
 
     /**
      * Private constructor to prevent instantiation
@@ -103,6 +115,8 @@ public class curandRngType
             case CURAND_RNG_QUASI_SCRAMBLED_SOBOL32: return "CURAND_RNG_QUASI_SCRAMBLED_SOBOL32";
             case CURAND_RNG_QUASI_SOBOL64: return "CURAND_RNG_QUASI_SOBOL64";
             case CURAND_RNG_QUASI_SCRAMBLED_SOBOL64: return "CURAND_RNG_QUASI_SCRAMBLED_SOBOL64";
+            case CURAND_RNG_QUASI_HALTON: return "CURAND_RNG_QUASI_HALTON";
+            case CURAND_RNG_QUASI_LATTICE: return "CURAND_RNG_QUASI_LATTICE";
         }
         return "INVALID curandRngType";
     }
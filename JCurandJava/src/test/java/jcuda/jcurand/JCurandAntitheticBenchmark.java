@@ -0,0 +1,79 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateNormal;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandSetGeneratorAntitheticMode;
+import static jcuda.jcurand.curandAntitheticMode.CURAND_ANTITHETIC_BLOCKED;
+import static jcuda.jcurand.curandAntitheticMode.CURAND_ANTITHETIC_INTERLEAVED;
+import static jcuda.jcurand.curandAntitheticMode.CURAND_ANTITHETIC_NONE;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the cost per value of curandGenerateUniform and
+ * curandGenerateNormal with independent samples, to the antithetic
+ * modes, and to computing the antithetic partners in Java. Requires the
+ * CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandAntitheticBenchmark
+ * </pre>
+ */
+public class JCurandAntitheticBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int n = 1 << 24;
+        int runs = 10;
+        float data[] = new float[n];
+        int modes[] = { CURAND_ANTITHETIC_NONE,
+            CURAND_ANTITHETIC_INTERLEAVED, CURAND_ANTITHETIC_BLOCKED };
+        for (int mode : modes)
+        {
+            curandGenerator generator = new curandGenerator();
+            curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+            curandSetGeneratorAntitheticMode(generator, mode);
+            curandGenerateNormal(generator, Pointer.to(data), n, 0.0f, 1.0f);
+            long before = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateUniform(generator, Pointer.to(data), n);
+            }
+            long afterUniform = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateNormal(
+                    generator, Pointer.to(data), n, 0.0f, 1.0f);
+            }
+            long afterNormal = System.nanoTime();
+            curandDestroyGenerator(generator);
+
+            double count = (double)n * runs;
+            System.out.printf("%-29s uniform %5.2f ns, normal %5.2f ns%n",
+                curandAntitheticMode.stringFor(mode) + ":",
+                (afterUniform - before) / count,
+                (afterNormal - afterUniform) / count);
+        }
+
+        // Half of the samples, with the partners written in Java
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        long before = System.nanoTime();
+        for (int r = 0; r < runs; r++)
+        {
+            curandGenerateNormal(
+                generator, Pointer.to(data), n / 2, 0.0f, 1.0f);
+            for (int i = 0; i < n / 2; i++)
+            {
+                data[n / 2 + i] = -data[i];
+            }
+        }
+        long after = System.nanoTime();
+        curandDestroyGenerator(generator);
+        System.out.printf("%-29s normal %5.2f ns%n", "partners in Java:",
+            (after - before) / ((double)n * runs));
+    }
+}
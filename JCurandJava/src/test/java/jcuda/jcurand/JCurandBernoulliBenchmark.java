@@ -0,0 +1,70 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateBernoulliBits;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the generation of packed Bernoulli bits with
+ * curandGenerateBernoulliBits to the generation of uniform floats
+ * with curandGenerateUniform, followed by a comparison to the
+ * probability and the packing of the bits in Java. Requires the
+ * CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandBernoulliBenchmark
+ * </pre>
+ */
+public class JCurandBernoulliBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int nBits = 1 << 25;
+        int runs = 10;
+        double probabilities[] = { 0.5, 0.25, 0.3, 0.001 };
+        float uniform[] = new float[nBits];
+        int result[] = new int[nBits / 32];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        for (double p : probabilities)
+        {
+            long checksum = 0;
+            long before = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateUniform(generator, Pointer.to(uniform), nBits);
+                for (int w = 0; w < result.length; w++)
+                {
+                    int bits = 0;
+                    for (int b = 0; b < 32; b++)
+                    {
+                        if (uniform[w * 32 + b] <= p)
+                        {
+                            bits |= 1 << b;
+                        }
+                    }
+                    result[w] = bits;
+                }
+                checksum += Integer.bitCount(result[result.length - 1]);
+            }
+            long afterCompare = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateBernoulliBits(
+                    generator, Pointer.to(result), nBits, p);
+                checksum += Integer.bitCount(result[result.length - 1]);
+            }
+            long afterBernoulli = System.nanoTime();
+            double bits = (double)nBits * runs;
+            System.out.printf("p=%-6s: float compare %8.3f Gbit/s, "
+                + "curandGenerateBernoulliBits %8.3f Gbit/s (%d)%n", p,
+                bits / (afterCompare - before),
+                bits / (afterBernoulli - afterCompare), checksum);
+        }
+        curandDestroyGenerator(generator);
+    }
+}
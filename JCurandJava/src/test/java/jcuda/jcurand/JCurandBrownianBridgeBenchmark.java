@@ -0,0 +1,161 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateBrownianBridge;
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyBrownianBridge;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateBrownianBridge;
+import static jcuda.jcurand.JCurand.curandGenerateNormal;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorDimensions;
+import static jcuda.jcurand.JCurand.curandTransformBrownianBridge;
+import static jcuda.jcurand.curandLayout.CURAND_LAYOUT_COLUMN_MAJOR;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_SOBOL32;
+
+import java.util.ArrayDeque;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the cost per path value of a Brownian bridge in Java, applied
+ * to the results of curandGenerateNormal with a Sobol generator, to
+ * curandTransformBrownianBridge and to curandGenerateBrownianBridge.
+ * Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandBrownianBridgeBenchmark
+ * </pre>
+ */
+public class JCurandBrownianBridgeBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int values = 1 << 22;
+        int runs = 5;
+        int stepCounts[] = { 16, 64, 256 };
+        for (int steps : stepCounts)
+        {
+            int n = values / steps;
+            float data[] = new float[n * steps];
+            curandGenerator generator = new curandGenerator();
+            curandCreateGeneratorHost(generator, CURAND_RNG_QUASI_SOBOL32);
+            curandSetQuasiRandomGeneratorDimensions(generator, steps);
+            curandBrownianBridge bridge = new curandBrownianBridge();
+            curandCreateBrownianBridge(bridge, steps, null);
+            JavaBridge javaBridge = new JavaBridge(steps);
+
+            long javaNanos = 0;
+            long transformNanos = 0;
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateNormal(
+                    generator, Pointer.to(data), n * steps, 0.0f, 1.0f);
+                long before = System.nanoTime();
+                javaBridge.transform(data, n);
+                javaNanos += System.nanoTime() - before;
+            }
+            long beforeNormal = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateNormal(
+                    generator, Pointer.to(data), n * steps, 0.0f, 1.0f);
+                long before = System.nanoTime();
+                curandTransformBrownianBridge(bridge, Pointer.to(data), n);
+                transformNanos += System.nanoTime() - before;
+            }
+            long afterNormal = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateBrownianBridge(generator, Pointer.to(data), n,
+                    bridge, CURAND_LAYOUT_COLUMN_MAJOR);
+            }
+            long afterFused = System.nanoTime();
+            curandDestroyBrownianBridge(bridge);
+            curandDestroyGenerator(generator);
+
+            double count = (double)n * steps * runs;
+            System.out.printf("steps=%3d: bridge in Java %6.2f ns, "
+                + "curandTransformBrownianBridge %6.2f ns, normal and "
+                + "transform %6.2f ns, curandGenerateBrownianBridge %6.2f ns%n",
+                steps, javaNanos / count, transformNanos / count,
+                (afterNormal - beforeNormal) / count,
+                (afterFused - afterNormal) / count);
+        }
+    }
+
+    /**
+     * A straightforward Brownian bridge for the times 1, 2, ..., steps,
+     * which constructs one path after the other
+     */
+    private static class JavaBridge
+    {
+        private final int steps;
+        private final int index[];
+        private final int left[];
+        private final int right[];
+        private final float weights[];
+
+        JavaBridge(int steps)
+        {
+            this.steps = steps;
+            index = new int[steps];
+            left = new int[steps];
+            right = new int[steps];
+            weights = new float[3 * steps];
+            index[0] = steps - 1;
+            left[0] = -1;
+            right[0] = -1;
+            weights[2] = (float)Math.sqrt(steps);
+            int k = 1;
+            ArrayDeque<int[]> intervals = new ArrayDeque<int[]>();
+            intervals.add(new int[] { -1, steps - 1 });
+            while (!intervals.isEmpty())
+            {
+                int interval[] = intervals.poll();
+                int l = interval[0];
+                int r = interval[1];
+                if (r - l < 2)
+                {
+                    continue;
+                }
+                int m = l + (r - l) / 2;
+                double tl = l + 1;
+                double tm = m + 1;
+                double tr = r + 1;
+                index[k] = m;
+                left[k] = l;
+                right[k] = r;
+                weights[3 * k] = (float)((tr - tm) / (tr - tl));
+                weights[3 * k + 1] = (float)((tm - tl) / (tr - tl));
+                weights[3 * k + 2] =
+                    (float)Math.sqrt((tm - tl) * (tr - tm) / (tr - tl));
+                k++;
+                intervals.add(new int[] { l, m });
+                intervals.add(new int[] { m, r });
+            }
+        }
+
+        void transform(float data[], int n)
+        {
+            float z[] = new float[steps];
+            float w[] = new float[steps];
+            for (int p = 0; p < n; p++)
+            {
+                for (int k = 0; k < steps; k++)
+                {
+                    z[k] = data[k * n + p];
+                }
+                for (int k = 0; k < steps; k++)
+                {
+                    float wl = left[k] < 0 ? 0.0f : w[left[k]];
+                    float wr = right[k] < 0 ? 0.0f : w[right[k]];
+                    w[index[k]] = weights[3 * k] * wl
+                        + weights[3 * k + 1] * wr + weights[3 * k + 2] * z[k];
+                }
+                for (int i = 0; i < steps; i++)
+                {
+                    data[i * n + p] = w[i];
+                }
+            }
+        }
+    }
+}
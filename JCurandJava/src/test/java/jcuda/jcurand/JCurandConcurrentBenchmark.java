@@ -0,0 +1,90 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandSetGeneratorConcurrent;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_XORWOW;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the throughput of 1 to 64 threads that generate small batches
+ * of uniform values with one generator, either by synchronizing on the
+ * shared generator, or with one lane per thread in the concurrent mode.
+ * Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandConcurrentBenchmark
+ * </pre>
+ */
+public class JCurandConcurrentBenchmark
+{
+    public static void main(String[] args) throws InterruptedException
+    {
+        JCurand.setExceptionsEnabled(true);
+        int n = 1024;
+        int calls = 1 << 16;
+        int types[] = { CURAND_RNG_PSEUDO_PHILOX4_32_10, CURAND_RNG_PSEUDO_XORWOW };
+        for (int type : types)
+        {
+            for (int numThreads = 1; numThreads <= 64; numThreads *= 2)
+            {
+                double locked = run(type, false, numThreads, n, calls);
+                double lanes = run(type, true, numThreads, n, calls);
+                System.out.printf("%-32s %2d threads: " +
+                    "locked %7.1f, lanes %7.1f million values/s%n",
+                    curandRngType.stringFor(type) + ":", numThreads,
+                    locked, lanes);
+            }
+        }
+    }
+
+    /**
+     * Run the given number of calls, distributed over the given number
+     * of threads, and return the number of values per microsecond
+     */
+    private static double run(int type, boolean concurrent,
+        int numThreads, int n, int calls) throws InterruptedException
+    {
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, type);
+        curandSetGeneratorConcurrent(generator, concurrent ? 1 : 0);
+        int callsPerThread = calls / numThreads;
+        Thread threads[] = new Thread[numThreads];
+        for (int t = 0; t < numThreads; t++)
+        {
+            threads[t] = new Thread(() ->
+            {
+                float data[] = new float[n];
+                Pointer pointer = Pointer.to(data);
+                for (int c = 0; c < callsPerThread; c++)
+                {
+                    if (concurrent)
+                    {
+                        curandGenerateUniform(generator, pointer, n);
+                    }
+                    else
+                    {
+                        synchronized (generator)
+                        {
+                            curandGenerateUniform(generator, pointer, n);
+                        }
+                    }
+                }
+            });
+        }
+        long before = System.nanoTime();
+        for (Thread thread : threads)
+        {
+            thread.start();
+        }
+        for (Thread thread : threads)
+        {
+            thread.join();
+        }
+        long after = System.nanoTime();
+        curandDestroyGenerator(generator);
+        return (double)callsPerThread * numThreads * n / ((after - before) / 1e3);
+    }
+}
@@ -0,0 +1,1315 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateBrownianBridge;
+import static jcuda.jcurand.JCurand.curandCreateGenerator;
+import static jcuda.jcurand.JCurand.curandCreateMultivariateNormal;
+import static jcuda.jcurand.JCurand.curandDeriveStreamSubsequence;
+import static jcuda.jcurand.JCurand.curandDestroyBrownianBridge;
+import static jcuda.jcurand.JCurand.curandDestroyDirectionFile;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandDestroyMultivariateNormal;
+import static jcuda.jcurand.JCurand.curandExportToFile;
+import static jcuda.jcurand.JCurand.curandGenerate;
+import static jcuda.jcurand.JCurand.curandGenerateBernoulliBits;
+import static jcuda.jcurand.JCurand.curandGenerateBeta;
+import static jcuda.jcurand.JCurand.curandGenerateBetaDouble;
+import static jcuda.jcurand.JCurand.curandGenerateBrownianBridge;
+import static jcuda.jcurand.JCurand.curandGenerateBrownianBridgeDouble;
+import static jcuda.jcurand.JCurand.curandGenerateChiSquared;
+import static jcuda.jcurand.JCurand.curandGenerateExponential;
+import static jcuda.jcurand.JCurand.curandGenerateGamma;
+import static jcuda.jcurand.JCurand.curandGenerateGammaDouble;
+import static jcuda.jcurand.JCurand.curandGenerateIntRange;
+import static jcuda.jcurand.JCurand.curandGenerateLatinHypercube;
+import static jcuda.jcurand.JCurand.curandGenerateLongLong;
+import static jcuda.jcurand.JCurand.curandGenerateLongLongRange;
+import static jcuda.jcurand.JCurand.curandGenerateMultivariateNormal;
+import static jcuda.jcurand.JCurand.curandGenerateMultivariateNormalDouble;
+import static jcuda.jcurand.JCurand.curandGenerateNormal;
+import static jcuda.jcurand.JCurand.curandGenerateNormalDouble;
+import static jcuda.jcurand.JCurand.curandGenerateNormalDouble2D;
+import static jcuda.jcurand.JCurand.curandGenerateNormalDoubleArray;
+import static jcuda.jcurand.JCurand.curandGeneratePermutation;
+import static jcuda.jcurand.JCurand.curandGeneratePermutationLongLong;
+import static jcuda.jcurand.JCurand.curandGenerateStudentT;
+import static jcuda.jcurand.JCurand.curandGenerateStudentTDouble;
+import static jcuda.jcurand.JCurand.curandGenerateTruncatedNormal;
+import static jcuda.jcurand.JCurand.curandGenerateTruncatedNormalDouble;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandGenerateUniform2D;
+import static jcuda.jcurand.JCurand.curandGenerateUniformArray;
+import static jcuda.jcurand.JCurand.curandGenerateUniformBF16;
+import static jcuda.jcurand.JCurand.curandGenerateUniformDouble;
+import static jcuda.jcurand.JCurand.curandGenerateUniformRange;
+import static jcuda.jcurand.JCurand.curandGenerateUniformRangeDouble;
+import static jcuda.jcurand.JCurand.curandGetDirectionVectors32;
+import static jcuda.jcurand.JCurand.curandLoadDirectionFile;
+import static jcuda.jcurand.JCurand.curandPhiloxUniform;
+import static jcuda.jcurand.JCurand.curandPhiloxUniformGather;
+import static jcuda.jcurand.JCurand.curandSampleWithoutReplacement;
+import static jcuda.jcurand.JCurand.curandSetGeneratorAntitheticMode;
+import static jcuda.jcurand.JCurand.curandSetGeneratorConcurrent;
+import static jcuda.jcurand.JCurand.curandSetGeneratorOffset;
+import static jcuda.jcurand.JCurand.curandSetGeneratorStream;
+import static jcuda.jcurand.JCurand.curandSetGeneratorStreams;
+import static jcuda.jcurand.JCurand.curandSetGeneratorThreadLane;
+import static jcuda.jcurand.JCurand.curandSetPseudoRandomGeneratorSeed;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorLayout;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorDimensions;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorDirectionFile;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorScrambling;
+import static jcuda.jcurand.JCurand.curandTransformBrownianBridge;
+import static jcuda.jcurand.JCurand.curandWriteDirectionFile;
+import static jcuda.jcurand.curandAntitheticMode.CURAND_ANTITHETIC_BLOCKED;
+import static jcuda.jcurand.curandAntitheticMode.CURAND_ANTITHETIC_INTERLEAVED;
+import static jcuda.jcurand.curandDirectionVectorSet.CURAND_DIRECTION_VECTORS_32_JOEKUO6;
+import static jcuda.jcurand.curandExportDistribution.CURAND_EXPORT_NORMAL_DOUBLE;
+import static jcuda.jcurand.curandExportFormat.CURAND_EXPORT_FORMAT_NPY;
+import static jcuda.jcurand.curandLatinHypercubeMode.CURAND_LATIN_HYPERCUBE_CENTERED;
+import static jcuda.jcurand.curandLatinHypercubeMode.CURAND_LATIN_HYPERCUBE_MAXIMIN;
+import static jcuda.jcurand.curandLatinHypercubeMode.CURAND_LATIN_HYPERCUBE_RANDOM;
+import static jcuda.jcurand.curandLayout.CURAND_LAYOUT_COLUMN_MAJOR;
+import static jcuda.jcurand.curandLayout.CURAND_LAYOUT_ROW_MAJOR;
+import static jcuda.jcurand.curandMatrixType.CURAND_MATRIX_CHOLESKY_FACTOR;
+import static jcuda.jcurand.curandMatrixType.CURAND_MATRIX_COVARIANCE;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_HALTON;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_LATTICE;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_SOBOL32;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_SOBOL64;
+import static jcuda.jcurand.curandScramblingMode.CURAND_SCRAMBLING_DEFAULT;
+import static jcuda.jcurand.curandScramblingMode.CURAND_SCRAMBLING_OWEN;
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.util.Arrays;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import jcuda.CudaException;
+import jcuda.Pointer;
+import jcuda.Sizeof;
+import jcuda.jcurand.StatisticalFunctions.Cdf;
+
+/**
+ * Basic test of the CPU backend of JCurand, which does not require
+ * a CUDA capable device
+ */
+public class JCurandCpuBackendTest
+{
+    /**
+     * The number of samples for the distribution fit tests
+     */
+    private static final int N_FIT = 200000;
+
+    @Before
+    public void setUp()
+    {
+        JCurand.setExceptionsEnabled(true);
+        JCurand.setBackend(JCurandBackend.JCURAND_BACKEND_CPU);
+    }
+
+    @After
+    public void tearDown()
+    {
+        JCurand.setBackend(JCurandBackend.JCURAND_BACKEND_CUDA);
+        JCurand.setExceptionsEnabled(false);
+    }
+
+    @Test
+    public void testUniform()
+    {
+        float result[] = generateUniform(42, 1000000);
+        double sum = 0;
+        for (float f : result)
+        {
+            sum += f;
+        }
+        assertEquals(0.5, sum / result.length, 1e-2);
+    }
+
+    @Test
+    public void testSeedReproducible()
+    {
+        assertArrayEquals(generateUniform(123, 1000), 
+            generateUniform(123, 1000), 0.0f);
+    }
+
+    @Test
+    public void testNormal()
+    {
+        int n = 1000000;
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        float result[] = new float[n];
+        curandGenerateNormal(generator, Pointer.to(result), n, 2.0f, 3.0f);
+        curandDestroyGenerator(generator);
+
+        double sum = 0;
+        double sumSquares = 0;
+        for (float f : result)
+        {
+            sum += f;
+            sumSquares += f * f;
+        }
+        double mean = sum / n;
+        double variance = sumSquares / n - mean * mean;
+        assertEquals(2.0, mean, 2e-2);
+        assertEquals(9.0, variance, 1e-1);
+    }
+
+    @Test
+    public void testUniformBF16()
+    {
+        int n = 100000;
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        curandSetPseudoRandomGeneratorSeed(generator, 123);
+        short result[] = new short[n];
+        curandGenerateUniformBF16(generator, Pointer.to(result), n);
+        curandDestroyGenerator(generator);
+
+        // The results must be the floats, rounded to nearest even
+        float expected[] = generateUniform(123, n);
+        for (int i = 0; i < n; i++)
+        {
+            int bits = Float.floatToIntBits(expected[i]);
+            bits += 0x7FFF + ((bits >>> 16) & 1);
+            assertEquals((short)(bits >>> 16), result[i]);
+        }
+    }
+
+    @Test
+    public void testIntRangeUniform()
+    {
+        // Small ranges use one word for two values, and a range of
+        // 2^30+1 rejects about a quarter of the words
+        assertIntRangeUniform(-3, 3);
+        assertIntRangeUniform(0, 12344);
+        assertIntRangeUniform(0, 1 << 30);
+    }
+
+    private static void assertIntRangeUniform(int lo, int hi)
+    {
+        int n = 7000001;
+        int bins = 7;
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        int result[] = new int[n];
+        curandGenerateIntRange(generator, Pointer.to(result), n, lo, hi);
+        curandDestroyGenerator(generator);
+
+        long range = (long)hi - lo + 1;
+        long observed[] = new long[bins];
+        for (int x : result)
+        {
+            assertTrue(x >= lo && x <= hi);
+            observed[(int)(((long)x - lo) * bins / range)]++;
+        }
+        double expected[] = new double[bins];
+        for (int i = 0; i < bins; i++)
+        {
+            long first = (i * range + bins - 1) / bins;
+            long end = ((i + 1) * range + bins - 1) / bins;
+            expected[i] = (double)n * (end - first) / range;
+        }
+        double pValue = StatisticalFunctions.chiSquareTest(observed, expected)[1];
+        assertTrue("p-value " + pValue, pValue > 1e-4);
+    }
+
+    @Test
+    public void testLongLongRange()
+    {
+        int n = 100000;
+        long lo = -(1L << 62);
+        long hi = (1L << 62);
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        long result[] = new long[n];
+        curandGenerateLongLongRange(generator, Pointer.to(result), n, lo, hi);
+        curandDestroyGenerator(generator);
+
+        double sum = 0;
+        for (long x : result)
+        {
+            assertTrue(x >= lo && x <= hi);
+            sum += x / (double)hi;
+        }
+        assertEquals(0.0, sum / n, 1e-2);
+    }
+
+    @Test
+    public void testUniformRange()
+    {
+        // The values are mapped from the same words as the uniform
+        // values, and a range of one float only contains its lower bound
+        int n = 100000;
+        float result[] = new float[n];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        curandSetPseudoRandomGeneratorSeed(generator, 123);
+        curandGenerateUniformRange(generator, Pointer.to(result), n, -2.0f, 3.0f);
+        float uniform[] = generateUniform(123, n);
+        for (int i = 0; i < n; i++)
+        {
+            assertTrue(result[i] >= -2.0f && result[i] < 3.0f);
+            assertEquals(-2.0f + 5.0f * uniform[i], result[i], 1e-6f);
+        }
+        curandGenerateUniformRange(generator, Pointer.to(result), n,
+            1.0f, Math.nextUp(1.0f));
+        for (float x : result)
+        {
+            assertEquals(1.0f, x, 0.0f);
+        }
+
+        double resultDouble[] = new double[n];
+        curandGenerateUniformRangeDouble(generator, Pointer.to(resultDouble), n,
+            -Double.MAX_VALUE, Double.MAX_VALUE);
+        curandDestroyGenerator(generator);
+        double sum = 0;
+        for (double x : resultDouble)
+        {
+            assertTrue(x >= -Double.MAX_VALUE && x < Double.MAX_VALUE);
+            sum += x / Double.MAX_VALUE;
+        }
+        assertEquals(0.0, sum / n, 1e-2);
+    }
+
+    @Test(expected = CudaException.class)
+    public void testUniformRangeEmpty()
+    {
+        curandGenerator generator = createGenerator();
+        float result[] = new float[2];
+        curandGenerateUniformRange(generator, Pointer.to(result), 2, 1.0f, 1.0f);
+    }
+
+    @Test
+    public void testBernoulliBits()
+    {
+        // A probability of 1/2 uses one word for 32 bits, and other
+        // probabilities are compared digit by digit
+        assertBernoulliBits(0.5);
+        assertBernoulliBits(0.3);
+        assertBernoulliBits(1.0 / 1024);
+    }
+
+    private static void assertBernoulliBits(double p)
+    {
+        int nBits = 10000001;
+        int words = (nBits + 31) / 32;
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        int result[] = new int[words];
+        result[words - 1] = -1;
+        curandGenerateBernoulliBits(generator, Pointer.to(result), nBits, p);
+        curandDestroyGenerator(generator);
+
+        // The bits after nBits in the last word are zero
+        assertEquals(0, result[words - 1] >>> (nBits % 32));
+        long ones = 0;
+        for (int w : result)
+        {
+            ones += Integer.bitCount(w);
+        }
+        double sigma = Math.sqrt(nBits * p * (1.0 - p));
+        assertEquals(nBits * p, ones, 5 * sigma);
+    }
+
+    @Test
+    public void testExponential()
+    {
+        float result[] = new float[N_FIT];
+        curandGenerator generator = createGenerator();
+        curandGenerateExponential(generator, Pointer.to(result), N_FIT, 3.0f);
+        curandDestroyGenerator(generator);
+        assertFit(toDouble(result), x -> 1.0 - Math.exp(-3.0 * x));
+    }
+
+    @Test
+    public void testGamma()
+    {
+        // Shapes below 1 use an additional uniform value
+        for (double shape : new double[] { 0.3, 1.0, 4.5 })
+        {
+            float result[] = new float[N_FIT];
+            double resultDouble[] = new double[N_FIT];
+            curandGenerator generator = createGenerator();
+            curandGenerateGamma(generator, Pointer.to(result), N_FIT,
+                (float)shape, 2.0f);
+            curandGenerateGammaDouble(generator, Pointer.to(resultDouble),
+                N_FIT, shape, 2.0);
+            curandDestroyGenerator(generator);
+            Cdf cdf = x -> StatisticalFunctions.gammaCdf(x, shape, 2.0);
+            assertFit(toDouble(result), cdf);
+            assertFit(resultDouble, cdf);
+        }
+    }
+
+    @Test
+    public void testBeta()
+    {
+        double parameters[][] = { { 0.5, 0.5 }, { 2.0, 5.0 }, { 0.7, 3.0 } };
+        for (double p[] : parameters)
+        {
+            float result[] = new float[N_FIT];
+            double resultDouble[] = new double[N_FIT];
+            curandGenerator generator = createGenerator();
+            curandGenerateBeta(generator, Pointer.to(result), N_FIT,
+                (float)p[0], (float)p[1]);
+            curandGenerateBetaDouble(generator, Pointer.to(resultDouble),
+                N_FIT, p[0], p[1]);
+            curandDestroyGenerator(generator);
+            Cdf cdf = x -> StatisticalFunctions.betaI(p[0], p[1], x);
+            assertFit(toDouble(result), cdf);
+            assertFit(resultDouble, cdf);
+        }
+    }
+
+    @Test
+    public void testChiSquaredAndStudentT()
+    {
+        float chiSquared[] = new float[N_FIT];
+        float studentT[] = new float[N_FIT];
+        double studentTDouble[] = new double[N_FIT];
+        curandGenerator generator = createGenerator();
+        curandGenerateChiSquared(generator, Pointer.to(chiSquared), N_FIT, 3.0f);
+        curandGenerateStudentT(generator, Pointer.to(studentT), N_FIT, 2.5f);
+        curandGenerateStudentTDouble(generator, Pointer.to(studentTDouble),
+            N_FIT, 2.5);
+        curandDestroyGenerator(generator);
+        assertFit(toDouble(chiSquared),
+            x -> StatisticalFunctions.gammaCdf(x, 1.5, 2.0));
+        assertFit(toDouble(studentT),
+            x -> StatisticalFunctions.studentTCdf(x, 2.5));
+        assertFit(studentTDouble,
+            x -> StatisticalFunctions.studentTCdf(x, 2.5));
+    }
+
+    @Test
+    public void testTruncatedNormal()
+    {
+        // Naive rejection, inversion, Robert's method in the upper and
+        // in the lower tail
+        assertTruncatedNormal(-1.0, 2.0);
+        assertTruncatedNormal(0.1, 0.3);
+        assertTruncatedNormal(3.0, Double.POSITIVE_INFINITY);
+        assertTruncatedNormal(Double.NEGATIVE_INFINITY, -8.0);
+    }
+
+    private static void assertTruncatedNormal(double a, double b)
+    {
+        double mean = 1.5;
+        double stddev = 2.0;
+        double lo = mean + stddev * a;
+        double hi = mean + stddev * b;
+        float result[] = new float[N_FIT];
+        double resultDouble[] = new double[N_FIT];
+        curandGenerator generator = createGenerator();
+        curandGenerateTruncatedNormal(generator, Pointer.to(result), N_FIT,
+            (float)mean, (float)stddev, (float)lo, (float)hi);
+        curandGenerateTruncatedNormalDouble(generator,
+            Pointer.to(resultDouble), N_FIT, mean, stddev, lo, hi);
+        curandDestroyGenerator(generator);
+        for (int i = 0; i < N_FIT; i++)
+        {
+            assertTrue(result[i] >= (float)lo && result[i] <= (float)hi);
+            assertTrue(resultDouble[i] >= lo && resultDouble[i] <= hi);
+        }
+
+        // The CDF in terms of upper tail probabilities, mirrored for
+        // intervals below the mean, to avoid cancellation in the tails
+        double sign = b <= 0.0 ? -1.0 : 1.0;
+        double ma = b <= 0.0 ? -b : a;
+        double mb = b <= 0.0 ? -a : b;
+        double qa = StatisticalFunctions.normalCdf(-ma);
+        double qb = StatisticalFunctions.normalCdf(-mb);
+        Cdf cdf = x ->
+        {
+            double z = sign * (x - mean) / stddev;
+            double f = (qa - StatisticalFunctions.normalCdf(-z)) / (qa - qb);
+            return sign > 0 ? f : 1.0 - f;
+        };
+        assertFit(toDouble(result), cdf);
+        assertFit(resultDouble, cdf);
+    }
+
+    @Test
+    public void testMultivariateNormal()
+    {
+        int d = 3;
+        double mean[] = { 1.0, -2.0, 0.5 };
+        double covariance[] =
+        {
+            4.0, 1.2, -0.8,
+            1.2, 1.0, 0.3,
+            -0.8, 0.3, 2.0
+        };
+        curandMultivariateNormal distribution = new curandMultivariateNormal();
+        curandCreateMultivariateNormal(distribution, d, Pointer.to(mean),
+            Pointer.to(covariance), CURAND_MATRIX_COVARIANCE);
+        double rows[] = new double[N_FIT * d];
+        double columns[] = new double[N_FIT * d];
+        curandGenerator generator = createGenerator();
+        curandGenerateMultivariateNormalDouble(generator, Pointer.to(rows),
+            N_FIT, distribution, CURAND_LAYOUT_ROW_MAJOR);
+        curandDestroyGenerator(generator);
+        generator = createGenerator();
+        curandGenerateMultivariateNormalDouble(generator, Pointer.to(columns),
+            N_FIT, distribution, CURAND_LAYOUT_COLUMN_MAJOR);
+        curandDestroyGenerator(generator);
+        curandDestroyMultivariateNormal(distribution);
+
+        // Both layouts contain the same vectors
+        for (int i = 0; i < N_FIT; i++)
+        {
+            for (int j = 0; j < d; j++)
+            {
+                assertEquals(rows[i * d + j], columns[j * N_FIT + i], 0.0);
+            }
+        }
+        double mu[] = new double[d];
+        for (int i = 0; i < N_FIT; i++)
+        {
+            for (int j = 0; j < d; j++)
+            {
+                mu[j] += rows[i * d + j] / N_FIT;
+            }
+        }
+        for (int j = 0; j < d; j++)
+        {
+            assertEquals(mean[j], mu[j], 0.02);
+            for (int k = 0; k <= j; k++)
+            {
+                double c = 0;
+                for (int i = 0; i < N_FIT; i++)
+                {
+                    c += (rows[i * d + j] - mu[j]) * (rows[i * d + k] - mu[k]);
+                }
+                assertEquals(covariance[j * d + k], c / N_FIT, 0.05);
+            }
+        }
+    }
+
+    @Test
+    public void testMultivariateNormalCholeskyFactor()
+    {
+        // The factor of the covariance matrix { 4, 2 }, { 2, 5 }
+        int d = 2;
+        double covariance[] = { 4.0, 2.0, 2.0, 5.0 };
+        double factor[] = { 2.0, 0.0, 1.0, 2.0 };
+        curandMultivariateNormal fromCovariance =
+            new curandMultivariateNormal();
+        curandCreateMultivariateNormal(fromCovariance, d, null,
+            Pointer.to(covariance), CURAND_MATRIX_COVARIANCE);
+        curandMultivariateNormal fromFactor = new curandMultivariateNormal();
+        curandCreateMultivariateNormal(fromFactor, d, null,
+            Pointer.to(factor), CURAND_MATRIX_CHOLESKY_FACTOR);
+        float expected[] = new float[1000 * d];
+        float actual[] = new float[1000 * d];
+        curandGenerator generator = createGenerator();
+        curandGenerateMultivariateNormal(generator, Pointer.to(expected),
+            1000, fromCovariance, CURAND_LAYOUT_ROW_MAJOR);
+        curandDestroyGenerator(generator);
+        generator = createGenerator();
+        curandGenerateMultivariateNormal(generator, Pointer.to(actual),
+            1000, fromFactor, CURAND_LAYOUT_ROW_MAJOR);
+        curandDestroyGenerator(generator);
+        curandDestroyMultivariateNormal(fromCovariance);
+        curandDestroyMultivariateNormal(fromFactor);
+        assertArrayEquals(expected, actual, 0.0f);
+    }
+
+    @Test(expected = CudaException.class)
+    public void testMultivariateNormalNotPositiveDefinite()
+    {
+        double covariance[] = { 1.0, 2.0, 2.0, 1.0 };
+        curandMultivariateNormal distribution = new curandMultivariateNormal();
+        curandCreateMultivariateNormal(distribution, 2, null,
+            Pointer.to(covariance), CURAND_MATRIX_COVARIANCE);
+    }
+
+    @Test
+    public void testBrownianBridgeQuasi()
+    {
+        // The fused generation gives the same paths as the generation
+        // of normal values followed by the transform
+        int steps = 12;
+        int n = 1000;
+        curandBrownianBridge bridge = new curandBrownianBridge();
+        curandCreateBrownianBridge(bridge, steps, null);
+        float expected[] = new float[n * steps];
+        float actual[] = new float[n * steps];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, steps);
+        curandGenerateNormal(
+            generator, Pointer.to(expected), n * steps, 0.0f, 1.0f);
+        curandDestroyGenerator(generator);
+        curandTransformBrownianBridge(bridge, Pointer.to(expected), n);
+        generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, steps);
+        curandGenerateBrownianBridge(generator, Pointer.to(actual), n, bridge,
+            CURAND_LAYOUT_COLUMN_MAJOR);
+        curandDestroyGenerator(generator);
+        curandDestroyBrownianBridge(bridge);
+        assertArrayEquals(expected, actual, 0.0f);
+    }
+
+    @Test
+    public void testBrownianBridgeCovariance()
+    {
+        // The covariance of the values at two times is the smaller time
+        double times[] = { 0.25, 0.5, 2.0, 3.0, 3.1 };
+        int steps = times.length;
+        curandBrownianBridge bridge = new curandBrownianBridge();
+        curandCreateBrownianBridge(bridge, steps, Pointer.to(times));
+        double paths[] = new double[N_FIT * steps];
+        curandGenerator generator = createGenerator();
+        curandGenerateBrownianBridgeDouble(generator, Pointer.to(paths),
+            N_FIT, bridge, CURAND_LAYOUT_ROW_MAJOR);
+        curandDestroyGenerator(generator);
+        curandDestroyBrownianBridge(bridge);
+        for (int j = 0; j < steps; j++)
+        {
+            for (int k = 0; k <= j; k++)
+            {
+                double c = 0;
+                for (int i = 0; i < N_FIT; i++)
+                {
+                    c += paths[i * steps + j] * paths[i * steps + k];
+                }
+                assertEquals(times[k], c / N_FIT, 0.05);
+            }
+        }
+    }
+
+    @Test
+    public void testPermutation()
+    {
+        // Enough values for several buckets. Under a uniform permutation,
+        // the values from each quarter end up in each quarter equally
+        // often.
+        int n = 1000003;
+        int bins = 4;
+        int result[] = new int[n];
+        curandGenerator generator = createGenerator();
+        curandGeneratePermutation(generator, Pointer.to(result), n);
+        curandDestroyGenerator(generator);
+        boolean seen[] = new boolean[n];
+        long observed[] = new long[bins * bins];
+        for (int i = 0; i < n; i++)
+        {
+            int x = result[i];
+            assertTrue(x >= 0 && x < n && !seen[x]);
+            seen[x] = true;
+            int row = (int)((long)x * bins / n);
+            int column = (int)((long)i * bins / n);
+            observed[row * bins + column]++;
+        }
+        double expected[] = new double[bins * bins];
+        Arrays.fill(expected, (double)n / (bins * bins));
+        double pValue = StatisticalFunctions.chiSquareTest(observed, expected)[1];
+        assertTrue("p-value " + pValue, pValue > 1e-4);
+
+        long resultLongLong[] = new long[1000];
+        generator = createGenerator();
+        curandGeneratePermutationLongLong(
+            generator, Pointer.to(resultLongLong), 1000);
+        curandDestroyGenerator(generator);
+        long sorted[] = resultLongLong.clone();
+        Arrays.sort(sorted);
+        for (int i = 0; i < sorted.length; i++)
+        {
+            assertEquals(i, sorted[i]);
+        }
+    }
+
+    @Test
+    public void testSampleWithoutReplacement()
+    {
+        // Sparse samples use Floyd's algorithm, dense samples are taken
+        // from a permutation. Each value is chosen equally often.
+        assertSampleWithoutReplacement(1000, 10, 20000);
+        assertSampleWithoutReplacement(1000, 600, 500);
+    }
+
+    private static void assertSampleWithoutReplacement(int n, int k, int runs)
+    {
+        int bins = 10;
+        int result[] = new int[k];
+        long observed[] = new long[bins];
+        curandGenerator generator = createGenerator();
+        for (int r = 0; r < runs; r++)
+        {
+            curandSampleWithoutReplacement(generator, Pointer.to(result), n, k);
+            boolean seen[] = new boolean[n];
+            for (int x : result)
+            {
+                assertTrue(x >= 0 && x < n && !seen[x]);
+                seen[x] = true;
+                observed[x * bins / n]++;
+            }
+        }
+        curandDestroyGenerator(generator);
+        double expected[] = new double[bins];
+        Arrays.fill(expected, (double)k * runs / bins);
+        double pValue = StatisticalFunctions.chiSquareTest(observed, expected)[1];
+        assertTrue("p-value " + pValue, pValue > 1e-4);
+    }
+
+    @Test
+    public void testAntitheticUniform()
+    {
+        // The samples are the values of the regular generation of half
+        // the size, and each partner is 1-u
+        int n = 100002;
+        int half = n / 2;
+        float expected[] = new float[half];
+        curandGenerator generator = createGenerator();
+        curandGenerateUniform(generator, Pointer.to(expected), half);
+        curandDestroyGenerator(generator);
+
+        float blocked[] = new float[n];
+        generator = createGenerator();
+        curandSetGeneratorAntitheticMode(generator, CURAND_ANTITHETIC_BLOCKED);
+        curandGenerateUniform(generator, Pointer.to(blocked), n);
+        curandDestroyGenerator(generator);
+
+        float interleaved[] = new float[n];
+        generator = createGenerator();
+        curandSetGeneratorAntitheticMode(generator, CURAND_ANTITHETIC_INTERLEAVED);
+        curandGenerateUniform(generator, Pointer.to(interleaved), n);
+        curandDestroyGenerator(generator);
+
+        for (int i = 0; i < half; i++)
+        {
+            assertEquals(expected[i], blocked[i], 0.0f);
+            assertEquals(1.0f, blocked[i] + blocked[half + i], 1e-6f);
+            assertTrue(blocked[half + i] > 0.0f && blocked[half + i] <= 1.0f);
+            assertEquals(blocked[i], interleaved[2 * i], 0.0f);
+            assertEquals(blocked[half + i], interleaved[2 * i + 1], 0.0f);
+        }
+    }
+
+    @Test
+    public void testAntitheticNormal()
+    {
+        // An odd number of samples uses only one value of the last
+        // Box-Muller pair
+        int n = 100006;
+        int half = n / 2;
+        double expected[] = new double[half + 1];
+        curandGenerator generator = createGenerator();
+        curandGenerateNormalDouble(
+            generator, Pointer.to(expected), half + 1, 2.0, 3.0);
+        curandDestroyGenerator(generator);
+
+        double result[] = new double[n];
+        generator = createGenerator();
+        curandSetGeneratorAntitheticMode(generator, CURAND_ANTITHETIC_INTERLEAVED);
+        curandGenerateNormalDouble(generator, Pointer.to(result), n, 2.0, 3.0);
+        curandDestroyGenerator(generator);
+
+        for (int i = 0; i < half; i++)
+        {
+            assertEquals(expected[i], result[2 * i], 0.0);
+            assertEquals(4.0, result[2 * i] + result[2 * i + 1], 1e-12);
+        }
+    }
+
+    @Test
+    public void testPitchedOutput()
+    {
+        // A block of a row-major matrix receives the values of the
+        // contiguous generation, and the other elements are untouched
+        int rows = 300;
+        int cols = 70;
+        int pitch = 100;
+        int offset = 10;
+        float expected[] = new float[rows * cols];
+        curandGenerator generator = createGenerator();
+        curandGenerateUniform(generator, Pointer.to(expected), rows * cols);
+        curandDestroyGenerator(generator);
+
+        float matrix[] = new float[rows * pitch];
+        Arrays.fill(matrix, -1.0f);
+        generator = createGenerator();
+        Pointer block = Pointer.to(matrix).withByteOffset(offset * Sizeof.FLOAT);
+        curandGenerateUniform2D(generator, block, rows, cols, pitch);
+        curandDestroyGenerator(generator);
+        for (int r = 0; r < rows; r++)
+        {
+            for (int c = 0; c < pitch; c++)
+            {
+                int i = c - offset;
+                float value = i >= 0 && i < cols ? expected[r * cols + i] : -1.0f;
+                assertEquals(value, matrix[r * pitch + c], 0.0f);
+            }
+        }
+    }
+
+    @Test
+    public void testPitchedOutputColumn()
+    {
+        int rows = 1000;
+        int pitch = 3;
+        double expected[] = new double[rows];
+        curandGenerator generator = createGenerator();
+        curandGenerateNormalDouble(
+            generator, Pointer.to(expected), rows, 1.0, 2.0);
+        curandDestroyGenerator(generator);
+
+        double matrix[] = new double[rows * pitch];
+        generator = createGenerator();
+        Pointer column = Pointer.to(matrix).withByteOffset(Sizeof.DOUBLE);
+        curandGenerateNormalDouble2D(
+            generator, column, rows, 1, pitch, 1.0, 2.0);
+        curandDestroyGenerator(generator);
+        for (int r = 0; r < rows; r++)
+        {
+            assertEquals(0.0, matrix[r * pitch], 0.0);
+            assertEquals(expected[r], matrix[r * pitch + 1], 0.0);
+            assertEquals(0.0, matrix[r * pitch + 2], 0.0);
+        }
+    }
+
+    @Test
+    public void testQuasiPointMajor()
+    {
+        // The point-major output is the transposed dimension-major output,
+        // also for dimensions that are split into several tiles
+        int dimensions = 100;
+        int points = 1000;
+        int n = dimensions * points;
+        float expected[] = new float[n];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, dimensions);
+        curandGenerateUniform(generator, Pointer.to(expected), n);
+        curandDestroyGenerator(generator);
+
+        float result[] = new float[n];
+        generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, dimensions);
+        curandSetQuasiRandomGeneratorLayout(generator, CURAND_LAYOUT_ROW_MAJOR);
+        curandGenerateUniform(generator, Pointer.to(result), n);
+        curandDestroyGenerator(generator);
+        for (int p = 0; p < points; p++)
+        {
+            for (int d = 0; d < dimensions; d++)
+            {
+                assertEquals(expected[d * points + p],
+                    result[p * dimensions + d], 0.0f);
+            }
+        }
+    }
+
+    @Test
+    public void testHeapArrayChunks()
+    {
+        // Chunked generation into Java arrays gives the same values as a
+        // single call, also when normal chunks are rounded to even sizes
+        int n = 100001;
+        double expected[] = new double[n + 1];
+        curandGenerator generator = createGenerator();
+        curandGenerateNormalDouble(
+            generator, Pointer.to(expected), n + 1, 1.0, 2.0);
+        curandDestroyGenerator(generator);
+
+        int chunkSize = JCurand.getHeapArrayChunkSize();
+        try
+        {
+            JCurand.setHeapArrayChunkSize(999);
+            double result[] = new double[n + 1];
+            generator = createGenerator();
+            curandGenerateNormalDoubleArray(generator, result, n + 1, 1.0, 2.0);
+            curandDestroyGenerator(generator);
+            assertArrayEquals(expected, result, 0.0);
+
+            float uniform[] = new float[n];
+            generator = createGenerator();
+            curandGenerateUniformArray(generator, uniform, n - 1);
+            curandDestroyGenerator(generator);
+            assertArrayEquals(generateUniform(0, n - 1),
+                Arrays.copyOf(uniform, n - 1), 0.0f);
+            assertEquals(0.0f, uniform[n - 1], 0.0f);
+        }
+        finally
+        {
+            JCurand.setHeapArrayChunkSize(chunkSize);
+        }
+    }
+
+    @Test
+    public void testConcurrentLanes() throws InterruptedException
+    {
+        // Each thread gets the values of its own lane, independent of the
+        // other threads, and lane 0 continues like a regular generator
+        final int numThreads = 4;
+        final int n = 10001;
+        final float expected[][] = new float[numThreads][2 * n];
+        curandGenerator generator = createGenerator();
+        curandSetPseudoRandomGeneratorSeed(generator, 42);
+        curandSetGeneratorConcurrent(generator, 1);
+        for (int lane = 0; lane < numThreads; lane++)
+        {
+            curandSetGeneratorThreadLane(generator, lane);
+            curandGenerateUniform(generator, Pointer.to(expected[lane]), 2 * n);
+        }
+        assertArrayEquals(generateUniform(42, 2 * n), expected[0], 0.0f);
+        assertTrue(!Arrays.equals(expected[0], expected[1]));
+
+        final curandGenerator shared = generator;
+        final float result[][] = new float[numThreads][2 * n];
+        final Throwable errors[] = new Throwable[numThreads];
+        Thread threads[] = new Thread[numThreads];
+        for (int t = 0; t < numThreads; t++)
+        {
+            final int lane = t;
+            threads[t] = new Thread(() ->
+            {
+                try
+                {
+                    curandSetGeneratorThreadLane(shared, lane);
+                    curandGenerateUniform(shared, Pointer.to(result[lane]), n);
+                    curandGenerateUniform(shared,
+                        Pointer.to(result[lane]).withByteOffset(n * Sizeof.FLOAT), n);
+                }
+                catch (Throwable e)
+                {
+                    errors[lane] = e;
+                }
+            });
+            threads[t].start();
+        }
+        for (int t = 0; t < numThreads; t++)
+        {
+            threads[t].join();
+            assertEquals(null, errors[t]);
+            assertArrayEquals(expected[t], result[t], 0.0f);
+        }
+
+        // Switching the mode off and on again numbers the lanes again,
+        // starting at the beginning of their subsequences
+        curandSetGeneratorConcurrent(generator, 0);
+        curandSetGeneratorConcurrent(generator, 1);
+        float restarted[] = new float[2 * n];
+        curandGenerateUniform(generator, Pointer.to(restarted), 2 * n);
+        assertArrayEquals(expected[0], restarted, 0.0f);
+        curandDestroyGenerator(generator);
+    }
+
+    @Test
+    public void testPhiloxStateless()
+    {
+        // The stateless functions give the values of a Philox generator
+        // at the given offsets, also when they are not aligned to blocks
+        int n = 10001;
+        long offset = 5;
+        float expected[] = new float[n];
+        curandGenerator generator = createGenerator();
+        curandSetPseudoRandomGeneratorSeed(generator, 42);
+        curandSetGeneratorOffset(generator, offset);
+        curandGenerateUniform(generator, Pointer.to(expected), n);
+        curandDestroyGenerator(generator);
+
+        float result[] = new float[n];
+        curandPhiloxUniform(42, 0, offset, Pointer.to(result), n);
+        assertArrayEquals(expected, result, 0.0f);
+
+        long offsets[] = new long[n];
+        for (int i = 0; i < n; i++)
+        {
+            offsets[i] = offset + (i * 7919L) % n;
+        }
+        float gathered[] = new float[n];
+        curandPhiloxUniformGather(
+            42, 0, Pointer.to(offsets), Pointer.to(gathered), n);
+        for (int i = 0; i < n; i++)
+        {
+            assertEquals(expected[(int)(offsets[i] - offset)], gathered[i], 0.0f);
+        }
+    }
+
+    @Test
+    public void testGeneratorStreams()
+    {
+        // The stream of a path is a subsequence of the seed, siblings get
+        // different streams, and the bulk call configures the same streams
+        long seed = 42;
+        int n = 1001;
+        long paths[] = { 7, 0, 7, 1, 7, 2 };
+        curandGenerator generators[] = new curandGenerator[3];
+        float results[][] = new float[3][n];
+        for (int i = 0; i < 3; i++)
+        {
+            generators[i] = createGenerator();
+        }
+        curandSetGeneratorStreams(generators, 3, seed, paths, 2);
+        for (int i = 0; i < 3; i++)
+        {
+            curandGenerateUniform(generators[i], Pointer.to(results[i]), n);
+            curandDestroyGenerator(generators[i]);
+        }
+        assertTrue(!Arrays.equals(results[0], results[1]));
+        assertTrue(!Arrays.equals(results[1], results[2]));
+
+        curandGenerator generator = createGenerator();
+        long path[] = { 7, 1 };
+        curandSetGeneratorStream(generator, seed, Pointer.to(path), 2);
+        float result[] = new float[n];
+        curandGenerateUniform(generator, Pointer.to(result), n);
+        curandDestroyGenerator(generator);
+        assertArrayEquals(results[1], result, 0.0f);
+
+        long subsequence[] = new long[1];
+        curandDeriveStreamSubsequence(Pointer.to(path), 2, Pointer.to(subsequence));
+        curandPhiloxUniform(seed, subsequence[0], 0, Pointer.to(result), n);
+        assertArrayEquals(results[1], result, 0.0f);
+    }
+
+    @Test
+    public void testExportToFile() throws IOException
+    {
+        // The file contains the values of a single call, after a .npy
+        // header that is padded to 64 bytes
+        int n = 3000000;
+        File file = File.createTempFile("JCurandExport", ".npy");
+        file.deleteOnExit();
+        curandGenerator generator = createGenerator();
+        double gigabytesPerSecond[] = new double[1];
+        curandExportToFile(generator, file.getPath(), CURAND_EXPORT_NORMAL_DOUBLE,
+            n, 1.0, 2.0, CURAND_EXPORT_FORMAT_NPY, gigabytesPerSecond);
+        curandDestroyGenerator(generator);
+        assertTrue(gigabytesPerSecond[0] > 0);
+
+        generator = createGenerator();
+        double expected[] = new double[n];
+        curandGenerateNormalDouble(generator, Pointer.to(expected), n, 1.0, 2.0);
+        curandDestroyGenerator(generator);
+
+        byte bytes[] = Files.readAllBytes(file.toPath());
+        int headerSize = bytes.length - n * Sizeof.DOUBLE;
+        assertEquals(0, headerSize % 64);
+        assertEquals((byte)0x93, bytes[0]);
+        assertEquals("NUMPY", new String(bytes, 1, 5, "US-ASCII"));
+        double actual[] = new double[n];
+        ByteBuffer.wrap(bytes, headerSize, n * Sizeof.DOUBLE)
+            .order(ByteOrder.nativeOrder()).asDoubleBuffer().get(actual);
+        assertArrayEquals(expected, actual, 0.0);
+        file.delete();
+    }
+
+    @Test(expected = CudaException.class)
+    public void testExportQuasiRandomDimensions() throws IOException
+    {
+        File file = File.createTempFile("JCurandExport", ".npy");
+        file.deleteOnExit();
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, 3);
+        curandExportToFile(generator, file.getPath(), CURAND_EXPORT_NORMAL_DOUBLE,
+            3, 0.0, 1.0, CURAND_EXPORT_FORMAT_NPY, null);
+    }
+
+    @Test
+    public void testDirectionFile() throws IOException
+    {
+        // The first lines of the table by Joe and Kuo give the first
+        // points of the standard Sobol sequence
+        File table = File.createTempFile("JCurandJoeKuo", ".txt");
+        File file = File.createTempFile("JCurandDirections", ".bin");
+        table.deleteOnExit();
+        file.deleteOnExit();
+        String lines = "d s a m_i\n2 1 0 1\n3 2 1 1 3\n";
+        Files.write(table.toPath(), lines.getBytes(StandardCharsets.US_ASCII));
+        curandWriteDirectionFile(table.getPath(), file.getPath(), 32, 0);
+
+        curandDirectionFile directionFile = new curandDirectionFile();
+        curandLoadDirectionFile(directionFile, file.getPath());
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDirectionFile(generator, directionFile);
+        curandSetQuasiRandomGeneratorDimensions(generator, 3);
+        int result[] = new int[3 * 8];
+        curandGenerate(generator, Pointer.to(result), result.length);
+        curandDestroyGenerator(generator);
+        curandDestroyDirectionFile(directionFile);
+
+        double expected[] = {
+            0, 0.5, 0.75, 0.25, 0.375, 0.875, 0.625, 0.125,
+            0, 0.5, 0.25, 0.75, 0.375, 0.875, 0.125, 0.625,
+            0, 0.5, 0.25, 0.75, 0.625, 0.125, 0.875, 0.375 };
+        for (int i = 0; i < result.length; i++)
+        {
+            assertEquals(expected[i], (result[i] & 0xFFFFFFFFL) / 4294967296.0, 0.0);
+        }
+        table.delete();
+        file.delete();
+    }
+
+    @Test
+    public void testDirectionFile64() throws IOException
+    {
+        // A 64 bit file gives the same points to a 64 bit generator
+        File table = File.createTempFile("JCurandJoeKuo", ".txt");
+        File file = File.createTempFile("JCurandDirections", ".bin");
+        table.deleteOnExit();
+        file.deleteOnExit();
+        String lines = "d s a m_i\n2 1 0 1\n3 2 1 1 3\n";
+        Files.write(table.toPath(), lines.getBytes(StandardCharsets.US_ASCII));
+        curandWriteDirectionFile(table.getPath(), file.getPath(), 64, 0);
+
+        curandDirectionFile directionFile = new curandDirectionFile();
+        curandLoadDirectionFile(directionFile, file.getPath());
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_QUASI_SOBOL64);
+        curandSetQuasiRandomGeneratorDirectionFile(generator, directionFile);
+        curandSetQuasiRandomGeneratorDimensions(generator, 3);
+        long result[] = new long[3 * 8];
+        curandGenerateLongLong(generator, Pointer.to(result), result.length);
+        curandDestroyGenerator(generator);
+        curandDestroyDirectionFile(directionFile);
+
+        double expected[] = {
+            0, 0.5, 0.75, 0.25, 0.375, 0.875, 0.625, 0.125,
+            0, 0.5, 0.25, 0.75, 0.375, 0.875, 0.125, 0.625,
+            0, 0.5, 0.25, 0.75, 0.625, 0.125, 0.875, 0.375 };
+        for (int i = 0; i < result.length; i++)
+        {
+            assertEquals(expected[i], (result[i] >>> 11) * 0x1.0p-53, 0.0);
+        }
+        table.delete();
+        file.delete();
+    }
+
+    @Test
+    public void testSobolJoeKuo()
+    {
+        // The built-in direction vectors are those of Joe and Kuo, and
+        // give the same points as the first lines of their table
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, 3);
+        int result[] = new int[3 * 8];
+        curandGenerate(generator, Pointer.to(result), result.length);
+        curandDestroyGenerator(generator);
+
+        double expected[] = {
+            0, 0.5, 0.75, 0.25, 0.375, 0.875, 0.625, 0.125,
+            0, 0.5, 0.25, 0.75, 0.375, 0.875, 0.125, 0.625,
+            0, 0.5, 0.25, 0.75, 0.625, 0.125, 0.875, 0.375 };
+        for (int i = 0; i < result.length; i++)
+        {
+            assertEquals(expected[i], (result[i] & 0xFFFFFFFFL) / 4294967296.0, 0.0);
+        }
+    }
+
+    @Test(expected = CudaException.class)
+    public void testSobolDimensionsWithoutDirectionFile()
+    {
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, 20001);
+    }
+
+    @Test
+    public void testDirectionVectors()
+    {
+        // The points of a Sobol generator can be computed from the
+        // direction vectors, also in the last dimension
+        int dimensions = 20000;
+        int n = 8;
+        int vectors[][][] = new int[1][][];
+        curandGetDirectionVectors32(vectors, CURAND_DIRECTION_VECTORS_32_JOEKUO6);
+        assertEquals(dimensions, vectors[0].length);
+        int points[] = new int[dimensions * n];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, dimensions);
+        curandGenerate(generator, Pointer.to(points), dimensions * n);
+        curandDestroyGenerator(generator);
+        int d = dimensions - 1;
+        for (int i = 0; i < n; i++)
+        {
+            int gray = i ^ (i >> 1);
+            int expected = 0;
+            for (int k = 0; k < 32; k++)
+            {
+                if (((gray >> k) & 1) != 0)
+                {
+                    expected ^= vectors[0][d][k];
+                }
+            }
+            assertEquals(expected, points[d * n + i]);
+        }
+    }
+
+    @Test
+    public void testOwenScrambling()
+    {
+        // The scrambled points keep the stratification of the Sobol
+        // points: Each dimension has one point in each interval
+        int dimensions = 3;
+        int n = 1024;
+        int a[] = generateOwenScrambled(123, dimensions, n);
+        for (int d = 0; d < dimensions; d++)
+        {
+            boolean occupied[] = new boolean[n];
+            for (int i = 0; i < n; i++)
+            {
+                int interval = a[d * n + i] >>> 22;
+                assertFalse(occupied[interval]);
+                occupied[interval] = true;
+            }
+        }
+        assertArrayEquals(a, generateOwenScrambled(123, dimensions, n));
+        assertFalse(Arrays.equals(a, generateOwenScrambled(124, dimensions, n)));
+    }
+
+    private static int[] generateOwenScrambled(long seed, int dimensions, int n)
+    {
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, dimensions);
+        curandSetQuasiRandomGeneratorScrambling(
+            generator, CURAND_SCRAMBLING_OWEN, seed);
+        int result[] = new int[dimensions * n];
+        curandGenerate(generator, Pointer.to(result), result.length);
+        curandDestroyGenerator(generator);
+        return result;
+    }
+
+    @Test
+    public void testHaltonAndLattice()
+    {
+        // The first 3^6 Halton points have one point in each interval
+        // of length 3^-6 in the second dimension, and the first 2^10
+        // lattice points have one point in each interval of length
+        // 2^-10 in all dimensions
+        assertStratified(CURAND_RNG_QUASI_HALTON, 1, 729);
+        assertStratified(CURAND_RNG_QUASI_LATTICE, 0, 1024);
+        assertStratified(CURAND_RNG_QUASI_LATTICE, 2, 1024);
+
+        for (int type : new int[] { CURAND_RNG_QUASI_HALTON, CURAND_RNG_QUASI_LATTICE })
+        {
+            curandGenerator generator = new curandGenerator();
+            curandCreateGenerator(generator, type);
+            curandSetQuasiRandomGeneratorDimensions(generator, 3);
+            curandSetQuasiRandomGeneratorScrambling(
+                generator, CURAND_SCRAMBLING_DEFAULT, 123);
+            curandSetQuasiRandomGeneratorLayout(
+                generator, CURAND_LAYOUT_ROW_MAJOR);
+            int all[] = new int[3 * 200];
+            curandGenerate(generator, Pointer.to(all), all.length);
+            curandSetGeneratorOffset(generator, 100);
+            int skipped[] = new int[3 * 100];
+            curandGenerate(generator, Pointer.to(skipped), skipped.length);
+            curandDestroyGenerator(generator);
+            assertArrayEquals(Arrays.copyOfRange(all, 300, 600), skipped);
+        }
+    }
+
+    private static void assertStratified(int type, int dimension, int n)
+    {
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, type);
+        curandSetQuasiRandomGeneratorDimensions(generator, 3);
+        double result[] = new double[3 * n];
+        curandGenerateUniformDouble(generator, Pointer.to(result), result.length);
+        curandDestroyGenerator(generator);
+        boolean occupied[] = new boolean[n];
+        for (int i = 0; i < n; i++)
+        {
+            int interval = (int)(result[dimension * n + i] * n);
+            assertFalse(occupied[interval]);
+            occupied[interval] = true;
+        }
+    }
+
+    @Test
+    public void testLatinHypercube()
+    {
+        // Each dimension has one point in each of the n strata, and the
+        // centered design uses the same strata
+        int n = 1000;
+        int dimensions = 3;
+        double random[] = generateLatinHypercube(n, dimensions, CURAND_LATIN_HYPERCUBE_RANDOM);
+        double centered[] = generateLatinHypercube(n, dimensions, CURAND_LATIN_HYPERCUBE_CENTERED);
+        double maximin[] = generateLatinHypercube(n, dimensions, CURAND_LATIN_HYPERCUBE_MAXIMIN);
+        for (int d = 0; d < dimensions; d++)
+        {
+            boolean occupied[] = new boolean[n];
+            boolean occupiedMaximin[] = new boolean[n];
+            for (int i = 0; i < n; i++)
+            {
+                int stratum = (int)(random[i * dimensions + d] * n);
+                assertFalse(occupied[stratum]);
+                occupied[stratum] = true;
+                assertEquals((stratum + 0.5) / n, centered[i * dimensions + d], 1e-12);
+                stratum = (int)(maximin[i * dimensions + d] * n);
+                assertFalse(occupiedMaximin[stratum]);
+                occupiedMaximin[stratum] = true;
+            }
+        }
+        assertArrayEquals(random, generateLatinHypercube(
+            n, dimensions, CURAND_LATIN_HYPERCUBE_RANDOM), 0.0);
+    }
+
+    private static double[] generateLatinHypercube(int n, int dimensions, int mode)
+    {
+        curandGenerator generator = createGenerator();
+        double result[] = new double[n * dimensions];
+        curandGenerateLatinHypercube(generator, Pointer.to(result),
+            n, dimensions, mode, CURAND_LAYOUT_ROW_MAJOR);
+        curandDestroyGenerator(generator);
+        return result;
+    }
+
+    private static curandGenerator createGenerator()
+    {
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        return generator;
+    }
+
+    private static void assertFit(double samples[], Cdf cdf)
+    {
+        double pValue =
+            StatisticalFunctions.kolmogorovSmirnovTest(samples, cdf)[1];
+        assertTrue("p-value " + pValue, pValue > 1e-4);
+    }
+
+    private static double[] toDouble(float data[])
+    {
+        double result[] = new double[data.length];
+        for (int i = 0; i < data.length; i++)
+        {
+            result[i] = data[i];
+        }
+        return result;
+    }
+
+    private static float[] generateUniform(long seed, int n)
+    {
+        curandGenerator generator = new curandGenerator();
+        curandCreateGenerator(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        curandSetPseudoRandomGeneratorSeed(generator, seed);
+        float result[] = new float[n];
+        curandGenerateUniform(generator, Pointer.to(result), n);
+        curandDestroyGenerator(generator);
+        return result;
+    }
+}
@@ -0,0 +1,74 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyDirectionFile;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandLoadDirectionFile;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorDimensions;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorDirectionFile;
+import static jcuda.jcurand.JCurand.curandWriteDirectionFile;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_SOBOL32;
+
+import java.io.File;
+import java.io.IOException;
+
+import jcuda.Pointer;
+
+/**
+ * Measures the time for converting a table of direction numbers by Joe
+ * and Kuo into a direction file, for loading the file, and for the
+ * first point of a Sobol generator with all dimensions of the file,
+ * compared to the first point with the 20000 built-in dimensions. The
+ * argument is the path of the table, like new-joe-kuo-6.21201. Requires
+ * the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandDirectionFileBenchmark new-joe-kuo-6.21201
+ * </pre>
+ */
+public class JCurandDirectionFileBenchmark
+{
+    public static void main(String[] args) throws IOException
+    {
+        JCurand.setExceptionsEnabled(true);
+        String table = args[0];
+        File file = File.createTempFile("JCurandDirections", ".bin");
+        file.deleteOnExit();
+
+        long before = System.nanoTime();
+        curandWriteDirectionFile(table, file.getPath(), 32, 0);
+        long afterWrite = System.nanoTime();
+        curandDirectionFile directionFile = new curandDirectionFile();
+        curandLoadDirectionFile(directionFile, file.getPath());
+        long afterLoad = System.nanoTime();
+        int dimensions = (int)((file.length() - 64) / (32 * 4));
+
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDirectionFile(generator, directionFile);
+        curandSetQuasiRandomGeneratorDimensions(generator, dimensions);
+        float point[] = new float[dimensions];
+        long beforeMapped = System.nanoTime();
+        curandGenerateUniform(generator, Pointer.to(point), dimensions);
+        long afterMapped = System.nanoTime();
+        curandDestroyGenerator(generator);
+        curandDestroyDirectionFile(directionFile);
+
+        generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, 20000);
+        float builtInPoint[] = new float[20000];
+        long beforeBuiltIn = System.nanoTime();
+        curandGenerateUniform(generator, Pointer.to(builtInPoint), 20000);
+        long afterBuiltIn = System.nanoTime();
+        curandDestroyGenerator(generator);
+        file.delete();
+
+        System.out.printf("Write direction file: %10.3f ms%n", (afterWrite - before) / 1e6);
+        System.out.printf("Load direction file:  %10.3f ms%n", (afterLoad - afterWrite) / 1e6);
+        System.out.printf("First point, %6d mapped dimensions:   %10.3f ms%n",
+            dimensions, (afterMapped - beforeMapped) / 1e6);
+        System.out.printf("First point,  20000 built-in dimensions: %10.3f ms%n",
+            (afterBuiltIn - beforeBuiltIn) / 1e6);
+    }
+}
@@ -0,0 +1,128 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateBeta;
+import static jcuda.jcurand.JCurand.curandGenerateExponential;
+import static jcuda.jcurand.JCurand.curandGenerateGamma;
+import static jcuda.jcurand.JCurand.curandGenerateNormal;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the generation of exponential, gamma and beta distributed
+ * values with the native functions to their computation in Java, from
+ * normal and uniform values that are generated in bulk. Requires the
+ * CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandDistributionBenchmark
+ * </pre>
+ */
+public class JCurandDistributionBenchmark
+{
+    private static final int N = 1 << 22;
+    private static final int RUNS = 10;
+
+    private static curandGenerator generator;
+    private static float normal[] = new float[N];
+    private static float uniform[] = new float[2 * N];
+    private static int normalIndex;
+    private static int uniformIndex;
+
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        float result[] = new float[N];
+        Pointer pointer = Pointer.to(result);
+
+        run("Exponential", () ->
+        {
+            curandGenerateUniform(generator, Pointer.to(uniform), N);
+            for (int i = 0; i < N; i++)
+            {
+                result[i] = (float)(-Math.log(uniform[i]) / 3.0);
+            }
+        }, () -> curandGenerateExponential(generator, pointer, N, 3.0f));
+        run("Gamma(2.5)", () ->
+        {
+            refill();
+            for (int i = 0; i < N; i++)
+            {
+                result[i] = (float)gamma(2.5);
+            }
+        }, () -> curandGenerateGamma(generator, pointer, N, 2.5f, 1.0f));
+        run("Beta(2,5)", () ->
+        {
+            refill();
+            for (int i = 0; i < N; i++)
+            {
+                double x = gamma(2.0);
+                double y = gamma(5.0);
+                result[i] = (float)(x / (x + y));
+            }
+        }, () -> curandGenerateBeta(generator, pointer, N, 2.0f, 5.0f));
+        curandDestroyGenerator(generator);
+    }
+
+    private static void run(String name, Runnable java, Runnable jcurand)
+    {
+        java.run();
+        jcurand.run();
+        long before = System.nanoTime();
+        for (int r = 0; r < RUNS; r++)
+        {
+            java.run();
+        }
+        long afterJava = System.nanoTime();
+        for (int r = 0; r < RUNS; r++)
+        {
+            jcurand.run();
+        }
+        long afterJCurand = System.nanoTime();
+        double values = (double)N * RUNS;
+        System.out.printf("%-12s: Java %8.1f M/s, JCurand %8.1f M/s%n", name,
+            values / ((afterJava - before) * 1e-3),
+            values / ((afterJCurand - afterJava) * 1e-3));
+    }
+
+    private static void refill()
+    {
+        curandGenerateNormal(generator, Pointer.to(normal), N, 0.0f, 1.0f);
+        curandGenerateUniform(generator, Pointer.to(uniform), 2 * N);
+        normalIndex = 0;
+        uniformIndex = 0;
+    }
+
+    /**
+     * A gamma sample with the method of Marsaglia and Tsang, for a
+     * shape of at least 1, as it is typically implemented in Java
+     */
+    private static double gamma(double shape)
+    {
+        double d = shape - 1.0 / 3.0;
+        double c = 1.0 / Math.sqrt(9.0 * d);
+        while (true)
+        {
+            if (normalIndex == N || uniformIndex == 2 * N)
+            {
+                refill();
+            }
+            double z = normal[normalIndex++];
+            double u = uniform[uniformIndex++];
+            double t = 1.0 + c * z;
+            if (t <= 0.0)
+            {
+                continue;
+            }
+            double v = t * t * t;
+            if (Math.log(u) < 0.5 * z * z + d - d * v + d * Math.log(v))
+            {
+                return d * v;
+            }
+        }
+    }
+}
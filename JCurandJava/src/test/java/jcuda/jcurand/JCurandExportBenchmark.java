@@ -0,0 +1,77 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandExportToFile;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.curandExportDistribution.CURAND_EXPORT_UNIFORM;
+import static jcuda.jcurand.curandExportFormat.CURAND_EXPORT_FORMAT_RAW;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.FileChannel;
+
+import jcuda.Pointer;
+
+/**
+ * Compares writing uniformly distributed floats into a file from Java,
+ * with curandGenerateUniform into a direct buffer and a FileChannel, to
+ * curandExportToFile. The optional arguments are the directory of the
+ * files and the size in gigabytes. Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandExportBenchmark /data 4
+ * </pre>
+ */
+public class JCurandExportBenchmark
+{
+    public static void main(String[] args) throws IOException
+    {
+        JCurand.setExceptionsEnabled(true);
+        File directory = new File(args.length > 0 ? args[0] : ".");
+        double gigabytes = args.length > 1 ? Double.parseDouble(args[1]) : 1.0;
+        long n = (long)(gigabytes * 1e9 / 4) / 2 * 2;
+        int chunkSize = 1 << 21;
+
+        File javaFile = new File(directory, "JCurandExportBenchmarkJava.bin");
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        ByteBuffer data = ByteBuffer.allocateDirect(chunkSize * 4)
+            .order(ByteOrder.nativeOrder());
+        Pointer pointer = Pointer.to(data);
+        long before = System.nanoTime();
+        try (FileChannel channel = new FileOutputStream(javaFile).getChannel())
+        {
+            for (long i = 0; i < n; i += chunkSize)
+            {
+                int count = (int)Math.min(chunkSize, n - i);
+                curandGenerateUniform(generator, pointer, count);
+                data.clear().limit(count * 4);
+                while (data.hasRemaining())
+                {
+                    channel.write(data);
+                }
+            }
+        }
+        long after = System.nanoTime();
+        curandDestroyGenerator(generator);
+        javaFile.delete();
+        System.out.printf("Java FileChannel:   %6.3f GB/s%n",
+            n * 4 / ((after - before) / 1e9) / 1e9);
+
+        File exportFile = new File(directory, "JCurandExportBenchmarkNative.bin");
+        generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        double gigabytesPerSecond[] = new double[1];
+        curandExportToFile(generator, exportFile.getPath(),
+            CURAND_EXPORT_UNIFORM, n, 0.0, 0.0, CURAND_EXPORT_FORMAT_RAW,
+            gigabytesPerSecond);
+        curandDestroyGenerator(generator);
+        exportFile.delete();
+        System.out.printf("curandExportToFile: %6.3f GB/s%n",
+            gigabytesPerSecond[0]);
+    }
+}
@@ -0,0 +1,79 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateNormal;
+import static jcuda.jcurand.JCurand.curandGenerateNormalBF16;
+import static jcuda.jcurand.JCurand.curandGenerateNormalHalf;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandGenerateUniformBF16;
+import static jcuda.jcurand.JCurand.curandGenerateUniformHalf;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the output bandwidth of the float generation functions with
+ * the functions that generate half and bfloat16 values. The output is
+ * written into direct buffers, so that the times do not include copies
+ * of Java arrays. Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandHalfBenchmark
+ * </pre>
+ */
+public class JCurandHalfBenchmark
+{
+    private interface Generation
+    {
+        void run(curandGenerator generator, Pointer output, int n);
+    }
+
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int n = 1 << 26;
+        int runs = 10;
+
+        benchmark("Uniform float", 4, n, runs,
+            (g, p, k) -> curandGenerateUniform(g, p, k));
+        benchmark("Uniform half", 2, n, runs,
+            (g, p, k) -> curandGenerateUniformHalf(g, p, k));
+        benchmark("Uniform bfloat16", 2, n, runs,
+            (g, p, k) -> curandGenerateUniformBF16(g, p, k));
+        benchmark("Normal float", 4, n, runs,
+            (g, p, k) -> curandGenerateNormal(g, p, k, 0.0f, 1.0f));
+        benchmark("Normal half", 2, n, runs,
+            (g, p, k) -> curandGenerateNormalHalf(g, p, k, 0.0f, 1.0f));
+        benchmark("Normal bfloat16", 2, n, runs,
+            (g, p, k) -> curandGenerateNormalBF16(g, p, k, 0.0f, 1.0f));
+    }
+
+    private static void benchmark(String name, int bytesPerValue, int n,
+        int runs, Generation generation)
+    {
+        ByteBuffer buffer = ByteBuffer.allocateDirect(n * bytesPerValue)
+            .order(ByteOrder.nativeOrder());
+        Pointer output = Pointer.to(buffer);
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+
+        // Warm up
+        generation.run(generator, output, n);
+
+        long before = System.nanoTime();
+        for (int i = 0; i < runs; i++)
+        {
+            generation.run(generator, output, n);
+        }
+        long after = System.nanoTime();
+        curandDestroyGenerator(generator);
+
+        double seconds = (after - before) * 1e-9;
+        double values = (double)n * runs;
+        System.out.printf("%-20s %10.3f Gvalues/s %10.3f GB/s%n", name,
+            values / seconds * 1e-9, values * bytesPerValue / seconds * 1e-9);
+    }
+}
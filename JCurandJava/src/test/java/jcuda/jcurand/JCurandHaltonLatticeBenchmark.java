@@ -0,0 +1,141 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandGenerateUniformDouble;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorDimensions;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorLayout;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorScrambling;
+import static jcuda.jcurand.curandLayout.CURAND_LAYOUT_ROW_MAJOR;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_HALTON;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_LATTICE;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_SOBOL32;
+import static jcuda.jcurand.curandScramblingMode.CURAND_SCRAMBLING_DEFAULT;
+import static jcuda.jcurand.curandScramblingMode.CURAND_SCRAMBLING_OWEN;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the Halton and rank-1 lattice generators with the Owen
+ * scrambled Sobol generator: The root mean square error over 16
+ * randomizations of the integrals of a periodic and of a non-periodic
+ * smooth function in 8 dimensions, and the throughput of generating
+ * uniform floats. Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandHaltonLatticeBenchmark
+ * </pre>
+ */
+public class JCurandHaltonLatticeBenchmark
+{
+    private static final int DIMENSIONS = 8;
+    private static final int REPLICATES = 16;
+
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int types[] = {
+            CURAND_RNG_QUASI_SOBOL32,
+            CURAND_RNG_QUASI_HALTON,
+            CURAND_RNG_QUASI_LATTICE };
+        String names[] = { "Sobol (Owen)", "Halton", "Lattice" };
+        for (int t = 0; t < types.length; t++)
+        {
+            for (int n = 1024; n <= 262144; n *= 4)
+            {
+                double periodic = 0;
+                double smooth = 0;
+                for (int r = 0; r < REPLICATES; r++)
+                {
+                    double x[] = generate(types[t], n, r);
+                    double e = integratePeriodic(x, n) - 1;
+                    periodic += e * e;
+                    e = integrateSmooth(x, n) - 1;
+                    smooth += e * e;
+                }
+                System.out.printf("%-12s %7d points: RMSE periodic %.3e, non-periodic %.3e%n",
+                    names[t], n, Math.sqrt(periodic / REPLICATES),
+                    Math.sqrt(smooth / REPLICATES));
+            }
+        }
+        for (int t = 0; t < types.length; t++)
+        {
+            System.out.printf("%-12s %8.1f M floats/s%n",
+                names[t], throughput(types[t]));
+        }
+    }
+
+    private static curandGenerator createGenerator(int type, long seed)
+    {
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, type);
+        curandSetQuasiRandomGeneratorDimensions(generator, DIMENSIONS);
+        curandSetQuasiRandomGeneratorScrambling(generator, type == CURAND_RNG_QUASI_SOBOL32 ?
+            CURAND_SCRAMBLING_OWEN : CURAND_SCRAMBLING_DEFAULT, seed);
+        return generator;
+    }
+
+    private static double[] generate(int type, int n, long seed)
+    {
+        curandGenerator generator = createGenerator(type, seed);
+        curandSetQuasiRandomGeneratorLayout(generator, CURAND_LAYOUT_ROW_MAJOR);
+        double x[] = new double[n * DIMENSIONS];
+        curandGenerateUniformDouble(generator, Pointer.to(x), x.length);
+        curandDestroyGenerator(generator);
+        return x;
+    }
+
+    /**
+     * The mean of the product of 1 + sin(2*pi*x)/(d+1), which has the
+     * integral 1
+     */
+    private static double integratePeriodic(double x[], int n)
+    {
+        double sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            double f = 1;
+            for (int d = 0; d < DIMENSIONS; d++)
+            {
+                f *= 1 + Math.sin(2 * Math.PI * x[i * DIMENSIONS + d]) / (d + 1);
+            }
+            sum += f;
+        }
+        return sum / n;
+    }
+
+    /**
+     * The mean of the product of 1 + (x-0.5)/(d+1), which has the
+     * integral 1
+     */
+    private static double integrateSmooth(double x[], int n)
+    {
+        double sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            double f = 1;
+            for (int d = 0; d < DIMENSIONS; d++)
+            {
+                f *= 1 + (x[i * DIMENSIONS + d] - 0.5) / (d + 1);
+            }
+            sum += f;
+        }
+        return sum / n;
+    }
+
+    private static double throughput(int type)
+    {
+        curandGenerator generator = createGenerator(type, 1);
+        float data[] = new float[1 << 24];
+        curandGenerateUniform(generator, Pointer.to(data), data.length);
+        int runs = 5;
+        long before = System.nanoTime();
+        for (int i = 0; i < runs; i++)
+        {
+            curandGenerateUniform(generator, Pointer.to(data), data.length);
+        }
+        long after = System.nanoTime();
+        curandDestroyGenerator(generator);
+        return (double)runs * data.length / ((after - before) / 1e9) / 1e6;
+    }
+}
@@ -0,0 +1,130 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateNormalDouble;
+import static jcuda.jcurand.JCurand.curandGenerateNormalDoubleArray;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the throughput and the longest stall of an allocating thread
+ * while a large Java array is filled with normal doubles, with
+ * Pointer.to(array) and with curandGenerateNormalDoubleArray for
+ * different chunk sizes. The number of collections and their total and
+ * average pause times are taken from the GarbageCollectorMXBeans.
+ * Requires the CPU backend, and a heap that can hold the array:
+ * <pre>
+ * java -Xmx2g -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandHeapArrayBenchmark
+ * </pre>
+ */
+public class JCurandHeapArrayBenchmark
+{
+    /**
+     * The longest time in nanoseconds between two allocations of the
+     * probe thread
+     */
+    private static volatile long maxStall;
+
+    /**
+     * Whether the probe thread should keep running
+     */
+    private static volatile boolean running;
+
+    public static void main(String[] args) throws InterruptedException
+    {
+        JCurand.setExceptionsEnabled(true);
+        int n = 1 << 26;
+        int runs = 3;
+        double data[] = new double[n];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        curandGenerateNormalDouble(generator, Pointer.to(data), n, 0.0, 1.0);
+
+        int chunkSizes[] = { 0, 1 << 14, 1 << 18, 1 << 22 };
+        for (int chunkSize : chunkSizes)
+        {
+            if (chunkSize > 0)
+            {
+                JCurand.setHeapArrayChunkSize(chunkSize);
+            }
+            Thread probe = startProbe();
+            long gcBefore[] = gcStatistics();
+            long before = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                if (chunkSize == 0)
+                {
+                    curandGenerateNormalDouble(
+                        generator, Pointer.to(data), n, 0.0, 1.0);
+                }
+                else
+                {
+                    curandGenerateNormalDoubleArray(
+                        generator, data, n, 0.0, 1.0);
+                }
+            }
+            long after = System.nanoTime();
+            long gcAfter[] = gcStatistics();
+            running = false;
+            probe.join();
+
+            String label = chunkSize == 0 ?
+                "Pointer.to(array):" : "chunks of " + chunkSize + ":";
+            long collections = gcAfter[0] - gcBefore[0];
+            long gcMillis = gcAfter[1] - gcBefore[1];
+            System.out.printf("%-22s %6.2f ns per value, %8.2f MB/s, "
+                + "longest stall %8.2f ms, %4d collections, GC time "
+                + "%5d ms, average pause %7.2f ms%n", label,
+                (after - before) / ((double)n * runs),
+                n * runs * 8.0 / 1e6 / ((after - before) / 1e9),
+                maxStall / 1e6, collections, gcMillis,
+                collections == 0 ? 0.0 : (double)gcMillis / collections);
+        }
+        curandDestroyGenerator(generator);
+    }
+
+    /**
+     * Starts a thread that keeps allocating small arrays, and records
+     * the longest time between two allocations
+     */
+    private static Thread startProbe()
+    {
+        maxStall = 0;
+        running = true;
+        Thread probe = new Thread(() ->
+        {
+            Object sink[] = new Object[1024];
+            long previous = System.nanoTime();
+            for (int i = 0; running; i++)
+            {
+                sink[i & 1023] = new byte[1024];
+                long now = System.nanoTime();
+                maxStall = Math.max(maxStall, now - previous);
+                previous = now;
+            }
+        });
+        probe.start();
+        return probe;
+    }
+
+    /**
+     * Returns the total number of collections and the total collection
+     * time in milliseconds of all garbage collectors
+     */
+    private static long[] gcStatistics()
+    {
+        long statistics[] = new long[2];
+        for (GarbageCollectorMXBean bean :
+            ManagementFactory.getGarbageCollectorMXBeans())
+        {
+            statistics[0] += Math.max(0, bean.getCollectionCount());
+            statistics[1] += Math.max(0, bean.getCollectionTime());
+        }
+        return statistics;
+    }
+}
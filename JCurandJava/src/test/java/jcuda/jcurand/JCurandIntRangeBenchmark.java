@@ -0,0 +1,60 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerate;
+import static jcuda.jcurand.JCurand.curandGenerateIntRange;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the generation of integers in a range with
+ * curandGenerateIntRange to the generation of 32 bit values with
+ * curandGenerate, followed by a (biased) modulo operation in Java.
+ * Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandIntRangeBenchmark
+ * </pre>
+ */
+public class JCurandIntRangeBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int n = 1 << 24;
+        int runs = 10;
+        int ranges[] = { 6, 1000, 100000, 1000000007 };
+        int result[] = new int[n];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        for (int range : ranges)
+        {
+            long checksum = 0;
+            long before = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerate(generator, Pointer.to(result), n);
+                for (int i = 0; i < n; i++)
+                {
+                    result[i] = Integer.remainderUnsigned(result[i], range);
+                }
+                checksum += result[n - 1];
+            }
+            long afterModulo = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateIntRange(
+                    generator, Pointer.to(result), n, 0, range - 1);
+                checksum += result[n - 1];
+            }
+            long afterRange = System.nanoTime();
+            double values = (double)n * runs;
+            System.out.printf("Range %10d: Java modulo %8.1f M/s, "
+                + "curandGenerateIntRange %8.1f M/s (%d)%n", range,
+                values / ((afterModulo - before) * 1e-3),
+                values / ((afterRange - afterModulo) * 1e-3), checksum);
+        }
+        curandDestroyGenerator(generator);
+    }
+}
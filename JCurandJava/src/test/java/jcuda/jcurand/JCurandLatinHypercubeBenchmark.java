@@ -0,0 +1,76 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateLatinHypercube;
+import static jcuda.jcurand.JCurand.curandGenerateUniformDouble;
+import static jcuda.jcurand.curandLatinHypercubeMode.CURAND_LATIN_HYPERCUBE_RANDOM;
+import static jcuda.jcurand.curandLayout.CURAND_LAYOUT_COLUMN_MAJOR;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import java.util.Random;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the time for generating a Latin hypercube design natively
+ * with building it in Java from uniform values and a shuffle of the
+ * strata of each dimension. The arguments are the number of points
+ * and of dimensions, by default 10000000 and 4. Requires the CPU
+ * backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandLatinHypercubeBenchmark 10000000 4
+ * </pre>
+ */
+public class JCurandLatinHypercubeBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int n = args.length > 0 ? Integer.parseInt(args[0]) : 10000000;
+        int dimensions = args.length > 1 ? Integer.parseInt(args[1]) : 4;
+        double x[] = new double[n * dimensions];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+
+        for (int run = 0; run < 3; run++)
+        {
+            long before = System.nanoTime();
+            curandGenerateLatinHypercube(generator, Pointer.to(x), n, dimensions,
+                CURAND_LATIN_HYPERCUBE_RANDOM, CURAND_LAYOUT_COLUMN_MAJOR);
+            long afterNative = System.nanoTime();
+            buildInJava(generator, x, n, dimensions);
+            long afterJava = System.nanoTime();
+            System.out.printf("%d x %d: native %8.3f ms, Java %8.3f ms%n",
+                n, dimensions, (afterNative - before) / 1e6,
+                (afterJava - afterNative) / 1e6);
+        }
+        curandDestroyGenerator(generator);
+    }
+
+    private static void buildInJava(curandGenerator generator, double x[],
+        int n, int dimensions)
+    {
+        curandGenerateUniformDouble(generator, Pointer.to(x), x.length);
+        Random random = new Random(0);
+        int strata[] = new int[n];
+        for (int d = 0; d < dimensions; d++)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                strata[i] = i;
+            }
+            for (int i = n - 1; i > 0; i--)
+            {
+                int j = random.nextInt(i + 1);
+                int t = strata[i];
+                strata[i] = strata[j];
+                strata[j] = t;
+            }
+            for (int i = 0; i < n; i++)
+            {
+                x[d * n + i] = (strata[i] + x[d * n + i]) / n;
+            }
+        }
+    }
+}
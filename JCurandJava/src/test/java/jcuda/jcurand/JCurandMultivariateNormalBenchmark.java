@@ -0,0 +1,101 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandCreateMultivariateNormal;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandDestroyMultivariateNormal;
+import static jcuda.jcurand.JCurand.curandGenerateMultivariateNormal;
+import static jcuda.jcurand.JCurand.curandGenerateNormal;
+import static jcuda.jcurand.curandLayout.CURAND_LAYOUT_COLUMN_MAJOR;
+import static jcuda.jcurand.curandLayout.CURAND_LAYOUT_ROW_MAJOR;
+import static jcuda.jcurand.curandMatrixType.CURAND_MATRIX_CHOLESKY_FACTOR;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the cost per value of curandGenerateMultivariateNormal to
+ * the generation of normal values with curandGenerateNormal and their
+ * multiplication with the Cholesky factor in Java, for different
+ * dimensions. Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandMultivariateNormalBenchmark
+ * </pre>
+ */
+public class JCurandMultivariateNormalBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int values = 1 << 22;
+        int runs = 5;
+        int dimensions[] = { 4, 16, 64, 256 };
+        float normal[] = new float[values];
+        float result[] = new float[values];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        for (int d : dimensions)
+        {
+            int n = values / d;
+
+            // A factor with a constant correlation between all elements
+            float factor[] = new float[d * d];
+            double factorDouble[] = new double[d * d];
+            for (int j = 0; j < d; j++)
+            {
+                for (int k = 0; k <= j; k++)
+                {
+                    factor[j * d + k] = k == j ? 1.0f : 0.1f;
+                    factorDouble[j * d + k] = factor[j * d + k];
+                }
+            }
+            curandMultivariateNormal distribution =
+                new curandMultivariateNormal();
+            curandCreateMultivariateNormal(distribution, d, null,
+                Pointer.to(factorDouble), CURAND_MATRIX_CHOLESKY_FACTOR);
+
+            long before = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateNormal(
+                    generator, Pointer.to(normal), n * d, 0.0f, 1.0f);
+                for (int i = 0; i < n; i++)
+                {
+                    int offset = i * d;
+                    for (int j = 0; j < d; j++)
+                    {
+                        float sum = 0.0f;
+                        for (int k = 0; k <= j; k++)
+                        {
+                            sum += factor[j * d + k] * normal[offset + k];
+                        }
+                        result[offset + j] = sum;
+                    }
+                }
+            }
+            long afterJava = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateMultivariateNormal(generator,
+                    Pointer.to(result), n, distribution,
+                    CURAND_LAYOUT_ROW_MAJOR);
+            }
+            long afterRows = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateMultivariateNormal(generator,
+                    Pointer.to(result), n, distribution,
+                    CURAND_LAYOUT_COLUMN_MAJOR);
+            }
+            long afterColumns = System.nanoTime();
+            curandDestroyMultivariateNormal(distribution);
+
+            double count = (double)n * d * runs;
+            System.out.printf("d=%4d: Normal and Java multiply %6.2f ns, "
+                + "row major %6.2f ns, column major %6.2f ns%n", d,
+                (afterJava - before) / count, (afterRows - afterJava) / count,
+                (afterColumns - afterRows) / count);
+        }
+        curandDestroyGenerator(generator);
+    }
+}
@@ -0,0 +1,125 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerate;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorDimensions;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorLayout;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorScrambling;
+import static jcuda.jcurand.curandLayout.CURAND_LAYOUT_ROW_MAJOR;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_SCRAMBLED_SOBOL32;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_SOBOL32;
+import static jcuda.jcurand.curandScramblingMode.CURAND_SCRAMBLING_OWEN;
+
+import java.util.Random;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the Owen scrambling of Sobol points with a random digital
+ * shift: The root mean square error of the integral of a smooth
+ * function over 64 independent scramblings, for increasing numbers
+ * of points, and the throughput of generating uniform floats. Requires
+ * the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandOwenBenchmark
+ * </pre>
+ */
+public class JCurandOwenBenchmark
+{
+    private static final int DIMENSIONS = 4;
+    private static final int REPLICATES = 64;
+
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        for (int n = 256; n <= 65536; n *= 4)
+        {
+            double shift = 0;
+            double owen = 0;
+            for (int r = 0; r < REPLICATES; r++)
+            {
+                double e = integrate(generate(n, -1), n, new Random(r)) - 1;
+                shift += e * e;
+                e = integrate(generate(n, r), n, null) - 1;
+                owen += e * e;
+            }
+            System.out.printf("%6d points: RMSE digital shift %.3e, Owen %.3e%n",
+                n, Math.sqrt(shift / REPLICATES), Math.sqrt(owen / REPLICATES));
+        }
+        System.out.printf("Digital shift: %8.1f M floats/s%n", throughput(false));
+        System.out.printf("Owen:          %8.1f M floats/s%n", throughput(true));
+    }
+
+    /**
+     * Generate n row-major points, Owen scrambled with the given seed,
+     * or unscrambled if the seed is negative
+     */
+    private static int[] generate(int n, long seed)
+    {
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_QUASI_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, DIMENSIONS);
+        curandSetQuasiRandomGeneratorLayout(generator, CURAND_LAYOUT_ROW_MAJOR);
+        if (seed >= 0)
+        {
+            curandSetQuasiRandomGeneratorScrambling(
+                generator, CURAND_SCRAMBLING_OWEN, seed);
+        }
+        int points[] = new int[n * DIMENSIONS];
+        curandGenerate(generator, Pointer.to(points), points.length);
+        curandDestroyGenerator(generator);
+        return points;
+    }
+
+    /**
+     * The mean of the product of 3*x*x over all dimensions, which has
+     * the integral 1, with a random digital shift if the given random
+     * is not null
+     */
+    private static double integrate(int points[], int n, Random random)
+    {
+        int shifts[] = new int[DIMENSIONS];
+        for (int d = 0; d < DIMENSIONS && random != null; d++)
+        {
+            shifts[d] = random.nextInt();
+        }
+        double sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            double f = 1;
+            for (int d = 0; d < DIMENSIONS; d++)
+            {
+                int bits = points[i * DIMENSIONS + d] ^ shifts[d];
+                double x = ((bits & 0xFFFFFFFFL) + 0.5) / 4294967296.0;
+                f *= 3 * x * x;
+            }
+            sum += f;
+        }
+        return sum / n;
+    }
+
+    private static double throughput(boolean owen)
+    {
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_QUASI_SCRAMBLED_SOBOL32);
+        curandSetQuasiRandomGeneratorDimensions(generator, 16);
+        if (owen)
+        {
+            curandSetQuasiRandomGeneratorScrambling(
+                generator, CURAND_SCRAMBLING_OWEN, 1);
+        }
+        float data[] = new float[1 << 24];
+        curandGenerateUniform(generator, Pointer.to(data), data.length);
+        int runs = 5;
+        long before = System.nanoTime();
+        for (int i = 0; i < runs; i++)
+        {
+            curandGenerateUniform(generator, Pointer.to(data), data.length);
+        }
+        long after = System.nanoTime();
+        curandDestroyGenerator(generator);
+        return (double)runs * data.length / ((after - before) / 1e9) / 1e6;
+    }
+}
@@ -0,0 +1,64 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerate;
+import static jcuda.jcurand.JCurand.curandGeneratePermutation;
+import static jcuda.jcurand.JCurand.curandSampleWithoutReplacement;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the cost per element of curandGeneratePermutation to a
+ * Fisher-Yates shuffle in Java with the results of curandGenerate,
+ * and the cost of curandSampleWithoutReplacement for small samples.
+ * Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandPermutationBenchmark
+ * </pre>
+ */
+public class JCurandPermutationBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int sizes[] = { 1 << 20, 1 << 24, 100000000 };
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        for (int n : sizes)
+        {
+            int words[] = new int[n];
+            int result[] = new int[n];
+            int sample[] = new int[n / 100];
+
+            long before = System.nanoTime();
+            curandGenerate(generator, Pointer.to(words), n);
+            for (int i = 0; i < n; i++)
+            {
+                result[i] = i;
+            }
+            for (int i = n - 1; i > 0; i--)
+            {
+                int j = (int)(((words[i] & 0xFFFFFFFFL) * (i + 1)) >>> 32);
+                int t = result[i];
+                result[i] = result[j];
+                result[j] = t;
+            }
+            long afterJava = System.nanoTime();
+            curandGeneratePermutation(generator, Pointer.to(result), n);
+            long afterNative = System.nanoTime();
+            curandSampleWithoutReplacement(
+                generator, Pointer.to(sample), n, sample.length);
+            long afterSample = System.nanoTime();
+
+            System.out.printf("n=%9d: Java Fisher-Yates %6.2f ns, "
+                + "curandGeneratePermutation %6.2f ns, "
+                + "curandSampleWithoutReplacement(n/100) %6.2f ns%n", n,
+                (double)(afterJava - before) / n,
+                (double)(afterNative - afterJava) / n,
+                (double)(afterSample - afterNative) / sample.length);
+        }
+        curandDestroyGenerator(generator);
+    }
+}
@@ -0,0 +1,66 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateNormal;
+import static jcuda.jcurand.JCurand.curandGenerateNormal2D;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import jcuda.Pointer;
+import jcuda.Sizeof;
+
+/**
+ * Compares the cost per value of filling a block and a column of a
+ * row-major matrix by generating into a temporary array and copying, to
+ * curandGenerateNormal2D. Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandPitchedOutputBenchmark
+ * </pre>
+ */
+public class JCurandPitchedOutputBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int size = 4096;
+        int runs = 10;
+        float matrix[] = new float[size * size];
+        float temp[] = new float[size * size];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+
+        int colCounts[] = { 1, 16, 1024 };
+        for (int cols : colCounts)
+        {
+            int n = size * cols;
+            int offset = size / 2;
+            long before = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateNormal(
+                    generator, Pointer.to(temp), n, 0.0f, 1.0f);
+                for (int row = 0; row < size; row++)
+                {
+                    System.arraycopy(temp, row * cols,
+                        matrix, row * size + offset, cols);
+                }
+            }
+            long afterCopy = System.nanoTime();
+            Pointer block =
+                Pointer.to(matrix).withByteOffset(offset * Sizeof.FLOAT);
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateNormal2D(
+                    generator, block, size, cols, size, 0.0f, 1.0f);
+            }
+            long afterPitched = System.nanoTime();
+
+            double count = (double)n * runs;
+            System.out.printf("cols=%4d: temporary and copy %6.2f ns, "
+                + "curandGenerateNormal2D %6.2f ns%n", cols,
+                (afterCopy - before) / count,
+                (afterPitched - afterCopy) / count);
+        }
+        curandDestroyGenerator(generator);
+    }
+}
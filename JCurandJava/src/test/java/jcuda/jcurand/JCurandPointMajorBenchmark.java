@@ -0,0 +1,70 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorDimensions;
+import static jcuda.jcurand.JCurand.curandSetQuasiRandomGeneratorLayout;
+import static jcuda.jcurand.curandLayout.CURAND_LAYOUT_ROW_MAJOR;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_QUASI_SOBOL32;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the cost per value of point-major Sobol points, computed by
+ * transposing the dimension-major output of curandGenerateUniform in
+ * Java, to the output with CURAND_LAYOUT_ROW_MAJOR. Requires the CPU
+ * backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandPointMajorBenchmark
+ * </pre>
+ */
+public class JCurandPointMajorBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int values = 1 << 24;
+        int runs = 5;
+        int dimensionCounts[] = { 2, 20, 200, 2000, 3667 };
+        for (int dimensions : dimensionCounts)
+        {
+            int points = values / dimensions;
+            int n = points * dimensions;
+            float data[] = new float[n];
+            float transposed[] = new float[n];
+            curandGenerator generator = new curandGenerator();
+            curandCreateGeneratorHost(generator, CURAND_RNG_QUASI_SOBOL32);
+            curandSetQuasiRandomGeneratorDimensions(generator, dimensions);
+            curandGenerateUniform(generator, Pointer.to(data), n);
+
+            long before = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateUniform(generator, Pointer.to(data), n);
+                for (int d = 0; d < dimensions; d++)
+                {
+                    for (int p = 0; p < points; p++)
+                    {
+                        transposed[p * dimensions + d] = data[d * points + p];
+                    }
+                }
+            }
+            long afterTranspose = System.nanoTime();
+            curandSetQuasiRandomGeneratorLayout(
+                generator, CURAND_LAYOUT_ROW_MAJOR);
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateUniform(generator, Pointer.to(data), n);
+            }
+            long afterPointMajor = System.nanoTime();
+            curandDestroyGenerator(generator);
+
+            double count = (double)n * runs;
+            System.out.printf("dimensions=%5d: transposed in Java %6.2f ns, "
+                + "point-major %6.2f ns%n", dimensions,
+                (afterTranspose - before) / count,
+                (afterPointMajor - afterTranspose) / count);
+        }
+    }
+}
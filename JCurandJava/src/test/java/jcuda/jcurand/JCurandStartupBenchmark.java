@@ -0,0 +1,66 @@
+package jcuda.jcurand;
+
+import java.lang.reflect.Method;
+
+/**
+ * Measures the startup time of JCurand: The time for loading the native
+ * library, and the time for the first CURAND call, which loads the
+ * CURAND library (or falls back to the CPU backend). Each measurement
+ * should be done in a new JVM, for example
+ * <pre>
+ * java jcuda.jcurand.JCurandStartupBenchmark
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandStartupBenchmark
+ * </pre>
+ * The baseline is the released JCurand 12.6.0, whose native library is
+ * linked against libcurand, so that libcurand is loaded together with
+ * it. The benchmark only uses methods of that release when the backend
+ * functions are missing, so the same class can be run with its JARs:
+ * <pre>
+ * java -cp jcuda-12.6.0.jar:jcurand-12.6.0.jar:jcurand-natives-12.6.0-linux-x86_64.jar:test-classes
+ *     jcuda.jcurand.JCurandStartupBenchmark
+ * </pre>
+ */
+public class JCurandStartupBenchmark
+{
+    public static void main(String[] args) throws Exception
+    {
+        long before = System.nanoTime();
+        JCurand.initialize();
+        long afterInitialize = System.nanoTime();
+        String backend = getBackend();
+        long afterBackend = System.nanoTime();
+        curandGenerator generator = new curandGenerator();
+        JCurand.curandCreateGeneratorHost(generator,
+            curandRngType.CURAND_RNG_PSEUDO_DEFAULT);
+        long afterCreate = System.nanoTime();
+        JCurand.curandDestroyGenerator(generator);
+
+        System.out.printf("Backend                  : %s%n",
+            backend);
+        System.out.printf("Load native library      : %8.3f ms%n",
+            (afterInitialize - before) / 1e6);
+        System.out.printf("Resolve backend          : %8.3f ms%n",
+            (afterBackend - afterInitialize) / 1e6);
+        System.out.printf("Create first generator   : %8.3f ms%n",
+            (afterCreate - afterBackend) / 1e6);
+    }
+
+    /**
+     * Returns the name of the backend, or a description of the baseline
+     * when JCurand.getBackend does not exist
+     */
+    private static String getBackend() throws Exception
+    {
+        Method method;
+        try
+        {
+            method = JCurand.class.getMethod("getBackend");
+        }
+        catch (NoSuchMethodException e)
+        {
+            return "CURAND (linked, baseline)";
+        }
+        int backend = (Integer)method.invoke(null);
+        return JCurandBackend.stringFor(backend);
+    }
+}
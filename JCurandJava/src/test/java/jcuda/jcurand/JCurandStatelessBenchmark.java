@@ -0,0 +1,93 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandPhiloxUniform;
+import static jcuda.jcurand.JCurand.curandPhiloxUniformGather;
+import static jcuda.jcurand.JCurand.curandSetGeneratorOffset;
+import static jcuda.jcurand.JCurand.curandSetPseudoRandomGeneratorSeed;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.LongBuffer;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the cost per value of a Philox generator to the stateless
+ * curandPhiloxUniform, and to curandPhiloxUniformGather for one value of
+ * each of many logical streams, which are given by disjoint ranges of
+ * offsets. The last case is also computed with one generator for each
+ * stream. Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandStatelessBenchmark
+ * </pre>
+ */
+public class JCurandStatelessBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int n = 1 << 22;
+        int runs = 10;
+        long seed = 42;
+        ByteBuffer data = ByteBuffer.allocateDirect(n * 4)
+            .order(ByteOrder.nativeOrder());
+        Pointer pointer = Pointer.to(data);
+
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        curandSetPseudoRandomGeneratorSeed(generator, seed);
+        long before = System.nanoTime();
+        for (int r = 0; r < runs; r++)
+        {
+            curandGenerateUniform(generator, pointer, n);
+        }
+        long afterGenerator = System.nanoTime();
+        for (int r = 0; r < runs; r++)
+        {
+            curandPhiloxUniform(seed, 0, (long)r * n, pointer, n);
+        }
+        long afterStateless = System.nanoTime();
+
+        // The value at a step of each of n streams of 2^40 words each
+        LongBuffer offsets = ByteBuffer.allocateDirect(n * 8)
+            .order(ByteOrder.nativeOrder()).asLongBuffer();
+        for (int s = 0; s < n; s++)
+        {
+            offsets.put(s, ((long)s << 40) + (s * 31L) % 1000);
+        }
+        long beforeGather = System.nanoTime();
+        for (int r = 0; r < runs; r++)
+        {
+            curandPhiloxUniformGather(
+                seed, 0, Pointer.to(offsets), pointer, n);
+        }
+        long afterGather = System.nanoTime();
+
+        int streams = n / 64;
+        Pointer single = Pointer.to(new float[1]);
+        long beforeStreams = System.nanoTime();
+        for (int s = 0; s < streams; s++)
+        {
+            curandSetGeneratorOffset(generator, offsets.get(s));
+            curandGenerateUniform(generator, single, 1);
+        }
+        long afterStreams = System.nanoTime();
+        curandDestroyGenerator(generator);
+
+        double count = (double)n * runs;
+        print("generator:", (afterGenerator - before) / count);
+        print("stateless:", (afterStateless - afterGenerator) / count);
+        print("gather, one per stream:", (afterGather - beforeGather) / count);
+        print("generator, offset per stream:",
+            (afterStreams - beforeStreams) / (double)streams);
+    }
+
+    private static void print(String name, double nanosPerValue)
+    {
+        System.out.printf("%-30s %7.2f ns per value%n", name, nanosPerValue);
+    }
+}
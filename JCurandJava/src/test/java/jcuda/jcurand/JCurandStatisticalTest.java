@@ -0,0 +1,539 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerate;
+import static jcuda.jcurand.JCurand.curandGenerateLogNormal;
+import static jcuda.jcurand.JCurand.curandGenerateLogNormalDouble;
+import static jcuda.jcurand.JCurand.curandGenerateNormal;
+import static jcuda.jcurand.JCurand.curandGenerateNormalDouble;
+import static jcuda.jcurand.JCurand.curandGeneratePoisson;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandGenerateUniformDouble;
+import static jcuda.jcurand.JCurand.curandSetPseudoRandomGeneratorSeed;
+import static jcuda.jcurand.curandRngType.*;
+import static org.junit.Assert.assertTrue;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
+import org.junit.After;
+import org.junit.Assume;
+import org.junit.Before;
+import org.junit.Test;
+
+import jcuda.Pointer;
+
+/**
+ * A battery of statistical tests, similar to the SmallCrush battery of
+ * TestU01, that is applied to all generator types and distributions of
+ * the host API. It uses host generators, so it runs with the backend that
+ * is selected with the <code>jcuda.jcurand.backend</code> property, or
+ * with the CPU backend when CURAND is not available.<br>
+ * <br>
+ * The tests are executed in parallel, one task for each generator type
+ * and test. For each test, the statistic, the p-value and the number of
+ * samples per second of the generation (excluding the evaluation) are
+ * printed. A test fails when its p-value is smaller than
+ * {@link #P_VALUE_THRESHOLD} or larger than 1-{@link #P_VALUE_THRESHOLD}.
+ * Quasirandom sequences are more uniform than random ones, so for them,
+ * only the lower bound is checked, and the tests that depend on the
+ * independence of successive values are skipped.<br>
+ * <br>
+ * The battery takes minutes, so the test only runs when the
+ * <code>jcuda.jcurand.statisticalTests</code> property is true:
+ * <pre>
+ * mvn test -Djcuda.jcurand.statisticalTests=true -Djcuda.jcurand.backend=CPU
+ * </pre>
+ * The battery can also be started with the main method.
+ */
+public class JCurandStatisticalTest
+{
+    /**
+     * The threshold for p-values that are considered to be a failure
+     */
+    private static final double P_VALUE_THRESHOLD = 1e-4;
+
+    /**
+     * The generator types that are tested
+     */
+    private static final int RNG_TYPES[] =
+    {
+        CURAND_RNG_PSEUDO_XORWOW,
+        CURAND_RNG_PSEUDO_MRG32K3A,
+        CURAND_RNG_PSEUDO_MTGP32,
+        CURAND_RNG_PSEUDO_MT19937,
+        CURAND_RNG_PSEUDO_PHILOX4_32_10,
+        CURAND_RNG_QUASI_SOBOL32,
+        CURAND_RNG_QUASI_SCRAMBLED_SOBOL32,
+        CURAND_RNG_QUASI_SOBOL64,
+        CURAND_RNG_QUASI_SCRAMBLED_SOBOL64,
+        CURAND_RNG_QUASI_HALTON,
+        CURAND_RNG_QUASI_LATTICE
+    };
+
+    /**
+     * The result of one test for one generator type
+     */
+    private static class Result
+    {
+        String rngType;
+        String test;
+        double statistic;
+        double pValue;
+        long samples;
+        long nanos;
+        boolean passed;
+
+        void addSamples(long n, long nanos)
+        {
+            this.samples += n;
+            this.nanos += nanos;
+        }
+
+        @Override
+        public String toString()
+        {
+            double samplesPerSecond = samples / (Math.max(1, nanos) * 1e-9);
+            return String.format("%-36s %-24s %14.4f %10.6f %10d %10.3e %s",
+                rngType, test, statistic, pValue, samples, samplesPerSecond,
+                passed ? "" : "FAILED");
+        }
+    }
+
+    /**
+     * One test of the battery
+     */
+    private interface BatteryTest
+    {
+        /**
+         * Run the test with the given generator, and write the statistic
+         * and p-value into the given result
+         */
+        void run(curandGenerator generator, Result result);
+    }
+
+    @Before
+    public void setUp()
+    {
+        JCurand.setExceptionsEnabled(true);
+    }
+
+    @After
+    public void tearDown()
+    {
+        JCurand.setExceptionsEnabled(false);
+    }
+
+    public static void main(String[] args) throws Exception
+    {
+        JCurand.setExceptionsEnabled(true);
+        runBattery();
+    }
+
+    @Test
+    public void testBattery() throws Exception
+    {
+        Assume.assumeTrue(Boolean.getBoolean("jcuda.jcurand.statisticalTests"));
+        List<Result> results = runBattery();
+        for (Result result : results)
+        {
+            assertTrue(result.toString(), result.passed);
+        }
+    }
+
+    /**
+     * Run all tests for all generator types, print the results, and
+     * return them
+     */
+    private static List<Result> runBattery() throws Exception
+    {
+        System.out.println("Backend: " +
+            JCurandBackend.stringFor(JCurand.getBackend()));
+        System.out.println(String.format("%-36s %-24s %14s %10s %10s %10s",
+            "Generator", "Test", "Statistic", "p-value", "Samples",
+            "Samples/s"));
+
+        int threads = Runtime.getRuntime().availableProcessors();
+        ExecutorService executor = Executors.newFixedThreadPool(threads);
+        List<Future<Result>> futures = new ArrayList<Future<Result>>();
+        long seed = 1234;
+        boolean cpu = JCurand.getBackend() == JCurandBackend.JCURAND_BACKEND_CPU;
+        for (int rngType : RNG_TYPES)
+        {
+            // The Halton and lattice generators only exist in the CPU backend
+            if (!cpu && (rngType == CURAND_RNG_QUASI_HALTON ||
+                rngType == CURAND_RNG_QUASI_LATTICE))
+            {
+                continue;
+            }
+            boolean quasi = rngType >= CURAND_RNG_QUASI_DEFAULT;
+            submit(executor, futures, rngType, seed++, "Frequency",
+                JCurandStatisticalTest::frequency);
+            submit(executor, futures, rngType, seed++, "Frequency (double)",
+                JCurandStatisticalTest::frequencyDouble);
+            if (!quasi)
+            {
+                submit(executor, futures, rngType, seed++, "Serial",
+                    JCurandStatisticalTest::serial);
+                submit(executor, futures, rngType, seed++, "Gap",
+                    JCurandStatisticalTest::gap);
+                submit(executor, futures, rngType, seed++, "Birthday spacing",
+                    JCurandStatisticalTest::birthdaySpacing);
+            }
+            submit(executor, futures, rngType, seed++, "KS normal",
+                JCurandStatisticalTest::normal);
+            submit(executor, futures, rngType, seed++, "KS normal (double)",
+                JCurandStatisticalTest::normalDouble);
+            submit(executor, futures, rngType, seed++, "KS lognormal",
+                JCurandStatisticalTest::logNormal);
+            submit(executor, futures, rngType, seed++, "KS lognormal (double)",
+                JCurandStatisticalTest::logNormalDouble);
+            submit(executor, futures, rngType, seed++, "Chi-square Poisson 4",
+                (g, r) -> poisson(g, r, 4.0));
+            submit(executor, futures, rngType, seed++, "Chi-square Poisson 1000",
+                (g, r) -> poisson(g, r, 1000.0));
+        }
+
+        long before = System.nanoTime();
+        List<Result> results = new ArrayList<Result>();
+        for (Future<Result> future : futures)
+        {
+            Result result = future.get();
+            System.out.println(result);
+            results.add(result);
+        }
+        executor.shutdown();
+        long after = System.nanoTime();
+        System.out.printf("Battery completed in %.3f s with %d threads%n",
+            (after - before) * 1e-9, threads);
+        return results;
+    }
+
+    private static void submit(ExecutorService executor,
+        List<Future<Result>> futures, int rngType, long seed, String name,
+        BatteryTest test)
+    {
+        futures.add(executor.submit(() ->
+        {
+            Result result = new Result();
+            result.rngType = curandRngType.stringFor(rngType);
+            result.test = name;
+            curandGenerator generator = new curandGenerator();
+            curandCreateGeneratorHost(generator, rngType);
+            boolean quasi = rngType >= CURAND_RNG_QUASI_DEFAULT;
+            if (!quasi)
+            {
+                curandSetPseudoRandomGeneratorSeed(generator, seed);
+            }
+            try
+            {
+                test.run(generator, result);
+            }
+            finally
+            {
+                curandDestroyGenerator(generator);
+            }
+            result.passed = result.pValue >= P_VALUE_THRESHOLD &&
+                (quasi || result.pValue <= 1.0 - P_VALUE_THRESHOLD);
+            return result;
+        }));
+    }
+
+    /**
+     * Chi-square test of the distribution of uniform floats in 256 bins
+     */
+    private static void frequency(curandGenerator generator, Result result)
+    {
+        int bins = 256;
+        float data[] = generateUniform(generator, 1 << 22, result);
+        long observed[] = new long[bins];
+        for (float f : data)
+        {
+            observed[bin(f, bins)]++;
+        }
+        setChiSquare(result, observed, uniformExpected(bins, data.length));
+    }
+
+    /**
+     * Chi-square test of the distribution of uniform doubles in 256 bins
+     */
+    private static void frequencyDouble(
+        curandGenerator generator, Result result)
+    {
+        int n = 1 << 22;
+        int bins = 256;
+        double data[] = new double[n];
+        long before = System.nanoTime();
+        curandGenerateUniformDouble(generator, Pointer.to(data), n);
+        result.addSamples(n, System.nanoTime() - before);
+        long observed[] = new long[bins];
+        for (double d : data)
+        {
+            observed[Math.min(bins - 1, (int)(d * bins))]++;
+        }
+        setChiSquare(result, observed, uniformExpected(bins, n));
+    }
+
+    /**
+     * Chi-square test of the distribution of non-overlapping pairs of
+     * uniform floats in 64x64 cells
+     */
+    private static void serial(curandGenerator generator, Result result)
+    {
+        int bins = 64;
+        float data[] = generateUniform(generator, 1 << 22, result);
+        long observed[] = new long[bins * bins];
+        for (int i = 0; i + 1 < data.length; i += 2)
+        {
+            observed[bin(data[i], bins) * bins + bin(data[i + 1], bins)]++;
+        }
+        setChiSquare(result, observed,
+            uniformExpected(bins * bins, data.length / 2));
+    }
+
+    /**
+     * Gap test (Knuth): Chi-square test of the lengths of the gaps
+     * between uniform floats that fall into [0, 1/8)
+     */
+    private static void gap(curandGenerator generator, Result result)
+    {
+        double p = 0.125;
+        int maxGap = 40;
+        float data[] = generateUniform(generator, 1 << 22, result);
+        long observed[] = new long[maxGap + 1];
+        long gaps = 0;
+        int length = 0;
+        for (float f : data)
+        {
+            if (f < p)
+            {
+                observed[Math.min(length, maxGap)]++;
+                gaps++;
+                length = 0;
+            }
+            else
+            {
+                length++;
+            }
+        }
+        double expected[] = new double[maxGap + 1];
+        for (int r = 0; r < maxGap; r++)
+        {
+            expected[r] = gaps * p * Math.pow(1.0 - p, r);
+        }
+        expected[maxGap] = gaps * Math.pow(1.0 - p, maxGap);
+        setChiSquare(result, observed, expected);
+    }
+
+    /**
+     * Birthday spacings test (Marsaglia): For 512 birthdays in a year of
+     * 2^24 days, taken from the upper bits of the raw 32 bit values, the
+     * number of duplicate spacings is Poisson distributed with mean 2.
+     * This is repeated 2000 times, and the counts are compared with a
+     * chi-square test.
+     */
+    private static void birthdaySpacing(
+        curandGenerator generator, Result result)
+    {
+        int m = 512;
+        int repetitions = 2000;
+        double lambda = 2.0;
+        int maxCount = 10;
+        int data[] = new int[m * repetitions];
+        long before = System.nanoTime();
+        curandGenerate(generator, Pointer.to(data), data.length);
+        result.addSamples(data.length, System.nanoTime() - before);
+
+        long observed[] = new long[maxCount + 1];
+        int days[] = new int[m];
+        int spacings[] = new int[m];
+        for (int r = 0; r < repetitions; r++)
+        {
+            for (int i = 0; i < m; i++)
+            {
+                days[i] = data[r * m + i] >>> 8;
+            }
+            Arrays.sort(days);
+            spacings[0] = days[0];
+            for (int i = 1; i < m; i++)
+            {
+                spacings[i] = days[i] - days[i - 1];
+            }
+            Arrays.sort(spacings);
+            int duplicates = 0;
+            for (int i = 1; i < m; i++)
+            {
+                if (spacings[i] == spacings[i - 1])
+                {
+                    duplicates++;
+                }
+            }
+            observed[Math.min(duplicates, maxCount)]++;
+        }
+        setChiSquare(result, observed,
+            poissonExpected(lambda, maxCount, repetitions));
+    }
+
+    /**
+     * Kolmogorov-Smirnov test of normally distributed floats
+     */
+    private static void normal(curandGenerator generator, Result result)
+    {
+        int n = 1 << 20;
+        float data[] = new float[n];
+        long before = System.nanoTime();
+        curandGenerateNormal(generator, Pointer.to(data), n, 0.0f, 1.0f);
+        result.addSamples(n, System.nanoTime() - before);
+        setKolmogorovSmirnov(result, toDouble(data),
+            StatisticalFunctions::normalCdf);
+    }
+
+    /**
+     * Kolmogorov-Smirnov test of normally distributed doubles
+     */
+    private static void normalDouble(curandGenerator generator, Result result)
+    {
+        int n = 1 << 20;
+        double data[] = new double[n];
+        long before = System.nanoTime();
+        curandGenerateNormalDouble(generator, Pointer.to(data), n, 0.0, 1.0);
+        result.addSamples(n, System.nanoTime() - before);
+        setKolmogorovSmirnov(result, data,
+            StatisticalFunctions::normalCdf);
+    }
+
+    /**
+     * Kolmogorov-Smirnov test of log-normally distributed floats
+     */
+    private static void logNormal(curandGenerator generator, Result result)
+    {
+        int n = 1 << 20;
+        float data[] = new float[n];
+        long before = System.nanoTime();
+        curandGenerateLogNormal(generator, Pointer.to(data), n, 0.5f, 0.75f);
+        result.addSamples(n, System.nanoTime() - before);
+        setKolmogorovSmirnov(result, toDouble(data),
+            x -> logNormalCdf(x, 0.5, 0.75));
+    }
+
+    /**
+     * Kolmogorov-Smirnov test of log-normally distributed doubles
+     */
+    private static void logNormalDouble(
+        curandGenerator generator, Result result)
+    {
+        int n = 1 << 20;
+        double data[] = new double[n];
+        long before = System.nanoTime();
+        curandGenerateLogNormalDouble(
+            generator, Pointer.to(data), n, 0.5, 0.75);
+        result.addSamples(n, System.nanoTime() - before);
+        setKolmogorovSmirnov(result, data, x -> logNormalCdf(x, 0.5, 0.75));
+    }
+
+    /**
+     * Chi-square test of Poisson distributed values
+     */
+    private static void poisson(
+        curandGenerator generator, Result result, double lambda)
+    {
+        int n = 1 << 20;
+        int maxCount = (int)(lambda + 10 * Math.sqrt(lambda) + 10);
+        int data[] = new int[n];
+        long before = System.nanoTime();
+        curandGeneratePoisson(generator, Pointer.to(data), n, lambda);
+        result.addSamples(n, System.nanoTime() - before);
+        long observed[] = new long[maxCount + 1];
+        for (int k : data)
+        {
+            observed[Math.min(k, maxCount)]++;
+        }
+        setChiSquare(result, observed, poissonExpected(lambda, maxCount, n));
+    }
+
+    private static float[] generateUniform(
+        curandGenerator generator, int n, Result result)
+    {
+        float data[] = new float[n];
+        long before = System.nanoTime();
+        curandGenerateUniform(generator, Pointer.to(data), n);
+        result.addSamples(n, System.nanoTime() - before);
+        return data;
+    }
+
+    /**
+     * Returns the bin for a value in (0,1]
+     */
+    private static int bin(float f, int bins)
+    {
+        return Math.min(bins - 1, (int)(f * bins));
+    }
+
+    private static double[] uniformExpected(int bins, long n)
+    {
+        double expected[] = new double[bins];
+        Arrays.fill(expected, (double)n / bins);
+        return expected;
+    }
+
+    /**
+     * Returns the expected counts of the values 0...maxCount-1 of the
+     * Poisson distribution, and of all values &gt;= maxCount
+     */
+    private static double[] poissonExpected(
+        double lambda, int maxCount, long n)
+    {
+        double expected[] = new double[maxCount + 1];
+        double sum = 0.0;
+        for (int k = 0; k < maxCount; k++)
+        {
+            double p = StatisticalFunctions.poissonPmf(k, lambda);
+            expected[k] = n * p;
+            sum += p;
+        }
+        expected[maxCount] = n * Math.max(0.0, 1.0 - sum);
+        return expected;
+    }
+
+    private static double logNormalCdf(double x, double mean, double stddev)
+    {
+        if (x <= 0.0)
+        {
+            return 0.0;
+        }
+        return StatisticalFunctions.normalCdf((Math.log(x) - mean) / stddev);
+    }
+
+    private static double[] toDouble(float data[])
+    {
+        double result[] = new double[data.length];
+        for (int i = 0; i < data.length; i++)
+        {
+            result[i] = data[i];
+        }
+        return result;
+    }
+
+    private static void setChiSquare(
+        Result result, long observed[], double expected[])
+    {
+        double statisticAndPValue[] =
+            StatisticalFunctions.chiSquareTest(observed, expected);
+        result.statistic = statisticAndPValue[0];
+        result.pValue = statisticAndPValue[1];
+    }
+
+    private static void setKolmogorovSmirnov(
+        Result result, double samples[], StatisticalFunctions.Cdf cdf)
+    {
+        double statisticAndPValue[] =
+            StatisticalFunctions.kolmogorovSmirnovTest(samples, cdf);
+        result.statistic = statisticAndPValue[0];
+        result.pValue = statisticAndPValue[1];
+    }
+}
@@ -0,0 +1,90 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandSetGeneratorStream;
+import static jcuda.jcurand.JCurand.curandSetGeneratorStreams;
+import static jcuda.jcurand.JCurand.curandSetPseudoRandomGeneratorSeed;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_MRG32K3A;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_XORWOW;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the time for configuring a pool of generators for the tasks
+ * of a job with hashed seeds, with one curandSetGeneratorStream call for
+ * each generator, and with one curandSetGeneratorStreams call for the
+ * whole pool. The time for the first values of each generator is shown
+ * separately, because XORWOW and MRG32k3a jump to their subsequence
+ * there. Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandStreamBenchmark
+ * </pre>
+ */
+public class JCurandStreamBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int count = 100000;
+        long seed = 42;
+        long job = 7;
+        int types[] = { CURAND_RNG_PSEUDO_PHILOX4_32_10,
+            CURAND_RNG_PSEUDO_XORWOW, CURAND_RNG_PSEUDO_MRG32K3A };
+        curandGenerator generators[] = new curandGenerator[count];
+        long paths[] = new long[2 * count];
+        for (int i = 0; i < count; i++)
+        {
+            paths[2 * i] = job;
+            paths[2 * i + 1] = i;
+        }
+        float data[] = new float[16];
+        Pointer pointer = Pointer.to(data);
+        for (int type : types)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                generators[i] = new curandGenerator();
+                curandCreateGeneratorHost(generators[i], type);
+            }
+
+            long before = System.nanoTime();
+            for (int i = 0; i < count; i++)
+            {
+                long hashed = (seed * 31 + job) * 31 + i;
+                curandSetPseudoRandomGeneratorSeed(generators[i], hashed);
+            }
+            long afterSeeds = System.nanoTime();
+            long path[] = new long[2];
+            for (int i = 0; i < count; i++)
+            {
+                path[0] = job;
+                path[1] = i;
+                curandSetGeneratorStream(
+                    generators[i], seed, Pointer.to(path), 2);
+            }
+            long afterStream = System.nanoTime();
+            curandSetGeneratorStreams(generators, count, seed, paths, 2);
+            long afterStreams = System.nanoTime();
+            for (int i = 0; i < count; i++)
+            {
+                curandGenerateUniform(generators[i], pointer, data.length);
+            }
+            long afterFirst = System.nanoTime();
+            for (int i = 0; i < count; i++)
+            {
+                curandDestroyGenerator(generators[i]);
+            }
+
+            System.out.printf("%-32s hashed seeds %6.3f us, stream %6.3f us, " +
+                "streams %6.3f us, first values %7.3f us per generator%n",
+                curandRngType.stringFor(type) + ":",
+                (afterSeeds - before) / 1e3 / count,
+                (afterStream - afterSeeds) / 1e3 / count,
+                (afterStreams - afterStream) / 1e3 / count,
+                (afterFirst - afterStreams) / 1e3 / count);
+        }
+    }
+}
@@ -0,0 +1,86 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateNormal;
+import static jcuda.jcurand.JCurand.curandGenerateTruncatedNormal;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the cost per sample of curandGenerateTruncatedNormal to the
+ * rejection of the results of curandGenerateNormal in Java, for
+ * standard normal distributions that are truncated to intervals in
+ * different parts of the tail. Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandTruncatedNormalBenchmark
+ * </pre>
+ */
+public class JCurandTruncatedNormalBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int n = 1 << 22;
+        int runs = 5;
+
+        // The number of normal values that are rejected in Java at most,
+        // for each interval
+        long maxNormals = 1L << 27;
+        float intervals[][] =
+        {
+            { Float.NEGATIVE_INFINITY, Float.POSITIVE_INFINITY },
+            { -1.0f, 1.0f },
+            { 0.1f, 0.3f },
+            { 1.0f, Float.POSITIVE_INFINITY },
+            { 2.0f, Float.POSITIVE_INFINITY },
+            { 3.0f, 3.5f },
+            { 4.0f, Float.POSITIVE_INFINITY },
+            { 10.0f, Float.POSITIVE_INFINITY },
+        };
+        float normal[] = new float[n];
+        float result[] = new float[n];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        for (float interval[] : intervals)
+        {
+            float lo = interval[0];
+            float hi = interval[1];
+
+            long accepted = 0;
+            long normals = 0;
+            long before = System.nanoTime();
+            while (accepted < n && normals < maxNormals)
+            {
+                curandGenerateNormal(generator, Pointer.to(normal), n, 0.0f, 1.0f);
+                normals += n;
+                for (int i = 0; i < n && accepted < n; i++)
+                {
+                    float x = normal[i];
+                    if (x >= lo && x <= hi)
+                    {
+                        result[(int)accepted++] = x;
+                    }
+                }
+            }
+            long afterJava = System.nanoTime();
+            curandGenerateTruncatedNormal(
+                generator, Pointer.to(result), n, 0.0f, 1.0f, lo, hi);
+            long beforeNative = System.nanoTime();
+            for (int r = 0; r < runs; r++)
+            {
+                curandGenerateTruncatedNormal(
+                    generator, Pointer.to(result), n, 0.0f, 1.0f, lo, hi);
+            }
+            long afterNative = System.nanoTime();
+
+            String java = accepted == 0 ? "       -" : String.format(
+                "%8.1f", (double)(afterJava - before) / accepted);
+            System.out.printf("[%5s, %5s]: Java rejection %s ns, "
+                + "curandGenerateTruncatedNormal %8.1f ns%n", lo, hi, java,
+                (double)(afterNative - beforeNative) / ((double)n * runs));
+        }
+        curandDestroyGenerator(generator);
+    }
+}
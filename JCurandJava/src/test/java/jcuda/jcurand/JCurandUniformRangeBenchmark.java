@@ -0,0 +1,66 @@
+package jcuda.jcurand;
+
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.JCurand.curandGenerateUniformDouble;
+import static jcuda.jcurand.JCurand.curandGenerateUniformRange;
+import static jcuda.jcurand.JCurand.curandGenerateUniformRangeDouble;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the bandwidth of generating uniform values in a range
+ * natively with generating uniform values and mapping them to the
+ * range in Java. The argument is the number of values, by default
+ * 50000000. Requires the CPU backend:
+ * <pre>
+ * java -Djcuda.jcurand.backend=CPU jcuda.jcurand.JCurandUniformRangeBenchmark 50000000
+ * </pre>
+ */
+public class JCurandUniformRangeBenchmark
+{
+    public static void main(String[] args)
+    {
+        JCurand.setExceptionsEnabled(true);
+        int n = args.length > 0 ? Integer.parseInt(args[0]) : 50000000;
+        float x[] = new float[n];
+        double y[] = new double[n];
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+
+        for (int run = 0; run < 3; run++)
+        {
+            long before = System.nanoTime();
+            curandGenerateUniformRange(generator, Pointer.to(x), n, -1.0f, 1.0f);
+            long afterNative = System.nanoTime();
+            curandGenerateUniform(generator, Pointer.to(x), n);
+            for (int i = 0; i < n; i++)
+            {
+                x[i] = -1.0f + 2.0f * x[i];
+            }
+            long afterJava = System.nanoTime();
+            print("float ", 4L * n, afterNative - before, afterJava - afterNative);
+
+            before = System.nanoTime();
+            curandGenerateUniformRangeDouble(generator, Pointer.to(y), n, -1.0, 1.0);
+            afterNative = System.nanoTime();
+            curandGenerateUniformDouble(generator, Pointer.to(y), n);
+            for (int i = 0; i < n; i++)
+            {
+                y[i] = -1.0 + 2.0 * y[i];
+            }
+            afterJava = System.nanoTime();
+            print("double", 8L * n, afterNative - before, afterJava - afterNative);
+        }
+        curandDestroyGenerator(generator);
+    }
+
+    private static void print(String type, long bytes, long nativeNanos,
+        long javaNanos)
+    {
+        System.out.printf("%s: native %6.2f GB/s, Java %6.2f GB/s%n", type,
+            (double)bytes / nativeNanos, (double)bytes / javaNanos);
+    }
+}
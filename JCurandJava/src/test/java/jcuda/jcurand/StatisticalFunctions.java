@@ -0,0 +1,357 @@
+package jcuda.jcurand;
+
+/**
+ * Distribution functions and goodness-of-fit statistics that are used
+ * by the {@link JCurandStatisticalTest}
+ */
+class StatisticalFunctions
+{
+    /**
+     * The coefficients for the Lanczos approximation of the log gamma
+     * function, with g=7
+     */
+    private static final double LANCZOS[] =
+    {
+        0.99999999999980993,
+        676.5203681218851,
+        -1259.1392167224028,
+        771.32342877765313,
+        -176.61502916214059,
+        12.507343278686905,
+        -0.13857109526572012,
+        9.9843695780195716e-6,
+        1.5056327351493116e-7
+    };
+
+    /**
+     * The minimum expected count of a chi-square bin. Adjacent bins
+     * are merged until they reach this count.
+     */
+    private static final double MIN_EXPECTED = 5.0;
+
+    /**
+     * Returns the natural logarithm of the gamma function for x &gt; 0
+     *
+     * @param x The argument
+     * @return The result
+     */
+    static double logGamma(double x)
+    {
+        if (x < 0.5)
+        {
+            return Math.log(Math.PI / Math.abs(Math.sin(Math.PI * x)))
+                - logGamma(1.0 - x);
+        }
+        x -= 1.0;
+        double a = LANCZOS[0];
+        double t = x + 7.5;
+        for (int i = 1; i < LANCZOS.length; i++)
+        {
+            a += LANCZOS[i] / (x + i);
+        }
+        return 0.5 * Math.log(2 * Math.PI) + (x + 0.5) * Math.log(t) - t
+            + Math.log(a);
+    }
+
+    /**
+     * Returns the regularized upper incomplete gamma function Q(a,x)
+     *
+     * @param a The parameter
+     * @param x The argument
+     * @return The result
+     */
+    static double gammaQ(double a, double x)
+    {
+        if (x <= 0.0)
+        {
+            return 1.0;
+        }
+        double logPrefix = -x + a * Math.log(x) - logGamma(a);
+        if (x < a + 1.0)
+        {
+            // Series expansion of P(a,x)
+            double term = 1.0 / a;
+            double sum = term;
+            for (int n = 1; n < 100000; n++)
+            {
+                term *= x / (a + n);
+                sum += term;
+                if (Math.abs(term) < Math.abs(sum) * 1e-15)
+                {
+                    break;
+                }
+            }
+            return 1.0 - sum * Math.exp(logPrefix);
+        }
+
+        // Continued fraction for Q(a,x), modified Lentz's method
+        double tiny = 1e-300;
+        double b = x + 1.0 - a;
+        double c = 1.0 / tiny;
+        double d = 1.0 / b;
+        double h = d;
+        for (int i = 1; i < 100000; i++)
+        {
+            double an = -i * (i - a);
+            b += 2.0;
+            d = an * d + b;
+            if (Math.abs(d) < tiny)
+            {
+                d = tiny;
+            }
+            c = b + an / c;
+            if (Math.abs(c) < tiny)
+            {
+                c = tiny;
+            }
+            d = 1.0 / d;
+            double delta = d * c;
+            h *= delta;
+            if (Math.abs(delta - 1.0) < 1e-15)
+            {
+                break;
+            }
+        }
+        return Math.exp(logPrefix) * h;
+    }
+
+    /**
+     * Returns the cumulative distribution function of the standard
+     * normal distribution
+     *
+     * @param x The argument
+     * @return The result
+     */
+    static double normalCdf(double x)
+    {
+        // erfc(z) = Q(1/2, z^2) for z >= 0
+        double q = 0.5 * gammaQ(0.5, 0.5 * x * x);
+        return x < 0 ? q : 1.0 - q;
+    }
+
+    /**
+     * Returns the probability mass function of the Poisson distribution
+     *
+     * @param k The value
+     * @param lambda The mean
+     * @return The probability
+     */
+    static double poissonPmf(int k, double lambda)
+    {
+        return Math.exp(k * Math.log(lambda) - lambda - logGamma(k + 1.0));
+    }
+
+    /**
+     * Returns the regularized incomplete beta function I_x(a,b)
+     *
+     * @param a The first parameter
+     * @param b The second parameter
+     * @param x The argument, in [0,1]
+     * @return The result
+     */
+    static double betaI(double a, double b, double x)
+    {
+        if (x <= 0.0)
+        {
+            return 0.0;
+        }
+        if (x >= 1.0)
+        {
+            return 1.0;
+        }
+        double logPrefix = logGamma(a + b) - logGamma(a) - logGamma(b)
+            + a * Math.log(x) + b * Math.log(1.0 - x);
+        if (x < (a + 1.0) / (a + b + 2.0))
+        {
+            return Math.exp(logPrefix) * betaContinuedFraction(a, b, x) / a;
+        }
+        return 1.0 - Math.exp(logPrefix) * betaContinuedFraction(b, a, 1.0 - x) / b;
+    }
+
+    /**
+     * Evaluates the continued fraction of the incomplete beta function,
+     * with the modified Lentz's method
+     */
+    private static double betaContinuedFraction(double a, double b, double x)
+    {
+        double tiny = 1e-300;
+        double c = 1.0;
+        double d = nonZero(1.0 - (a + b) * x / (a + 1.0), tiny);
+        d = 1.0 / d;
+        double h = d;
+        for (int m = 1; m < 100000; m++)
+        {
+            int m2 = 2 * m;
+            double an = m * (b - m) * x / ((a - 1.0 + m2) * (a + m2));
+            d = 1.0 / nonZero(1.0 + an * d, tiny);
+            c = nonZero(1.0 + an / c, tiny);
+            h *= d * c;
+            an = -(a + m) * (a + b + m) * x / ((a + m2) * (a + 1.0 + m2));
+            d = 1.0 / nonZero(1.0 + an * d, tiny);
+            c = nonZero(1.0 + an / c, tiny);
+            double delta = d * c;
+            h *= delta;
+            if (Math.abs(delta - 1.0) < 1e-15)
+            {
+                break;
+            }
+        }
+        return h;
+    }
+
+    /**
+     * Returns the cumulative distribution function of the gamma
+     * distribution
+     *
+     * @param x The argument
+     * @param shape The shape
+     * @param scale The scale
+     * @return The result
+     */
+    static double gammaCdf(double x, double shape, double scale)
+    {
+        return 1.0 - gammaQ(shape, x / scale);
+    }
+
+    /**
+     * Returns the cumulative distribution function of Student's t
+     * distribution
+     *
+     * @param t The argument
+     * @param nu The degrees of freedom
+     * @return The result
+     */
+    static double studentTCdf(double t, double nu)
+    {
+        double p = 0.5 * betaI(0.5 * nu, 0.5, nu / (nu + t * t));
+        return t > 0 ? 1.0 - p : p;
+    }
+
+    /**
+     * Returns the p-value for the given chi-square statistic with the
+     * given degrees of freedom
+     *
+     * @param chiSquare The statistic
+     * @param degreesOfFreedom The degrees of freedom
+     * @return The p-value
+     */
+    static double chiSquarePValue(double chiSquare, int degreesOfFreedom)
+    {
+        return gammaQ(0.5 * degreesOfFreedom, 0.5 * chiSquare);
+    }
+
+    /**
+     * Computes the chi-square statistic for the given observed counts
+     * and expected counts, after merging adjacent bins whose expected
+     * count is too small. Returns the statistic and the p-value.
+     *
+     * @param observed The observed counts
+     * @param expected The expected counts
+     * @return The statistic and the p-value
+     */
+    static double[] chiSquareTest(long observed[], double expected[])
+    {
+        double chiSquare = 0.0;
+        int bins = 0;
+        double o = 0.0;
+        double e = 0.0;
+        double lastO = 0.0;
+        double lastE = 0.0;
+        for (int i = 0; i < observed.length; i++)
+        {
+            o += observed[i];
+            e += expected[i];
+            if (e >= MIN_EXPECTED)
+            {
+                if (bins > 0)
+                {
+                    chiSquare += square(lastO - lastE) / lastE;
+                }
+                lastO = o;
+                lastE = e;
+                bins++;
+                o = 0.0;
+                e = 0.0;
+            }
+        }
+        // The remaining counts are merged into the last bin
+        lastO += o;
+        lastE += e;
+        chiSquare += square(lastO - lastE) / lastE;
+        return new double[]
+        {
+            chiSquare, chiSquarePValue(chiSquare, bins - 1)
+        };
+    }
+
+    /**
+     * Computes the Kolmogorov-Smirnov statistic of the given samples
+     * against the given cumulative distribution function. The samples
+     * will be sorted. Returns the statistic and the p-value.
+     *
+     * @param samples The samples
+     * @param cdf The cumulative distribution function
+     * @return The statistic and the p-value
+     */
+    static double[] kolmogorovSmirnovTest(double samples[], Cdf cdf)
+    {
+        java.util.Arrays.sort(samples);
+        int n = samples.length;
+        double d = 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            double f = cdf.apply(samples[i]);
+            d = Math.max(d, Math.max(f - (double)i / n, (i + 1.0) / n - f));
+        }
+        return new double[] { d, kolmogorovPValue(d, n) };
+    }
+
+    /**
+     * Returns the asymptotic p-value of the Kolmogorov-Smirnov statistic,
+     * with the correction of Stephens for finite sample sizes
+     *
+     * @param d The statistic
+     * @param n The number of samples
+     * @return The p-value
+     */
+    static double kolmogorovPValue(double d, int n)
+    {
+        double sqrtN = Math.sqrt(n);
+        double lambda = (sqrtN + 0.12 + 0.11 / sqrtN) * d;
+        if (lambda < 0.2)
+        {
+            return 1.0;
+        }
+        double sum = 0.0;
+        double sign = 1.0;
+        for (int k = 1; k <= 100; k++)
+        {
+            double term = sign * Math.exp(-2.0 * k * k * lambda * lambda);
+            sum += term;
+            if (Math.abs(term) < 1e-16)
+            {
+                break;
+            }
+            sign = -sign;
+        }
+        return Math.max(0.0, Math.min(1.0, 2.0 * sum));
+    }
+
+    /**
+     * A cumulative distribution function
+     */
+    interface Cdf
+    {
+        double apply(double x);
+    }
+
+    private static double nonZero(double x, double tiny)
+    {
+        return Math.abs(x) < tiny ? tiny : x;
+    }
+
+    private static double square(double x)
+    {
+        return x * x;
+    }
+}
@@ -0,0 +1,130 @@
+package jcuda.jcurand;
+
+import static java.lang.foreign.ValueLayout.ADDRESS;
+import static java.lang.foreign.ValueLayout.JAVA_FLOAT;
+import static java.lang.foreign.ValueLayout.JAVA_INT;
+import static java.lang.foreign.ValueLayout.JAVA_LONG;
+import static jcuda.jcurand.JCurand.curandCreateGeneratorHost;
+import static jcuda.jcurand.JCurand.curandDestroyGenerator;
+import static jcuda.jcurand.JCurand.curandGenerateUniform;
+import static jcuda.jcurand.curandRngType.CURAND_RNG_PSEUDO_PHILOX4_32_10;
+
+import java.lang.foreign.Arena;
+import java.lang.foreign.FunctionDescriptor;
+import java.lang.foreign.Linker;
+import java.lang.foreign.MemorySegment;
+import java.lang.foreign.SymbolLookup;
+import java.lang.invoke.MethodHandle;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+import jcuda.Pointer;
+
+/**
+ * Compares the cost per call of curandGenerateUniform through JNI, with
+ * a Java array and with a direct buffer, to the flat C interface of the
+ * native library through the Foreign Function and Memory API, with
+ * native memory and with a Java array in a critical downcall.<br>
+ * <br>
+ * This class requires Java 22. It is compiled with the other tests by
+ * the "java22" profile of the pom, which is active when Maven runs on
+ * Java 22 or later. It uses the native library that is loaded by JCurand:
+ * <pre>
+ * java --enable-native-access=ALL-UNNAMED -Djcuda.jcurand.backend=CPU
+ *     -cp jcuda.jar:jcurand.jar:test-classes jcuda.jcurand.JCurandFfmBenchmark
+ * </pre>
+ */
+public class JCurandFfmBenchmark
+{
+    public static void main(String[] args) throws Throwable
+    {
+        JCurand.setExceptionsEnabled(true);
+        Linker linker = Linker.nativeLinker();
+        SymbolLookup lookup = SymbolLookup.loaderLookup();
+        MethodHandle create = linker.downcallHandle(
+            lookup.find("jcurand_create_generator_host").orElseThrow(),
+            FunctionDescriptor.of(JAVA_INT, ADDRESS, JAVA_INT));
+        MethodHandle destroy = linker.downcallHandle(
+            lookup.find("jcurand_destroy_generator").orElseThrow(),
+            FunctionDescriptor.of(JAVA_INT, ADDRESS));
+        FunctionDescriptor generateDescriptor =
+            FunctionDescriptor.of(JAVA_INT, ADDRESS, ADDRESS, JAVA_LONG);
+        MethodHandle generate = linker.downcallHandle(
+            lookup.find("jcurand_generate_uniform").orElseThrow(),
+            generateDescriptor);
+        MethodHandle generateCritical = linker.downcallHandle(
+            lookup.find("jcurand_generate_uniform").orElseThrow(),
+            generateDescriptor, Linker.Option.critical(true));
+
+        int sizes[] = { 1, 16, 256, 4096, 65536 };
+        int maxSize = sizes[sizes.length - 1];
+        float array[] = new float[maxSize];
+        ByteBuffer buffer = ByteBuffer.allocateDirect(maxSize * 4)
+            .order(ByteOrder.nativeOrder());
+
+        curandGenerator generator = new curandGenerator();
+        curandCreateGeneratorHost(generator, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+        try (Arena arena = Arena.ofConfined())
+        {
+            MemorySegment handleOut = arena.allocate(ADDRESS);
+            int status = (int)create.invokeExact(
+                handleOut, CURAND_RNG_PSEUDO_PHILOX4_32_10);
+            checkStatus(status);
+            MemorySegment handle = handleOut.get(ADDRESS, 0);
+            MemorySegment segment = arena.allocate(JAVA_FLOAT, maxSize);
+            MemorySegment arraySegment = MemorySegment.ofArray(array);
+
+            for (int n : sizes)
+            {
+                int calls = Math.max(1000, Math.min(1000000, (1 << 24) / n));
+                for (int warmup = 0; warmup < 2; warmup++)
+                {
+                    long t0 = System.nanoTime();
+                    for (int i = 0; i < calls; i++)
+                    {
+                        curandGenerateUniform(generator, Pointer.to(array), n);
+                    }
+                    long t1 = System.nanoTime();
+                    for (int i = 0; i < calls; i++)
+                    {
+                        curandGenerateUniform(generator, Pointer.to(buffer), n);
+                    }
+                    long t2 = System.nanoTime();
+                    for (int i = 0; i < calls; i++)
+                    {
+                        status = (int)generate.invokeExact(handle, segment, (long)n);
+                    }
+                    long t3 = System.nanoTime();
+                    for (int i = 0; i < calls; i++)
+                    {
+                        status = (int)generateCritical.invokeExact(
+                            handle, arraySegment, (long)n);
+                    }
+                    long t4 = System.nanoTime();
+                    checkStatus(status);
+                    if (warmup == 1)
+                    {
+                        System.out.printf("n=%5d: JNI array %8.1f ns, "
+                            + "JNI direct buffer %8.1f ns, FFM native "
+                            + "segment %8.1f ns, FFM critical array "
+                            + "%8.1f ns per call%n", n,
+                            (t1 - t0) / (double)calls,
+                            (t2 - t1) / (double)calls,
+                            (t3 - t2) / (double)calls,
+                            (t4 - t3) / (double)calls);
+                    }
+                }
+            }
+            checkStatus((int)destroy.invokeExact(handle));
+        }
+        curandDestroyGenerator(generator);
+    }
+
+    private static void checkStatus(int status)
+    {
+        if (status != curandStatus.CURAND_STATUS_SUCCESS)
+        {
+            throw new IllegalStateException(curandStatus.stringFor(status));
+        }
+    }
+}